@@ -84,6 +84,25 @@ DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persis
     MS_LOG(DEBUG) << "Rewrite stream id from INT32 MAX to 0.";
     stream_id = kDefaultStreamIndex;
   }
+  if (IsThreadCacheAlloc(size, from_persistent_mem, need_recycle, stream_id)) {
+    auto device_addr = thread_cache_->Alloc(AlignMemorySize(size));
+    if (device_addr != nullptr) {
+      return device_addr;
+    }
+  }
+  return AllocTensorMemFromPool(size, from_persistent_mem, need_recycle, stream_id);
+}
+
+bool DynamicMemPoolBestFit::IsThreadCacheAlloc(size_t size, bool from_persistent_mem, bool need_recycle,
+                                               uint32_t stream_id) const {
+  // The memory of the thread cache is not profiled or recycled one by one.
+  return IsEnableThreadCache() && !from_persistent_mem && !need_recycle && stream_id == kDefaultStreamIndex &&
+         MemThreadCache::IsCacheable(AlignMemorySize(size)) && !common::IsNeedProfileMemory() &&
+         !IsMemoryPoolRecycle();
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMemFromPool(size_t size, bool from_persistent_mem, bool need_recycle,
+                                                           uint32_t stream_id) {
   size_t align_size = AlignMemorySize(size);
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
@@ -141,8 +160,8 @@ std::vector<DeviceMemPtr> DynamicMemPoolBestFit::AllocContinuousTensorMem(const
                                                                           uint32_t stream_id) {
   std::vector<DeviceMemPtr> device_addr_list;
   size_t total_size = std::accumulate(size_list.begin(), size_list.end(), IntToSize(0));
-  // Pre-alloc the one whole piece memory.
-  auto device_addr = AllocTensorMem(total_size, false, false, stream_id);
+  // Pre-alloc the one whole piece memory, which is split by the address so it is not from the thread cache.
+  auto device_addr = AllocTensorMemFromPool(total_size, false, false, stream_id);
   if (!device_addr) {
     return device_addr_list;
   }
@@ -526,6 +545,13 @@ DynamicMemBlockPtr DynamicMemPoolBestFit::FindMemBlock(const DeviceMemPtr &devic
 }
 
 void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
+  if (thread_cache_->Free(device_addr)) {
+    return;
+  }
+  FreeTensorMemToPool(device_addr);
+}
+
+void DynamicMemPoolBestFit::FreeTensorMemToPool(const DeviceMemPtr &device_addr) {
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
 #else
@@ -810,6 +836,8 @@ std::tuple<DynamicMemBlockPtr, DynamicMemBufPtr, MemStatusManagerPtr> DynamicMem
 }
 
 void DynamicMemPoolBestFit::ReleaseDeviceRes() {
+  // Drop the spans of the thread cache first, which takes the lock of the pool to free them.
+  thread_cache_->Release();
 #ifdef __APPLE__
   std::lock_guard<SpinLock> spin_lock(spin_lock_);
 #else
@@ -882,6 +910,7 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
                << "M, total used by event mem:" << TotalUsedByEventMemStatistics() / kMBToByte
                << "M, total idle mem:" << TotalIdleMemStatistics() / kMBToByte
                << "M, total eager free mem:" << TotalEagerFreeMemStatistics() / kMBToByte
+               << "M, thread cache idle mem:" << ThreadCacheMemStatistics().idle_mem_size_ / kMBToByte
                << "M. Weight used size:" << total_used_size_list[static_cast<int>(AllocatorType::kWeight)] / kMBToByte
                << "M, constant value used size:"
                << total_used_size_list[static_cast<int>(AllocatorType::kConstantValue)] / kMBToByte
@@ -962,6 +991,10 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
 
   MS_LOG(WARNING) << "Start dump dynamic memory pool debug info.";
   fn(common_mem_, std::string(kCommonMem));
+  if (IsEnableThreadCache()) {
+    // The spans of the thread cache are used memory bufs of the common mem.
+    MS_LOG(WARNING) << kCommonMem << " " << thread_cache_->StatisticsString();
+  }
   fn(persistent_mem_, std::string(kPersistentParamMem));
   MS_LOG(WARNING) << "Finish dump dynamic memory pool debug info.";
 }
@@ -1101,6 +1134,7 @@ size_t DynamicMemPoolBestFit::UsedMemPeakStatistics() const {
 size_t DynamicMemPoolBestFit::ActualPeakStatistics() const {
   return common_mem_->CalActualPeak() + persistent_mem_->CalActualPeak();
 }
+ThreadCacheStatistics DynamicMemPoolBestFit::ThreadCacheMemStatistics() const { return thread_cache_->Statistics(); }
 
 size_t MemStatusManager::CalActualPeak() {
   if (mem_block_insertion_order_.empty()) {
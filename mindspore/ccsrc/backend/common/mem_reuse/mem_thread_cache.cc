@@ -0,0 +1,452 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "include/backend/mem_reuse/mem_thread_cache.h"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace device {
+namespace {
+// The size classes are multiples of the alignment of the pool up to kSmallClassMaxSize, then four classes for each
+// power of two up to kThreadCacheMaxSize, so that no more than a quarter of the memory is wasted by the rounding.
+constexpr size_t kSizeClassAlignSize = 512;
+constexpr size_t kSmallClassMaxSize = 4 << 10;
+constexpr size_t kClassStepsPerPowerOfTwo = 4;
+// The operations of a thread between two scavenges of its free lists.
+constexpr size_t kThreadCacheScavengeInterval = 4096;
+// The memory a thread takes from the central free lists when its free list is empty.
+constexpr size_t kRefillSize = 64 << 10;
+// The memory a thread keeps in the free list of a size class, half of it goes back to the central free lists beyond.
+constexpr size_t kMaxThreadFreeListSize = 1 << 20;
+// The spans are found by the span size page of their begin address, for the addresses of kAddressBits bits.
+constexpr size_t kAddressBits = 48;
+constexpr size_t kSpanPageBits = 20;
+constexpr size_t kPageRootBits = 14;
+constexpr size_t kPageLeafBits = kAddressBits - kSpanPageBits - kPageRootBits;
+static_assert(kThreadCacheSpanSize == (static_cast<size_t>(1) << kSpanPageBits), "A span is a page of the page map.");
+
+const std::vector<size_t> &SizeClasses() {
+  static const std::vector<size_t> size_classes = []() {
+    std::vector<size_t> sizes;
+    for (size_t size = kSizeClassAlignSize; size <= kSmallClassMaxSize; size += kSizeClassAlignSize) {
+      (void)sizes.emplace_back(size);
+    }
+    for (size_t power = kSmallClassMaxSize; power < kThreadCacheMaxSize; power <<= 1) {
+      size_t step = power / kClassStepsPerPowerOfTwo;
+      for (size_t size = power + step; size <= (power << 1); size += step) {
+        (void)sizes.emplace_back(size);
+      }
+    }
+    return sizes;
+  }();
+  return size_classes;
+}
+
+size_t ObjectsPerSpan(size_t class_index) { return kThreadCacheSpanSize / MemThreadCache::SizeClassSize(class_index); }
+}  // namespace
+
+// The entry of the page map for the span beginning in the page, at most one span begins in a page of the span size.
+struct SpanEntry {
+  // The begin address of the span, zero if no span begins in the page. It is stored after the class index, and
+  // cleared before the class index changes.
+  std::atomic<uintptr_t> begin_{0};
+  std::atomic<size_t> class_index_{0};
+};
+
+// The spans and the central free lists, shared by the threads of a memory pool.
+struct ThreadCacheCentral {
+  ThreadCacheCentral(const std::function<DeviceMemPtr(size_t)> &alloc_span,
+                     const std::function<void(const DeviceMemPtr &)> &free_span)
+      : id_(NextId()),
+        alloc_span_(alloc_span),
+        free_span_(free_span),
+        page_root_(new std::atomic<SpanEntry *>[static_cast<size_t>(1) << kPageRootBits]()),
+        free_lists_(SizeClasses().size()) {}
+
+  ~ThreadCacheCentral() {
+    for (size_t i = 0; i < (static_cast<size_t>(1) << kPageRootBits); ++i) {
+      delete[] page_root_[i].load();
+    }
+  }
+
+  SpanEntry *PageEntry(uintptr_t page, bool create) {
+    if (page >= (static_cast<uintptr_t>(1) << (kPageRootBits + kPageLeafBits))) {
+      return nullptr;
+    }
+    auto &root_entry = page_root_[page >> kPageLeafBits];
+    auto leaf = root_entry.load(std::memory_order_acquire);
+    if (leaf == nullptr) {
+      if (!create) {
+        return nullptr;
+      }
+      leaf = new SpanEntry[static_cast<size_t>(1) << kPageLeafBits]();
+      root_entry.store(leaf, std::memory_order_release);
+    }
+    return &leaf[page & ((static_cast<uintptr_t>(1) << kPageLeafBits) - 1)];
+  }
+
+  // Find the span of the address without lock, return false if the address is not in a span.
+  bool FindSpan(const DeviceMemPtr &device_addr, uintptr_t *span_begin, size_t *class_index) {
+    auto addr = reinterpret_cast<uintptr_t>(device_addr);
+    auto page = addr >> kSpanPageBits;
+    for (auto candidate : {page, page - 1}) {
+      if (candidate > page) {
+        break;
+      }
+      auto entry = PageEntry(candidate, false);
+      if (entry == nullptr) {
+        continue;
+      }
+      auto begin = entry->begin_.load(std::memory_order_acquire);
+      if (begin != 0 && addr >= begin && addr < begin + kThreadCacheSpanSize) {
+        *span_begin = begin;
+        *class_index = entry->class_index_.load(std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Take a new span of the size class from the pool and carve it into the central free list.
+  bool NewSpanLocked(size_t class_index) {
+    auto device_addr = alloc_span_(kThreadCacheSpanSize);
+    if (device_addr == nullptr) {
+      return false;
+    }
+    auto begin = reinterpret_cast<uintptr_t>(device_addr);
+    auto entry = PageEntry(begin >> kSpanPageBits, true);
+    if (entry == nullptr) {
+      MS_LOG(INFO) << "The span address " << device_addr << " can not be cached.";
+      free_span_(device_addr);
+      return false;
+    }
+    entry->class_index_.store(class_index, std::memory_order_relaxed);
+    entry->begin_.store(begin, std::memory_order_release);
+    size_t class_size = MemThreadCache::SizeClassSize(class_index);
+    auto &objects = free_lists_[class_index][begin];
+    for (size_t i = 0; i < ObjectsPerSpan(class_index); ++i) {
+      (void)objects.emplace_back(reinterpret_cast<DeviceMemPtr>(begin + i * class_size));
+    }
+    span_mem_size_ += kThreadCacheSpanSize;
+    central_idle_size_ += ObjectsPerSpan(class_index) * class_size;
+    return true;
+  }
+
+  bool RefillLocked(size_t class_index, size_t count, std::vector<DeviceMemPtr> *objects) {
+    auto &free_list = free_lists_[class_index];
+    if (free_list.empty() && !NewSpanLocked(class_index)) {
+      return false;
+    }
+    // Take from the spans of the lowest addresses, so that the spans of higher addresses become all free.
+    while (count > 0 && !free_list.empty()) {
+      auto &span_objects = free_list.begin()->second;
+      size_t take = std::min(count, span_objects.size());
+      (void)objects->insert(objects->end(), span_objects.end() - take, span_objects.end());
+      span_objects.resize(span_objects.size() - take);
+      central_idle_size_ -= take * MemThreadCache::SizeClassSize(class_index);
+      count -= take;
+      if (span_objects.empty()) {
+        (void)free_list.erase(free_list.begin());
+      }
+    }
+    return true;
+  }
+
+  void GiveBackLocked(size_t class_index, std::vector<DeviceMemPtr>::iterator begin,
+                      std::vector<DeviceMemPtr>::iterator end) {
+    for (auto iter = begin; iter != end; ++iter) {
+      uintptr_t span_begin = 0;
+      size_t span_class_index = 0;
+      if (!FindSpan(*iter, &span_begin, &span_class_index) || span_class_index != class_index) {
+        MS_LOG(ERROR) << "The address " << *iter << " is not in a span of the size class " << class_index << ".";
+        continue;
+      }
+      (void)free_lists_[class_index][span_begin].emplace_back(*iter);
+      central_idle_size_ += MemThreadCache::SizeClassSize(class_index);
+    }
+  }
+
+  // Release the spans which are all free to the pool.
+  void ReleaseFreeSpansLocked() {
+    for (size_t class_index = 0; class_index < free_lists_.size(); ++class_index) {
+      auto &free_list = free_lists_[class_index];
+      for (auto iter = free_list.begin(); iter != free_list.end();) {
+        if (iter->second.size() < ObjectsPerSpan(class_index)) {
+          ++iter;
+          continue;
+        }
+        auto begin = iter->first;
+        PageEntry(begin >> kSpanPageBits, false)->begin_.store(0, std::memory_order_release);
+        free_span_(reinterpret_cast<DeviceMemPtr>(begin));
+        central_idle_size_ -= ObjectsPerSpan(class_index) * MemThreadCache::SizeClassSize(class_index);
+        span_mem_size_ -= kThreadCacheSpanSize;
+        ++released_span_count_;
+        iter = free_list.erase(iter);
+      }
+    }
+  }
+
+  // Drop the spans without giving them back, the pool releases all the device memory.
+  void ClearLocked() {
+    for (auto &free_list : free_lists_) {
+      free_list.clear();
+    }
+    for (size_t i = 0; i < (static_cast<size_t>(1) << kPageRootBits); ++i) {
+      auto leaf = page_root_[i].load();
+      if (leaf == nullptr) {
+        continue;
+      }
+      for (size_t j = 0; j < (static_cast<size_t>(1) << kPageLeafBits); ++j) {
+        leaf[j].begin_.store(0, std::memory_order_release);
+      }
+    }
+    hit_count_ = 0;
+    miss_count_ = 0;
+    span_mem_size_ = 0;
+    released_span_count_ = 0;
+    central_idle_size_ = 0;
+    thread_idle_size_ = 0;
+    (void)generation_.fetch_add(1);
+  }
+
+  static uint64_t NextId() {
+    static std::atomic<uint64_t> next_id{0};
+    return next_id.fetch_add(1);
+  }
+
+  // The threads find their free lists by the id, which is not reused by the central of another memory pool.
+  const uint64_t id_;
+  std::function<DeviceMemPtr(size_t)> alloc_span_;
+  std::function<void(const DeviceMemPtr &)> free_span_;
+  // The two level page map from the span size pages to the spans beginning in them, read without lock.
+  std::unique_ptr<std::atomic<SpanEntry *>[]> page_root_;
+
+  std::mutex mutex_;
+  // Set when the memory pool is destroyed, the threads then drop their free lists.
+  bool closed_{false};
+  // Increased when the spans are dropped, the threads then drop their free lists.
+  std::atomic<uint64_t> generation_{0};
+  // The free memory of each size class, by the begin address of its span.
+  std::vector<std::map<uintptr_t, std::vector<DeviceMemPtr>>> free_lists_;
+  // The statistics are changed with the lock, and read without it, as the memory pool dumps them with its own lock.
+  std::atomic<size_t> hit_count_{0};
+  std::atomic<size_t> miss_count_{0};
+  std::atomic<size_t> span_mem_size_{0};
+  std::atomic<size_t> released_span_count_{0};
+  std::atomic<size_t> central_idle_size_{0};
+  // The idle memory in the free lists of the threads, as of their last scavenge.
+  std::atomic<int64_t> thread_idle_size_{0};
+};
+
+namespace {
+// The free lists of a thread for a memory pool, only used by the thread.
+class LocalCache {
+ public:
+  explicit LocalCache(const std::shared_ptr<ThreadCacheCentral> &central)
+      : central_(central), generation_(central->generation_.load()), free_lists_(SizeClasses().size()) {}
+
+  ~LocalCache() {
+    auto central = central_.lock();
+    if (central == nullptr) {
+      return;
+    }
+    std::lock_guard<std::mutex> locker(central->mutex_);
+    if (central->closed_ || generation_ != central->generation_.load()) {
+      return;
+    }
+    for (size_t class_index = 0; class_index < free_lists_.size(); ++class_index) {
+      auto &objects = free_lists_[class_index].objects_;
+      central->GiveBackLocked(class_index, objects.begin(), objects.end());
+    }
+    ReportLocked(central.get(), 0);
+  }
+
+  DeviceMemPtr Alloc(ThreadCacheCentral *central, size_t class_index) {
+    CheckGeneration(central);
+    auto &free_list = free_lists_[class_index];
+    if (free_list.objects_.empty()) {
+      ++miss_count_;
+      size_t count = std::max(kRefillSize / MemThreadCache::SizeClassSize(class_index), static_cast<size_t>(1));
+      std::lock_guard<std::mutex> locker(central->mutex_);
+      if (!central->RefillLocked(class_index, std::min(count, ObjectsPerSpan(class_index)), &free_list.objects_)) {
+        return nullptr;
+      }
+    } else {
+      ++hit_count_;
+    }
+    auto device_addr = free_list.objects_.back();
+    free_list.objects_.pop_back();
+    free_list.low_water_ = std::min(free_list.low_water_, free_list.objects_.size());
+    CountOperation(central);
+    return device_addr;
+  }
+
+  void Free(ThreadCacheCentral *central, size_t class_index, const DeviceMemPtr &device_addr) {
+    CheckGeneration(central);
+    auto &objects = free_lists_[class_index].objects_;
+    (void)objects.emplace_back(device_addr);
+    if (objects.size() * MemThreadCache::SizeClassSize(class_index) > kMaxThreadFreeListSize) {
+      // Give back the half of the free list which was freed first.
+      auto half = objects.begin() + static_cast<std::ptrdiff_t>(objects.size() / 2);
+      {
+        std::lock_guard<std::mutex> locker(central->mutex_);
+        central->GiveBackLocked(class_index, objects.begin(), half);
+      }
+      (void)objects.erase(objects.begin(), half);
+      free_lists_[class_index].low_water_ = std::min(free_lists_[class_index].low_water_, objects.size());
+    }
+    CountOperation(central);
+  }
+
+  // Give back the memory which stayed in the free lists since the last scavenge, and report the statistics.
+  void Scavenge(ThreadCacheCentral *central) {
+    std::lock_guard<std::mutex> locker(central->mutex_);
+    size_t idle_size = 0;
+    for (size_t class_index = 0; class_index < free_lists_.size(); ++class_index) {
+      auto &free_list = free_lists_[class_index];
+      auto unused = free_list.objects_.begin() + static_cast<std::ptrdiff_t>(free_list.low_water_);
+      central->GiveBackLocked(class_index, free_list.objects_.begin(), unused);
+      (void)free_list.objects_.erase(free_list.objects_.begin(), unused);
+      free_list.low_water_ = free_list.objects_.size();
+      idle_size += free_list.objects_.size() * MemThreadCache::SizeClassSize(class_index);
+    }
+    central->ReleaseFreeSpansLocked();
+    ReportLocked(central, idle_size);
+    op_count_ = 0;
+  }
+
+ private:
+  struct FreeList {
+    std::vector<DeviceMemPtr> objects_;
+    // The least size of the free list since the last scavenge, the memory below it was not used since then.
+    size_t low_water_{0};
+  };
+
+  void CheckGeneration(const ThreadCacheCentral *central) {
+    auto generation = central->generation_.load(std::memory_order_relaxed);
+    if (generation != generation_) {
+      for (auto &free_list : free_lists_) {
+        free_list.objects_.clear();
+        free_list.low_water_ = 0;
+      }
+      generation_ = generation;
+      reported_idle_size_ = 0;
+    }
+  }
+
+  void CountOperation(ThreadCacheCentral *central) {
+    if (++op_count_ >= kThreadCacheScavengeInterval) {
+      Scavenge(central);
+    }
+  }
+
+  void ReportLocked(ThreadCacheCentral *central, size_t idle_size) {
+    central->hit_count_ += hit_count_;
+    central->miss_count_ += miss_count_;
+    central->thread_idle_size_ += static_cast<int64_t>(idle_size) - static_cast<int64_t>(reported_idle_size_);
+    hit_count_ = 0;
+    miss_count_ = 0;
+    reported_idle_size_ = idle_size;
+  }
+
+  std::weak_ptr<ThreadCacheCentral> central_;
+  uint64_t generation_;
+  std::vector<FreeList> free_lists_;
+  size_t op_count_{0};
+  size_t hit_count_{0};
+  size_t miss_count_{0};
+  size_t reported_idle_size_{0};
+};
+
+LocalCache &GetLocalCache(const std::shared_ptr<ThreadCacheCentral> &central) {
+  thread_local std::unordered_map<uint64_t, std::unique_ptr<LocalCache>> local_caches;
+  auto &local_cache = local_caches[central->id_];
+  if (local_cache == nullptr) {
+    local_cache = std::make_unique<LocalCache>(central);
+  }
+  return *local_cache;
+}
+}  // namespace
+
+MemThreadCache::MemThreadCache(const std::function<DeviceMemPtr(size_t)> &alloc_span,
+                               const std::function<void(const DeviceMemPtr &)> &free_span)
+    : central_(std::make_shared<ThreadCacheCentral>(alloc_span, free_span)) {}
+
+MemThreadCache::~MemThreadCache() {
+  std::lock_guard<std::mutex> locker(central_->mutex_);
+  central_->closed_ = true;
+}
+
+size_t MemThreadCache::SizeClassIndex(size_t size) {
+  const auto &size_classes = SizeClasses();
+  return static_cast<size_t>(std::lower_bound(size_classes.begin(), size_classes.end(), size) - size_classes.begin());
+}
+
+size_t MemThreadCache::SizeClassSize(size_t class_index) { return SizeClasses()[class_index]; }
+
+DeviceMemPtr MemThreadCache::Alloc(size_t size) {
+  if (!IsCacheable(size)) {
+    return nullptr;
+  }
+  return GetLocalCache(central_).Alloc(central_.get(), SizeClassIndex(size));
+}
+
+bool MemThreadCache::Free(const DeviceMemPtr &device_addr) {
+  uintptr_t span_begin = 0;
+  size_t class_index = 0;
+  if (!central_->FindSpan(device_addr, &span_begin, &class_index)) {
+    return false;
+  }
+  GetLocalCache(central_).Free(central_.get(), class_index, device_addr);
+  return true;
+}
+
+void MemThreadCache::Scavenge() { GetLocalCache(central_).Scavenge(central_.get()); }
+
+void MemThreadCache::Release() {
+  std::lock_guard<std::mutex> locker(central_->mutex_);
+  central_->ClearLocked();
+}
+
+ThreadCacheStatistics MemThreadCache::Statistics() const {
+  ThreadCacheStatistics stats;
+  stats.hit_count_ = central_->hit_count_;
+  stats.miss_count_ = central_->miss_count_;
+  stats.span_mem_size_ = central_->span_mem_size_;
+  auto thread_idle_size = std::max(central_->thread_idle_size_.load(), static_cast<int64_t>(0));
+  stats.idle_mem_size_ = central_->central_idle_size_ + static_cast<size_t>(thread_idle_size);
+  stats.released_span_count_ = central_->released_span_count_;
+  return stats;
+}
+
+std::string MemThreadCache::StatisticsString() const {
+  auto stats = Statistics();
+  std::ostringstream buf;
+  buf << "Thread cache span mem:" << stats.span_mem_size_ << "B, idle mem:" << stats.idle_mem_size_
+      << "B, hit count:" << stats.hit_count_ << ", miss count:" << stats.miss_count_
+      << ", released span count:" << stats.released_span_count_ << ".";
+  return buf.str();
+}
+}  // namespace device
+}  // namespace mindspore
@@ -34,6 +34,7 @@
 #include "include/backend/optimizer/helper.h"
 #include "include/common/debug/common.h"
 #include "include/common/debug/anf_ir_dump.h"
+#include "include/common/utils/utils.h"
 #ifdef ENABLE_DUMP_IR
 #include "debug/rdr/string_recorder.h"
 #endif
@@ -255,6 +256,12 @@ bool Somas::ConfigSomas(const session::KernelGraph &graph) {
   device_name_ = GetDeviceName();
   communication_gap_size_ = GetCommunicationReservedSize();
   enable_cache_ = GetEnableCacheFlag(graph);
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  // the cache of the whole SOMAS model of a big graph wins, the plans of the solver are cached for the other graphs
+  enable_plan_cache_ = !enable_cache_ && (context_ptr->get_param<bool>(MS_CTX_ENABLE_COMPILE_CACHE) ||
+                                          common::GetEnv(kCompilerCacheEnable) == "1");
+  solver_tries_ = SomasSolverPre::GetImproveTriesConfig();
   depend_exec_order_ = GetDependExecOrderFlag(graph);
   auto debug_config = GetDebugConfig();
   save_debug_info_ = debug_config.first;
@@ -335,7 +342,8 @@ void Somas::UpdateSomasResultToGraph(const session::KernelGraph &graph) {
                << "Total LifeLong All Tensor Size:\t" << lifelong_all_total_size_ << "\n"
                << "Total LifeLong Start Tensor Size:\t" << lifelong_start_total_size_ << "\n"
                << "Total LifeLong End Tensor Size:\t" << lifelong_end_total_size_ << "\n"
-               << "Reused Size(Allocate Size):\t" << reused_memory_size_ << "\n\n\n";
+               << "Reused Size(Allocate Size):\t" << reused_memory_size_ << "\n"
+               << "Gap to Lower Bound:\t" << LowerBoundGap() << "%\n\n\n";
 
   auto &execution_nodes = graph.execution_order();
   std::vector<Block> block_list;
@@ -1553,6 +1561,11 @@ void Somas::Solve(const session::KernelGraph &graph) {
 
   somas_solver_ = std::make_shared<SomasSolverPre>();
   MS_EXCEPTION_IF_NULL(somas_solver_);
+  somas_solver_->SetLowerBound(lower_bound_);
+  somas_solver_->SetImproveTries(solver_tries_);
+  if (enable_plan_cache_) {
+    somas_solver_->SetPlanCacheDir(Common::GetCompilerCachePath() + "/somas_meta/");
+  }
   auto core_list = GetCoreList();
   auto status = somas_solver_->Solving(graph, &solver_tensor_desc_map_, &reuse_matrix_,
                                        processed_contiguous_tensors_list_, core_list, false);
@@ -1885,6 +1898,10 @@ std::string Somas::SomasInfo(bool calc_hash) const {
     oss << merged_block.first << "\t" << merged_block.second << "\n";
   }
   oss << "\nTotal Memory Size after reused:" << reused_memory_size_;
+  if (!calc_hash) {
+    oss << "\nTheoretical Optimal Size (Lower Bound):" << lower_bound_;
+    oss << "\nGap to Lower Bound:" << LowerBoundGap() << "%";
+  }
   return oss.str();
 }
 
@@ -2164,6 +2181,14 @@ size_t Somas::CalcLowerBound() const {
   return max_lifetime;
 }
 
+double Somas::LowerBoundGap() const {
+  constexpr double kPercent = 100.0;
+  if (lower_bound_ == 0 || reused_memory_size_ <= lower_bound_) {
+    return 0;
+  }
+  return static_cast<double>(reused_memory_size_ - lower_bound_) * kPercent / static_cast<double>(lower_bound_);
+}
+
 void Somas::GenGraphStatisticInfo() {
   MS_LOG(INFO) << "Start Calc lower bound";
   lower_bound_ = CalcLowerBound();
@@ -105,6 +105,8 @@ class BACKEND_EXPORT Somas {
 
   bool depend_exec_order_{false};
   bool enable_cache_{false};
+  bool enable_plan_cache_{false};
+  size_t solver_tries_{0};
   bool save_debug_info_{false};
   std::string debug_info_path_;
 
@@ -198,6 +200,7 @@ class BACKEND_EXPORT Somas {
   size_t CalcLowerBound() const;
   void UpdateTensorPeak(const std::vector<SomasTensorPtr> &peak_tensors) const;
   void GenGraphStatisticInfo();
+  double LowerBoundGap() const;
   void DumpParameters(std::ostringstream &oss) const;
   void DumpTensors(std::ostringstream &oss) const;
   void DumpNodes(std::ostringstream &oss) const;
@@ -19,6 +19,7 @@
 #include <cstdio>
 #include <ctime>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 #include <map>
@@ -34,6 +35,9 @@ using std::vector;
 namespace mindspore {
 namespace somas {
 constexpr auto kSolBytesThreshold = 100 * 1024 * 1024;
+// A perturbation swaps one block in kPerturbRatio with a block at most kPerturbWindow places after it
+constexpr size_t kPerturbRatio = 16;
+constexpr size_t kPerturbWindow = 8;
 Status SomasSolverCore::MemoryAllocationSolver() {
   Status retval = SUCCESS;
   // print only for single heuristic no multi thread
@@ -44,6 +48,9 @@ Status SomasSolverCore::MemoryAllocationSolver() {
   }
   BuildBlocks();
   SortTensors();
+  if (seed_ != 0) {
+    PerturbBlocks();
+  }
   upperbound_ = FindSolutions();
   Verify();
   return retval;
@@ -233,11 +240,48 @@ void SomasSolverCore::SortTensors() {  // need to sort the tensors for Fast Heur
   sort_map[kGreaterSizeGreaterConstraintsSmallerIndex] = &GreaterSizeGreaterConstraintsSmallerIndex;
   sort_map[kGreaterSizeGreaterConstraintsGreaterIndex] = &GreaterSizeGreaterConstraintsGreaterIndex;
 #endif
-  if (sort_strategy_ < kNumSortingTypes) {
+  if (!base_order_.empty()) {
+    mindspore::HashMap<size_t, size_t> position;
+    for (size_t i = 0; i < base_order_.size(); i++) {
+      position[base_order_[i]] = i;
+    }
+    sort(block_tensors_.begin(), block_tensors_.end(), [&position](const BlockTensor &t1, const BlockTensor &t2) {
+      return position[t1.m_start_tensor_->index_] < position[t2.m_start_tensor_->index_];
+    });
+  } else if (sort_strategy_ < kNumSortingTypes) {
     sort(block_tensors_.begin(), block_tensors_.end(), *(sort_map[sort_strategy_]));
   }
 }
 
+void SomasSolverCore::PerturbBlocks() {
+  size_t block_count = block_tensors_.size();
+  if (block_count < 2) {
+    return;
+  }
+  std::mt19937 generator(seed_);
+  std::uniform_int_distribution<size_t> first(0, block_count - 2);
+  std::uniform_int_distribution<size_t> distance(1, kPerturbWindow);
+  size_t swap_count = std::max(block_count / kPerturbRatio, static_cast<size_t>(1));
+  for (size_t i = 0; i < swap_count; i++) {
+    size_t a = first(generator);
+    size_t b = std::min(a + distance(generator), block_count - 1);
+    // graph outputs stay in front of the other blocks
+    if (block_tensors_[a].m_start_tensor_->is_graph_output_ != block_tensors_[b].m_start_tensor_->is_graph_output_) {
+      continue;
+    }
+    std::swap(block_tensors_[a], block_tensors_[b]);
+  }
+}
+
+std::vector<size_t> SomasSolverCore::GetBlockOrder() const {
+  std::vector<size_t> order;
+  order.reserve(block_tensors_.size());
+  for (const auto &block : block_tensors_) {
+    order.emplace_back(block.m_start_tensor_->index_);
+  }
+  return order;
+}
+
 size_t SomasSolverCore::Search(const std::shared_ptr<FootPrint> &pFootprint) {
   size_t result = 0;
   FastHeuristic fh;
@@ -248,7 +292,7 @@ size_t SomasSolverCore::Search(const std::shared_ptr<FootPrint> &pFootprint) {
     auto end = std::chrono::system_clock::now();
     timing_ = std::chrono::duration_cast<std::chrono::milliseconds>((end - start)).count();
     // print for serial all_ or multi thread solver
-    if (is_multi_thread_valid_) {
+    if (is_multi_thread_valid_ && seed_ == 0) {
       const double giga = 1073741824.;
       MS_LOG(INFO) << timing_ << " ms\t" << sol_count_ + 1 << "/"
                    << static_cast<size_t>(kNumFittingTypes) * static_cast<size_t>(kNumAlgorithmTypes) *
@@ -57,6 +57,13 @@ class SomasSolverCore {
   void SetSortingStrategy(SortingType sort_strategy) { sort_strategy_ = sort_strategy; }
   void SetFittingStrategy(FittingType branching_strategy) { branching_strategy_ = branching_strategy; }
   void SetAlgorithmStrategy(AlgorithmType algorithm_strategy) { algorithm_ = algorithm_strategy; }
+  /// Place the blocks in base_order (index of their start tensors) instead of the sorting strategy, randomly
+  /// perturbed with the seed, so that the solvers of an improvement round try the neighbours of the best order
+  void SetPerturbation(uint32_t seed, const std::vector<size_t> &base_order) {
+    seed_ = seed;
+    base_order_ = base_order;
+  }
+  std::vector<size_t> GetBlockOrder() const;
   const size_t &GetUpperbound() const { return upperbound_; }
   const size_t &Getlifelongmemory() const { return lifelong_memory_; }
 
@@ -75,9 +82,12 @@ class SomasSolverCore {
   size_t lifelong_memory_{0};
   bool verify_{false};
   bool is_multi_thread_valid_{true};
+  uint32_t seed_{0};
+  std::vector<size_t> base_order_;
 
   size_t FindSolutions();
   size_t Search(const std::shared_ptr<FootPrint> &pFootprint);
+  void PerturbBlocks();
   void AppendLifelongTensors();
   void Destroy(std::shared_ptr<FootPrint> *pFootprint) const;
 };
@@ -14,12 +14,20 @@
  * limitations under the License.
 */
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <cstdio>
 #include <fstream>
+#include <iomanip>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include "include/common/thread_pool.h"
+#include "utils/hashing.h"
+#include "utils/ms_utils.h"
 
 #include "backend/common/somas/somas_solver_core.h"
 #include "backend/common/somas/somas_solver_pre.h"
@@ -29,6 +37,10 @@ namespace mindspore {
 namespace somas {
 constexpr auto kSolBytesThreshold = 100 * 1024 * 1024;
 constexpr auto kSolNumThresholdMultiThread = 8;
+constexpr auto kPlanCacheMagic = "somas_plan";
+// Number of randomized perturbations of the best heuristic solution the solver tries, 0 by default
+constexpr auto kSomasSolverTries = "MS_DEV_SOMAS_SOLVER_TRIES";
+constexpr size_t kBitsPerWord = 64;
 Status SomasSolverPre::CheckTensors(const TensorsDescMap *pTensors, uint32_t index1, uint32_t index2) const {
   auto tensors = *pTensors;
   if (tensors[index1] == nullptr) {
@@ -130,6 +142,14 @@ Status SomasSolverPre::Solving(const session::KernelGraph &graph, TensorsDescMap
   Status ret = SUCCESS;
   try {
     TensorsDescMap &tensors = *ptensors;
+    uint64_t fingerprint = 0;
+    if (!plan_cache_dir_.empty()) {
+      fingerprint = Fingerprint(tensors, pConstraints, continuous_v);
+      if (LoadPlan(fingerprint, ptensors, pConstraints, continuous_v)) {
+        Log(graph, tensors, pConstraints, continuous_v);
+        return ret;
+      }
+    }
     constexpr size_t numSortingTypes = static_cast<size_t>(kNumSortingTypes);
     constexpr size_t numFittingTypes = static_cast<size_t>(kNumFittingTypes);
     constexpr size_t numAlgorithmTypes = static_cast<size_t>(kNumAlgorithmTypes);
@@ -188,6 +208,18 @@ Status SomasSolverPre::Solving(const session::KernelGraph &graph, TensorsDescMap
                  << static_cast<double>((best_info.worst - best_info.best) /
                                         static_cast<double>(best_info.best * kFloatPresent))
                  << " %%";
+    if (improve_tries_ > 0) {
+      ImproveSolution(ptensors, pConstraints, continuous_v, core_list, bVerifySolution, best_solver);
+    }
+    if (lower_bound_ > 0) {
+      MS_LOG(INFO) << "Lower bound:" << lower_bound_ << " Bytes, gap of the solution: "
+                   << static_cast<double>(max_offset_ - std::min(max_offset_, lower_bound_)) * kFloatPresent /
+                        static_cast<double>(lower_bound_)
+                   << " %";
+    }
+    if (!plan_cache_dir_.empty()) {
+      SavePlan(fingerprint, tensors);
+    }
     Log(graph, tensors, pConstraints, continuous_v);
   } catch (const std::exception &e) {
     MS_LOG(EXCEPTION) << "SomasSolver::Solving FAILED: " << e.what();
@@ -195,6 +227,248 @@ Status SomasSolverPre::Solving(const session::KernelGraph &graph, TensorsDescMap
   return ret;
 }
 
+void SomasSolverPre::ImproveSolution(TensorsDescMap *ptensors, const std::vector<VectorBitSet> *pConstraints,
+                                     const vector<vector<size_t>> &continuous_v, const std::vector<int> &core_list,
+                                     bool bVerifySolution, const std::shared_ptr<SomasSolverCore> &best_solver) {
+  MS_EXCEPTION_IF_NULL(ptensors);
+  MS_EXCEPTION_IF_NULL(best_solver);
+  auto start = std::chrono::system_clock::now();
+  auto &tensors = *ptensors;
+  size_t heuristic_result = max_offset_;
+  auto best_order = best_solver->GetBlockOrder();
+  size_t round_size = std::max(common::ThreadPool::GetInstance().GetSyncRunThreadNum(), static_cast<size_t>(1));
+  size_t tries = 0;
+  // every round perturbs the best order found so far, one try per thread, until the lower bound is reached
+  while (tries < improve_tries_ && max_offset_ > lower_bound_) {
+    size_t round_tries = std::min(round_size, improve_tries_ - tries);
+    vector<TensorsDescMap> vecTensorsMap(round_tries);
+    vector<std::shared_ptr<SomasSolverCore>> solvers;
+    std::vector<common::Task> tasks;
+    for (size_t i = 0; i < round_tries; i++) {
+      for (auto &pairT : tensors) {
+        SomasSolverTensorDescPtr newDescPtr = std::make_shared<SomasSolverTensorDesc>(*(pairT.second.get()));
+        newDescPtr->offset_ = 0;
+        newDescPtr->blocked_ = false;
+        newDescPtr->right_ = nullptr;
+        newDescPtr->left_ = nullptr;
+        (void)vecTensorsMap[i].emplace(pairT.first, newDescPtr);
+      }
+      if (AddContiguousInfoInMap(continuous_v, &vecTensorsMap[i]) == FAILED) {
+        return;
+      }
+      std::shared_ptr<SomasSolverCore> pSolver =
+        std::make_shared<SomasSolverCore>(vecTensorsMap[i], pConstraints, best_solver->sol_count_);
+      pSolver->SetAlgorithmStrategy(best_solver->algorithm_);
+      pSolver->SetSortingStrategy(best_solver->sort_strategy_);
+      pSolver->SetFittingStrategy(best_solver->branching_strategy_);
+      pSolver->SetPerturbation(SizeToUint(tries + i + 1), best_order);
+      pSolver->VerifySolution(bVerifySolution);
+      auto task = [pSolver]() {
+        return pSolver->MemoryAllocationSolver() == SUCCESS ? common::SUCCESS : common::FAIL;
+      };
+      tasks.emplace_back(task);
+      solvers.emplace_back(pSolver);
+    }
+    (void)common::ThreadPool::GetInstance().SyncRun(tasks, core_list);
+    tries += round_tries;
+    size_t best_try = round_tries;
+    for (size_t i = 0; i < round_tries; i++) {
+      if (solvers[i]->GetUpperbound() < max_offset_) {
+        max_offset_ = solvers[i]->GetUpperbound();
+        best_try = i;
+      }
+    }
+    if (best_try == round_tries) {
+      continue;
+    }
+    for (auto &tensor : tensors) {
+      tensor.second->offset_ = vecTensorsMap[best_try][tensor.first]->offset_;
+    }
+    best_order = solvers[best_try]->GetBlockOrder();
+  }
+  common::ThreadPool::GetInstance().ClearThreadPool();
+  auto end = std::chrono::system_clock::now();
+  MS_LOG(INFO) << "Improvement of the best solution: " << heuristic_result << " Bytes -> " << max_offset_
+               << " Bytes after " << tries << " tries, time elapsed: "
+               << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms";
+}
+
+size_t SomasSolverPre::GetImproveTriesConfig() {
+  auto tries = common::GetEnv(kSomasSolverTries);
+  if (tries.empty()) {
+    return 0;
+  }
+  if (std::all_of(tries.begin(), tries.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); })) {
+    try {
+      return static_cast<size_t>(std::stoull(tries));
+    } catch (const std::out_of_range &) {
+    }
+  }
+  MS_LOG(WARNING) << "Ignore the invalid value " << tries << " of " << kSomasSolverTries
+                  << ", which should be a non-negative integer.";
+  return 0;
+}
+
+uint64_t SomasSolverPre::Fingerprint(const TensorsDescMap &tensors, const std::vector<VectorBitSet> *pConstraints,
+                                     const vector<vector<size_t>> &continuous_v) const {
+  MS_EXCEPTION_IF_NULL(pConstraints);
+  std::vector<size_t> indexes;
+  indexes.reserve(tensors.size());
+  for (auto &tensor : tensors) {
+    indexes.emplace_back(tensor.first);
+  }
+  std::sort(indexes.begin(), indexes.end());
+  std::size_t hash = hash_combine(improve_tries_, indexes.size());
+  for (auto index : indexes) {
+    auto &tensor = tensors.at(index);
+    MS_EXCEPTION_IF_NULL(tensor);
+    hash = hash_combine({hash, index, tensor->size_, static_cast<std::size_t>(tensor->lifelong_),
+                         tensor->can_reuse_peak_mem_, static_cast<std::size_t>(tensor->is_graph_output_)});
+  }
+  for (auto &continuous : continuous_v) {
+    hash = hash_combine(hash, continuous.size());
+    for (auto index : continuous) {
+      hash = hash_combine(hash, index);
+    }
+  }
+  // the conflicts between the tensors of the solver, packed in words
+  for (auto index1 : indexes) {
+    auto &constraint = (*pConstraints)[index1];
+    uint64_t word = 0;
+    size_t bits = 0;
+    for (auto index2 : indexes) {
+      word = (word << 1) | static_cast<uint64_t>(constraint.IsBitTrue(index2));
+      if (++bits == kBitsPerWord) {
+        hash = hash_combine(hash, word);
+        word = 0;
+        bits = 0;
+      }
+    }
+    hash = hash_combine(hash, word);
+  }
+  return hash;
+}
+
+std::string SomasSolverPre::PlanCacheFile(uint64_t fingerprint) const {
+  std::ostringstream oss;
+  oss << plan_cache_dir_ << "somas_plan_" << std::hex << std::setw(sizeof(uint64_t) * 2) << std::setfill('0')
+      << fingerprint << ".txt";
+  return oss.str();
+}
+
+bool SomasSolverPre::LoadPlan(uint64_t fingerprint, TensorsDescMap *ptensors,
+                              const std::vector<VectorBitSet> *pConstraints,
+                              const vector<vector<size_t>> &continuous_v) {
+  MS_EXCEPTION_IF_NULL(ptensors);
+  auto filename = PlanCacheFile(fingerprint);
+  std::ifstream ifs(filename);
+  if (!ifs.is_open()) {
+    MS_LOG(INFO) << "No SOMAS plan cached in " << filename;
+    return false;
+  }
+  std::string magic;
+  uint64_t cached_fingerprint = 0;
+  size_t max_offset = 0;
+  size_t tensor_count = 0;
+  ifs >> magic >> cached_fingerprint >> max_offset >> tensor_count;
+  if (ifs.fail() || magic != kPlanCacheMagic || cached_fingerprint != fingerprint ||
+      tensor_count != ptensors->size()) {
+    MS_LOG(WARNING) << "Ignore the SOMAS plan cache file " << filename << " which does not match the graph.";
+    return false;
+  }
+  HashMap<size_t, size_t> offsets;
+  for (size_t i = 0; i < tensor_count; i++) {
+    size_t index = 0;
+    size_t offset = 0;
+    ifs >> index >> offset;
+    if (ifs.fail() || ptensors->find(index) == ptensors->end() || !offsets.emplace(index, offset).second) {
+      MS_LOG(WARNING) << "Ignore the SOMAS plan cache file " << filename << " which is broken.";
+      return false;
+    }
+  }
+  if (!CheckPlan(*ptensors, offsets, max_offset, pConstraints, continuous_v)) {
+    MS_LOG(WARNING) << "Ignore the SOMAS plan cache file " << filename << " which breaks the constraints of the graph.";
+    return false;
+  }
+  for (auto &tensor : *ptensors) {
+    tensor.second->offset_ = offsets[tensor.first];
+  }
+  max_offset_ = max_offset;
+  MS_LOG(INFO) << "Load SOMAS plan cache file " << filename << " successfully, result: " << max_offset_
+               << " Bytes, lower bound: " << lower_bound_ << " Bytes";
+  return true;
+}
+
+bool SomasSolverPre::CheckPlan(const TensorsDescMap &tensors, const HashMap<size_t, size_t> &offsets,
+                               size_t max_offset, const std::vector<VectorBitSet> *pConstraints,
+                               const vector<vector<size_t>> &continuous_v) const {
+  MS_EXCEPTION_IF_NULL(pConstraints);
+  // the plan must use exactly the memory it claims
+  size_t used_size = 0;
+  std::vector<std::pair<size_t, size_t>> spans;
+  spans.reserve(tensors.size());
+  for (auto &tensor : tensors) {
+    auto offset = offsets.at(tensor.first);
+    auto size = tensor.second->size_;
+    if (tensor.first >= pConstraints->size() || offset > max_offset || size > max_offset - offset) {
+      MS_LOG(INFO) << "Tensor " << tensor.first << " of the plan is out of the memory of the plan.";
+      return false;
+    }
+    used_size = std::max(used_size, offset + size);
+    if (size > 0) {
+      spans.emplace_back(offset, tensor.first);
+    }
+  }
+  if (used_size != max_offset) {
+    MS_LOG(INFO) << "The plan claims " << max_offset << " Bytes but its tensors use " << used_size << " Bytes.";
+    return false;
+  }
+  for (auto &continuous : continuous_v) {
+    for (size_t i = 1; i < continuous.size(); i++) {
+      auto prev = tensors.find(continuous[i - 1]);
+      auto next = tensors.find(continuous[i]);
+      if (prev == tensors.end() || next == tensors.end() ||
+          offsets.at(next->first) != offsets.at(prev->first) + prev->second->size_) {
+        MS_LOG(INFO) << "Tensors " << continuous[i - 1] << " and " << continuous[i]
+                     << " of the plan are not contiguous.";
+        return false;
+      }
+    }
+  }
+  // sweep the tensors by offset, only the tensors overlapping the current one are checked for a conflict
+  std::sort(spans.begin(), spans.end());
+  std::vector<size_t> overlapping;
+  for (auto &span : spans) {
+    auto &tensor1 = tensors.at(span.second);
+    (void)overlapping.erase(std::remove_if(overlapping.begin(), overlapping.end(),
+                                           [&offsets, &tensors, &span](size_t index) {
+                                             return offsets.at(index) + tensors.at(index)->size_ <= span.first;
+                                           }),
+                            overlapping.end());
+    for (auto index : overlapping) {
+      auto &tensor2 = tensors.at(index);
+      if (tensor1->lifelong_ || tensor2->lifelong_ || !(*pConstraints)[span.second].IsBitTrue(index)) {
+        MS_LOG(INFO) << "Conflicting tensors " << index << " and " << span.second << " overlap in the plan.";
+        return false;
+      }
+    }
+    overlapping.emplace_back(span.second);
+  }
+  return true;
+}
+
+void SomasSolverPre::SavePlan(uint64_t fingerprint, const TensorsDescMap &tensors) const {
+  std::ostringstream oss;
+  oss << kPlanCacheMagic << " " << fingerprint << " " << max_offset_ << " " << tensors.size() << "\n";
+  for (auto &tensor : tensors) {
+    oss << tensor.first << " " << tensor.second->offset_ << "\n";
+  }
+  auto filename = PlanCacheFile(fingerprint);
+  if (Common::SaveStringToFile(filename, oss.str())) {
+    MS_LOG(INFO) << "Save SOMAS plan cache file " << filename;
+  }
+}
+
 void SomasSolverPre::Log(const session::KernelGraph &graph, const TensorsDescMap &tensors,
                          const std::vector<VectorBitSet> *pConstraints,
                          const vector<vector<size_t>> &continuous_v) const {
@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <stack>
+#include <string>
 #include <vector>
 #include <climits>
 #include "utils/hash_map.h"
@@ -214,6 +215,7 @@ struct SomasSolverTensorDesc {
 };
 using SomasSolverTensorDescPtr = std::shared_ptr<SomasSolverTensorDesc>;
 typedef mindspore::HashMap<size_t, SomasSolverTensorDescPtr> TensorsDescMap;
+class SomasSolverCore;
 class SomasSolverPre {
  public:
   SomasSolverPre() = default;
@@ -224,6 +226,22 @@ class SomasSolverPre {
 
   size_t GetMaxOffset() const { return max_offset_; }
 
+  // The memory size no solution can go below, which stops the improvement rounds once reached
+  void SetLowerBound(size_t lower_bound) { lower_bound_ = lower_bound; }
+  // Number of randomized perturbations of the best heuristic solution to try, 0 to keep the heuristic solution
+  void SetImproveTries(size_t improve_tries) { improve_tries_ = improve_tries; }
+  // Directory of the solved plans keyed by the fingerprint of the solver input, empty not to cache them
+  void SetPlanCacheDir(const std::string &plan_cache_dir) { plan_cache_dir_ = plan_cache_dir; }
+  // Number of improvement tries set by MS_DEV_SOMAS_SOLVER_TRIES, 0 if it is not set or invalid
+  static size_t GetImproveTriesConfig();
+
+  uint64_t Fingerprint(const TensorsDescMap &tensors, const std::vector<VectorBitSet> *pConstraints,
+                       const vector<vector<size_t>> &continuous_v) const;
+  // Load the cached plan of the fingerprint, a plan breaking any constraint of the solver input is ignored
+  bool LoadPlan(uint64_t fingerprint, TensorsDescMap *ptensors, const std::vector<VectorBitSet> *pConstraints,
+                const vector<vector<size_t>> &continuous_v);
+  void SavePlan(uint64_t fingerprint, const TensorsDescMap &tensors) const;
+
   Status Solving(const session::KernelGraph &graph, TensorsDescMap *ptensors,
                  const std::vector<VectorBitSet> *pConstraints, const vector<vector<size_t>> &continuous_v,
                  const std::vector<int> &core_list,
@@ -242,11 +260,20 @@ class SomasSolverPre {
 
  private:
   size_t max_offset_;
+  size_t lower_bound_{0};
+  size_t improve_tries_{0};
+  std::string plan_cache_dir_;
   void SolverInputLog(const session::KernelGraph &graph, const TensorsDescMap &tensors,
                       const vector<vector<size_t>> &continuous_v) const;
   void SolverOutputLog(const session::KernelGraph &graph, const TensorsDescMap &tensors) const;
   vector<TensorsDescMap> CreateTensorsMaps(const TensorsDescMap &tensors, size_t total_sol) const;
   void TensorRelationLog(const std::vector<VectorBitSet> *pConstraints, const session::KernelGraph &graph) const;
+  void ImproveSolution(TensorsDescMap *ptensors, const std::vector<VectorBitSet> *pConstraints,
+                       const vector<vector<size_t>> &continuous_v, const std::vector<int> &core_list,
+                       bool bVerifySolution, const std::shared_ptr<SomasSolverCore> &best_solver);
+  std::string PlanCacheFile(uint64_t fingerprint) const;
+  bool CheckPlan(const TensorsDescMap &tensors, const HashMap<size_t, size_t> &offsets, size_t max_offset,
+                 const std::vector<VectorBitSet> *pConstraints, const vector<vector<size_t>> &continuous_v) const;
 };
 using SomasSolverPrePtr = std::shared_ptr<SomasSolverPre>;
 }  // namespace somas
@@ -34,6 +34,7 @@
 
 #include "utils/ms_utils.h"
 #include "include/backend/visible.h"
+#include "include/backend/mem_reuse/mem_thread_cache.h"
 #include "include/common/utils/stream_util.h"
 #include "ir/device_event.h"
 #ifdef __APPLE__
@@ -89,7 +90,11 @@ struct pair_hash {
 class BACKEND_EXPORT DynamicMemPoolBestFit {
  public:
   DynamicMemPoolBestFit()
-      : persistent_mem_(std::make_shared<MemStatusManager>()), common_mem_(std::make_shared<MemStatusManager>()) {}
+      : persistent_mem_(std::make_shared<MemStatusManager>()),
+        common_mem_(std::make_shared<MemStatusManager>()),
+        thread_cache_(std::make_unique<MemThreadCache>(
+          [this](size_t size) { return AllocTensorMemFromPool(size, false, false, kDefaultStreamIndex); },
+          [this](const DeviceMemPtr &device_addr) { FreeTensorMemToPool(device_addr); })) {}
   virtual ~DynamicMemPoolBestFit();
 
   // The main program entry of memory alloc.
@@ -120,6 +125,7 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
   size_t TotalEagerFreeMemStatistics() const;
   size_t UsedMemPeakStatistics() const;
   size_t ActualPeakStatistics() const;
+  ThreadCacheStatistics ThreadCacheMemStatistics() const;
 
   // Display the brief state information of memory block and memory buf.
   void DumpDynamicMemPoolStateInfo();
@@ -149,6 +155,7 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
 #endif
   const MemStatusManagerPtr &common_mem() const { return common_mem_; }
   const MemStatusManagerPtr &persistent_mem() const { return persistent_mem_; }
+  const std::unique_ptr<MemThreadCache> &thread_cache() const { return thread_cache_; }
   void *GetMinUsingMemoryAddr() const;
   // The real size by memory alloc aligned.
   virtual size_t AlignMemorySize(size_t size) const;
@@ -158,11 +165,20 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
   // The related interface of device memory eager free.
   virtual const bool IsEnableEagerFree() const { return false; }
   virtual const bool SyncAllStreams() { return false; }
+  // The thread cache serves the small memory of the common pool on the default stream without lock, the memory pools
+  // whose memory is alloced and freed by many threads enable it.
+  virtual const bool IsEnableThreadCache() const { return false; }
   virtual size_t AllocDeviceMemByEagerFree(size_t size, DeviceMemPtr *addr) { return 0; }
   virtual size_t FreeDeviceMemByEagerFree(const DeviceMemPtr addr, const size_t size) { return 0; }
   const size_t FreeIdleMemsByEagerFree();
 
  private:
+  // Alloc the memory from the best fit pool, with lock.
+  DeviceMemPtr AllocTensorMemFromPool(size_t size, bool from_persistent_mem, bool need_recycle, uint32_t stream_id);
+  // Free the memory to the best fit pool, with lock.
+  void FreeTensorMemToPool(const DeviceMemPtr &device_addr);
+  // Whether the memory alloc is served by the thread cache.
+  bool IsThreadCacheAlloc(size_t size, bool from_persistent_mem, bool need_recycle, uint32_t stream_id) const;
   // Find available memory buf from total pools by status, which contains idle and eager free.
   DeviceMemPtr FindAvailableMemBuf(size_t size, bool from_persistent_mem, uint32_t stream_id);
   // Find the target status memory buf from total pools by aligned size when memory alloc.
@@ -228,6 +244,9 @@ class BACKEND_EXPORT DynamicMemPoolBestFit {
 
   // key : <user_stream_id, memory_stream_id>
   std::unordered_map<std::pair<uint32_t, uint32_t>, std::set<DynamicMemBufPtr>, pair_hash> stream_pair_addresses_;
+
+  // The size class front end, whose spans are memory bufs used in the common pool.
+  std::unique_ptr<MemThreadCache> thread_cache_{nullptr};
 };
 
 // Recording information for debugging the memory allocator.
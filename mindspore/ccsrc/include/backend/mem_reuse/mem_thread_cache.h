@@ -0,0 +1,91 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_THREAD_CACHE_H_
+#define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_THREAD_CACHE_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace device {
+using DeviceMemPtr = void(*);
+
+// The max size of memory served by the thread cache, bigger memory goes to the best fit pool.
+constexpr size_t kThreadCacheMaxSize = 64 << 10;
+// The size of the span which the thread cache takes from the best fit pool and carves into memory of one size class.
+constexpr size_t kThreadCacheSpanSize = 1 << 20;
+
+// The statistics information of the thread cache.
+struct ThreadCacheStatistics {
+  // Allocations served from a thread free list.
+  size_t hit_count_{0};
+  // Allocations which refilled the thread free list from the central free lists.
+  size_t miss_count_{0};
+  // Memory of the spans taken from the best fit pool, which counts as used memory of the pool.
+  size_t span_mem_size_{0};
+  // Memory of the spans which is not in use, in the thread and central free lists.
+  size_t idle_mem_size_{0};
+  // Spans given back to the best fit pool.
+  size_t released_span_count_{0};
+};
+
+struct ThreadCacheCentral;
+
+// The size class front end of the dynamic memory pool. Small memory is carved out of spans taken from the best fit
+// pool, and each thread keeps free lists of it per size class, so that the alloc and free of small memory take no lock.
+// A thread refills its free lists from the central free lists, and every kThreadCacheScavengeInterval operations gives
+// back the memory it has not used since the last time, so the central free lists release the spans which are all
+// free to the best fit pool. The memory freed by a thread goes to the free lists of this thread, whichever thread
+// allocated it.
+class BACKEND_EXPORT MemThreadCache {
+ public:
+  // alloc_span and free_span take and give back a span of the best fit pool, holding the lock of the pool.
+  MemThreadCache(const std::function<DeviceMemPtr(size_t)> &alloc_span,
+                 const std::function<void(const DeviceMemPtr &)> &free_span);
+  ~MemThreadCache();
+
+  // Whether the memory of the size is served by the thread cache.
+  static bool IsCacheable(size_t size) { return size <= kThreadCacheMaxSize; }
+  // The index of the size class of the size, and the size of the class.
+  static size_t SizeClassIndex(size_t size);
+  static size_t SizeClassSize(size_t class_index);
+
+  // Alloc the memory from the free list of the calling thread, return nullptr if no span can be taken from the pool.
+  DeviceMemPtr Alloc(size_t size);
+  // Free the memory to the free list of the calling thread, return false if the memory is not from the thread cache.
+  bool Free(const DeviceMemPtr &device_addr);
+
+  // Give back the free memory of the calling thread, and release the spans which are all free to the best fit pool.
+  void Scavenge();
+  // Drop all the spans and free lists, called before the best fit pool releases the device memory.
+  void Release();
+
+  ThreadCacheStatistics Statistics() const;
+  std::string StatisticsString() const;
+
+ private:
+  DISABLE_COPY_AND_ASSIGN(MemThreadCache);
+
+  std::shared_ptr<ThreadCacheCentral> central_;
+};
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_THREAD_CACHE_H_
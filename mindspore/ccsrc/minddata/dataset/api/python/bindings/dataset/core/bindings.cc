@@ -81,6 +81,22 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_debug_mode", &ConfigManager::get_debug_mode)
                     .def("set_error_samples_mode", &ConfigManager::set_error_samples_mode)
                     .def("get_error_samples_mode", &ConfigManager::get_error_samples_mode)
+                    .def("set_mindrecord_mmap", &ConfigManager::set_mindrecord_mmap)
+                    .def("get_mindrecord_mmap", &ConfigManager::mindrecord_mmap)
+                    .def("set_io_prefetch_depth", &ConfigManager::set_io_prefetch_depth)
+                    .def("get_io_prefetch_depth", &ConfigManager::io_prefetch_depth)
+                    .def("set_shuffle_memory_limit", &ConfigManager::set_shuffle_memory_limit)
+                    .def("get_shuffle_memory_limit", &ConfigManager::shuffle_memory_limit)
+                    .def("set_shuffle_spill_dir", &ConfigManager::set_shuffle_spill_dir)
+                    .def("get_shuffle_spill_dir", &ConfigManager::shuffle_spill_dir)
+                    .def("set_embedded_cache", &ConfigManager::set_embedded_cache)
+                    .def("get_embedded_cache", &ConfigManager::embedded_cache)
+                    .def("set_numa_placement", &ConfigManager::set_numa_placement)
+                    .def("get_numa_placement", &ConfigManager::get_numa_placement)
+                    .def("set_autotune_strategy", &ConfigManager::set_autotune_strategy)
+                    .def("get_autotune_strategy", &ConfigManager::get_autotune_strategy)
+                    .def("set_executor_mode", &ConfigManager::set_executor_mode)
+                    .def("get_executor_mode", &ConfigManager::get_executor_mode)
                     .def("load", [](ConfigManager &c, const std::string &s) { THROW_IF_ERROR(c.LoadFile(s)); });
                 }));
 
@@ -217,5 +233,27 @@ PYBIND_REGISTER(ErrorSamplesMode, 0, ([](const py::module *m) {
                     .value("DE_ERROR_SAMPLES_MODE_SKIP", ErrorSamplesMode::kSkip)
                     .export_values();
                 }));
+
+PYBIND_REGISTER(NumaPlacement, 0, ([](const py::module *m) {
+                  (void)py::enum_<NumaPlacement>(*m, "NumaPlacement", py::arithmetic())
+                    .value("DE_NUMA_PLACEMENT_NONE", NumaPlacement::kNone)
+                    .value("DE_NUMA_PLACEMENT_DEVICE", NumaPlacement::kDevice)
+                    .value("DE_NUMA_PLACEMENT_SPREAD", NumaPlacement::kSpread)
+                    .export_values();
+                }));
+
+PYBIND_REGISTER(AutoTuneStrategy, 0, ([](const py::module *m) {
+                  (void)py::enum_<AutoTuneStrategy>(*m, "AutoTuneStrategy", py::arithmetic())
+                    .value("DE_AUTOTUNE_STRATEGY_HEURISTIC", AutoTuneStrategy::kHeuristic)
+                    .value("DE_AUTOTUNE_STRATEGY_MODEL", AutoTuneStrategy::kModel)
+                    .export_values();
+                }));
+
+PYBIND_REGISTER(ExecutorMode, 0, ([](const py::module *m) {
+                  (void)py::enum_<ExecutorMode>(*m, "ExecutorMode", py::arithmetic())
+                    .value("DE_EXECUTOR_MODE_THREAD_PER_OP", ExecutorMode::kThreadPerOp)
+                    .value("DE_EXECUTOR_MODE_SHARED", ExecutorMode::kShared)
+                    .export_values();
+                }));
 }  // namespace dataset
 }  // namespace mindspore
@@ -17,8 +17,13 @@
 #include "minddata/dataset/audio/kernels/audio_utils.h"
 
 #include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #include "mindspore/core/base/float16.h"
+#include "minddata/dataset/audio/kernels/fft_plan.h"
 #include "minddata/dataset/core/type_id.h"
 #include "minddata/dataset/util/random.h"
 #include "utils/file_utils.h"
@@ -28,6 +33,39 @@ namespace dataset {
 // global lock for cyl_bessel_i and cyl_bessel_if function
 std::mutex cyl_bessel_mux_;
 
+namespace {
+// Get the value of a key from a process-wide cache of immutable values, creating it on the first call. Two threads
+// missing the same key may both create it, the value of the first one is kept.
+template <typename K, typename V>
+Status GetOrCreate(const K &key, const std::function<Status(std::shared_ptr<V> *)> &create,
+                   std::shared_ptr<V> *output) {
+  static std::mutex mux;
+  static std::map<K, std::shared_ptr<V>> cache;
+  {
+    std::unique_lock<std::mutex> lock(mux);
+    auto iter = cache.find(key);
+    if (iter != cache.end()) {
+      *output = iter->second;
+      return Status::OK();
+    }
+  }
+  std::shared_ptr<V> value;
+  RETURN_IF_NOT_OK(create(&value));
+  std::unique_lock<std::mutex> lock(mux);
+  *output = cache.emplace(key, std::move(value)).first->second;
+  return Status::OK();
+}
+
+// Transpose a filterbank tensor <freq, filter> into the weights <filter, freq>
+template <typename T>
+std::shared_ptr<const RowMajorMatrix<T>> TransposeToWeights(const std::shared_ptr<Tensor> &fb) {
+  const dsize_t n_freqs = fb->shape()[0];
+  const dsize_t n_filter = fb->shape()[1];
+  Eigen::Map<const RowMajorMatrix<T>> matrix_fb(reinterpret_cast<const T *>(fb->GetBuffer()), n_freqs, n_filter);
+  return std::make_shared<const RowMajorMatrix<T>>(matrix_fb.transpose());
+}
+}  // namespace
+
 // Compute the thread nums.
 Status CountThreadNums(size_t input_size, float block_size, size_t *task_num, size_t *once_compute_size) {
   CHECK_FAIL_RETURN_UNEXPECTED(block_size > 0, "Invalid data, the value of 'block_size' should be greater than 0.");
@@ -141,6 +179,53 @@ Status CreateLinearFbanks(std::shared_ptr<Tensor> *output, int32_t n_freqs, floa
   return Status::OK();
 }
 
+template <typename T>
+Status MelFbankWeights(std::shared_ptr<const RowMajorMatrix<T>> *output, int32_t n_freqs, float f_min, float f_max,
+                       int32_t n_mels, int32_t sample_rate, NormType norm, MelType mel_type) {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  auto create = [=](std::shared_ptr<const RowMajorMatrix<T>> *weights) -> Status {
+    std::shared_ptr<Tensor> fb;
+    RETURN_IF_NOT_OK(CreateFbanks<T>(&fb, n_freqs, f_min, f_max, n_mels, sample_rate, norm, mel_type));
+    *weights = TransposeToWeights<T>(fb);
+    return Status::OK();
+  };
+  return GetOrCreate<std::tuple<int32_t, float, float, int32_t, int32_t, NormType, MelType>, const RowMajorMatrix<T>>(
+    std::make_tuple(n_freqs, f_min, f_max, n_mels, sample_rate, norm, mel_type), create, output);
+}
+
+template Status MelFbankWeights<float>(std::shared_ptr<const RowMajorMatrix<float>> *output, int32_t n_freqs,
+                                       float f_min, float f_max, int32_t n_mels, int32_t sample_rate, NormType norm,
+                                       MelType mel_type);
+template Status MelFbankWeights<double>(std::shared_ptr<const RowMajorMatrix<double>> *output, int32_t n_freqs,
+                                        float f_min, float f_max, int32_t n_mels, int32_t sample_rate, NormType norm,
+                                        MelType mel_type);
+
+Status LinearFbankWeights(std::shared_ptr<const RowMajorMatrix<float>> *output, int32_t n_freqs, float f_min,
+                          float f_max, int32_t n_filter, int32_t sample_rate) {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  auto create = [=](std::shared_ptr<const RowMajorMatrix<float>> *weights) -> Status {
+    std::shared_ptr<Tensor> fb;
+    RETURN_IF_NOT_OK(CreateLinearFbanks(&fb, n_freqs, f_min, f_max, n_filter, sample_rate));
+    *weights = TransposeToWeights<float>(fb);
+    return Status::OK();
+  };
+  return GetOrCreate<std::tuple<int32_t, float, float, int32_t, int32_t>, const RowMajorMatrix<float>>(
+    std::make_tuple(n_freqs, f_min, f_max, n_filter, sample_rate), create, output);
+}
+
+Status DctWeights(std::shared_ptr<const RowMajorMatrix<float>> *output, int32_t n_mfcc, int32_t n_mels,
+                  NormMode norm) {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  auto create = [=](std::shared_ptr<const RowMajorMatrix<float>> *weights) -> Status {
+    std::shared_ptr<Tensor> dct;
+    RETURN_IF_NOT_OK(Dct(&dct, n_mfcc, n_mels, norm));
+    *weights = TransposeToWeights<float>(dct);
+    return Status::OK();
+  };
+  return GetOrCreate<std::tuple<int32_t, int32_t, NormMode>, const RowMajorMatrix<float>>(
+    std::make_tuple(n_mfcc, n_mels, norm), create, output);
+}
+
 /// \brief Reconstruct complex tensor from norm and angle.
 /// \param[in] abs - The absolute value of the complex tensor.
 /// \param[in] angle - The angle of the complex tensor.
@@ -1332,6 +1417,29 @@ Status Window(std::shared_ptr<Tensor> *output, WindowType window_type, int len)
   }
 }
 
+// Get the window of the STFT padded on both sides to n_fft. The windows are cached and shared by all calls with the
+// same arguments, the output must not be modified.
+Status StftWindow(WindowType window, int win_length, int n_fft, std::shared_ptr<Tensor> *output) {
+  auto create = [window, win_length, n_fft](std::shared_ptr<Tensor> *padded) -> Status {
+    std::shared_ptr<Tensor> window_tensor;
+    RETURN_IF_NOT_OK(Window(&window_tensor, window, win_length));
+    if (win_length == 1) {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape({1}), DataType(DataType::DE_FLOAT32), &window_tensor));
+      auto win = window_tensor->begin<float>();
+      *(win) = 1;
+    }
+
+    // Pad window length
+    int pad_left = (n_fft - win_length) / 2;
+    int pad_right = n_fft - win_length - pad_left;
+    RETURN_IF_NOT_OK(window_tensor->Reshape(TensorShape({1, win_length})));
+    RETURN_IF_NOT_OK(Pad<float>(window_tensor, padded, pad_left, pad_right, BorderType::kConstant));
+    return (*padded)->Reshape(TensorShape({n_fft}));
+  };
+  return GetOrCreate<std::tuple<WindowType, int, int>, Tensor>(std::make_tuple(window, win_length, n_fft), create,
+                                                               output);
+}
+
 // control whether return half of results after stft.
 template <typename T>
 Status Onesided(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int n_fft, int n_columns) {
@@ -1399,7 +1507,6 @@ Status Stft(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
             bool onesided) {
   CHECK_FAIL_RETURN_UNEXPECTED(win_length != 0, "Spectrogram: win_length can not be zero.");
   double win_sum = 0.;
-  float twice = 2.0;
   for (auto iter_win = win->begin<float>(); iter_win != win->end<float>(); iter_win++) {
     win_sum += (*iter_win) * (*iter_win);
   }
@@ -1416,39 +1523,20 @@ Status Stft(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
   std::shared_ptr<Tensor> spec_p;
   RETURN_IF_NOT_OK(
     Tensor::CreateEmpty(TensorShape({input->shape()[0], n_fft / 2 + 1, n_columns}), input->type(), &spec_p));
-  std::shared_ptr<Tensor> exp_complex;
-  RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape({n_fft / 2 + 1, win_length, 2}), input->type(), &exp_complex));
-  auto exp_complex_begin = exp_complex->begin<T>();
-  std::vector<int> exp_complex_slice = {win_length * 2, 2};
-  for (int i = 0; i < (n_fft / TWO + 1); i++) {
-    for (int k = 0; k <= win_length - 1; k++) {
-      ptrdiff_t exp_complex_offset_0 = i * exp_complex_slice[0] + k * exp_complex_slice[1];
-      ptrdiff_t exp_complex_offset_1 = exp_complex_offset_0 + 1;
-      *(exp_complex_begin + exp_complex_offset_0) = std::cos(twice * PI * i * k / win_length);
-      *(exp_complex_begin + exp_complex_offset_1) = std::sin(twice * PI * i * k / win_length);
-    }
-  }
+  // the frames are transformed with the real FFT plan of the window length, shared by all calls
+  std::shared_ptr<const RealFftPlan<T>> plan;
+  RETURN_IF_NOT_OK(RealFftPlan<T>::Get(win_length, &plan));
+  CHECK_FAIL_RETURN_UNEXPECTED(plan->num_bins() == n_fft / TWO + 1,
+                               "Spectrogram: win_length should be equal to n_fft, but got win_length: " +
+                                 std::to_string(win_length) + ", n_fft: " + std::to_string(n_fft) + ".");
+  const T *input_win_data = &*input_win_begin;
+  T *spec_f_data = &*spec_f_begin;
   for (int r = 0; r < input->shape()[0]; r++) {
-    for (int i = 0; i < (n_fft / TWO + 1); i++) {
-      for (int j = 0; j < n_columns; j++) {
-        T spec_f_0 = 0.;
-        T spec_f_1 = 0.;
-        ptrdiff_t exp_complex_offset_0 = i * exp_complex_slice[0];
-        for (int k = 0; k < win_length; k++) {
-          ptrdiff_t exp_complex_offset_1 = exp_complex_offset_0 + 1;
-          T exp_complex_a = *(exp_complex_begin + exp_complex_offset_0);
-          T exp_complex_b = *(exp_complex_begin + exp_complex_offset_1);
-          ptrdiff_t input_win_offset = r * input_win_slice[0] + j * input_win_slice[1] + k;
-          T input_value = *(input_win_begin + input_win_offset);
-          spec_f_0 += input_value * exp_complex_a;
-          spec_f_1 += -input_value * exp_complex_b;
-          exp_complex_offset_0 = exp_complex_offset_1 + 1;
-        }
-        ptrdiff_t spec_f_offset_0 = r * spec_f_slice[0] + i * spec_f_slice[1] + j * spec_f_slice[2];
-        ptrdiff_t spec_f_offset_1 = spec_f_offset_0 + 1;
-        *(spec_f_begin + spec_f_offset_0) = spec_f_0;
-        *(spec_f_begin + spec_f_offset_1) = spec_f_1;
-      }
+    for (int j = 0; j < n_columns; j++) {
+      // bin i of the frame goes to spec_f[r][i][j], the bins of a frame are spec_f_slice[1] values apart
+      const T *frame = input_win_data + r * input_win_slice[0] + j * input_win_slice[1];
+      T *bins = spec_f_data + r * spec_f_slice[0] + j * spec_f_slice[2];
+      plan->Forward(frame, bins, spec_f_slice[1]);
     }
   }
   CHECK_FAIL_RETURN_UNEXPECTED(win_sum != 0, "Window: the total value of window function can not be zero.");
@@ -1491,7 +1579,6 @@ template <typename T>
 Status SpectrogramImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int pad,
                        WindowType window, int n_fft, int hop_length, int win_length, float power, bool normalized,
                        bool center, BorderType pad_mode, bool onesided) {
-  std::shared_ptr<Tensor> fft_window_tensor;
   std::shared_ptr<Tensor> fft_window_later;
   TensorShape shape = input->shape();
   std::vector output_shape = shape.AsVector();
@@ -1501,20 +1588,8 @@ Status SpectrogramImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Ten
   RETURN_IF_NOT_OK(input->Reshape(TensorShape({input->Size() / input_len, input_len})));
 
   DataType data_type = input->type();
-  // get the windows
-  RETURN_IF_NOT_OK(Window(&fft_window_tensor, window, win_length));
-  if (win_length == 1) {
-    RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape({1}), DataType(DataType::DE_FLOAT32), &fft_window_tensor));
-    auto win = fft_window_tensor->begin<float>();
-    *(win) = 1;
-  }
-
-  // Pad window length
-  int pad_left = (n_fft - win_length) / 2;
-  int pad_right = n_fft - win_length - pad_left;
-  RETURN_IF_NOT_OK(fft_window_tensor->Reshape(TensorShape({1, win_length})));
-  RETURN_IF_NOT_OK(Pad<float>(fft_window_tensor, &fft_window_later, pad_left, pad_right, BorderType::kConstant));
-  RETURN_IF_NOT_OK(fft_window_later->Reshape(TensorShape({n_fft})));
+  // get the window padded to n_fft
+  RETURN_IF_NOT_OK(StftWindow(window, win_length, n_fft, &fft_window_later));
 
   int length = input_len + pad * 2 + n_fft;
 
@@ -2398,45 +2473,21 @@ Status LFCC(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
   RETURN_UNEXPECTED_IF_NULL(input);
   RETURN_UNEXPECTED_IF_NULL(output);
   std::shared_ptr<Tensor> spectrogram;
-  std::shared_ptr<Tensor> filter_mat;
-  std::shared_ptr<Tensor> dct_mat;
+  std::shared_ptr<const RowMajorMatrix<float>> filter_weights;
+  std::shared_ptr<const RowMajorMatrix<float>> dct_weights;
   RETURN_IF_NOT_OK(Spectrogram(input, &spectrogram, pad, window, n_fft, hop_length, win_length, power, normalized,
                                center, pad_mode, onesided));
-  RETURN_IF_NOT_OK(
-    CreateLinearFbanks(&filter_mat, static_cast<int32_t>(floor(n_fft / TWO)) + 1, f_min, f_max, n_filter, sample_rate));
-  RETURN_IF_NOT_OK(Dct(&dct_mat, n_lfcc, n_filter, norm));
+  if (spectrogram->type() != DataType::DE_FLOAT32) {
+    std::shared_ptr<Tensor> spectrogram_f32;
+    RETURN_IF_NOT_OK(TypeCast(spectrogram, &spectrogram_f32, DataType(DataType::DE_FLOAT32)));
+    spectrogram = spectrogram_f32;
+  }
+  RETURN_IF_NOT_OK(LinearFbankWeights(&filter_weights, static_cast<int32_t>(floor(n_fft / TWO)) + 1, f_min, f_max,
+                                      n_filter, sample_rate));
+  RETURN_IF_NOT_OK(DctWeights(&dct_weights, n_lfcc, n_filter, norm));
   std::shared_ptr<Tensor> spectrogramxfilter;
   std::shared_ptr<Tensor> specgram_temp;
-
-  TensorShape specgram_shape = spectrogram->shape();
-  TensorShape specgram_reshape(
-    {spectrogram->Size() / specgram_shape[-1] / specgram_shape[-2], specgram_shape[-2], specgram_shape[-1]});
-  RETURN_IF_NOT_OK(spectrogram->Reshape(specgram_reshape));
-  auto filter_mat_ptr = &*filter_mat->begin<float>();
-  Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_fm(
-    filter_mat_ptr, n_filter, static_cast<int32_t>(floor(n_fft / TWO)) + 1);
-  auto dct_mat_ptr = &*dct_mat->begin<float>();
-  Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_dm(dct_mat_ptr, n_lfcc, n_filter);
-
-  int rows = specgram_reshape[1];
-  int cols = specgram_reshape[TWO];
-
-  std::vector<float> sf_temp;
-  Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic> mat_res;
-
-  for (int c = 0; c < specgram_reshape[0]; c++) {
-    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_c(
-      &*spectrogram->begin<float>() + rows * cols * c, cols, rows);
-    mat_res.noalias() = (matrix_c * matrix_fm.transpose());
-    std::vector<float> vec_c(mat_res.data(), mat_res.data() + mat_res.size());
-    sf_temp.insert(sf_temp.end(), vec_c.begin(), vec_c.end());
-  }
-  // unpack
-  std::vector<int64_t> sf_shape_vec = specgram_shape.AsVector();
-  sf_shape_vec[specgram_shape.Size() - 1] = cols;
-  sf_shape_vec[specgram_shape.Size() - TWO] = n_filter;
-  TensorShape sf_shape(sf_shape_vec);
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(sf_temp, sf_shape, &spectrogramxfilter));
+  RETURN_IF_NOT_OK(ApplyWeights<float>(spectrogram, *filter_weights, &spectrogramxfilter));
 
   if (log_lf == true) {
     float log_offset = 1e-6;
@@ -2454,29 +2505,7 @@ Status LFCC(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
     specgram_temp = amplitude_to_db;
   }
 
-  TensorShape st_shape = specgram_temp->shape();
-  TensorShape st_reshape({specgram_temp->Size() / st_shape[-1] / st_shape[-2], st_shape[-2], st_shape[-1]});
-  RETURN_IF_NOT_OK(specgram_temp->Reshape(st_reshape));
-
-  rows = st_reshape[1];
-  cols = st_reshape[TWO];
-  std::vector<float> out_temp;
-
-  for (int c = 0; c < st_reshape[0]; c++) {
-    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_c(
-      &*specgram_temp->begin<float>() + rows * cols * c, cols, rows);
-    mat_res.noalias() = (matrix_c * matrix_dm.transpose());
-    std::vector<float> vec_c(mat_res.data(), mat_res.data() + mat_res.size());
-    out_temp.insert(out_temp.end(), vec_c.begin(), vec_c.end());
-  }
-  // unpack
-  std::vector<int64_t> output_shape_vec = st_shape.AsVector();
-  output_shape_vec[st_shape.Size() - 1] = cols;
-  output_shape_vec[st_shape.Size() - TWO] = n_lfcc;
-  TensorShape output_shape(output_shape_vec);
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(out_temp, output_shape, output));
-
-  return Status::OK();
+  return ApplyWeights<float>(specgram_temp, *dct_weights, output);
 }
 
 Status MelSpectrogram(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int32_t sample_rate,
@@ -2491,9 +2520,15 @@ Status MelSpectrogram(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tens
   std::shared_ptr<Tensor> spectrogram;
   RETURN_IF_NOT_OK(Spectrogram(input, &spectrogram, pad, window, n_fft, hop_length, win_length, power, normalized,
                                center, pad_mode, onesided));
-  RETURN_IF_NOT_OK(
-    MelScale<float>(spectrogram, output, n_mels, sample_rate, f_min, f_max, n_fft / TWO + 1, norm, mel_scale));
-  return Status::OK();
+  if (spectrogram->type() == DataType::DE_FLOAT64) {
+    return MelScale<double>(spectrogram, output, n_mels, sample_rate, f_min, f_max, n_fft / TWO + 1, norm, mel_scale);
+  }
+  if (spectrogram->type() != DataType::DE_FLOAT32) {
+    std::shared_ptr<Tensor> spectrogram_f32;
+    RETURN_IF_NOT_OK(TypeCast(spectrogram, &spectrogram_f32, DataType(DataType::DE_FLOAT32)));
+    spectrogram = spectrogram_f32;
+  }
+  return MelScale<float>(spectrogram, output, n_mels, sample_rate, f_min, f_max, n_fft / TWO + 1, norm, mel_scale);
 }
 
 Status MFCC(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int32_t sample_rate, int32_t n_mfcc,
@@ -2503,10 +2538,15 @@ Status MFCC(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
   RETURN_UNEXPECTED_IF_NULL(input);
   RETURN_UNEXPECTED_IF_NULL(output);
   std::shared_ptr<Tensor> mel_spectrogram;
-  std::shared_ptr<Tensor> dct_mat;
+  std::shared_ptr<const RowMajorMatrix<float>> dct_weights;
   RETURN_IF_NOT_OK(MelSpectrogram(input, &mel_spectrogram, sample_rate, n_fft, win_length, hop_length, f_min, f_max,
                                   pad, n_mels, window, power, normalized, center, pad_mode, onesided, norm, mel_scale));
-  RETURN_IF_NOT_OK(Dct(&dct_mat, n_mfcc, n_mels, norm_M));
+  if (mel_spectrogram->type() != DataType::DE_FLOAT32) {
+    std::shared_ptr<Tensor> mel_spectrogram_f32;
+    RETURN_IF_NOT_OK(TypeCast(mel_spectrogram, &mel_spectrogram_f32, DataType(DataType::DE_FLOAT32)));
+    mel_spectrogram = mel_spectrogram_f32;
+  }
+  RETURN_IF_NOT_OK(DctWeights(&dct_weights, n_mfcc, n_mels, norm_M));
   if (log_mels) {
     for (auto itr = mel_spectrogram->begin<float>(); itr != mel_spectrogram->end<float>(); ++itr) {
       float log_offset = 1e-6;
@@ -2521,34 +2561,7 @@ Status MFCC(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
     RETURN_IF_NOT_OK(AmplitudeToDB(mel_spectrogram, &amplitude_to_db, multiplier, amin, db_multiplier, top_db));
     mel_spectrogram = amplitude_to_db;
   }
-  auto dct_mat_ptr = &*dct_mat->begin<float>();
-  Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic> mat_res;
-  Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_dm(dct_mat_ptr, n_mfcc, n_mels);
-  TensorShape st_shape = mel_spectrogram->shape();
-  TensorShape st_reshape({mel_spectrogram->Size() / st_shape[-1] / st_shape[-2], st_shape[-2], st_shape[-1]});
-  RETURN_IF_NOT_OK(mel_spectrogram->Reshape(st_reshape));
-
-  const dsize_t kRowIndex = 1;
-  const dsize_t kColIndex = 2;
-  int rows = st_reshape[kRowIndex];
-  int cols = st_reshape[kColIndex];
-  std::vector<float> out_temp;
-
-  for (int c = 0; c < st_reshape[0]; c++) {
-    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_c(
-      &*mel_spectrogram->begin<float>() + rows * cols * c, cols, rows);
-    mat_res.noalias() = (matrix_c * matrix_dm.transpose());
-    std::vector<float> vec_c(mat_res.data(), mat_res.data() + mat_res.size());
-    out_temp.insert(out_temp.end(), vec_c.begin(), vec_c.end());
-  }
-  // unpack
-  std::vector<int64_t> output_shape_vec = st_shape.AsVector();
-  output_shape_vec[st_shape.Size() - 1] = cols;
-  output_shape_vec[st_shape.Size() - TWO] = n_mfcc;
-  TensorShape output_shape(output_shape_vec);
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(out_temp, output_shape, output));
-
-  return Status::OK();
+  return ApplyWeights<float>(mel_spectrogram, *dct_weights, output);
 }
 
 template <typename T>
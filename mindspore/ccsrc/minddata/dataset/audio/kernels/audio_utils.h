@@ -598,6 +598,63 @@ Status CreateFbanks(std::shared_ptr<Tensor> *output, int32_t n_freqs, float f_mi
 Status CreateLinearFbanks(std::shared_ptr<Tensor> *output, int32_t n_freqs, float f_min, float f_max, int32_t n_filter,
                           int32_t sample_rate);
 
+template <typename T>
+using RowMajorMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/// \brief Get the weights of a mel filterbank, the transpose of CreateFbanks. The weights are created on the first
+///     call and shared by all calls with the same arguments, so that the ops do not rebuild them for each sample.
+/// \param output: Matrix of shape <n_mels, n_freqs>.
+/// \return Status code.
+template <typename T>
+Status MelFbankWeights(std::shared_ptr<const RowMajorMatrix<T>> *output, int32_t n_freqs, float f_min, float f_max,
+                       int32_t n_mels, int32_t sample_rate, NormType norm, MelType mel_type);
+
+/// \brief Get the weights of a linear triangular filterbank, the transpose of CreateLinearFbanks, shared by all calls
+///     with the same arguments.
+/// \param output: Matrix of shape <n_filter, n_freqs>.
+/// \return Status code.
+Status LinearFbankWeights(std::shared_ptr<const RowMajorMatrix<float>> *output, int32_t n_freqs, float f_min,
+                          float f_max, int32_t n_filter, int32_t sample_rate);
+
+/// \brief Get the weights of a DCT, the transpose of Dct, shared by all calls with the same arguments.
+/// \param output: Matrix of shape <n_mfcc, n_mels>.
+/// \return Status code.
+Status DctWeights(std::shared_ptr<const RowMajorMatrix<float>> *output, int32_t n_mfcc, int32_t n_mels,
+                  NormMode norm);
+
+/// \brief Apply weights to the second to last axis of a tensor, all frames of a channel in one matrix product.
+/// \param input: Tensor of shape <..., rows, time>.
+/// \param weights: Matrix of shape <out_rows, rows>.
+/// \param output: Tensor of shape <..., out_rows, time>.
+/// \return Status code.
+template <typename T>
+Status ApplyWeights(const std::shared_ptr<Tensor> &input, const RowMajorMatrix<T> &weights,
+                    std::shared_ptr<Tensor> *output) {
+  TensorShape input_shape = input->shape();
+  CHECK_FAIL_RETURN_UNEXPECTED(input->type().IsCompatible<T>(), "ApplyWeights: the type of the weights does not match "
+                               "the input tensor type: " + input->type().ToString());
+  CHECK_FAIL_RETURN_UNEXPECTED(input_shape.Rank() >= TWO && input_shape[-TWO] == weights.cols(),
+                               "ApplyWeights: the input tensor should be in shape of <..., " +
+                                 std::to_string(weights.cols()) + ", time>, but got: " + input_shape.ToString());
+  std::vector<dsize_t> output_shape = input_shape.AsVector();
+  output_shape[output_shape.size() - TWO] = weights.rows();
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape(output_shape), input->type(), output));
+  const dsize_t rows = input_shape[-TWO];
+  const dsize_t time = input_shape[-1];
+  const dsize_t channels = rows * time == 0 ? 0 : input->Size() / (rows * time);
+  if ((*output)->Size() == 0) {
+    return Status::OK();
+  }
+  const T *input_ptr = reinterpret_cast<const T *>(input->GetBuffer());
+  T *output_ptr = reinterpret_cast<T *>((*output)->GetMutableBuffer());
+  for (dsize_t c = 0; c < channels; c++) {
+    Eigen::Map<const RowMajorMatrix<T>> matrix_in(input_ptr + c * rows * time, rows, time);
+    Eigen::Map<RowMajorMatrix<T>> matrix_out(output_ptr + c * weights.rows() * time, weights.rows(), time);
+    matrix_out.noalias() = weights * matrix_in;
+  }
+  return Status::OK();
+}
+
 /// \brief Convert normal STFT to STFT at the Mel scale.
 /// \param input: Input audio tensor.
 /// \param output: Mel scale audio tensor.
@@ -618,42 +675,21 @@ Status MelScale(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *o
   TensorShape input_reshape({input->Size() / input_shape[-1] / input_shape[-2], input_shape[-2], input_shape[-1]});
   RETURN_IF_NOT_OK(input->Reshape(input_reshape));
 
-  int rows = input_reshape[1];
-  int cols = input_reshape[2];
+  if (n_mels == 0) {
+    // unpack
+    std::vector<int64_t> out_shape_vec = input_shape.AsVector();
+    out_shape_vec[input_shape.Size() - TWO] = n_mels;
+    return Tensor::CreateEmpty(TensorShape(out_shape_vec), input->type(), output);
+  }
 
+  // get the cached freq bin mat <n_mels, freq>
+  std::shared_ptr<const RowMajorMatrix<T>> weights;
+  RETURN_IF_NOT_OK(MelFbankWeights<T>(&weights, n_stft, f_min, f_max, n_mels, sample_rate, norm, mel_type));
+  RETURN_IF_NOT_OK(ApplyWeights<T>(input, *weights, output));
   // unpack
   std::vector<int64_t> out_shape_vec = input_shape.AsVector();
-  out_shape_vec[input_shape.Size() - 1] = cols;
   out_shape_vec[input_shape.Size() - TWO] = n_mels;
-  TensorShape output_shape(out_shape_vec);
-
-  RETURN_IF_NOT_OK(Tensor::CreateEmpty(output_shape, input->type(), output));
-  if (n_mels == 0) {
-    return Status::OK();
-  }
-  auto out_in = (*output)->GetMutableBuffer();
-  size_t t_size = sizeof(T);
-
-  // gen freq bin mat
-  std::shared_ptr<Tensor> freq_bin_mat;
-  RETURN_IF_NOT_OK(CreateFbanks<T>(&freq_bin_mat, n_stft, f_min, f_max, n_mels, sample_rate, norm, mel_type));
-  auto data_ptr = &*freq_bin_mat->begin<T>();
-  Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>> matrix_fb(data_ptr, n_mels, n_stft);
-  auto matrix_fb_t = matrix_fb.transpose();
-
-  for (size_t c = 0; c < input_reshape[0]; c++) {
-    Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>> matrix_c(
-      static_cast<T *>(&*input->begin<T>() + rows * cols * c), cols, rows);
-    auto mat_res = matrix_c * matrix_fb_t;
-    size_t mat_res_size = mat_res.size() * t_size;
-    size_t offset = mat_res_size * c;
-    int ret_code =
-      memcpy_s(reinterpret_cast<void *>(out_in + offset), mat_res_size, mat_res.eval().data(), mat_res_size);
-    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK,
-                                 "Failed to copy data into std::vector, ret code: " + std::to_string(ret_code) + ".");
-  }
-
-  return Status::OK();
+  return (*output)->Reshape(TensorShape(out_shape_vec));
 }
 
 /// \brief Transform audio signal into spectrogram.
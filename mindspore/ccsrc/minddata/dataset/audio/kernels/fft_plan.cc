@@ -0,0 +1,338 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/audio/kernels/fft_plan.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr double kTwoPi = 6.283185307179586;
+constexpr int32_t kRadix2 = 2;
+constexpr int32_t kRadix3 = 3;
+constexpr int32_t kRadix4 = 4;
+
+// Split n into the radices of the stages, 4 first as it takes the fewest operations per value
+std::vector<int32_t> Factorize(int32_t n) {
+  std::vector<int32_t> radices;
+  for (int32_t p : {kRadix4, kRadix2, kRadix3}) {
+    while (n % p == 0) {
+      radices.push_back(p);
+      n /= p;
+    }
+  }
+  for (int32_t p = 5; n > 1; p += 2) {
+    if (static_cast<int64_t>(p) * p > n) {
+      p = n;
+    }
+    while (n % p == 0) {
+      radices.push_back(p);
+      n /= p;
+    }
+  }
+  return radices;
+}
+
+// One stage of the Stockham FFT: for each sub-transform q of length n = radix * m and each of the s interleaved
+// transforms k, y[k + s * (radix * q + r)] = w^(r * q) * DFT(x[k + s * (q + j * m)] for j in [0, radix))[r].
+// The loops over k read and write contiguous values.
+template <typename T>
+void Radix2(int32_t m, int32_t s, const T *tw_re, const T *tw_im, const T *xr, const T *xi, T *yr, T *yi) {
+  const int64_t stride = static_cast<int64_t>(s) * m;
+  for (int32_t q = 0; q < m; ++q) {
+    const T w_re = tw_re[q];
+    const T w_im = tw_im[q];
+    const T *a0r = xr + static_cast<int64_t>(s) * q;
+    const T *a0i = xi + static_cast<int64_t>(s) * q;
+    const T *a1r = a0r + stride;
+    const T *a1i = a0i + stride;
+    T *b0r = yr + static_cast<int64_t>(s) * kRadix2 * q;
+    T *b0i = yi + static_cast<int64_t>(s) * kRadix2 * q;
+    T *b1r = b0r + s;
+    T *b1i = b0i + s;
+    for (int32_t k = 0; k < s; ++k) {
+      const T dr = a0r[k] - a1r[k];
+      const T di = a0i[k] - a1i[k];
+      b0r[k] = a0r[k] + a1r[k];
+      b0i[k] = a0i[k] + a1i[k];
+      b1r[k] = dr * w_re - di * w_im;
+      b1i[k] = dr * w_im + di * w_re;
+    }
+  }
+}
+
+template <typename T>
+void Radix3(int32_t m, int32_t s, const T *tw_re, const T *tw_im, const T *xr, const T *xi, T *yr, T *yi) {
+  const T half = static_cast<T>(0.5);
+  const T sn = static_cast<T>(std::sin(kTwoPi / kRadix3));
+  const int64_t stride = static_cast<int64_t>(s) * m;
+  for (int32_t q = 0; q < m; ++q) {
+    const T w1_re = tw_re[q * (kRadix3 - 1)];
+    const T w1_im = tw_im[q * (kRadix3 - 1)];
+    const T w2_re = tw_re[q * (kRadix3 - 1) + 1];
+    const T w2_im = tw_im[q * (kRadix3 - 1) + 1];
+    const T *a0r = xr + static_cast<int64_t>(s) * q;
+    const T *a0i = xi + static_cast<int64_t>(s) * q;
+    T *b0r = yr + static_cast<int64_t>(s) * kRadix3 * q;
+    T *b0i = yi + static_cast<int64_t>(s) * kRadix3 * q;
+    for (int32_t k = 0; k < s; ++k) {
+      const T tr = a0r[k + stride] + a0r[k + 2 * stride];
+      const T ti = a0i[k + stride] + a0i[k + 2 * stride];
+      const T dr = sn * (a0r[k + stride] - a0r[k + 2 * stride]);
+      const T di = sn * (a0i[k + stride] - a0i[k + 2 * stride]);
+      const T mr = a0r[k] - half * tr;
+      const T mi = a0i[k] - half * ti;
+      b0r[k] = a0r[k] + tr;
+      b0i[k] = a0i[k] + ti;
+      // b1 = m - i * d, b2 = m + i * d
+      const T b1r = mr + di;
+      const T b1i = mi - dr;
+      const T b2r = mr - di;
+      const T b2i = mi + dr;
+      b0r[k + s] = b1r * w1_re - b1i * w1_im;
+      b0i[k + s] = b1r * w1_im + b1i * w1_re;
+      b0r[k + 2 * s] = b2r * w2_re - b2i * w2_im;
+      b0i[k + 2 * s] = b2r * w2_im + b2i * w2_re;
+    }
+  }
+}
+
+template <typename T>
+void Radix4(int32_t m, int32_t s, const T *tw_re, const T *tw_im, const T *xr, const T *xi, T *yr, T *yi) {
+  const int64_t stride = static_cast<int64_t>(s) * m;
+  for (int32_t q = 0; q < m; ++q) {
+    const T *w_re = tw_re + q * (kRadix4 - 1);
+    const T *w_im = tw_im + q * (kRadix4 - 1);
+    const T w1_re = w_re[0];
+    const T w1_im = w_im[0];
+    const T w2_re = w_re[1];
+    const T w2_im = w_im[1];
+    const T w3_re = w_re[2];
+    const T w3_im = w_im[2];
+    const T *a0r = xr + static_cast<int64_t>(s) * q;
+    const T *a0i = xi + static_cast<int64_t>(s) * q;
+    T *b0r = yr + static_cast<int64_t>(s) * kRadix4 * q;
+    T *b0i = yi + static_cast<int64_t>(s) * kRadix4 * q;
+    for (int32_t k = 0; k < s; ++k) {
+      const T t0r = a0r[k] + a0r[k + 2 * stride];
+      const T t0i = a0i[k] + a0i[k + 2 * stride];
+      const T t1r = a0r[k] - a0r[k + 2 * stride];
+      const T t1i = a0i[k] - a0i[k + 2 * stride];
+      const T t2r = a0r[k + stride] + a0r[k + 3 * stride];
+      const T t2i = a0i[k + stride] + a0i[k + 3 * stride];
+      const T t3r = a0r[k + stride] - a0r[k + 3 * stride];
+      const T t3i = a0i[k + stride] - a0i[k + 3 * stride];
+      b0r[k] = t0r + t2r;
+      b0i[k] = t0i + t2i;
+      // b1 = t1 - i * t3, b2 = t0 - t2, b3 = t1 + i * t3
+      const T b1r = t1r + t3i;
+      const T b1i = t1i - t3r;
+      const T b2r = t0r - t2r;
+      const T b2i = t0i - t2i;
+      const T b3r = t1r - t3i;
+      const T b3i = t1i + t3r;
+      b0r[k + s] = b1r * w1_re - b1i * w1_im;
+      b0i[k + s] = b1r * w1_im + b1i * w1_re;
+      b0r[k + 2 * s] = b2r * w2_re - b2i * w2_im;
+      b0i[k + 2 * s] = b2r * w2_im + b2i * w2_re;
+      b0r[k + 3 * s] = b3r * w3_re - b3i * w3_im;
+      b0i[k + 3 * s] = b3r * w3_im + b3i * w3_re;
+    }
+  }
+}
+
+template <typename T>
+void RadixGeneric(int32_t p, int32_t m, int32_t s, const T *tw_re, const T *tw_im, const T *root_re,
+                  const T *root_im, const T *xr, const T *xi, T *yr, T *yi) {
+  const int64_t stride = static_cast<int64_t>(s) * m;
+  for (int32_t q = 0; q < m; ++q) {
+    const T *a0r = xr + static_cast<int64_t>(s) * q;
+    const T *a0i = xi + static_cast<int64_t>(s) * q;
+    T *b0r = yr + static_cast<int64_t>(s) * p * q;
+    T *b0i = yi + static_cast<int64_t>(s) * p * q;
+    for (int32_t r = 0; r < p; ++r) {
+      T *br = b0r + static_cast<int64_t>(s) * r;
+      T *bi = b0i + static_cast<int64_t>(s) * r;
+      for (int32_t k = 0; k < s; ++k) {
+        br[k] = a0r[k];
+        bi[k] = a0i[k];
+      }
+      int32_t idx = 0;
+      for (int32_t j = 1; j < p; ++j) {
+        idx += r;
+        if (idx >= p) {
+          idx -= p;
+        }
+        const T c = root_re[idx];
+        const T d = root_im[idx];
+        const T *ar = a0r + stride * j;
+        const T *ai = a0i + stride * j;
+        for (int32_t k = 0; k < s; ++k) {
+          br[k] += ar[k] * c - ai[k] * d;
+          bi[k] += ar[k] * d + ai[k] * c;
+        }
+      }
+      if (r > 0) {
+        const T w_re = tw_re[q * (p - 1) + r - 1];
+        const T w_im = tw_im[q * (p - 1) + r - 1];
+        for (int32_t k = 0; k < s; ++k) {
+          const T vr = br[k];
+          br[k] = vr * w_re - bi[k] * w_im;
+          bi[k] = vr * w_im + bi[k] * w_re;
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+template <typename T>
+Status RealFftPlan<T>::Get(int32_t n_fft, std::shared_ptr<const RealFftPlan<T>> *plan) {
+  RETURN_UNEXPECTED_IF_NULL(plan);
+  CHECK_FAIL_RETURN_UNEXPECTED(n_fft > 0, "FFT: n_fft must be positive, but got: " + std::to_string(n_fft));
+  static std::mutex mux;
+  static std::unordered_map<int32_t, std::shared_ptr<const RealFftPlan<T>>> plans;
+  std::unique_lock<std::mutex> lock(mux);
+  auto iter = plans.find(n_fft);
+  if (iter == plans.end()) {
+    iter = plans.emplace(n_fft, std::make_shared<const RealFftPlan<T>>(n_fft)).first;
+  }
+  *plan = iter->second;
+  return Status::OK();
+}
+
+template <typename T>
+RealFftPlan<T>::RealFftPlan(int32_t n_fft)
+    : n_fft_(n_fft), n_complex_(n_fft % kRadix2 == 0 ? n_fft / kRadix2 : n_fft) {
+  int32_t n = n_complex_;
+  int32_t s = 1;
+  for (int32_t radix : Factorize(n_complex_)) {
+    Stage stage;
+    stage.radix = radix;
+    stage.m = n / radix;
+    stage.s = s;
+    stage.re.resize(static_cast<size_t>(stage.m) * (radix - 1));
+    stage.im.resize(stage.re.size());
+    for (int32_t q = 0; q < stage.m; ++q) {
+      for (int32_t r = 1; r < radix; ++r) {
+        double angle = -kTwoPi * static_cast<double>(r) * q / n;
+        stage.re[q * (radix - 1) + r - 1] = static_cast<T>(std::cos(angle));
+        stage.im[q * (radix - 1) + r - 1] = static_cast<T>(std::sin(angle));
+      }
+    }
+    if (radix != kRadix2 && radix != kRadix3 && radix != kRadix4) {
+      stage.root_re.resize(radix);
+      stage.root_im.resize(radix);
+      for (int32_t j = 0; j < radix; ++j) {
+        stage.root_re[j] = static_cast<T>(std::cos(-kTwoPi * j / radix));
+        stage.root_im[j] = static_cast<T>(std::sin(-kTwoPi * j / radix));
+      }
+    }
+    stages_.push_back(std::move(stage));
+    n /= radix;
+    s *= radix;
+  }
+  if (n_complex_ != n_fft_) {
+    split_re_.resize(n_complex_ + 1);
+    split_im_.resize(n_complex_ + 1);
+    for (int32_t k = 0; k <= n_complex_; ++k) {
+      split_re_[k] = static_cast<T>(std::cos(-kTwoPi * k / n_fft_));
+      split_im_[k] = static_cast<T>(std::sin(-kTwoPi * k / n_fft_));
+    }
+  }
+}
+
+template <typename T>
+void RealFftPlan<T>::Complex(T *re, T *im, T *scratch_re, T *scratch_im) const {
+  T *xr = re;
+  T *xi = im;
+  T *yr = scratch_re;
+  T *yi = scratch_im;
+  for (const auto &stage : stages_) {
+    const T *tw_re = stage.re.data();
+    const T *tw_im = stage.im.data();
+    switch (stage.radix) {
+      case kRadix2:
+        Radix2(stage.m, stage.s, tw_re, tw_im, xr, xi, yr, yi);
+        break;
+      case kRadix3:
+        Radix3(stage.m, stage.s, tw_re, tw_im, xr, xi, yr, yi);
+        break;
+      case kRadix4:
+        Radix4(stage.m, stage.s, tw_re, tw_im, xr, xi, yr, yi);
+        break;
+      default:
+        RadixGeneric(stage.radix, stage.m, stage.s, tw_re, tw_im, stage.root_re.data(), stage.root_im.data(), xr, xi,
+                     yr, yi);
+        break;
+    }
+    std::swap(xr, yr);
+    std::swap(xi, yi);
+  }
+  if (xr != re) {
+    std::copy(xr, xr + n_complex_, re);
+    std::copy(xi, xi + n_complex_, im);
+  }
+}
+
+template <typename T>
+void RealFftPlan<T>::Forward(const T *input, T *output, int64_t output_stride) const {
+  thread_local std::vector<T> buffer;
+  const size_t n = static_cast<size_t>(n_complex_);
+  if (buffer.size() < n * 4) {
+    buffer.resize(n * 4);
+  }
+  T *re = buffer.data();
+  T *im = re + n;
+  if (n_complex_ == n_fft_) {
+    // odd length, transform as a complex signal with zero imaginary parts
+    std::copy(input, input + n_fft_, re);
+    std::fill(im, im + n, static_cast<T>(0));
+    Complex(re, im, im + n, im + n * 2);
+    for (int32_t k = 0; k < num_bins(); ++k) {
+      output[k * output_stride] = re[k];
+      output[k * output_stride + 1] = im[k];
+    }
+    return;
+  }
+  // the even samples as the real parts and the odd samples as the imaginary parts of a signal of half the length
+  for (int32_t k = 0; k < n_complex_; ++k) {
+    re[k] = input[kRadix2 * k];
+    im[k] = input[kRadix2 * k + 1];
+  }
+  Complex(re, im, im + n, im + n * 2);
+  // X[k] = (Z[k] + conj(Z[n - k])) / 2 - i / 2 * w^k * (Z[k] - conj(Z[n - k])), with w = e^(-2 * pi * i / n_fft)
+  const T half = static_cast<T>(0.5);
+  for (int32_t k = 0; k <= n_complex_; ++k) {
+    const int32_t a = k == n_complex_ ? 0 : k;
+    const int32_t b = k == 0 ? 0 : n_complex_ - k;
+    const T even_re = half * (re[a] + re[b]);
+    const T even_im = half * (im[a] - im[b]);
+    const T odd_re = half * (im[a] + im[b]);
+    const T odd_im = -half * (re[a] - re[b]);
+    output[k * output_stride] = even_re + odd_re * split_re_[k] - odd_im * split_im_[k];
+    output[k * output_stride + 1] = even_im + odd_re * split_im_[k] + odd_im * split_re_[k];
+  }
+}
+
+template class RealFftPlan<float>;
+template class RealFftPlan<double>;
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,82 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_AUDIO_KERNELS_FFT_PLAN_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_AUDIO_KERNELS_FFT_PLAN_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief The precomputed factors and twiddles of the forward FFT of real signals of one length.
+///     A signal of even length is transformed as a complex signal of half the length, whose result is then split
+///     into the spectrum of the real signal. The complex FFT is a mixed-radix Stockham FFT with radix 4, 2 and 3
+///     butterflies and a generic one for the other prime factors. The complex values are held as separate real and
+///     imaginary arrays, so that the butterflies of one stage run over contiguous values and vectorize.
+///     A plan is immutable once created and is shared by all threads through RealFftPlan::Get.
+template <typename T>
+class RealFftPlan {
+ public:
+  /// \brief Get the plan of a length, creating it on the first call.
+  /// \param[in] n_fft The length of the signals.
+  /// \param[out] plan The shared plan.
+  /// \return Status code.
+  static Status Get(int32_t n_fft, std::shared_ptr<const RealFftPlan<T>> *plan);
+
+  /// \brief Constructor, use Get to share the plans.
+  /// \param[in] n_fft The length of the signals, must be positive.
+  explicit RealFftPlan(int32_t n_fft);
+
+  ~RealFftPlan() = default;
+
+  int32_t n_fft() const { return n_fft_; }
+
+  /// \return The number of bins of the spectrum, n_fft / 2 + 1.
+  int32_t num_bins() const { return n_fft_ / 2 + 1; }
+
+  /// \brief Compute the spectrum of a real signal.
+  /// \param[in] input The n_fft samples of the signal.
+  /// \param[out] output The num_bins complex values of the spectrum, each as a pair of real and imaginary parts.
+  /// \param[in] output_stride The distance between the real parts of two consecutive bins in output, 2 if the
+  ///     values are contiguous.
+  void Forward(const T *input, T *output, int64_t output_stride) const;
+
+ private:
+  struct Stage {
+    int32_t radix;
+    int32_t m;               // length of the sub-transforms after the stage
+    int32_t s;               // stride of the stage, the number of sub-transforms before it
+    std::vector<T> re;       // twiddles w^(r*q) for q in [0, m), r in [1, radix)
+    std::vector<T> im;
+    std::vector<T> root_re;  // roots of unity of the radix, only for the generic butterfly
+    std::vector<T> root_im;
+  };
+
+  // Run the complex FFT on re and im, using the scratch arrays of the same length
+  void Complex(T *re, T *im, T *scratch_re, T *scratch_im) const;
+
+  int32_t n_fft_;
+  int32_t n_complex_;        // length of the complex FFT
+  std::vector<Stage> stages_;
+  std::vector<T> split_re_;  // twiddles of the split of the half-length transform, for k in [0, n_complex_]
+  std::vector<T> split_im_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_AUDIO_KERNELS_FFT_PLAN_H_
@@ -67,6 +67,10 @@ ConfigManager::ConfigManager()
       cache_port_ = 0;  // cause the port range validation to generate an error during the validation checks
     }
   }
+  std::string env_cache_embedded = common::GetEnv("MS_CACHE_EMBEDDED");
+  if (!env_cache_embedded.empty()) {
+    embedded_cache_ = env_cache_embedded == "1" || env_cache_embedded == "true" || env_cache_embedded == "True";
+  }
 }
 
 // A print method typically used for debugging
@@ -93,6 +97,14 @@ Status ConfigManager::FromJson(const nlohmann::json &j) {
   set_num_connections(j.value("numConnections", num_connections_));
   set_cache_prefetch_size(j.value("cachePrefetchSize", cache_prefetch_size_));
   set_debug_mode(j.value("debug_mode_flag", debug_mode_flag_));
+  set_mindrecord_mmap(j.value("mindrecord_mmap", mindrecord_mmap_));
+  set_io_prefetch_depth(j.value("io_prefetch_depth", io_prefetch_depth_));
+  set_shuffle_memory_limit(j.value("shuffle_memory_limit", shuffle_memory_limit_));
+  set_shuffle_spill_dir(j.value("shuffle_spill_dir", shuffle_spill_dir_));
+  set_embedded_cache(j.value("embedded_cache", embedded_cache_));
+  set_numa_placement(j.value("numa_placement", numa_placement_));
+  set_autotune_strategy(j.value("autotune_strategy", autotune_strategy_));
+  set_executor_mode(j.value("executor_mode", executor_mode_));
   return Status::OK();
 }
 
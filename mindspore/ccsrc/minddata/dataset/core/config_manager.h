@@ -260,6 +260,21 @@ class ConfigManager {
   // @param interval - autotune interval in steps
   void set_autotune_interval(int64_t interval) { autotune_interval_ = interval; }
 
+  // setter function
+  // @param autotune_strategy - Set how AutoTune chooses the configuration of the pipeline
+  //     (System default = AutoTuneStrategy::kHeuristic)
+  void set_autotune_strategy(const AutoTuneStrategy autotune_strategy) { autotune_strategy_ = autotune_strategy; }
+
+  // getter function
+  // @return - How AutoTune chooses the configuration of the pipeline
+  // @notes This method is used for external configuration API which returns integer type
+  int32_t get_autotune_strategy() const { return static_cast<int32_t>(autotune_strategy_); }
+
+  // getter function
+  // @return - How AutoTune chooses the configuration of the pipeline
+  // @notes This method is used for internal processing, using enum type
+  AutoTuneStrategy autotune_strategy() const { return autotune_strategy_; }
+
   // setter function
   // @param enable - To enable watchdog python thread
   void set_enable_watchdog(bool enable) { enable_watchdog_ = enable; }
@@ -320,6 +335,81 @@ class ConfigManager {
   // @notes This method is used for internal processing, using enum type
   ErrorSamplesMode error_samples_mode() const { return error_samples_mode_; }
 
+  // setter function
+  // @param mindrecord_mmap - Set whether MindRecord data files are mapped into memory, so that blobs are handed to
+  //     the pipeline as tensors which alias the page cache instead of copies (System default = false)
+  void set_mindrecord_mmap(const bool mindrecord_mmap) { mindrecord_mmap_ = mindrecord_mmap; }
+
+  // getter function
+  // @return - Flag to indicate whether MindRecord data files are mapped into memory
+  bool mindrecord_mmap() const { return mindrecord_mmap_; }
+
+  // setter function
+  // @param io_prefetch_depth - Set the number of file reads which source ops keep in flight on background I/O
+  //     threads ahead of the rows being loaded, 0 to read synchronously (System default = 0)
+  void set_io_prefetch_depth(const int32_t io_prefetch_depth) { io_prefetch_depth_ = io_prefetch_depth; }
+
+  // getter function
+  // @return - The number of file reads kept in flight by source ops
+  int32_t io_prefetch_depth() const { return io_prefetch_depth_; }
+
+  // setter function
+  // @param shuffle_memory_limit - Set the number of bytes of rows a shuffle buffer keeps in memory, the rows beyond
+  //     it are spilled to local disk, 0 to keep all rows in memory (System default = 0)
+  void set_shuffle_memory_limit(const uint64_t shuffle_memory_limit) { shuffle_memory_limit_ = shuffle_memory_limit; }
+
+  // getter function
+  // @return - The number of bytes of rows a shuffle buffer keeps in memory
+  uint64_t shuffle_memory_limit() const { return shuffle_memory_limit_; }
+
+  // setter function
+  // @param shuffle_spill_dir - Set the directory of the files holding the spilled rows of the shuffle buffers, empty
+  //     to use the directory given by TMPDIR, or /tmp (System default = "")
+  void set_shuffle_spill_dir(const std::string &shuffle_spill_dir) { shuffle_spill_dir_ = shuffle_spill_dir; }
+
+  // getter function
+  // @return - The directory of the files holding the spilled rows of the shuffle buffers
+  std::string shuffle_spill_dir() const { return shuffle_spill_dir_; }
+
+  // setter function
+  // @param embedded_cache - Set whether dataset caches are kept in shared memory of the host by the pipelines using
+  //     them, instead of by a cache server (System default = false)
+  void set_embedded_cache(const bool embedded_cache) { embedded_cache_ = embedded_cache; }
+
+  // getter function
+  // @return - Whether dataset caches are embedded in the pipelines
+  bool embedded_cache() const { return embedded_cache_; }
+
+  // setter function
+  // @param numa_placement - Set the policy to place the threads of the dataset pipelines on numa nodes
+  //     (System default = NumaPlacement::kNone)
+  void set_numa_placement(const NumaPlacement numa_placement) { numa_placement_ = numa_placement; }
+
+  // getter function
+  // @return - The policy to place the threads of the dataset pipelines on numa nodes
+  // @notes This method is used for external configuration API which returns integer type
+  int32_t get_numa_placement() const { return static_cast<int32_t>(numa_placement_); }
+
+  // getter function
+  // @return - The policy to place the threads of the dataset pipelines on numa nodes
+  // @notes This method is used for internal processing, using enum type
+  NumaPlacement numa_placement() const { return numa_placement_; }
+
+  // setter function
+  // @param executor_mode - Set the mode to execute the threads of the dataset pipelines
+  //     (System default = ExecutorMode::kThreadPerOp)
+  void set_executor_mode(const ExecutorMode executor_mode) { executor_mode_ = executor_mode; }
+
+  // getter function
+  // @return - The mode to execute the threads of the dataset pipelines
+  // @notes This method is used for external configuration API which returns integer type
+  int32_t get_executor_mode() const { return static_cast<int32_t>(executor_mode_); }
+
+  // getter function
+  // @return - The mode to execute the threads of the dataset pipelines
+  // @notes This method is used for internal processing, using enum type
+  ExecutorMode executor_mode() const { return executor_mode_; }
+
  private:
   // Private helper function that takes a nlohmann json format and populates the settings
   // @param j - The json nlohmann json info
@@ -357,6 +447,14 @@ class ConfigManager {
   bool fast_recovery_{true};     // Used for failover scenario to recover quickly or produce same augmentations
   bool debug_mode_flag_{false};  // Indicator for debug mode
   ErrorSamplesMode error_samples_mode_{ErrorSamplesMode::kReturn};  // The method to process erroneous samples
+  bool mindrecord_mmap_{false};  // Read MindRecord blobs from mapped data files without copy
+  int32_t io_prefetch_depth_{0};  // Number of file reads kept in flight by source ops, 0 means disabled
+  uint64_t shuffle_memory_limit_{0};  // Bytes of rows kept in memory by a shuffle buffer, 0 means no limit
+  std::string shuffle_spill_dir_;     // Directory of the spilled rows of the shuffle buffers
+  bool embedded_cache_{false};        // Keep dataset caches in shared memory instead of a cache server
+  NumaPlacement numa_placement_{NumaPlacement::kNone};  // How the threads of a pipeline are placed on numa nodes
+  AutoTuneStrategy autotune_strategy_{AutoTuneStrategy::kHeuristic};  // How AutoTune tunes the pipeline
+  ExecutorMode executor_mode_{ExecutorMode::kThreadPerOp};  // How the threads of a pipeline are executed
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -28,6 +28,9 @@
 #include "minddata/dataset/engine/perf/profiling.h"
 #endif
 #include "minddata/dataset/util/allocator.h"
+#ifndef ENABLE_ANDROID
+#include "minddata/dataset/util/buffer_pool.h"
+#endif
 #include "minddata/dataset/util/system_pool.h"
 
 namespace mindspore {
@@ -56,7 +59,12 @@ GlobalContext *GlobalContext::Instance() {
 
 Status GlobalContext::Init() {
   config_manager_ = std::make_shared<ConfigManager>();
+#ifndef ENABLE_ANDROID
+  // Recycle the buffers of the tensors instead of going to the system for every image and batch
+  mem_pool_ = std::make_shared<BufferPool>();
+#else
   mem_pool_ = std::make_shared<SystemPool>();
+#endif
   // For testing we can use Dummy pool instead
 
   // Create some tensor allocators for the different types and hook them into the pool.
@@ -0,0 +1,62 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/core/string_tensor_builder.h"
+
+#include <limits>
+#include <string>
+
+namespace mindspore {
+namespace dataset {
+void StringTensorBuilder::Truncate(size_t num_items) {
+  if (num_items < ends_.size()) {
+    ends_.resize(num_items);
+    bytes_.resize(num_items == 0 ? 0 : ends_.back());
+  }
+}
+
+Status StringTensorBuilder::Build(const TensorShape &shape, const DataType &type, TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(static_cast<dsize_t>(size()) == shape.NumOfElements(),
+                               "The number of strings: " + std::to_string(size()) +
+                                 " does not match the number of elements: " + std::to_string(shape.NumOfElements()) +
+                                 " the shape required.");
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsString(), "Can not create a numeric Tensor from strings.");
+  *out = std::make_shared<Tensor>(TensorShape({static_cast<dsize_t>(size())}), type);
+  if (!empty()) {
+    // the layout of Tensor::CreateFromVector, the offset array with one extra offset followed by the strings
+    const size_t offsets_size = kOffsetSize * (size() + 1);
+    CHECK_FAIL_RETURN_UNEXPECTED(offsets_size + bytes_.size() <= std::numeric_limits<offset_t>::max(),
+                                 "The strings are too large to be held by a Tensor, total size: " +
+                                   std::to_string(offsets_size + bytes_.size()));
+    RETURN_IF_NOT_OK((*out)->AllocateBuffer(static_cast<dsize_t>(offsets_size + bytes_.size())));
+    auto offset_arr = reinterpret_cast<offset_t *>((*out)->data_);
+    const auto base = static_cast<offset_t>(offsets_size);
+    offset_arr[0] = base;
+    for (size_t i = 0; i < size(); i++) {
+      offset_arr[i + 1] = base + ends_[i];
+    }
+    int ret_code = memcpy_s((*out)->data_ + offsets_size, bytes_.size(), bytes_.data(), bytes_.size());
+    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "Failed to copy strings into Tensor, ret code: " +
+                                                    std::to_string(ret_code) + ".");
+  }
+  Clear();
+  if (shape.known()) {
+    RETURN_IF_NOT_OK((*out)->Reshape(shape));
+  }
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,110 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_CORE_STRING_TENSOR_BUILDER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_CORE_STRING_TENSOR_BUILDER_H_
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "minddata/dataset/core/data_type.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/core/tensor_shape.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief Collects the items of a string tensor in one arena, laid out as the strings of the tensor, so that the
+///     tensor is created with one allocation and one copy instead of one std::string per item.
+///     The builder can be reused once a tensor is built, keeping its capacity.
+class StringTensorBuilder {
+ public:
+  StringTensorBuilder() = default;
+
+  ~StringTensorBuilder() = default;
+
+  /// \brief Reserve the space of a number of items.
+  /// \param[in] num_items The number of items.
+  /// \param[in] num_bytes The total length of the items.
+  void Reserve(size_t num_items, size_t num_bytes) {
+    ends_.reserve(num_items);
+    bytes_.reserve(num_bytes + num_items);
+  }
+
+  /// \brief Append a copy of an item.
+  /// \param[in] item The item, it may point into a tensor or another string which is not kept.
+  void Append(std::string_view item) {
+    (void)bytes_.insert(bytes_.end(), item.begin(), item.end());
+    Terminate();
+  }
+
+  /// \brief Append an item made of a prefix followed by a string.
+  /// \param[in] prefix The prefix of the item.
+  /// \param[in] item The rest of the item.
+  void Append(std::string_view prefix, std::string_view item) {
+    (void)bytes_.insert(bytes_.end(), prefix.begin(), prefix.end());
+    (void)bytes_.insert(bytes_.end(), item.begin(), item.end());
+    Terminate();
+  }
+
+  /// \return The number of items appended.
+  size_t size() const { return ends_.size(); }
+
+  bool empty() const { return ends_.empty(); }
+
+  /// \param[in] index The index of an item, should be less than size().
+  /// \return The item, valid until the next change of the builder.
+  std::string_view operator[](size_t index) const {
+    size_t begin = index == 0 ? 0 : ends_[index - 1];
+    return std::string_view(bytes_.data() + begin, ends_[index] - begin - 1);
+  }
+
+  /// \brief Drop the items after the first ones.
+  /// \param[in] num_items The number of items to keep.
+  void Truncate(size_t num_items);
+
+  /// \brief Drop all the items.
+  void Clear() {
+    bytes_.clear();
+    ends_.clear();
+  }
+
+  /// \brief Create a tensor of the items and clear the builder.
+  /// \param[in] shape The shape of the tensor, its number of elements should be the number of items.
+  /// \param[in] type The type of the tensor, DE_STRING or DE_BYTES.
+  /// \param[out] out The tensor created.
+  /// \return Status code.
+  Status Build(const TensorShape &shape, const DataType &type, TensorPtr *out);
+
+  /// \brief Create a 1-D string tensor of the items and clear the builder.
+  /// \param[out] out The tensor created.
+  /// \return Status code.
+  Status Build(TensorPtr *out) {
+    return Build(TensorShape({static_cast<dsize_t>(size())}), DataType(DataType::DE_STRING), out);
+  }
+
+ private:
+  void Terminate() {
+    bytes_.push_back('\0');
+    ends_.push_back(static_cast<offset_t>(bytes_.size()));
+  }
+
+  std::vector<char> bytes_;  // the items, each followed by a null character
+  std::vector<offset_t> ends_;  // the end of each item in bytes_, past its null character
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_CORE_STRING_TENSOR_BUILDER_H_
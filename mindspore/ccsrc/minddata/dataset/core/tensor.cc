@@ -28,6 +28,7 @@
 #include "minddata/dataset/core/cv_tensor.h"
 #endif
 #include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/core/string_tensor_builder.h"
 #ifdef ENABLE_PYTHON
 #include "minddata/dataset/core/pybind_support.h"
 #endif
@@ -63,7 +64,11 @@ namespace dataset {
 Tensor::Tensor(TensorShape shape, DataType type) : shape_(std::move(shape)), type_(type), data_(nullptr) {}
 
 Tensor::Tensor(Tensor &&other) noexcept
-    : shape_(std::move(other.shape_)), type_(other.type_), data_(other.data_), data_end_(other.data_end_) {
+    : shape_(std::move(other.shape_)),
+      type_(other.type_),
+      data_(other.data_),
+      data_end_(other.data_end_),
+      external_owner_(std::move(other.external_owner_)) {
 #ifdef ENABLE_PYTHON
   if (type_.value() == DataType::DE_PYTHON) {
     py::gil_scoped_acquire gil_acquire;
@@ -85,6 +90,7 @@ Tensor &Tensor::operator=(Tensor &&other) noexcept {
     data_ = other.data_;
     data_end_ = other.data_end_;
     yuv_shape_ = std::move(other.yuv_shape_);
+    external_owner_ = std::move(other.external_owner_);
 #ifdef ENABLE_PYTHON
     if (type_.value() == DataType::DE_PYTHON) {
       py::gil_scoped_acquire gil_acquire;
@@ -151,6 +157,26 @@ Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type,
   return Status::OK();
 }
 
+Status Tensor::CreateFromExternalMemory(const TensorShape &shape, const DataType &type, const uchar *src,
+                                        const dsize_t &length, std::shared_ptr<void> owner, TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsNumeric(), "Failed to create tensor from external memory, data type: " +
+                                                   type.ToString() + " is not numeric.");
+  CHECK_FAIL_RETURN_UNEXPECTED(owner != nullptr, "Failed to create tensor from external memory, owner is null.");
+  *out = std::make_shared<Tensor>(shape, type);
+  CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Allocate memory failed.");
+  dsize_t calculated_length = (*out)->SizeInBytes();
+  CHECK_FAIL_RETURN_UNEXPECTED(calculated_length == length, "Length of source data does not match the shape.");
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_UNEXPECTED_IF_NULL(src);
+  (*out)->external_owner_ = std::move(owner);
+  (*out)->data_ = const_cast<uchar *>(src);
+  (*out)->data_end_ = (*out)->data_ + length;
+  return Status::OK();
+}
+
 Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src, const dsize_t &length,
                                 TensorPtr *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
@@ -458,6 +484,12 @@ Status Tensor::CopyStridedArray(unsigned char *dst, unsigned char *src, std::vec
 // Name: Destructor
 // Description: Destructor
 Tensor::~Tensor() {
+  if (external_owner_ != nullptr) {
+    // the data is released together with its owner
+    data_ = nullptr;
+    data_end_ = nullptr;
+    external_owner_ = nullptr;
+  }
 #ifdef ENABLE_PYTHON
   if (!static_cast<bool>(python_array_)) {  // the data is not np.ndarray from python layer
 #endif
@@ -642,6 +674,7 @@ void Tensor::Invalidate() {
   type_ = DataType(DataType::DE_UNKNOWN);
   data_ = nullptr;
   data_end_ = nullptr;
+  external_owner_ = nullptr;
 #ifdef ENABLE_PYTHON
   if (type_.value() == DataType::DE_PYTHON) {
     py::gil_scoped_acquire gil_acquire;
@@ -1324,17 +1357,17 @@ Status Tensor::SliceString(std::shared_ptr<Tensor> *out, const std::vector<std::
                            const TensorShape &shape) {
   RETURN_UNEXPECTED_IF_NULL(out);
   std::vector<dsize_t> dim_length = shape_.AsVector();
-  std::vector<std::string> strings;
+  // copy the strings straight from this tensor into the one buffer of the slice
+  StringTensorBuilder strings;
+  strings.Reserve(indices.size(), 0);
 
   for (const std::vector<dsize_t> &index : indices) {
     std::vector<dsize_t> cur_index = HandleNegIndices(index, dim_length);
-    dsize_t cur_flat_index;
-    RETURN_IF_NOT_OK(shape_.ToFlatIndex(cur_index, &cur_flat_index));
     std::string_view sv;
     RETURN_IF_NOT_OK(GetItemAt(&sv, {cur_index}));
-    strings.emplace_back(sv);
+    strings.Append(sv);
   }
-  return CreateFromVector(strings, shape, type_, out);
+  return strings.Build(shape, type_, out);
 }
 
 Status Tensor::CreateFromMSTensor(const MSTensor &in, TensorPtr *out) {
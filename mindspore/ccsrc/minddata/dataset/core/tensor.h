@@ -107,6 +107,19 @@ class DATASET_API Tensor {
   static Status CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src,
                                  const dsize_t &length, TensorPtr *out);
 
+  /// Create a numeric tensor which aliases the memory of src instead of copying it, e.g. a page of a mapped file.
+  /// The memory must stay valid as long as owner is alive, the tensor keeps a reference to owner until it is
+  /// destroyed.
+  /// \param[in] shape shape of the output tensor
+  /// \param[in] type type of the output tensor, must be numeric
+  /// \param[in] src pointer to the source data
+  /// \param[in] length length of the src data
+  /// \param[in] owner object which keeps the memory of src alive
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateFromExternalMemory(const TensorShape &shape, const DataType &type, const uchar *src,
+                                         const dsize_t &length, std::shared_ptr<void> owner, TensorPtr *out);
+
   /// Create a copy of the input tensor
   /// \param[in] in original tensor to be copied
   /// \param[out] out output tensor to be generated
@@ -868,8 +881,12 @@ class DATASET_API Tensor {
   py::buffer python_array_;
 #endif
 
+  /// Hold the owner of the external memory which data_ points to without memcpy cost
+  std::shared_ptr<void> external_owner_;
+
  private:
   friend class DETensor;
+  friend class StringTensorBuilder;
 
   /// Slice numeric tensors.
   Status SliceNumeric(TensorPtr *out, const std::vector<std::vector<dsize_t>> &indices, const TensorShape &shape);
@@ -43,7 +43,8 @@ CacheAdminArgHandler::CacheAdminArgHandler()
       memory_cap_ratio_(kDefaultMemoryCapRatio),
       hostname_(kCfgDefaultCacheHost),
       port_(kCfgDefaultCachePort),
-      spill_dir_("") {
+      spill_dir_(""),
+      persist_dir_("") {
   std::string env_cache_host = common::GetEnv("MS_CACHE_HOST");
   std::string env_cache_port = common::GetEnv("MS_CACHE_PORT");
   if (!env_cache_host.empty()) {
@@ -90,6 +91,7 @@ CacheAdminArgHandler::CacheAdminArgHandler()
   arg_map_["--memory_cap_ratio"] = ArgValue::kArgMemoryCapRatio;
   arg_map_["--list_sessions"] = ArgValue::kArgListSessions;
   arg_map_["--server_info"] = ArgValue::kArgServerInfo;
+  arg_map_["--persistdir"] = ArgValue::kArgPersistDir;
   // Initialize argument tracker with false values
   for (int16_t i = 0; i < static_cast<int16_t>(ArgValue::kArgNumArgs); ++i) {
     ArgValue currAV = static_cast<ArgValue>(i);
@@ -322,6 +324,10 @@ Status CacheAdminArgHandler::ParseArgStream(std::stringstream *arg_stream) {
         RETURN_IF_NOT_OK(AssignArg(tok, &spill_dir_, arg_stream));
         break;
       }
+      case ArgValue::kArgPersistDir: {
+        RETURN_IF_NOT_OK(AssignArg(tok, &persist_dir_, arg_stream));
+        break;
+      }
       case ArgValue::kArgSharedMemorySize: {
         RETURN_IF_NOT_OK(AssignArg(tok, &shm_mem_sz_, arg_stream));
         break;
@@ -498,6 +504,10 @@ Status CacheAdminArgHandler::ShowServerInfo() {
   if (spill_dir.empty()) {
     spill_dir = "None";
   }
+  std::string persist_dir = server_cfg_info.persist_dir;
+  if (persist_dir.empty()) {
+    persist_dir = "None";
+  }
 
   int name_w = 20;
   int value_w = 50;
@@ -512,6 +522,7 @@ Status CacheAdminArgHandler::ShowServerInfo() {
   std::cout << std::left << std::setw(name_w) << "log level" << std::setw(value_w) << std::to_string(log_level)
             << std::endl;
   std::cout << std::left << std::setw(name_w) << "spill dir" << std::setw(value_w) << spill_dir << std::endl;
+  std::cout << std::left << std::setw(name_w) << "persist dir" << std::setw(value_w) << persist_dir << std::endl;
   std::cout << std::string(name_w + value_w, '-') << std::endl;
 
   std::cout << "Active sessions: " << std::endl;
@@ -644,7 +655,7 @@ Status CacheAdminArgHandler::StartServer() {
     std::string daemonize_string = "true";
     std::string memory_cap_ratio_string = std::to_string(memory_cap_ratio_);
 
-    char *argv[9];
+    char *argv[10];
     argv[0] = cache_server_binary.data();
     argv[1] = spill_dir_.data();
     argv[2] = workers_string.data();
@@ -653,7 +664,8 @@ Status CacheAdminArgHandler::StartServer() {
     argv[5] = minloglevel_string.data();
     argv[6] = daemonize_string.data();
     argv[7] = memory_cap_ratio_string.data();
-    argv[8] = nullptr;
+    argv[8] = persist_dir_.data();
+    argv[9] = nullptr;
 
     // Now exec the binary
     execv(cache_server_binary.data(), argv);
@@ -673,6 +685,7 @@ void CacheAdminArgHandler::Help() {
   std::cerr << "                [[-w | --workers] <number of workers>]    Default is " << kDefaultNumWorkers << ".\n";
   std::cerr << "                [[-s | --spilldir] <spilling directory>]  Default is no spilling.\n";
   std::cerr << "                [[-l | --loglevel] <log level>]           Default is 1 (INFO level).\n";
+  std::cerr << "                [--persistdir <persistent cache directory>]  Default is no persistence.\n";
   std::cerr << "            [--destroy_session  | -d] <session id>\n";
   std::cerr << "                [[-p | --port] <port number>]\n";
   std::cerr << "            [--generate_session | -g]\n";
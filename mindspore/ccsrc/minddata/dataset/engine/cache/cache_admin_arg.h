@@ -75,7 +75,8 @@ class CacheAdminArgHandler {
     kArgMemoryCapRatio = 12,
     kArgListSessions = 13,
     kArgServerInfo = 14,
-    kArgNumArgs = 15  // Must be the last position to provide a count
+    kArgPersistDir = 15,
+    kArgNumArgs = 16  // Must be the last position to provide a count
   };
 
   Status StartServer();
@@ -107,6 +108,7 @@ class CacheAdminArgHandler {
   std::string hostname_;
   int32_t port_;
   std::string spill_dir_;
+  std::string persist_dir_;
   std::string trailing_args_;
   std::map<std::string, ArgValue> arg_map_;
   std::map<ArgValue, bool> used_args_;
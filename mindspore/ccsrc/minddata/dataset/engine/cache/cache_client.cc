@@ -23,19 +23,27 @@
 namespace mindspore {
 namespace dataset {
 CacheClient::Builder::Builder()
-    : session_id_(0), cache_mem_sz_(0), spill_(false), hostname_(""), port_(0), num_connections_(0), prefetch_size_(0) {
+    : session_id_(0),
+      cache_mem_sz_(0),
+      spill_(false),
+      hostname_(""),
+      port_(0),
+      num_connections_(0),
+      prefetch_size_(0),
+      embedded_(false) {
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
   hostname_ = cfg->cache_host();
   port_ = cfg->cache_port();
   num_connections_ = cfg->num_connections();    // number of async tcp/ip connections
   prefetch_size_ = cfg->cache_prefetch_size();  // prefetch size
+  embedded_ = cfg->embedded_cache();            // no cache server
 }
 
 Status CacheClient::Builder::Build(std::shared_ptr<CacheClient> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
   RETURN_IF_NOT_OK(SanityCheck());
   *out = std::make_shared<CacheClient>(session_id_, cache_mem_sz_, spill_, hostname_, port_, num_connections_,
-                                       prefetch_size_);
+                                       prefetch_size_, embedded_);
   return Status::OK();
 }
 
@@ -44,6 +52,11 @@ Status CacheClient::Builder::SanityCheck() {
   CHECK_FAIL_RETURN_SYNTAX_ERROR(cache_mem_sz_ >= 0, "cache memory size must not be negative (0 implies unlimited).");
   CHECK_FAIL_RETURN_SYNTAX_ERROR(num_connections_ > 0, "number of tcp/ip connections must be positive.");
   CHECK_FAIL_RETURN_SYNTAX_ERROR(prefetch_size_ > 0, "prefetch size must be positive.");
+  if (embedded_) {
+    // There is no cache server to connect to, nor to spill to disk.
+    CHECK_FAIL_RETURN_SYNTAX_ERROR(!spill_, "embedded cache does not support spilling to disk.");
+    return Status::OK();
+  }
   CHECK_FAIL_RETURN_SYNTAX_ERROR(!hostname_.empty(), "hostname must not be empty.");
   CHECK_FAIL_RETURN_SYNTAX_ERROR(port_ >= kMinLegalPort, "Port must be in range (1025..65535).");
   CHECK_FAIL_RETURN_SYNTAX_ERROR(port_ <= kMaxLegalPort, "Port must be in range (1025..65535).");
@@ -54,7 +67,7 @@ Status CacheClient::Builder::SanityCheck() {
 
 // Constructor
 CacheClient::CacheClient(session_id_type session_id, uint64_t cache_mem_sz, bool spill, std::string hostname,
-                         int32_t port, int32_t num_connections, int32_t prefetch_size)
+                         int32_t port, int32_t num_connections, int32_t prefetch_size, bool embedded)
     : cache_mem_sz_(cache_mem_sz),
       spill_(spill),
       server_connection_id_(0),
@@ -62,9 +75,14 @@ CacheClient::CacheClient(session_id_type session_id, uint64_t cache_mem_sz, bool
       local_bypass_(false),
       num_connections_(num_connections),
       prefetch_size_(prefetch_size),
+      embedded_(embedded),
       fetch_all_keys_(true) {
   cinfo_.set_session_id(session_id);
-  comm_ = std::make_shared<CacheClientGreeter>(hostname, port, num_connections_);
+  if (embedded_) {
+    comm_ = std::make_shared<CacheEmbeddedGreeter>();
+  } else {
+    comm_ = std::make_shared<CacheClientGreeter>(hostname, port, num_connections_);
+  }
 }
 
 CacheClient::~CacheClient() {
@@ -101,7 +119,7 @@ void CacheClient::Print(std::ostream &out) const {
       << "\n  Server cache id: " << server_connection_id_ << "\n  Cache mem size: " << GetCacheMemSz()
       << "\n  Spilling: " << std::boolalpha << isSpill() << "\n  Number of rpc workers: " << GetNumConnections()
       << "\n  Prefetch size: " << GetPrefetchSize() << "\n  Local client support: " << std::boolalpha
-      << SupportLocalClient();
+      << SupportLocalClient() << "\n  Embedded: " << std::boolalpha << IsEmbedded();
 }
 
 std::string CacheClient::GetHostname() const { return comm_->GetHostname(); }
@@ -145,7 +163,7 @@ Status CacheClient::GetRows(const std::vector<row_id_type> &row_id, TensorTable
   return rc;
 }
 
-Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id) {
+Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id, const CacheFingerprintFunc &fingerprint_func) {
   UniqueLock lck(&mux_);
   // To create a cache, we identify ourself at the client by:
   // - the shared session id
@@ -198,8 +216,27 @@ Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id) {
     }
     // Start the comm layer to receive reply
     RETURN_IF_NOT_OK(comm_->ServiceStart());
+    // Only fingerprint the pipeline if the server is going to persist the cache. Without a fingerprint the cache
+    // still works, it is just not persisted.
+    CacheFingerprint fingerprint;
+    bool persistent = false;
+    if (fingerprint_func != nullptr && !embedded_) {
+      Status rc = IsPersistent(&persistent);
+      if (rc.IsError()) {
+        MS_LOG(WARNING) << "The cache can not be persisted, failed to get the server config: "
+                        << rc.GetErrDescription();
+      }
+    }
+    if (persistent) {
+      Status rc = fingerprint_func(&fingerprint);
+      if (rc.IsError()) {
+        MS_LOG(WARNING) << "The cache can not be persisted, failed to fingerprint the pipeline: "
+                        << rc.GetErrDescription();
+        fingerprint = {};
+      }
+    }
     // Initiate connection
-    auto rq = std::make_shared<CreateCacheRequest>(this, cinfo_, cache_mem_sz_, createFlag);
+    auto rq = std::make_shared<CreateCacheRequest>(this, cinfo_, cache_mem_sz_, createFlag, fingerprint);
     RETURN_IF_NOT_OK(PushRequest(rq));
     Status rc = rq->Wait();
     bool success = (rc.IsOk() || rc.StatusCode() == StatusCode::kMDDuplicateKey);
@@ -223,6 +260,15 @@ Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id) {
   return Status::OK();
 }
 
+Status CacheClient::IsPersistent(bool *persistent) {
+  RETURN_UNEXPECTED_IF_NULL(persistent);
+  auto rq = std::make_shared<ListSessionsRequest>();
+  RETURN_IF_NOT_OK(PushRequest(rq));
+  RETURN_IF_NOT_OK(rq->Wait());
+  *persistent = !rq->GetServerStat().persist_dir.empty();
+  return Status::OK();
+}
+
 Status CacheClient::DestroyCache() {
   UniqueLock lck(&mux_);
   auto rq = std::make_shared<DestroyCacheRequest>(server_connection_id_);
@@ -30,8 +30,10 @@
 
 #include "minddata/dataset/core/config_manager.h"
 #ifdef ENABLE_CACHE
+#include "minddata/dataset/engine/cache/cache_embedded.h"
 #include "minddata/dataset/engine/cache/cache_grpc_client.h"
 #else
+#include "minddata/dataset/engine/cache/stub/cache_embedded.h"
 #include "minddata/dataset/engine/cache/stub/cache_grpc_client.h"
 #endif
 
@@ -117,6 +119,14 @@ class CacheClient {
       return *this;
     }
 
+    /// Setter function to use an embedded cache in shared memory instead of a cache server
+    /// \param embedded
+    /// \return Builder object itself
+    Builder &SetEmbedded(bool embedded) {
+      embedded_ = embedded;
+      return *this;
+    }
+
     /// Getter functions
     session_id_type GetSessionId() const { return session_id_; }
     uint64_t GetCacheMemSz() const { return cache_mem_sz_; }
@@ -125,6 +135,7 @@ class CacheClient {
     int32_t GetPort() const { return port_; }
     int32_t GetNumConnections() const { return num_connections_; }
     int32_t GetPrefetchSize() const { return prefetch_size_; }
+    bool IsEmbedded() const { return embedded_; }
 
     Status SanityCheck();
 
@@ -138,14 +149,16 @@ class CacheClient {
     int32_t port_;
     int32_t num_connections_;
     int32_t prefetch_size_;
+    bool embedded_;
   };
 
   /// \brief Constructor
   /// \param session_id A user assigned session id for the current pipeline
   /// \param cache_mem_sz Size of the memory set aside for the row caching. 0 for unlimited
   /// \param spill Spill to disk if out of memory
+  /// \param embedded Keep the cache in shared memory of this host instead of a cache server
   CacheClient(session_id_type session_id, uint64_t cache_mem_sz, bool spill, std::string hostname, int32_t port,
-              int32_t num_connections, int32_t prefetch_size);
+              int32_t num_connections, int32_t prefetch_size, bool embedded = false);
 
   /// \brief Destructor
   ~CacheClient();
@@ -166,8 +179,15 @@ class CacheClient {
   /// \brief Create a cache.
   /// \param tree_crc  A crc that was generated during tree prepare phase
   /// \param generate_id Let the cache service generate row id
+  /// \param fingerprint_func Computes the fingerprints of the pipeline cached, to persist the cache across cache
+  ///     servers. It is only called if the server persists the caches.
+  /// \return Status object
+  Status CreateCache(uint32_t tree_crc, bool generate_id, const CacheFingerprintFunc &fingerprint_func = nullptr);
+
+  /// \brief Check whether the cache server saves the caches to a persistent directory.
+  /// \param[out] persistent True if the server was started with a persistent cache directory
   /// \return Status object
-  Status CreateCache(uint32_t tree_crc, bool generate_id);
+  Status IsPersistent(bool *persistent);
 
   /// \brief Destroy a cache. Like Purge but the cache is deleted and can't be reused.
   /// \return Status object
@@ -232,6 +252,7 @@ class CacheClient {
   int32_t GetNumConnections() const { return num_connections_; }
   int32_t GetPrefetchSize() const { return prefetch_size_; }
   int32_t GetClientId() const { return client_id_; }
+  bool IsEmbedded() const { return embedded_; }
   std::string GetHostname() const;
   int32_t GetPort() const;
 
@@ -286,7 +307,8 @@ class CacheClient {
   bool local_bypass_;
   int32_t num_connections_;
   int32_t prefetch_size_;
-  mutable std::shared_ptr<CacheClientGreeter> comm_;
+  bool embedded_;
+  mutable std::shared_ptr<CacheClientComm> comm_;
   std::atomic<bool> fetch_all_keys_;
   WaitPost cache_miss_keys_wp_;
   /// A structure shared by all the prefetchers to know what keys are missing at the server.
@@ -0,0 +1,52 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_CLIENT_COMM_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_CLIENT_COMM_H_
+
+#include <memory>
+#include <string>
+#include "minddata/dataset/engine/cache/cache_request.h"
+#include "minddata/dataset/util/service.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief The comm layer of a CacheClient. It carries a BaseRequest to where the cache lives and posts the reply
+/// back into the request, either the gRPC client of a cache server or an embedded cache in shared memory.
+/// \see CacheClientGreeter
+/// \see CacheEmbeddedGreeter
+class CacheClientComm : public Service {
+ public:
+  ~CacheClientComm() override = default;
+
+  /// \brief Send the request. The reply is ready once BaseRequest::Wait returns.
+  /// \return Status object
+  virtual Status HandleRequest(std::shared_ptr<BaseRequest> rq) = 0;
+
+  /// \brief Attach to the shared memory of a local cache server after a cache is created.
+  /// \param[out] local_bypass Whether rows can be passed through the shared memory of the server.
+  /// \return Status object.
+  virtual Status AttachToSharedMemory(bool *local_bypass) = 0;
+
+  /// \return Base address of the shared memory used for local bypass.
+  virtual const void *SharedMemoryBaseAddr() const = 0;
+
+  virtual std::string GetHostname() const = 0;
+  virtual int32_t GetPort() const = 0;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_CLIENT_COMM_H_
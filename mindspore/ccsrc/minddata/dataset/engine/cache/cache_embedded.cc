@@ -0,0 +1,551 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/cache/cache_embedded.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "minddata/dataset/engine/cache/cache_request.h"
+#include "minddata/dataset/util/bit.h"
+#include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/services.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+uint64_t AlignUp(uint64_t n, uint64_t alignment) { return (n + alignment - 1) / alignment * alignment; }
+
+// Scramble the bits so that consecutive keys, and connection ids differing in the session only, spread out.
+uint64_t Mix(uint64_t x) {
+  x ^= x >> 33u;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33u;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33u;
+  return x;
+}
+}  // namespace
+
+CacheEmbeddedGreeter::CacheEmbeddedGreeter() : base_(nullptr), hdr_(nullptr), creator_(false) {}
+
+CacheEmbeddedGreeter::~CacheEmbeddedGreeter() { (void)ServiceStop(); }
+
+Status CacheEmbeddedGreeter::DoServiceStop() {
+  if (base_ != nullptr) {
+    // The last process to leave gives the memory back.
+    int32_t num_attached = 0;
+    if (mem_.GetNumAttached(&num_attached).IsOk() && num_attached == 1) {
+      RETURN_IF_NOT_OK(mem_.Destroy());
+    }
+    base_ = nullptr;
+    hdr_ = nullptr;
+    RETURN_IF_NOT_OK(mem_.Detach());
+  }
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::AttachToSharedMemory(bool *local_bypass) {
+  RETURN_UNEXPECTED_IF_NULL(local_bypass);
+  *local_bypass = false;
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::HandleRequest(std::shared_ptr<BaseRequest> rq) {
+  RETURN_UNEXPECTED_IF_NULL(rq);
+  // If there is anything extra we need to do before we send.
+  RETURN_IF_NOT_OK(rq->Prepare());
+  CacheRequest *cache_rq = &rq->rq_;
+  CacheReply *reply = &rq->reply_;
+  Status rc;
+  switch (rq->type_) {
+    case BaseRequest::RequestType::kCreateCache:
+      rc = CreateCache(cache_rq, reply);
+      break;
+    case BaseRequest::RequestType::kCacheRow:
+      rc = CacheRow(cache_rq, reply);
+      break;
+    case BaseRequest::RequestType::kBatchFetchRows:
+      rc = BatchFetchRows(cache_rq, reply);
+      break;
+    case BaseRequest::RequestType::kGetStat:
+      rc = CheckConnection(cache_rq);
+      if (rc.IsOk()) {
+        rc = GetStat(reply);
+      }
+      break;
+    case BaseRequest::RequestType::kGetCacheState:
+      rc = CheckConnection(cache_rq);
+      if (rc.IsOk()) {
+        reply->set_result(std::to_string(hdr_->state.load(std::memory_order_acquire)));
+      }
+      break;
+    case BaseRequest::RequestType::kCacheSchema:
+      rc = CacheSchema(cache_rq);
+      break;
+    case BaseRequest::RequestType::kFetchSchema:
+      rc = CheckConnection(cache_rq);
+      if (rc.IsOk()) {
+        rc = FetchSchema(reply);
+      }
+      break;
+    case BaseRequest::RequestType::kBuildPhaseDone:
+      rc = BuildPhaseDone(cache_rq);
+      break;
+    case BaseRequest::RequestType::kToggleWriteMode:
+      rc = ToggleWriteMode(cache_rq);
+      break;
+    case BaseRequest::RequestType::kGetCacheMissKeys:
+      rc = CheckConnection(cache_rq);
+      if (rc.IsOk()) {
+        rc = GetCacheMissKeys(reply);
+      }
+      break;
+    case BaseRequest::RequestType::kDestroyCache:
+      rc = CheckConnection(cache_rq);
+      if (rc.IsOk()) {
+        rc = DestroyCache();
+      }
+      break;
+    case BaseRequest::RequestType::kConnectReset:
+    case BaseRequest::RequestType::kFreeSharedBlock:
+      // Nothing is held on behalf of a client.
+      break;
+    default: {
+      std::string errMsg = "Request type " + std::to_string(static_cast<int16_t>(rq->type_));
+      errMsg += " is not supported by the embedded cache";
+      rc = STATUS_ERROR(StatusCode::kMDUnexpectedError, errMsg);
+      break;
+    }
+  }
+  Status2CacheReply(rc, reply);
+  rq->wp_.Set();
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::CheckConnection(const CacheRequest *rq) const {
+  if (hdr_ == nullptr || rq->connection_id() != hdr_->connection_id) {
+    RETURN_STATUS_UNEXPECTED("Connection " + std::to_string(rq->connection_id()) + " not found");
+  }
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::CreateCache(CacheRequest *rq, CacheReply *reply) {
+  CHECK_FAIL_RETURN_UNEXPECTED(base_ == nullptr, "A cache has been created already");
+  auto session_id = rq->connection_info().session_id();
+  auto crc = rq->connection_info().crc();
+  auto connection_id =
+    (static_cast<connection_id_type>(session_id) << 32u) | static_cast<connection_id_type>(crc);
+  CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing info to create cache");
+  auto p = flatbuffers::GetRoot<CreateCacheRequestMsg>(rq->buf_data(0).data());
+  RETURN_UNEXPECTED_IF_NULL(p);
+  auto flag = static_cast<CreateCacheRequest::CreateCacheFlag>(p->flag());
+  bool generate_id =
+    (flag & CreateCacheRequest::CreateCacheFlag::kGenerateRowId) == CreateCacheRequest::CreateCacheFlag::kGenerateRowId;
+  // cache_mem_sz is in MB unit. 0 means the default size of the shared memory of a cache server.
+  constexpr uint64_t kMB = 1048576L;
+  constexpr uint64_t kGB = 1024 * kMB;
+  uint64_t size = p->cache_mem_sz() > 0 ? p->cache_mem_sz() * kMB : kDefaultSharedMemorySize * kGB;
+  // IPC_PRIVATE is 0 and can't be the key.
+  auto key = static_cast<SharedMemory::shm_key_t>(Mix(connection_id) & 0x7fffffffu);
+  mem_.SetPublicKey(key == 0 ? 1 : key);
+
+  // A segment left by a job which crashed would keep this job waiting forever for the build phase of the dead job to
+  // end. It is removed if no process is attached to it and its creator is gone.
+  bool removed = false;
+  RETURN_IF_NOT_OK(mem_.RemoveIfOrphaned(&removed));
+  if (removed) {
+    MS_LOG(WARNING) << "Removed the shared memory with key " << mem_.GetKey() << " of embedded cache "
+                    << connection_id << " left by a process which has exited.";
+  }
+  // The first process to come creates the segment, the others attach to it.
+  creator_ = false;
+  if (mem_.Attach().IsError()) {
+    Status rc = mem_.Create(static_cast<int64_t>(size));
+    if (rc.IsOk()) {
+      creator_ = true;
+    } else if (mem_.Attach().IsError()) {
+      // Not created by another process in the meantime either.
+      return rc;
+    }
+  }
+  base_ = static_cast<char *>(mem_.SharedMemoryBaseAddr());
+  hdr_ = reinterpret_cast<Header *>(base_);
+  Status rc;
+  if (creator_) {
+    hdr_ = new (base_) Header();
+    hdr_->connection_id = connection_id;
+    hdr_->size = size;
+    uint64_t num_slots = kMinNumSlots;
+    while (num_slots * kBytesPerSlot < size) {
+      num_slots <<= 1u;
+    }
+    hdr_->num_slots = num_slots;
+    hdr_->slots_offset = AlignUp(sizeof(Header), kAlignment);
+    hdr_->data_offset = AlignUp(hdr_->slots_offset + num_slots * sizeof(Slot), kAlignment);
+    hdr_->generate_id = generate_id;
+    std::string cookie = Services::GetUniqueID();
+    (void)cookie.copy(hdr_->cookie, sizeof(hdr_->cookie) - 1);
+    hdr_->min_key.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+    hdr_->max_key.store(-1, std::memory_order_relaxed);
+    hdr_->state.store(static_cast<int8_t>(generate_id ? CacheServiceState::kBuildPhase : CacheServiceState::kNone),
+                      std::memory_order_relaxed);
+    // The segment is zero filled, every slot is free already. Publish the header last.
+    hdr_->magic.store(kMagic, std::memory_order_release);
+  } else {
+    rc = WaitForHeader(connection_id);
+  }
+  if (rc.IsError()) {
+    base_ = nullptr;
+    hdr_ = nullptr;
+    (void)mem_.Detach();
+    return rc;
+  }
+  auto client_id = hdr_->num_clients.fetch_add(1);
+  MS_LOG(INFO) << (creator_ ? "Created" : "Attached to") << " embedded cache " << connection_id << " of "
+               << hdr_->size << " bytes as client " << client_id;
+
+  // Send back the same reply as a cache server, except there is no cpu to bind to.
+  flatbuffers::FlatBufferBuilder fbb;
+  auto off_cookie = fbb.CreateString(creator_ ? std::string(hdr_->cookie) : std::string());
+  auto off_cpu_list = fbb.CreateVector(std::vector<cpu_id_t>());
+  CreateCacheReplyMsgBuilder bld(fbb);
+  bld.add_connection_id(connection_id);
+  bld.add_cookie(off_cookie);
+  bld.add_client_id(client_id);
+  bld.add_cpu_id(off_cpu_list);
+  auto off = bld.Finish();
+  fbb.Finish(off);
+  reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
+  // Like a cache server, only the creator gets the cookie and the others a duplicate key.
+  return creator_ ? Status::OK() : Status(StatusCode::kMDDuplicateKey);
+}
+
+Status CacheEmbeddedGreeter::WaitForHeader(connection_id_type connection_id) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(kAttachTimeoutInSec);
+  while (hdr_->magic.load(std::memory_order_acquire) != kMagic) {
+    CHECK_FAIL_RETURN_UNEXPECTED(std::chrono::steady_clock::now() < deadline,
+                                 "Embedded cache " + std::to_string(connection_id) +
+                                   " is not initialized by its creator, please remove the shared memory with key " +
+                                   std::to_string(mem_.GetKey()) + " using ipcrm -M command");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr_->connection_id == connection_id,
+                               "Shared memory key " + std::to_string(mem_.GetKey()) + " of embedded cache " +
+                                 std::to_string(connection_id) + " is used by embedded cache " +
+                                 std::to_string(hdr_->connection_id));
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::Allocate(const std::vector<ReadableSlice> &buf, uint64_t *offset) {
+  uint64_t sz = 0;
+  for (const auto &piece : buf) {
+    sz += piece.GetSize();
+  }
+  // Each block is prefixed with its size.
+  const uint64_t block_sz = AlignUp(sizeof(uint64_t) + sz, kAlignment);
+  auto off = hdr_->alloc.fetch_add(block_sz, std::memory_order_relaxed);
+  if (off + block_sz > hdr_->size - hdr_->data_offset) {
+    RETURN_STATUS_OOM("Out of memory.");
+  }
+  *offset = hdr_->data_offset + off;
+  char *p = base_ + *offset;
+  *reinterpret_cast<uint64_t *>(p) = sz;
+  WritableSlice all(p + sizeof(uint64_t), sz);
+  uint64_t pos = 0;
+  for (const auto &piece : buf) {
+    WritableSlice dest(all, static_cast<off64_t>(pos), piece.GetSize());
+    RETURN_IF_NOT_OK(WritableSlice::Copy(&dest, piece));
+    pos += piece.GetSize();
+  }
+  return Status::OK();
+}
+
+ReadableSlice CacheEmbeddedGreeter::BlockAt(uint64_t offset) const {
+  auto sz = *reinterpret_cast<const uint64_t *>(base_ + offset);
+  return ReadableSlice(base_ + offset + sizeof(uint64_t), sz);
+}
+
+Status CacheEmbeddedGreeter::Insert(row_id_type key, const std::vector<ReadableSlice> &buf) {
+  // Most duplicates are found before any space is taken.
+  if (Find(key).GetPointer() != nullptr) {
+    return Status(StatusCode::kMDDuplicateKey);
+  }
+  uint64_t offset = 0;
+  RETURN_IF_NOT_OK(Allocate(buf, &offset));
+  const int64_t tag = key + 1;
+  const uint64_t h = Mix(static_cast<uint64_t>(key));
+  for (uint64_t i = 0; i < hdr_->num_slots; ++i) {
+    Slot *slot = SlotAt(h + i);
+    int64_t expected = 0;
+    if (slot->key.compare_exchange_strong(expected, tag, std::memory_order_acq_rel)) {
+      // The row is complete, publish it.
+      slot->offset.store(offset, std::memory_order_release);
+      (void)hdr_->num_rows.fetch_add(1, std::memory_order_relaxed);
+      (void)hdr_->total_bytes.fetch_add(static_cast<int64_t>(BlockAt(offset).GetSize()), std::memory_order_relaxed);
+      auto lo = hdr_->min_key.load(std::memory_order_relaxed);
+      while (key < lo && !hdr_->min_key.compare_exchange_weak(lo, key, std::memory_order_relaxed)) {
+      }
+      auto hi = hdr_->max_key.load(std::memory_order_relaxed);
+      while (key > hi && !hdr_->max_key.compare_exchange_weak(hi, key, std::memory_order_relaxed)) {
+      }
+      return Status::OK();
+    }
+    if (expected == tag) {
+      // Another process cached the same row in the meantime. The space taken is not given back.
+      return Status(StatusCode::kMDDuplicateKey);
+    }
+  }
+  RETURN_STATUS_OOM("Out of memory, the index of the embedded cache is full.");
+}
+
+ReadableSlice CacheEmbeddedGreeter::Find(row_id_type key) const {
+  if (key < 0) {
+    return ReadableSlice();
+  }
+  const int64_t tag = key + 1;
+  const uint64_t h = Mix(static_cast<uint64_t>(key));
+  for (uint64_t i = 0; i < hdr_->num_slots; ++i) {
+    const Slot *slot = SlotAt(h + i);
+    auto k = slot->key.load(std::memory_order_acquire);
+    if (k == 0) {
+      break;
+    }
+    if (k == tag) {
+      // A row being inserted is a miss until it is published.
+      auto offset = slot->offset.load(std::memory_order_acquire);
+      return offset == 0 ? ReadableSlice() : BlockAt(offset);
+    }
+  }
+  return ReadableSlice();
+}
+
+Status CacheEmbeddedGreeter::CacheRow(CacheRequest *rq, CacheReply *reply) {
+  RETURN_IF_NOT_OK(CheckConnection(rq));
+  // First one is cookie, followed by the flatbuffer describing the row and then the buffer of each column.
+  const auto &cookie = rq->buf_data(0);
+  auto state = static_cast<CacheServiceState>(hdr_->state.load(std::memory_order_acquire));
+  if (hdr_->generate_id) {
+    // Only if the cookie matches, we can accept insert into this cache that has a build phase
+    CHECK_FAIL_RETURN_UNEXPECTED(cookie == hdr_->cookie, "Cookie mismatch");
+    CHECK_FAIL_RETURN_UNEXPECTED(state == CacheServiceState::kBuildPhase,
+                                 "Can't accept cache request in non-build phase. Current phase: " +
+                                   std::to_string(static_cast<int>(state)));
+  }
+  if (state == CacheServiceState::kNoLocking) {
+    // The keys missing are known to the clients already, don't change them.
+    RETURN_STATUS_OOM("Out of memory.");
+  }
+  const auto &fb = rq->buf_data(1);
+  auto msg = GetTensorRowHeaderMsg(fb.data());
+  RETURN_UNEXPECTED_IF_NULL(msg);
+  row_id_type row_id;
+  if (hdr_->generate_id) {
+    row_id = hdr_->next_row_id.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    CHECK_FAIL_RETURN_UNEXPECTED(msg->row_id() >= 0, "Expect positive row id: " + std::to_string(msg->row_id()));
+    row_id = msg->row_id();
+  }
+  auto column_hdr = msg->column();
+  RETURN_UNEXPECTED_IF_NULL(column_hdr);
+  // Number of tensor buffer should match the number of columns plus the cookie and the flatbuffer.
+  constexpr int32_t kNumHeaderBuf = 2;
+  CHECK_FAIL_RETURN_UNEXPECTED(rq->buf_data_size() == static_cast<int32_t>(column_hdr->size()) + kNumHeaderBuf,
+                               "Column count does not match. Expect " +
+                                 std::to_string(column_hdr->size() + kNumHeaderBuf) + " but get " +
+                                 std::to_string(rq->buf_data_size()));
+  std::vector<ReadableSlice> all_data;
+  all_data.reserve(column_hdr->size() + 1);
+  all_data.emplace_back(fb.data(), msg->size_of_this());
+  for (uint32_t i = 0; i < column_hdr->size(); ++i) {
+    all_data.emplace_back(rq->buf_data(static_cast<int32_t>(i) + kNumHeaderBuf).data(), msg->data_sz()->Get(i));
+  }
+  Status rc = Insert(row_id, all_data);
+  if (rc == StatusCode::kMDDuplicateKey) {
+    MS_LOG(DEBUG) << "Ignoring duplicate key.";
+  } else if (rc.IsError()) {
+    if (hdr_->generate_id) {
+      // Record the error in the state so other clients can be aware of it.
+      hdr_->state.store(static_cast<int8_t>(CacheServiceState::kOutOfMemory), std::memory_order_release);
+    }
+    return rc;
+  }
+  reply->set_result(std::to_string(row_id));
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::BatchFetchRows(CacheRequest *rq, CacheReply *reply) {
+  RETURN_IF_NOT_OK(CheckConnection(rq));
+  auto state = static_cast<CacheServiceState>(hdr_->state.load(std::memory_order_acquire));
+  if (hdr_->generate_id && state != CacheServiceState::kFetchPhase) {
+    RETURN_STATUS_UNEXPECTED("Can't accept fetch request in non-fetch phase. Current phase: " +
+                             std::to_string(static_cast<int>(state)));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing row id");
+  auto p = flatbuffers::GetRoot<TensorRowIds>(rq->buf_data(0).data());
+  RETURN_UNEXPECTED_IF_NULL(p);
+  const auto num_elements = p->row_id()->size();
+  std::vector<ReadableSlice> rows;
+  rows.reserve(num_elements);
+  // Same layout as a cache server, an offset array followed by the rows. A miss is a row of length 0.
+  int64_t mem_sz = sizeof(int64_t) * (num_elements + 1);
+  for (uint32_t i = 0; i < num_elements; ++i) {
+    rows.push_back(Find(p->row_id()->Get(i)));
+    mem_sz += static_cast<int64_t>(AlignUp(rows.back().GetSize(), kAlignment));
+  }
+  std::string mem;
+  try {
+    mem.resize(mem_sz);
+  } catch (const std::bad_alloc &e) {
+    RETURN_STATUS_OOM("Out of memory.");
+  }
+  WritableSlice all(mem.data(), mem.size());
+  auto *offset_array = reinterpret_cast<int64_t *>(mem.data());
+  offset_array[0] = static_cast<int64_t>(sizeof(int64_t) * (num_elements + 1));
+  for (uint32_t i = 0; i < num_elements; ++i) {
+    const auto &row = rows[i];
+    offset_array[i + 1] = offset_array[i] + static_cast<int64_t>(AlignUp(row.GetSize(), kAlignment));
+    if (row.GetSize() > 0) {
+      WritableSlice dest(all, offset_array[i], row.GetSize());
+      RETURN_IF_NOT_OK(WritableSlice::Copy(&dest, row));
+    }
+  }
+  reply->set_flag(0);
+  reply->set_result(std::move(mem));
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::GetStat(CacheReply *reply) {
+  auto num_rows = hdr_->num_rows.load(std::memory_order_relaxed);
+  int64_t avg_cache_sz = 0;
+  if (num_rows > 0) {
+    // integer arithmetic. NO need to cast to float or double.
+    avg_cache_sz = std::max<int64_t>(hdr_->total_bytes.load(std::memory_order_relaxed) / num_rows, 1);
+  }
+  flatbuffers::FlatBufferBuilder fbb;
+  ServiceStatMsgBuilder bld(fbb);
+  bld.add_num_disk_cached(0);
+  bld.add_num_mem_cached(num_rows);
+  bld.add_avg_cache_sz(avg_cache_sz);
+  bld.add_num_numa_hit(0);
+  bld.add_max_row_id(num_rows > 0 ? hdr_->max_key.load(std::memory_order_relaxed) : -1);
+  bld.add_min_row_id(num_rows > 0 ? hdr_->min_key.load(std::memory_order_relaxed) : -1);
+  bld.add_state(hdr_->state.load(std::memory_order_acquire));
+  auto offset = bld.Finish();
+  fbb.Finish(offset);
+  reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::CacheSchema(CacheRequest *rq) {
+  RETURN_IF_NOT_OK(CheckConnection(rq));
+  CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing schema information");
+  // In case we are calling the same function from multiple processes, only the first one is considered.
+  if (hdr_->schema.load(std::memory_order_acquire) != 0) {
+    MS_LOG(DEBUG) << "Caching Schema already done";
+    return Status::OK();
+  }
+  const auto &schema = rq->buf_data(0);
+  uint64_t offset = 0;
+  RETURN_IF_NOT_OK(Allocate({ReadableSlice(schema.data(), schema.size())}, &offset));
+  uint64_t expected = 0;
+  if (!hdr_->schema.compare_exchange_strong(expected, offset, std::memory_order_acq_rel)) {
+    MS_LOG(DEBUG) << "Caching Schema already done";
+  }
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::FetchSchema(CacheReply *reply) {
+  auto state = static_cast<CacheServiceState>(hdr_->state.load(std::memory_order_acquire));
+  if (state == CacheServiceState::kBuildPhase) {
+    RETURN_STATUS_UNEXPECTED("Can't accept fetch request in non-fetch phase. Current phase: " +
+                             std::to_string(static_cast<int>(state)));
+  }
+  auto offset = hdr_->schema.load(std::memory_order_acquire);
+  if (offset == 0) {
+    RETURN_STATUS_ERROR(StatusCode::kMDFileNotExist, "No schema has been cached");
+  }
+  auto schema = BlockAt(offset);
+  reply->set_result(schema.GetPointer(), schema.GetSize());
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::BuildPhaseDone(CacheRequest *rq) {
+  RETURN_IF_NOT_OK(CheckConnection(rq));
+  CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing cookie");
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr_->generate_id, "Not a cache that has a build phase");
+  // We can only allow to switch phase if the cookie match.
+  CHECK_FAIL_RETURN_UNEXPECTED(rq->buf_data(0) == hdr_->cookie, "Cookie mismatch");
+  hdr_->state.store(static_cast<int8_t>(CacheServiceState::kFetchPhase), std::memory_order_release);
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::ToggleWriteMode(CacheRequest *rq) {
+  RETURN_IF_NOT_OK(CheckConnection(rq));
+  CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing action flag");
+  CHECK_FAIL_RETURN_UNEXPECTED(!hdr_->generate_id, "Not applicable to non-mappable dataset");
+  const auto &action = rq->buf_data(0);
+  auto from = CacheServiceState::kNone;
+  auto to = CacheServiceState::kNoLocking;
+  if (action == "on") {
+    std::swap(from, to);
+  } else if (action != "off") {
+    RETURN_STATUS_UNEXPECTED("Unknown request: " + action);
+  }
+  auto expected = static_cast<int8_t>(from);
+  (void)hdr_->state.compare_exchange_strong(expected, static_cast<int8_t>(to), std::memory_order_acq_rel);
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::GetCacheMissKeys(CacheReply *reply) {
+  std::vector<row_id_type> keys;
+  for (uint64_t i = 0; i < hdr_->num_slots; ++i) {
+    const Slot *slot = SlotAt(i);
+    if (slot->key.load(std::memory_order_acquire) != 0 && slot->offset.load(std::memory_order_acquire) != 0) {
+      keys.push_back(slot->key.load(std::memory_order_relaxed) - 1);
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  // Same as a cache server, the min and max keys followed by the keys missing in between.
+  std::vector<row_id_type> gap;
+  gap.push_back(keys.empty() ? -1 : keys.front());
+  gap.push_back(keys.empty() ? -1 : keys.back());
+  for (size_t i = 1; i < keys.size(); ++i) {
+    for (auto k = keys[i - 1] + 1; k < keys[i]; ++k) {
+      gap.push_back(k);
+    }
+  }
+  flatbuffers::FlatBufferBuilder fbb;
+  auto off_t = fbb.CreateVector(gap);
+  TensorRowIdsBuilder bld(fbb);
+  bld.add_row_id(off_t);
+  auto off = bld.Finish();
+  fbb.Finish(off);
+  reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
+  return Status::OK();
+}
+
+Status CacheEmbeddedGreeter::DestroyCache() {
+  // The segment is removed once every process detaches from it. No one else can attach to it from now on.
+  RETURN_IF_NOT_OK(mem_.Destroy());
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_EMBEDDED_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_EMBEDDED_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "minddata/dataset/engine/cache/cache_client_comm.h"
+#include "minddata/dataset/engine/cache/cache_common.h"
+#include "minddata/dataset/engine/cache/cache_ipc.h"
+#include "minddata/dataset/util/slice.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief An embedded cache which needs no cache server. The rows of a cache are kept in a SysV shared memory segment
+/// keyed by the connection id, i.e. the session id and the crc of the pipeline, so that all the processes of a
+/// data-parallel job on one host which use the same session attach to the same segment and share the rows. Requests
+/// are served synchronously in the calling thread, a fetch is a lookup in the segment with no rpc round-trip.
+///
+/// The segment is laid out as
+///   | header | index slots | rows |
+/// The index is an open addressing hash table which is updated with atomic operations only. A row is copied into
+/// space bump allocated from the segment, then its key claims a free slot and the offset of the row is published
+/// last, so that a reader either sees a complete row or misses. Rows are never removed, the space is given back when
+/// the segment is destroyed by DestroyCache or by the last process detaching from it. A segment left by processes
+/// which crashed is removed by the next process which creates the cache.
+class CacheEmbeddedGreeter : public CacheClientComm {
+ public:
+  constexpr static int32_t kAttachTimeoutInSec = 60;
+  /// \brief The number of bytes of the segment for each slot of the index, i.e. the smallest average row size with
+  /// which the index can be full before the segment is.
+  constexpr static uint64_t kBytesPerSlot = 1024;
+  constexpr static uint64_t kMinNumSlots = 1024;
+
+  CacheEmbeddedGreeter();
+  ~CacheEmbeddedGreeter() override;
+
+  /// Override base Service class
+  Status DoServiceStart() override { return Status::OK(); }
+  Status DoServiceStop() override;
+
+  /// \brief Serve the request in the calling thread. The reply is posted before it returns.
+  /// \return Status object
+  Status HandleRequest(std::shared_ptr<BaseRequest> rq) override;
+
+  /// \brief The rows are already in shared memory, there is no local bypass of a server to set up.
+  /// \return Status object.
+  Status AttachToSharedMemory(bool *local_bypass) override;
+
+  const void *SharedMemoryBaseAddr() const override { return nullptr; }
+
+  std::string GetHostname() const override { return "embedded"; }
+  int32_t GetPort() const override { return 0; }
+
+ private:
+  struct Header {
+    std::atomic<uint64_t> magic;  // stored last by the creator of the segment
+    connection_id_type connection_id;
+    uint64_t size;
+    uint64_t num_slots;
+    uint64_t slots_offset;
+    uint64_t data_offset;
+    bool generate_id;
+    char cookie[64];
+    std::atomic<uint64_t> alloc;  // bytes allocated from data_offset
+    std::atomic<uint64_t> schema;  // offset of the cached schema, 0 if none
+    std::atomic<int64_t> next_row_id;
+    std::atomic<int64_t> num_rows;
+    std::atomic<int64_t> total_bytes;
+    std::atomic<int64_t> min_key;
+    std::atomic<int64_t> max_key;
+    std::atomic<int32_t> num_clients;
+    std::atomic<int8_t> state;
+  };
+
+  struct Slot {
+    std::atomic<int64_t> key;      // key + 1, 0 if the slot is free
+    std::atomic<uint64_t> offset;  // offset of the row, 0 until the row is published
+  };
+
+  constexpr static uint64_t kMagic = 0x4d44454d42434143;  // MDEMBCAC
+  constexpr static uint64_t kAlignment = 8;
+
+  /// \brief Create the segment of a cache or attach to the one created by another process.
+  Status CreateCache(CacheRequest *rq, CacheReply *reply);
+  Status CacheRow(CacheRequest *rq, CacheReply *reply);
+  Status BatchFetchRows(CacheRequest *rq, CacheReply *reply);
+  Status GetStat(CacheReply *reply);
+  Status CacheSchema(CacheRequest *rq);
+  Status FetchSchema(CacheReply *reply);
+  Status BuildPhaseDone(CacheRequest *rq);
+  Status ToggleWriteMode(CacheRequest *rq);
+  Status GetCacheMissKeys(CacheReply *reply);
+  Status DestroyCache();
+
+  /// \brief Wait for the creator of the segment to initialize the header.
+  Status WaitForHeader(connection_id_type connection_id);
+
+  /// \brief Check that a request is for the cache of the segment.
+  Status CheckConnection(const CacheRequest *rq) const;
+
+  /// \brief Copy the pieces of a block into the segment.
+  /// \param[out] offset Offset of the block.
+  /// \return Status object, kMDOutOfMemory if the segment is full.
+  Status Allocate(const std::vector<ReadableSlice> &buf, uint64_t *offset);
+
+  /// \brief Add a row to the index.
+  /// \return Status object, kMDDuplicateKey if the key is cached already, kMDOutOfMemory if the segment is full.
+  Status Insert(row_id_type key, const std::vector<ReadableSlice> &buf);
+
+  /// \return The row of a key, or an empty slice if it is not cached.
+  ReadableSlice Find(row_id_type key) const;
+
+  /// \return The block at an offset of the segment.
+  ReadableSlice BlockAt(uint64_t offset) const;
+
+  Slot *SlotAt(uint64_t i) const {
+    return reinterpret_cast<Slot *>(base_ + hdr_->slots_offset) + (i & (hdr_->num_slots - 1));
+  }
+
+  static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<int64_t>::is_always_lock_free &&
+                  std::atomic<int32_t>::is_always_lock_free && std::atomic<int8_t>::is_always_lock_free,
+                "The index shared between processes needs address-free atomics.");
+
+  SharedMemory mem_;
+  char *base_;
+  Header *hdr_;
+  bool creator_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_EMBEDDED_H_
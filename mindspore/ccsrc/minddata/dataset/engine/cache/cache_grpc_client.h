@@ -22,6 +22,7 @@
 #include <mutex>
 #include <string>
 #include <utility>
+#include "minddata/dataset/engine/cache/cache_client_comm.h"
 #include "minddata/dataset/engine/cache/cache_common.h"
 #include "minddata/dataset/engine/cache/cache_ipc.h"
 #include "minddata/dataset/util/service.h"
@@ -55,14 +56,14 @@ class CacheClientRequestTag {
 
 /// \brief A GRPC layer to convert BaseRequest into protobuf and send to the cache server using gRPC
 /// \see BaseRequest
-class CacheClientGreeter : public Service {
+class CacheClientGreeter : public CacheClientComm {
   friend class CacheClient;
 
  public:
   constexpr static int32_t kRequestTimeoutDeadlineInSec = 60;
   constexpr static int32_t kWaitForNewEventDeadlineInSec = 1;
   explicit CacheClientGreeter(const std::string &hostname, int32_t port, int32_t num_connections);
-  ~CacheClientGreeter();
+  ~CacheClientGreeter() override;
 
   /// Override base Service class
   Status DoServiceStart() override;
@@ -70,7 +71,7 @@ class CacheClientGreeter : public Service {
 
   /// \brief Send the request to the server
   /// \return Status object
-  Status HandleRequest(std::shared_ptr<BaseRequest> rq);
+  Status HandleRequest(std::shared_ptr<BaseRequest> rq) override;
 
   /// \brief A handful of threads will be handling async reply from the server
   /// \return
@@ -82,14 +83,14 @@ class CacheClientGreeter : public Service {
   /// \brief Attach to shared memory for local client
   /// \note Called after we have established a connection.
   /// \return Status object.
-  Status AttachToSharedMemory(bool *local_bypass);
+  Status AttachToSharedMemory(bool *local_bypass) override;
 
   /// \brief This returns where we attach to the shared memory.
   /// \return Base address of the shared memory.
-  const void *SharedMemoryBaseAddr() const { return mem_.SharedMemoryBaseAddr(); }
+  const void *SharedMemoryBaseAddr() const override { return mem_.SharedMemoryBaseAddr(); }
 
-  std::string GetHostname() const { return hostname_; }
-  int32_t GetPort() const { return port_; }
+  std::string GetHostname() const override { return hostname_; }
+  int32_t GetPort() const override { return port_; }
 
  private:
   std::shared_ptr<grpc::Channel> channel_;
@@ -14,7 +14,9 @@
  * limitations under the License.
 */
 #include "minddata/dataset/engine/cache/cache_ipc.h"
+#include <signal.h>
 #include <sys/stat.h>
+#include <cerrno>
 
 namespace mindspore {
 namespace dataset {
@@ -159,5 +161,37 @@ Status SharedMemory::GetNumAttached(int32_t *num) {
   *num = ds.shm_nattch;
   return Status::OK();
 }
+
+Status SharedMemory::RemoveIfOrphaned(bool *removed) {
+  RETURN_UNEXPECTED_IF_NULL(removed);
+  *removed = false;
+  auto id = shmget(shm_key_, 0, 0);
+  if (id == -1) {
+    // Nothing to remove.
+    return Status::OK();
+  }
+  struct shmid_ds ds {};
+  if (shmctl(id, IPC_STAT, &ds) == -1) {
+    // Removed in the meantime.
+    return Status::OK();
+  }
+  // A process which exists but belongs to another user still owns the shared memory.
+  if (ds.shm_nattch > 0 || kill(ds.shm_cpid, 0) == 0 || errno != ESRCH) {
+    return Status::OK();
+  }
+  // Remove it by the id, a shared memory created with the same key by another process in the meantime is kept.
+  if (shmctl(id, IPC_RMID, nullptr) == -1) {
+    if (errno == EINVAL || errno == EIDRM) {
+      // Removed by another process in the meantime.
+      return Status::OK();
+    }
+    std::string errMsg = "Unable to remove orphaned shared memory with id " + std::to_string(id);
+    errMsg += ". Errno :" + std::to_string(errno);
+    errMsg += "\nPlease remove it manually using ipcrm -m command";
+    RETURN_STATUS_UNEXPECTED(errMsg);
+  }
+  *removed = true;
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -191,6 +191,12 @@ class SharedMemory : public BaseIPC {
   /// \return Status object
   Status GetNumAttached(int32_t *num);
 
+  /// \brief Remove the shared memory of the key if no process is attached to it and the process which created it has
+  /// exited, i.e. it is left behind by a process which crashed. It is checked before attaching to the shared memory.
+  /// \param[out] removed True if the shared memory is removed
+  /// \return Status object
+  Status RemoveIfOrphaned(bool *removed);
+
  private:
   shm_id_t shm_id_;
   shm_key_t shm_key_;
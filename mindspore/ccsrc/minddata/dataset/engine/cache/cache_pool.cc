@@ -15,6 +15,9 @@
  */
 #include "minddata/dataset/engine/cache/cache_pool.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "minddata/dataset/engine/cache/cache_server.h"
 #include "minddata/dataset/util/services.h"
 #include "utils/ms_utils.h"
@@ -60,6 +63,7 @@ Status CachePool::DoServiceStop() {
   // release each buffer in the DataLocator one by one.
 
   tree_.reset();
+  snapshot_.reset();
   if (!root_.ToString().empty()) {
     Path spill = GetSpillPath();
     auto it = Path::DirIterator::OpenDirectory(&spill);
@@ -80,6 +84,9 @@ Status CachePool::DoServiceStop() {
 CachePool::~CachePool() noexcept { (void)ServiceStop(); }
 
 Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlice> &buf) {
+  if (snapshot_ != nullptr && snapshot_->Find(key).GetSize() > 0) {
+    RETURN_STATUS_ERROR(StatusCode::kMDDuplicateKey, "Key " + std::to_string(key) + " is in the persistent cache.");
+  }
   DataLocator bl;
   Status rc;
   size_t sz = 0;
@@ -177,12 +184,36 @@ Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *byt
     if (bytesRead != nullptr) {
       *bytesRead = it->sz;
     }
+  } else if (snapshot_ != nullptr && snapshot_->Find(key).GetSize() > 0) {
+    ReadableSlice src = snapshot_->Find(key);
+    RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
+    if (bytesRead != nullptr) {
+      *bytesRead = src.GetSize();
+    }
   } else {
     RETURN_STATUS_UNEXPECTED("Key not found");
   }
   return Status::OK();
 }
 
+Status CachePool::Persist(const Path &file, const CacheSnapshot::Info &info, const std::string &schema) const {
+  std::vector<std::pair<key_type, size_t>> rows;
+  rows.reserve(tree_->size() + (snapshot_ != nullptr ? snapshot_->NumRows() : 0));
+  tree_->LockShared();
+  for (auto it = tree_->begin(); it != tree_->end(); ++it) {
+    rows.emplace_back(it.key(), it.value().sz);
+  }
+  tree_->Unlock();
+  if (snapshot_ != nullptr) {
+    for (size_t i = 0; i < snapshot_->NumRows(); ++i) {
+      rows.emplace_back(snapshot_->KeyAt(i), snapshot_->SizeAt(i));
+    }
+  }
+  // Rows spilled to disk are read back through the StorageManager like any other row.
+  auto read_row = [this](key_type key, WritableSlice *dest) { return Read(key, dest, nullptr); };
+  return CacheSnapshot::Create(file, info, schema, std::move(rows), read_row);
+}
+
 Path CachePool::GetSpillPath() const {
   auto spill = Path(root_) / subfolder_;
   return spill;
@@ -192,7 +223,9 @@ CachePool::CacheStat CachePool::GetStat(bool GetMissingKeys) const {
   tree_->LockShared();  // Prevent any node split while we search.
   CacheStat cs{-1, -1, 0, 0, 0, 0};
   int64_t total_sz = 0;
-  if (tree_->begin() != tree_->end()) {
+  if (snapshot_ != nullptr && snapshot_->NumRows() > 0) {
+    GetStatWithSnapshot(GetMissingKeys, &cs, &total_sz);
+  } else if (tree_->begin() != tree_->end()) {
     cs.min_key = tree_->begin().key();
     cs.max_key = cs.min_key;  // will adjust later.
     for (auto it = tree_->begin(); it != tree_->end(); ++it) {
@@ -227,6 +260,42 @@ CachePool::CacheStat CachePool::GetStat(bool GetMissingKeys) const {
   return cs;
 }
 
+void CachePool::GetStatWithSnapshot(bool GetMissingKeys, CacheStat *cs, int64_t *total_sz) const {
+  // The rows of the snapshot are on disk, mapped into memory on demand. Merge their keys with the keys of the tree.
+  std::vector<key_type> keys;
+  keys.reserve(snapshot_->NumRows() + tree_->size());
+  for (size_t i = 0; i < snapshot_->NumRows(); ++i) {
+    keys.push_back(snapshot_->KeyAt(i));
+    *total_sz += static_cast<int64_t>(snapshot_->SizeAt(i));
+  }
+  cs->num_disk_cached += snapshot_->NumRows();
+  for (auto it = tree_->begin(); it != tree_->end(); ++it) {
+    it.LockShared();
+    keys.push_back(it.key());
+    *total_sz += it.value().sz;
+    if (it.value().ptr != nullptr) {
+      ++cs->num_mem_cached;
+    } else {
+      ++cs->num_disk_cached;
+    }
+    if (it.value().node_hit) {
+      ++cs->num_numa_hit;
+    }
+    it.Unlock();
+  }
+  std::sort(keys.begin(), keys.end());
+  cs->min_key = keys.front();
+  cs->max_key = keys.front();
+  for (auto cur_key : keys) {
+    if (GetMissingKeys) {
+      for (auto i = cs->max_key + 1; i < cur_key; ++i) {
+        cs->gap.push_back(i);
+      }
+    }
+    cs->max_key = cur_key;
+  }
+}
+
 Status CachePool::GetDataLocator(key_type key, const std::shared_ptr<flatbuffers::FlatBufferBuilder> &fbb,
                                  flatbuffers::Offset<DataLocatorMsg> *out) const {
   RETURN_UNEXPECTED_IF_NULL(out);
@@ -240,6 +309,11 @@ Status CachePool::GetDataLocator(key_type key, const std::shared_ptr<flatbuffers
     bld.add_addr(reinterpret_cast<int64_t>(it->ptr));
     auto offset = bld.Finish();
     *out = offset;
+  } else if (snapshot_ != nullptr && snapshot_->Find(key).GetSize() > 0) {
+    // The row is read straight from the mapped file.
+    ReadableSlice src = snapshot_->Find(key);
+    auto offset = CreateDataLocatorMsg(*fbb, key, 0, reinterpret_cast<int64_t>(src.GetPointer()), src.GetSize());
+    *out = offset;
   } else {
     // Key not in the cache.
     auto offset = CreateDataLocatorMsg(*fbb, key, 0, 0, 0);
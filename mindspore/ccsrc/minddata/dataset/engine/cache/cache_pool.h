@@ -23,6 +23,7 @@
 #include <vector>
 #include "minddata/dataset/engine/cache/cache_common.h"
 #include "minddata/dataset/engine/cache/cache_numa.h"
+#include "minddata/dataset/engine/cache/cache_snapshot.h"
 #include "minddata/dataset/engine/cache/storage_manager.h"
 #include "minddata/dataset/util/allocator.h"
 #include "minddata/dataset/util/service.h"
@@ -143,12 +144,33 @@ class CachePool : public Service {
   /// \note Once locking is off. It is user's responsibility to ensure concurrency
   void SetLocking(bool on_off) { tree_->SetLocking(on_off); }
 
+  /// \brief Serve the rows of a persistent cache file on top of the rows inserted. The keys of the snapshot can not
+  /// be inserted again.
+  /// \note Must be called before any insert or read.
+  /// \param[in] snapshot The mapped file.
+  void AttachSnapshot(std::shared_ptr<CacheSnapshot> snapshot) { snapshot_ = std::move(snapshot); }
+
+  /// \return True if rows have been inserted, which are not in a persistent cache file yet.
+  bool HasNewRows() const { return !tree_->empty(); }
+
+  /// \brief Save all the rows, the ones inserted in memory or spilled to disk and the ones of the attached snapshot, to
+  /// a persistent cache file.
+  /// \param[in] file Path of the file.
+  /// \param[in] info Information of the cache.
+  /// \param[in] schema The serialized schema of the cache.
+  /// \return Status object
+  Status Persist(const Path &file, const CacheSnapshot::Info &info, const std::string &schema) const;
+
  private:
+  /// \brief GetStat over the rows of the snapshot and the rows of the tree.
+  void GetStatWithSnapshot(bool GetMissingKeys, CacheStat *cs, int64_t *total_sz) const;
+
   std::shared_ptr<NumaMemoryPool> mp_;
   Path root_;
   const std::string subfolder_;
   std::shared_ptr<StorageManager> sm_;
   std::shared_ptr<data_index> tree_;
+  std::shared_ptr<CacheSnapshot> snapshot_;
   std::atomic<uint64_t> soft_mem_limit_;  // the available memory in the machine
   std::atomic<uint64_t> temp_mem_usage_;  // temporary count on the amount of memory usage by cache every 100Mb (because
                                           // we will adjust soft_mem_limit_ every 100Mb based on this parameter)
@@ -207,8 +207,12 @@ Status BatchFetchRequest::RestoreRows(TensorTable *out, const void *baseAddr, in
 }
 
 CreateCacheRequest::CreateCacheRequest(CacheClient *cc, const CacheClientInfo &cinfo, uint64_t cache_mem_sz,
-                                       CreateCacheRequest::CreateCacheFlag flag)
-    : BaseRequest(RequestType::kCreateCache), cache_mem_sz_(cache_mem_sz), flag_(flag), cc_(cc) {
+                                       CreateCacheRequest::CreateCacheFlag flag, const CacheFingerprint &fingerprint)
+    : BaseRequest(RequestType::kCreateCache),
+      cache_mem_sz_(cache_mem_sz),
+      flag_(flag),
+      fingerprint_(fingerprint),
+      cc_(cc) {
   // Type has been set already in the base constructor. So we need to fill in the connection info.
   // On successful return, we will get the connection id
   rq_.mutable_connection_info()->operator=(cinfo);
@@ -220,6 +224,8 @@ Status CreateCacheRequest::Prepare() {
     CreateCacheRequestMsgBuilder bld(fbb);
     bld.add_cache_mem_sz(cache_mem_sz_);
     bld.add_flag(static_cast<uint32_t>(flag_));
+    bld.add_pipeline_fp(fingerprint_.pipeline);
+    bld.add_source_fp(fingerprint_.source);
     auto off = bld.Finish();
     fbb.Finish(off);
     rq_.add_buf_data(fbb.GetBufferPointer(), fbb.GetSize());
@@ -337,6 +343,12 @@ Status ListSessionsRequest::PostReply() {
   }
   server_cfg_.num_workers = msg->num_workers();
   server_cfg_.log_level = msg->log_level();
+  if (msg->spill_dir() != nullptr) {
+    server_cfg_.spill_dir = msg->spill_dir()->str();
+  }
+  if (msg->persist_dir() != nullptr) {
+    server_cfg_.persist_dir = msg->persist_dir()->str();
+  }
   server_cfg_.spill_dir = msg->spill_dir()->str();
   return Status::OK();
 }
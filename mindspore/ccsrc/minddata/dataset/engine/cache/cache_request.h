@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_REQ_H_
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <iostream>
 #include <string>
@@ -51,6 +52,7 @@ struct CacheServerCfgInfo {
   int32_t num_workers;
   int8_t log_level;
   std::string spill_dir;
+  std::string persist_dir;
 };
 
 /// \brief Info structure ListSessionsRequest
@@ -95,6 +97,7 @@ class BaseRequest {
   friend class CacheServerRequest;
   friend class CacheClientGreeter;
   friend class CacheClientRequestTag;
+  friend class CacheEmbeddedGreeter;
   friend class CacheClient;
   friend class CacheService;
   friend class CacheServerGreeterImpl;
@@ -241,6 +244,18 @@ class BatchFetchRequest : public BaseRequest {
 };
 
 /// \brief Request to create a cache for the current connection
+/// \brief The fingerprints of the pipeline a cache holds the rows of, see Serdes::Fingerprint.
+/// A cache server with a persistent directory saves the cache to a file keyed by the pipeline fingerprint, and
+/// the file is loaded by a later cache of the same pipeline if the source fingerprint still matches.
+struct CacheFingerprint {
+  uint64_t pipeline = 0;  // 0 if the cache is not to be persisted
+  uint64_t source = 0;
+};
+
+/// \brief Computes the fingerprints of the pipeline a cache holds the rows of. It is only called if the cache server
+/// persists the caches, because hashing the pipeline and its source files is not free.
+using CacheFingerprintFunc = std::function<Status(CacheFingerprint *)>;
+
 class CreateCacheRequest : public BaseRequest {
  public:
   friend class CacheServer;
@@ -250,8 +265,9 @@ class CreateCacheRequest : public BaseRequest {
   /// \param connection_id
   /// \param cache_mem_sz Maximum memory assigned for this connection. 0 means unlimited
   /// \param flag Attributes of the cache.
+  /// \param fingerprint Fingerprints of the pipeline cached.
   explicit CreateCacheRequest(CacheClient *cc, const CacheClientInfo &cinfo, uint64_t cache_mem_sz,
-                              CreateCacheFlag flag = CreateCacheFlag::kNone);
+                              CreateCacheFlag flag = CreateCacheFlag::kNone, const CacheFingerprint &fingerprint = {});
   ~CreateCacheRequest() override = default;
 
   /// Overload the base class Prepare/PostReply
@@ -261,6 +277,7 @@ class CreateCacheRequest : public BaseRequest {
  private:
   uint64_t cache_mem_sz_;
   CreateCacheFlag flag_;
+  CacheFingerprint fingerprint_;
   CacheClient *cc_;
 };
 
@@ -205,6 +205,9 @@ Status CacheServer::CreateService(CacheRequest *rq, CacheReply *reply) {
   auto p = flatbuffers::GetRoot<CreateCacheRequestMsg>(create_cache_buf.data());
   auto flag = static_cast<CreateCacheRequest::CreateCacheFlag>(p->flag());
   auto cache_mem_sz = p->cache_mem_sz();
+  // A pipeline that can not be fingerprinted is never persisted.
+  CacheFingerprint fingerprint{p->pipeline_fp(), p->source_fp()};
+  std::string persist_dir = fingerprint.pipeline != 0 ? persist_dir_ : "";
   // We can't do spilling unless this server is setup with a spill path in the first place
   bool spill =
     (flag & CreateCacheRequest::CreateCacheFlag::kSpillToDisk) == CreateCacheRequest::CreateCacheFlag::kSpillToDisk;
@@ -218,6 +221,7 @@ Status CacheServer::CreateService(CacheRequest *rq, CacheReply *reply) {
   // The first create will be successful and be given a special cookie.
   UniqueLock lck(&rwLock_);
   bool duplicate = false;
+  bool loaded = false;
   CacheService *curr_cs = GetService(connection_id);
   if (curr_cs != nullptr) {
     duplicate = true;
@@ -234,9 +238,12 @@ Status CacheServer::CreateService(CacheRequest *rq, CacheReply *reply) {
     RETURN_IF_NOT_OK(GlobalMemoryCheck(cache_mem_sz));
     std::unique_ptr<CacheService> cs;
     try {
-      cs = std::make_unique<CacheService>(cache_mem_sz, spill ? top_ : "", generate_id);
+      cs = std::make_unique<CacheService>(cache_mem_sz, spill ? top_ : "", generate_id, persist_dir, fingerprint);
       RETURN_IF_NOT_OK(cs->ServiceStart());
-      cookie = cs->cookie();
+      // A cache with a build phase loaded from a persistent file is complete already. Like a duplicate request, no
+      // cookie is given so that the client skips the build phase.
+      loaded = cs->HasBuildPhase() && cs->IsLoaded();
+      cookie = loaded ? "" : cs->cookie();
       client_id = cs->num_clients_.fetch_add(1);
       all_caches_.emplace(connection_id, std::move(cs));
     } catch (const std::bad_alloc &e) {
@@ -267,7 +274,7 @@ Status CacheServer::CreateService(CacheRequest *rq, CacheReply *reply) {
   reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
   // We can return OK but we will return a duplicate key so user can act accordingly to either ignore it
   // treat it as OK.
-  return duplicate ? Status(StatusCode::kMDDuplicateKey) : Status::OK();
+  return (duplicate || loaded) ? Status(StatusCode::kMDDuplicateKey) : Status::OK();
 }
 
 Status CacheServer::DestroyCache(CacheRequest *rq) {
@@ -733,12 +740,14 @@ Status CacheServer::ListSessions(CacheReply *reply) {
   }
   flatbuffers::Offset<flatbuffers::String> spill_dir;
   spill_dir = fbb.CreateString(top_);
+  auto persist_dir = fbb.CreateString(persist_dir_);
   auto session_msgs = fbb.CreateVector(session_msgs_vector);
   ListSessionsMsgBuilder s_builder(fbb);
   s_builder.add_sessions(session_msgs);
   s_builder.add_num_workers(num_workers_);
   s_builder.add_log_level(log_level_);
   s_builder.add_spill_dir(spill_dir);
+  s_builder.add_persist_dir(persist_dir);
   auto offset = s_builder.Finish();
   fbb.Finish(offset);
   reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
@@ -1002,8 +1011,9 @@ session_id_type CacheServer::GetSessionID(connection_id_type connection_id) cons
 
 CacheServer::CacheServer(const std::string &spill_path, int32_t num_workers, int32_t port,
                          int32_t shared_meory_sz_in_gb, float memory_cap_ratio, int8_t log_level,
-                         std::shared_ptr<CacheServerHW> hw_info)
+                         const std::string &persist_dir, std::shared_ptr<CacheServerHW> hw_info)
     : top_(spill_path),
+      persist_dir_(persist_dir),
       num_workers_(num_workers),
       num_grpc_workers_(num_workers_),
       port_(port),
@@ -1286,6 +1296,21 @@ Status CacheServer::Builder::SanityCheck() {
       RETURN_STATUS_UNEXPECTED("Spilling directory is not writable\n" + rc.ToString());
     }
   }
+  if (!persist_dir_.empty()) {
+    if (persist_dir_[0] != '/') {
+      RETURN_STATUS_UNEXPECTED("Persistent cache directory must be an absolute path");
+    }
+    // Check if the persistent cache directory is writable
+    Path persist(persist_dir_);
+    auto t = persist / Services::GetUniqueID();
+    Status rc = t.CreateDirectory();
+    if (rc.IsOk()) {
+      rc = t.Remove();
+    }
+    if (rc.IsError()) {
+      RETURN_STATUS_UNEXPECTED("Persistent cache directory is not writable\n" + rc.ToString());
+    }
+  }
   if (memory_cap_ratio_ <= 0 || memory_cap_ratio_ > 1) {
     RETURN_STATUS_UNEXPECTED("Memory cap ratio should be positive and no greater than 1");
   }
@@ -73,6 +73,7 @@ class CacheServer : public Service {
     int32_t GetSharedMemorySzInGb() const { return shared_memory_sz_in_gb_; }
     float GetMemoryCapRatio() const { return memory_cap_ratio_; }
     int8_t GetLogLevel() const { return log_level_; }
+    const std::string &GetPersistDir() const { return persist_dir_; }
 
     Builder &SetRootDirectory(std::string root) {
       top_ = std::move(root);
@@ -98,6 +99,10 @@ class CacheServer : public Service {
       log_level_ = log_level;
       return *this;
     }
+    Builder &SetPersistDirectory(std::string dir) {
+      persist_dir_ = std::move(dir);
+      return *this;
+    }
 
     Status SanityCheck();
 
@@ -108,7 +113,8 @@ class CacheServer : public Service {
           << "Tcp/ip port: " << GetPort() << "\n"
           << "Shared memory size (in GB): " << GetSharedMemorySzInGb() << "\n"
           << "Memory cap ratio: " << GetMemoryCapRatio() << "\n"
-          << "Log level: " << std::to_string(GetLogLevel());
+          << "Log level: " << std::to_string(GetLogLevel()) << "\n"
+          << "Persistent cache directory: " << (GetPersistDir().empty() ? "None" : GetPersistDir());
     }
 
     friend std::ostream &operator<<(std::ostream &out, const Builder &bld) {
@@ -143,7 +149,7 @@ class CacheServer : public Service {
       // We need to bring up the Task Manager by bringing up the Services singleton.
       RETURN_IF_NOT_OK(Services::CreateInstance());
       RETURN_IF_NOT_OK(CacheServer::CreateInstance(top_, num_workers_, port_, shared_memory_sz_in_gb_,
-                                                   memory_cap_ratio_, log_level_, std::move(hw_info_)));
+                                                   memory_cap_ratio_, log_level_, persist_dir_, std::move(hw_info_)));
       return Status(StatusCode::kSuccess, warning_string);
     }
 
@@ -154,6 +160,7 @@ class CacheServer : public Service {
     int32_t shared_memory_sz_in_gb_;
     float memory_cap_ratio_;
     int8_t log_level_;
+    std::string persist_dir_;
     std::shared_ptr<CacheServerHW> hw_info_;
 
     /// \brief Sanity checks on the shared memory.
@@ -174,11 +181,11 @@ class CacheServer : public Service {
 
   static Status CreateInstance(const std::string &spill_path, int32_t num_workers, int32_t port,
                                int32_t shared_memory_sz, float memory_cap_ratio, int8_t log_level,
-                               std::shared_ptr<CacheServerHW> hw_info) {
+                               const std::string &persist_dir, std::shared_ptr<CacheServerHW> hw_info) {
     std::call_once(init_instance_flag_, [&]() -> Status {
       auto &SvcManager = Services::GetInstance();
       RETURN_IF_NOT_OK(SvcManager.AddHook(&instance_, spill_path, num_workers, port, shared_memory_sz, memory_cap_ratio,
-                                          log_level, hw_info));
+                                          log_level, persist_dir, hw_info));
       return Status::OK();
     });
     return Status::OK();
@@ -281,6 +288,7 @@ class CacheServer : public Service {
   mutable RWLock rwLock_;
   mutable RWLock sessions_lock_;
   std::string top_;
+  std::string persist_dir_;
   cache_index all_caches_;
   std::set<session_id_type> active_sessions_;
   std::shared_ptr<QueueList<CacheServerRequest *>> cache_q_;
@@ -302,8 +310,10 @@ class CacheServer : public Service {
   /// \brief Constructor
   /// \param spill_path Top directory for spilling buffers to.
   /// \param num_workers Number of threads for handling requests.
+  /// \param persist_dir Directory of the persistent cache files. Empty string means caches are not persisted.
   explicit CacheServer(const std::string &spill_path, int32_t num_workers, int32_t port, int32_t share_memory_sz_in_gb,
-                       float memory_cap_ratio, int8_t log_level, std::shared_ptr<CacheServerHW> hw_info);
+                       float memory_cap_ratio, int8_t log_level, const std::string &persist_dir,
+                       std::shared_ptr<CacheServerHW> hw_info);
 
   /// \brief Locate a cache service from connection id.
   /// \return Pointer to cache service. Null if not found
@@ -22,14 +22,18 @@
 
 namespace mindspore {
 namespace dataset {
-CacheService::CacheService(uint64_t mem_sz, const std::string &root, bool generate_id)
+CacheService::CacheService(uint64_t mem_sz, const std::string &root, bool generate_id, const std::string &persist_dir,
+                           const CacheFingerprint &fingerprint)
     : root_(root),
       cache_mem_sz_(mem_sz * 1048576L),  // mem_sz is in MB unit
       cp_(nullptr),
       next_id_(0),
       generate_id_(generate_id),
       num_clients_(0),
-      st_(generate_id ? CacheServiceState::kBuildPhase : CacheServiceState::kNone) {}
+      st_(generate_id ? CacheServiceState::kBuildPhase : CacheServiceState::kNone),
+      persist_dir_(persist_dir),
+      fingerprint_(fingerprint),
+      loaded_(false) {}
 
 CacheService::~CacheService() { (void)ServiceStop(); }
 
@@ -57,16 +61,55 @@ Status CacheService::DoServiceStart() {
   RETURN_IF_NOT_OK(cp_->ServiceStart());
   // Assign a name to this cache. Used for exclusive connection. But we can just use CachePool's name.
   cookie_ = cp_->MyName();
+  if (!persist_dir_.empty()) {
+    Status rc = LoadSnapshot();
+    if (rc.IsError() && rc != StatusCode::kMDFileNotExist) {
+      // Not fatal, the cache is simply built again and the file replaced once it is done.
+      MS_LOG(WARNING) << "The persistent cache can not be used, the cache will be built again. " << rc.ToString();
+    }
+  }
   return Status::OK();
 }
 
 Status CacheService::DoServiceStop() {
   if (cp_ != nullptr) {
+    if (!persist_dir_.empty()) {
+      Status rc = SaveSnapshot();
+      if (rc.IsError()) {
+        MS_LOG(WARNING) << "Failed to save the persistent cache. " << rc.ToString();
+      }
+    }
     RETURN_IF_NOT_OK(cp_->ServiceStop());
   }
   return Status::OK();
 }
 
+Status CacheService::LoadSnapshot() {
+  std::shared_ptr<CacheSnapshot> snapshot;
+  CacheSnapshot::Info info{fingerprint_, generate_id_};
+  RETURN_IF_NOT_OK(CacheSnapshot::Open(CacheSnapshot::FileOf(persist_dir_, fingerprint_), info, &snapshot));
+  schema_ = snapshot->GetSchema();
+  if (generate_id_) {
+    // Only a complete cache is saved, which needs no build phase. Row ids of the snapshot are 0, 1, ..., n - 1.
+    next_id_ = static_cast<row_id_type>(snapshot->NumRows());
+    st_ = CacheServiceState::kFetchPhase;
+  }
+  MS_LOG(INFO) << "Cache of " << snapshot->NumRows() << " rows is loaded from " << snapshot->GetPath();
+  cp_->AttachSnapshot(std::move(snapshot));
+  loaded_ = true;
+  return Status::OK();
+}
+
+Status CacheService::SaveSnapshot() {
+  // Nothing to save if no row is added to the cache loaded, or if the build phase never completes, in which case
+  // some rows are missing and a later job would take the cache as a complete one.
+  if (!cp_->HasNewRows() || schema_.empty() || (generate_id_ && st_ != CacheServiceState::kFetchPhase)) {
+    return Status::OK();
+  }
+  CacheSnapshot::Info info{fingerprint_, generate_id_};
+  return cp_->Persist(CacheSnapshot::FileOf(persist_dir_, fingerprint_), info, schema_);
+}
+
 Status CacheService::CacheRow(const std::vector<const void *> &buf, row_id_type *row_id_generated) {
   SharedLock rw(&rw_lock_);
   RETURN_UNEXPECTED_IF_NULL(row_id_generated);
@@ -203,6 +246,12 @@ std::ostream &operator<<(std::ostream &out, const CacheService &cs) {
   } else {
     out << cs.GetSpillPath();
   }
+  out << "\nPersistent cache file: ";
+  if (cs.persist_dir_.empty()) {
+    out << "None";
+  } else {
+    out << CacheSnapshot::FileOf(cs.persist_dir_, cs.fingerprint_);
+  }
   return out;
 }
 
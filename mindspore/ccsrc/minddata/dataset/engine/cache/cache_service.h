@@ -49,7 +49,10 @@ class CacheService : public Service {
   /// \param root Spill path. Empty string means no spilling
   /// \param generate_id If the cache service should generate row id for buffer that is cached.
   /// For non-mappable dataset, this should be set to true.
-  CacheService(uint64_t mem_sz, const std::string &root, bool generate_id);
+  /// \param persist_dir Directory of the persistent cache files. Empty string means the cache is not persisted
+  /// \param fingerprint The fingerprints of the pipeline, which name the persistent cache file
+  CacheService(uint64_t mem_sz, const std::string &root, bool generate_id, const std::string &persist_dir = "",
+               const CacheFingerprint &fingerprint = {});
   ~CacheService() override;
 
   Status DoServiceStart() override;
@@ -123,6 +126,8 @@ class CacheService : public Service {
   Status BuildPhaseDone();
   /// \brief For kToggleWriteMode request
   Status ToggleWriteMode(bool on_off);
+  /// \return True if the rows of this cache are loaded from a persistent cache file.
+  bool IsLoaded() const { return loaded_; }
 
  private:
   mutable RWLock rw_lock_;
@@ -136,6 +141,9 @@ class CacheService : public Service {
   std::atomic<CacheServiceState> st_;
   std::string schema_;
   std::shared_ptr<NumaMemoryPool> numa_pool_;
+  std::string persist_dir_;
+  CacheFingerprint fingerprint_;
+  bool loaded_;
   // We also cache the result from calling FindKeysMiss because it is expensive. Besides user make
   // this request after we hit memory full or disk full. So the result is unlikely to change.
   std::mutex get_key_miss_mux_;
@@ -145,6 +153,14 @@ class CacheService : public Service {
   row_id_type GetNextRowId() { return next_id_.fetch_add(1); }
 
   Status InternalFetchRow(const FetchRowMsg *p);
+
+  /// \brief Serve the rows of the persistent cache file of the pipeline if there is a valid one.
+  /// \return Status object
+  Status LoadSnapshot();
+
+  /// \brief Save the rows to the persistent cache file of the pipeline if there are new ones.
+  /// \return Status object
+  Status SaveSnapshot();
 };
 }  // namespace dataset
 }  // namespace mindspore
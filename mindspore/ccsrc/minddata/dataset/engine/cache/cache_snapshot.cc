@@ -0,0 +1,243 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/cache/cache_snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/services.h"
+#include "utils/system/crc32c.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+uint64_t AlignUp(uint64_t n, uint64_t alignment) { return (n + alignment - 1) / alignment * alignment; }
+
+// Write the whole buffer at the current position of the file, retrying on partial writes.
+Status WriteAll(int fd, const void *buf, size_t sz) {
+  auto p = static_cast<const char *>(buf);
+  while (sz > 0) {
+    auto n = write(fd, p, sz);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      if (errno == ENOSPC) {
+        RETURN_STATUS_ERROR(StatusCode::kMDNoSpace, "no space left.");
+      }
+      RETURN_STATUS_UNEXPECTED(strerror(errno));
+    }
+    p += n;
+    sz -= static_cast<size_t>(n);
+  }
+  return Status::OK();
+}
+
+Status WritePadding(int fd, uint64_t *pos, uint64_t alignment) {
+  static const char zeros[4096] = {0};
+  uint64_t end = AlignUp(*pos, alignment);
+  while (*pos < end) {
+    auto n = std::min<uint64_t>(end - *pos, sizeof(zeros));
+    RETURN_IF_NOT_OK(WriteAll(fd, zeros, n));
+    *pos += n;
+  }
+  return Status::OK();
+}
+}  // namespace
+
+CacheSnapshot::CacheSnapshot(Path file, const char *base, size_t file_size)
+    : file_(std::move(file)),
+      base_(base),
+      file_size_(file_size),
+      num_rows_(0),
+      schema_offset_(0),
+      schema_size_(0),
+      index_(nullptr) {}
+
+CacheSnapshot::~CacheSnapshot() {
+  if (base_ != nullptr) {
+    (void)munmap(const_cast<char *>(base_), file_size_);
+    base_ = nullptr;
+  }
+}
+
+Path CacheSnapshot::FileOf(const std::string &dir, const CacheFingerprint &fingerprint) {
+  std::ostringstream oss;
+  oss << std::hex << std::setfill('0') << std::setw(16) << fingerprint.pipeline << ".mdcache";
+  return Path(dir) / oss.str();
+}
+
+uint32_t CacheSnapshot::Checksum(const char *schema, size_t schema_size, const char *index, size_t index_size) {
+  uint32_t crc = system::Crc32c::MakeCrc32c(0, schema, schema_size);
+  return system::Crc32c::MakeCrc32c(crc, index, index_size);
+}
+
+Status CacheSnapshot::Create(const Path &file, const Info &info, const std::string &schema,
+                             std::vector<std::pair<key_type, size_t>> rows, const RowReader &read_row) {
+  std::sort(rows.begin(), rows.end());
+  // Lay out the file before writing anything
+  Header hdr{};
+  (void)std::copy(std::begin(kMagic), std::end(kMagic), hdr.magic);
+  hdr.version = kVersion;
+  hdr.header_size = sizeof(Header);
+  hdr.pipeline_fp = info.fingerprint.pipeline;
+  hdr.source_fp = info.fingerprint.source;
+  hdr.flags = info.generate_id ? kGenerateRowId : 0;
+  hdr.num_rows = rows.size();
+  hdr.schema_offset = sizeof(Header);
+  hdr.schema_size = schema.size();
+  hdr.index_offset = AlignUp(hdr.schema_offset + hdr.schema_size, kRowAlignment);
+  hdr.data_offset = AlignUp(hdr.index_offset + rows.size() * sizeof(IndexEntry), kDataAlignment);
+  std::vector<IndexEntry> index;
+  index.reserve(rows.size());
+  uint64_t pos = hdr.data_offset;
+  size_t max_row_size = 0;
+  for (const auto &[key, sz] : rows) {
+    index.push_back({key, pos, sz});
+    pos = AlignUp(pos + sz, kRowAlignment);
+    max_row_size = std::max(max_row_size, sz);
+  }
+  hdr.file_size = pos;
+  hdr.checksum = Checksum(schema.data(), schema.size(), reinterpret_cast<const char *>(index.data()),
+                          index.size() * sizeof(IndexEntry));
+
+  Path tmp(file.ToString() + "." + Services::GetUniqueID() + ".tmp");
+  int fd = -1;
+  RETURN_IF_NOT_OK(tmp.CreateFile(&fd));
+  auto write_file = [&]() -> Status {
+    RETURN_IF_NOT_OK(WriteAll(fd, &hdr, sizeof(hdr)));
+    RETURN_IF_NOT_OK(WriteAll(fd, schema.data(), schema.size()));
+    pos = hdr.schema_offset + hdr.schema_size;
+    RETURN_IF_NOT_OK(WritePadding(fd, &pos, kRowAlignment));
+    RETURN_IF_NOT_OK(WriteAll(fd, index.data(), index.size() * sizeof(IndexEntry)));
+    pos += index.size() * sizeof(IndexEntry);
+    RETURN_IF_NOT_OK(WritePadding(fd, &pos, kDataAlignment));
+    std::vector<char> buf(max_row_size);
+    for (const auto &entry : index) {
+      WritableSlice dest(buf.data(), entry.size);
+      RETURN_IF_NOT_OK(read_row(entry.key, &dest));
+      RETURN_IF_NOT_OK(WriteAll(fd, buf.data(), entry.size));
+      pos += entry.size;
+      RETURN_IF_NOT_OK(WritePadding(fd, &pos, kRowAlignment));
+    }
+    if (fsync(fd) != 0) {
+      RETURN_STATUS_UNEXPECTED(strerror(errno));
+    }
+    return Status::OK();
+  };
+  Status rc = write_file();
+  Status rc_close = tmp.CloseFile(fd);
+  if (rc.IsOk()) {
+    rc = rc_close;
+  }
+  if (rc.IsOk() && rename(tmp.ToString().c_str(), file.ToString().c_str()) != 0) {
+    rc = STATUS_ERROR(StatusCode::kMDUnexpectedError, strerror(errno));
+  }
+  if (rc.IsError()) {
+    (void)tmp.Remove();
+    return rc;
+  }
+  MS_LOG(INFO) << "Cache of " << rows.size() << " rows is saved to " << file << ", " << hdr.file_size << " bytes.";
+  return Status::OK();
+}
+
+Status CacheSnapshot::Open(const Path &file, const Info &info, std::shared_ptr<CacheSnapshot> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  int fd = open(file.ToString().c_str(), O_RDONLY);
+  if (fd < 0) {
+    if (errno == ENOENT) {
+      RETURN_STATUS_ERROR(StatusCode::kMDFileNotExist, "No persistent cache file " + file.ToString());
+    }
+    RETURN_STATUS_UNEXPECTED("Failed to open persistent cache file " + file.ToString() + ": " + strerror(errno));
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED("Persistent cache file " + file.ToString() + " is truncated");
+  }
+  auto file_size = static_cast<size_t>(st.st_size);
+  void *base = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping stays valid once the file is closed, or even replaced by a newer snapshot.
+  (void)close(fd);
+  if (base == MAP_FAILED) {
+    RETURN_STATUS_UNEXPECTED("Failed to map persistent cache file " + file.ToString() + ": " + strerror(errno));
+  }
+  std::shared_ptr<CacheSnapshot> snapshot(new CacheSnapshot(file, static_cast<const char *>(base), file_size));
+  RETURN_IF_NOT_OK(snapshot->Validate(info));
+  *out = std::move(snapshot);
+  return Status::OK();
+}
+
+Status CacheSnapshot::Validate(const Info &info) {
+  const std::string name = file_.ToString();
+  auto hdr = reinterpret_cast<const Header *>(base_);
+  CHECK_FAIL_RETURN_UNEXPECTED(std::equal(std::begin(kMagic), std::end(kMagic), hdr->magic),
+                               name + " is not a persistent cache file");
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr->version == kVersion && hdr->header_size == sizeof(Header),
+                               name + " is of another version of persistent cache files");
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr->file_size == file_size_, name + " is truncated");
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr->data_offset <= file_size_ && hdr->index_offset <= hdr->data_offset &&
+                                 hdr->schema_offset <= hdr->index_offset &&
+                                 hdr->schema_size <= hdr->index_offset - hdr->schema_offset &&
+                                 hdr->num_rows <= (hdr->data_offset - hdr->index_offset) / sizeof(IndexEntry) &&
+                                 hdr->index_offset % kRowAlignment == 0,
+                               name + " is corrupted, the sections are out of the file");
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr->checksum == Checksum(base_ + hdr->schema_offset, hdr->schema_size,
+                                                         base_ + hdr->index_offset,
+                                                         hdr->num_rows * sizeof(IndexEntry)),
+                               name + " is corrupted, checksum mismatch");
+  // A snapshot of another pipeline with the same fingerprint, of the same pipeline over files changed since, or of
+  // another kind of cache can not be used.
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr->pipeline_fp == info.fingerprint.pipeline,
+                               name + " is the cache of another pipeline");
+  CHECK_FAIL_RETURN_UNEXPECTED(hdr->source_fp == info.fingerprint.source,
+                               name + " is stale, the dataset files have changed since it was saved");
+  CHECK_FAIL_RETURN_UNEXPECTED(((hdr->flags & kGenerateRowId) != 0) == info.generate_id,
+                               name + " is the cache of another kind of dataset");
+  num_rows_ = static_cast<size_t>(hdr->num_rows);
+  schema_offset_ = static_cast<size_t>(hdr->schema_offset);
+  schema_size_ = static_cast<size_t>(hdr->schema_size);
+  index_ = reinterpret_cast<const IndexEntry *>(base_ + hdr->index_offset);
+  for (size_t i = 0; i < num_rows_; ++i) {
+    const IndexEntry &entry = index_[i];
+    CHECK_FAIL_RETURN_UNEXPECTED(entry.offset >= hdr->data_offset && entry.offset <= file_size_ &&
+                                   entry.size <= file_size_ - entry.offset &&
+                                   (i == 0 || index_[i - 1].key < entry.key),
+                                 name + " is corrupted, bad row " + std::to_string(i));
+  }
+  return Status::OK();
+}
+
+ReadableSlice CacheSnapshot::Find(key_type key) const {
+  auto it = std::lower_bound(index_, index_ + num_rows_, key,
+                             [](const IndexEntry &entry, key_type k) { return entry.key < k; });
+  if (it == index_ + num_rows_ || it->key != key) {
+    return ReadableSlice();
+  }
+  return ReadableSlice(base_ + it->offset, it->size);
+}
+}  // namespace dataset
+}  // namespace mindspore
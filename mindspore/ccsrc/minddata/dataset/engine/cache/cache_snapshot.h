@@ -0,0 +1,147 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_SNAPSHOT_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/engine/cache/cache_request.h"
+#include "minddata/dataset/util/path.h"
+#include "minddata/dataset/util/slice.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A CacheSnapshot is a file holding all the rows of a cache, which a cache server of a later job maps
+/// read-only instead of building the cache again. Many servers on the same host can map the same file and share its
+/// pages. The file is used in place, all its integers are in the byte order of the host:
+///   | header | schema | index of the rows sorted by key | padding to a page | rows, each aligned to 8 bytes |
+/// The header records the fingerprints of the pipeline, which are checked when the file is opened so that a file of
+/// another pipeline, or of the same pipeline over data that has changed since, is never used.
+class CacheSnapshot {
+ public:
+  using key_type = int64_t;
+  /// \brief Bump it on any change of the layout, files of other versions are rebuilt
+  constexpr static uint32_t kVersion = 1;
+
+  /// \brief What a cache expects of its snapshot
+  struct Info {
+    CacheFingerprint fingerprint;
+    bool generate_id;  // the cache of a non-mappable dataset, which has a build phase
+  };
+
+  /// \brief Read the whole row of a key into a buffer of its size
+  using RowReader = std::function<Status(key_type key, WritableSlice *dest)>;
+
+  CacheSnapshot(const CacheSnapshot &) = delete;
+  CacheSnapshot &operator=(const CacheSnapshot &) = delete;
+  ~CacheSnapshot();
+
+  /// \brief Get the file of the snapshot of a pipeline.
+  /// \param[in] dir The persistent directory of the cache server.
+  /// \param[in] fingerprint The fingerprints of the pipeline.
+  /// \return Path of the file.
+  static Path FileOf(const std::string &dir, const CacheFingerprint &fingerprint);
+
+  /// \brief Write a snapshot file. The file is written under a temporary name and then renamed, so that a
+  /// snapshot is either complete or absent, and servers still mapping the previous file are not affected.
+  /// \param[in] file Path of the file.
+  /// \param[in] info Information of the cache, written to the header.
+  /// \param[in] schema The serialized schema of the cache.
+  /// \param[in] rows The key and size of each row.
+  /// \param[in] read_row Function to read a row.
+  /// \return Status object
+  static Status Create(const Path &file, const Info &info, const std::string &schema,
+                       std::vector<std::pair<key_type, size_t>> rows, const RowReader &read_row);
+
+  /// \brief Map a snapshot file and validate it.
+  /// \param[in] file Path of the file.
+  /// \param[in] info Information of the cache, which should match the header.
+  /// \param[out] out The snapshot.
+  /// \return Status object, kMDFileNotExist if there is no file, or an error if the file is not a valid snapshot of
+  ///     the cache, in which case the cache should be built again.
+  static Status Open(const Path &file, const Info &info, std::shared_ptr<CacheSnapshot> *out);
+
+  /// \return The number of rows.
+  size_t NumRows() const { return num_rows_; }
+
+  /// \return The key of a row, the keys are in ascending order.
+  key_type KeyAt(size_t i) const { return index_[i].key; }
+
+  /// \return The size of a row.
+  size_t SizeAt(size_t i) const { return static_cast<size_t>(index_[i].size); }
+
+  /// \brief Find the row of a key.
+  /// \return The row in the mapped file, or an empty slice if the key is not in the snapshot.
+  ReadableSlice Find(key_type key) const;
+
+  /// \return The serialized schema of the cache.
+  std::string GetSchema() const { return std::string(base_ + schema_offset_, schema_size_); }
+
+  /// \return Path of the file.
+  const Path &GetPath() const { return file_; }
+
+ private:
+  struct Header {
+    char magic[8];
+    uint32_t version;  // also tells the byte order, as a file of the other order has an unknown version
+    uint32_t header_size;
+    uint64_t pipeline_fp;
+    uint64_t source_fp;
+    uint32_t flags;
+    uint32_t checksum;  // crc32c of the schema and the index
+    uint64_t num_rows;
+    uint64_t schema_offset;
+    uint64_t schema_size;
+    uint64_t index_offset;
+    uint64_t data_offset;
+    uint64_t file_size;
+  };
+
+  struct IndexEntry {
+    int64_t key;
+    uint64_t offset;  // from the start of the file
+    uint64_t size;
+  };
+
+  constexpr static char kMagic[8] = {'M', 'D', 'C', 'A', 'C', 'H', 'E', '\0'};
+  constexpr static uint32_t kGenerateRowId = 1;
+  constexpr static uint64_t kRowAlignment = 8;
+  constexpr static uint64_t kDataAlignment = 4096;
+
+  CacheSnapshot(Path file, const char *base, size_t file_size);
+
+  Status Validate(const Info &info);
+
+  static uint32_t Checksum(const char *schema, size_t schema_size, const char *index, size_t index_size);
+
+  Path file_;
+  const char *base_;
+  size_t file_size_;
+  size_t num_rows_;
+  size_t schema_offset_;
+  size_t schema_size_;
+  const IndexEntry *index_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_SNAPSHOT_H_
@@ -71,7 +71,9 @@ void CachePerfRun::PrintHelp() {
                "       --connection:     Set number of TCP/IP connections per pipeline. Default = "
             << kDftNumConnections << "\n"
             << "       --port:           TCP/IP port of the cache server. Default = " << kCfgDefaultCachePort << "\n"
-            << "       --hostname:       Hostname of the cache server. Default = " << kCfgDefaultCacheHost << "\n";
+            << "       --hostname:       Hostname of the cache server. Default = " << kCfgDefaultCacheHost << "\n"
+            << "       --embedded:       Use an embedded cache in shared memory instead of the cache server. Default = "
+            << std::boolalpha << false << "\n";
 }
 
 int32_t CachePerfRun::ProcessArgsHelper(int32_t opt) {
@@ -206,6 +208,7 @@ int32_t CachePerfRun::ProcessArgs(int argc, char **argv) {
 
   int shuffle = 0;
   int spill = 0;
+  int embedded = 0;
 
   const char *const short_opts = ":n:e:p:a:s:r:w:";
   const option long_opts[] = {{"pipeline", required_argument, nullptr, 'n'},
@@ -219,6 +222,7 @@ int32_t CachePerfRun::ProcessArgs(int argc, char **argv) {
                               {"port", required_argument, nullptr, port_opt},
                               {"hostname", required_argument, nullptr, hostname_opt},
                               {"spill", no_argument, &spill, 1},
+                              {"embedded", no_argument, &embedded, 1},
                               {"connection", required_argument, nullptr, connect_opt},
                               {"help", no_argument, nullptr, 'h'},
                               {nullptr, no_argument, nullptr, 0}};
@@ -257,6 +261,8 @@ int32_t CachePerfRun::ProcessArgs(int argc, char **argv) {
           shuffle_ = true;
         } else if (long_opts[option_indxex].flag == &spill) {
           cache_builder_.SetSpill(true);
+        } else if (long_opts[option_indxex].flag == &embedded) {
+          cache_builder_.SetEmbedded(true);
         }
         continue;
       }
@@ -281,6 +287,13 @@ int32_t CachePerfRun::ProcessArgs(int argc, char **argv) {
 }
 
 Status CachePerfRun::GetSession() {
+  if (cache_builder_.IsEmbedded()) {
+    // There is no server to generate a session, any positive id not used by other runs will do.
+    session_ = static_cast<session_id_type>(getpid());
+    std::cout << "Session: " << session_ << std::endl;
+    cache_builder_.SetSessionId(session_);
+    return Status::OK();
+  }
   CacheClientGreeter comm(cache_builder_.GetHostname(), cache_builder_.GetPort(), 1);
   RETURN_IF_NOT_OK(comm.ServiceStart());
   auto rq = std::make_shared<GenerateSessionIdRequest>();
@@ -306,7 +319,7 @@ CachePerfRun::CachePerfRun()
 }
 
 CachePerfRun::~CachePerfRun() {
-  if (session_ != 0) {
+  if (session_ != 0 && !cache_builder_.IsEmbedded()) {
     Status rc;
     CacheClientGreeter comm(cache_builder_.GetHostname(), cache_builder_.GetPort(), 1);
     rc = comm.ServiceStart();
@@ -465,7 +478,9 @@ Status CachePerfRun::StartPipelines() {
                                std::to_string(cache_builder_.GetPrefetchSize()) + "," +
                                std::to_string(cache_builder_.GetCacheMemSz()) + "," +
                                std::to_string(cache_builder_.GetNumConnections()) + "," +
-                               (cache_builder_.isSpill() ? std::string("true").data() : std::string("false").data());
+                               (cache_builder_.isSpill() ? std::string("true").data() : std::string("false").data()) +
+                               "," +
+                               (cache_builder_.IsEmbedded() ? std::string("true").data() : std::string("false").data());
       char *argv[4];
       argv[0] = const_cast<char *>(kCachePipelineBinary);
       argv[1] = pipeline_cfg.data();
@@ -491,6 +506,10 @@ Status CachePerfRun::StartPipelines() {
 Status CachePerfRun::Cleanup() {
   // Destroy the cache. We no longer need it around.
   RETURN_IF_NOT_OK(cc_->DestroyCache());
+  if (cc_->IsEmbedded()) {
+    session_ = 0;
+    return Status::OK();
+  }
 
   // Unreserve the session
   CacheClientInfo cinfo;
@@ -0,0 +1,43 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_STUB_EMBEDDED_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_STUB_EMBEDDED_H_
+
+#include <memory>
+#include <string>
+#include "minddata/dataset/engine/cache/cache_client_comm.h"
+#include "minddata/dataset/engine/cache/cache_common.h"
+#include "minddata/dataset/engine/cache/cache_request.h"
+
+namespace mindspore {
+namespace dataset {
+class CacheEmbeddedGreeter : public CacheClientComm {
+ public:
+  CacheEmbeddedGreeter() {}
+  ~CacheEmbeddedGreeter() override {}
+  Status DoServiceStart() override { RETURN_STATUS_UNEXPECTED("Not supported"); }
+  Status DoServiceStop() override { RETURN_STATUS_UNEXPECTED("Not supported"); }
+
+  const void *SharedMemoryBaseAddr() const override { return nullptr; }
+  Status HandleRequest(std::shared_ptr<BaseRequest> rq) override { RETURN_STATUS_UNEXPECTED("Not supported"); }
+  Status AttachToSharedMemory(bool *local_bypass) override { RETURN_STATUS_UNEXPECTED("Not supported"); }
+  std::string GetHostname() const override { return "Not supported"; }
+  int32_t GetPort() const override { return 0; }
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_STUB_EMBEDDED_H_
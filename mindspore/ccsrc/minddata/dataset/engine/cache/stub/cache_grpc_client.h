@@ -18,24 +18,25 @@
 
 #include <memory>
 #include <string>
+#include "minddata/dataset/engine/cache/cache_client_comm.h"
 #include "minddata/dataset/engine/cache/cache_common.h"
 #include "minddata/dataset/engine/cache/cache_request.h"
 #include "minddata/dataset/util/service.h"
 
 namespace mindspore {
 namespace dataset {
-class CacheClientGreeter : public Service {
+class CacheClientGreeter : public CacheClientComm {
  public:
   explicit CacheClientGreeter(const std::string &hostname, int32_t port, int32_t num_workers) {}
   ~CacheClientGreeter() override {}
   Status DoServiceStart() override { RETURN_STATUS_UNEXPECTED("Not supported"); }
   Status DoServiceStop() override { RETURN_STATUS_UNEXPECTED("Not supported"); }
 
-  void *SharedMemoryBaseAddr() { return nullptr; }
-  Status HandleRequest(std::shared_ptr<BaseRequest> rq) { RETURN_STATUS_UNEXPECTED("Not supported"); }
-  Status AttachToSharedMemory(bool *local_bypass) { RETURN_STATUS_UNEXPECTED("Not supported"); }
-  std::string GetHostname() const { return "Not supported"; }
-  int32_t GetPort() const { return 0; }
+  const void *SharedMemoryBaseAddr() const override { return nullptr; }
+  Status HandleRequest(std::shared_ptr<BaseRequest> rq) override { RETURN_STATUS_UNEXPECTED("Not supported"); }
+  Status AttachToSharedMemory(bool *local_bypass) override { RETURN_STATUS_UNEXPECTED("Not supported"); }
+  std::string GetHostname() const override { return "Not supported"; }
+  int32_t GetPort() const override { return 0; }
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -22,11 +22,15 @@
 #include "minddata/dataset/core/pybind_support.h"
 #endif
 
+#include "minddata/dataset/engine/datasetops/map_op/map_op.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
 namespace dataset {
+// slabs allowed on top of the batches in flight, for the batch the MapOp is starting and the one the BatchOp gathers
+constexpr int64_t kMinBatchSlabs = 2;
+
 #ifdef ENABLE_PYTHON
 BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size, int32_t num_workers,
                  const std::vector<std::string> &in_col, const std::vector<std::string> &out_col,
@@ -91,7 +95,7 @@ Status BatchOp::operator()() {
       // if # of rows is enough to make 1 batch, send it to worker_queue
       if (table->size() == static_cast<size_t>(cur_batch_size)) {
         RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->EmplaceBack(
-          std::make_pair(std::move(table), CBatchInfo(op_current_epochs_, batch_num++, cnt++))));
+          std::make_pair(std::move(table), NextBatchInfo(&batch_num, &cnt))));
         table = std::make_unique<TensorQTable>();
         RETURN_IF_NOT_OK(GetBatchSize(&cur_batch_size, CBatchInfo(op_current_epochs_, batch_num, cnt)));
       }
@@ -100,11 +104,14 @@ Status BatchOp::operator()() {
     // Reminder logic, execute only when there is a remainder (table is non empty) and don't drop
     if (!drop_ && !table->empty()) {
       RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->EmplaceBack(
-        std::make_pair(std::move(table), CBatchInfo(op_current_epochs_, batch_num++, cnt++))));
+        std::make_pair(std::move(table), NextBatchInfo(&batch_num, &cnt))));
     }
     table = std::make_unique<TensorQTable>();  // this drops when drop == true
     // end of the current epoch, batch_num should start from 0 again
     batch_num = 0;
+    if (batch_slabs_ != nullptr) {
+      batch_slabs_->EndRound(op_current_repeats_);
+    }
     RETURN_IF_NOT_OK(
       worker_in_queues_[NextWorkerID()]->EmplaceBack(std::make_pair(nullptr, CBatchInfo(BatchCtrl::kEOE))));
     UpdateRepeatAndEpochCounter();
@@ -129,6 +136,14 @@ Status BatchOp::operator()() {
   return Status::OK();
 }
 
+CBatchInfo BatchOp::NextBatchInfo(int64_t *batch_num, int64_t *cnt) {
+  CBatchInfo info(op_current_epochs_, (*batch_num)++, (*cnt)++);
+  if (batch_slabs_ != nullptr) {
+    info.slab_ = batch_slabs_->PopSlab(op_current_repeats_, info.batch_num_);
+  }
+  return info;
+}
+
 void BatchOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
@@ -144,7 +159,7 @@ void BatchOp::Print(std::ostream &out, bool show_all) const {
 }
 
 Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *tensor_row_dequeue, TensorRow *batched_tensor_row,
-                          bool concat_batch, bool contains_per_batch_map) {
+                          bool concat_batch, bool contains_per_batch_map, const std::shared_ptr<BatchSlab> &slab) {
   RETURN_UNEXPECTED_IF_NULL(tensor_row_dequeue);
   RETURN_UNEXPECTED_IF_NULL(batched_tensor_row);
   auto batch_size = (*tensor_row_dequeue)->size();
@@ -164,7 +179,14 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *tensor_row_dequeu
   auto num_columns = (*tensor_row_dequeue)->front().size();
   for (size_t i = 0; i < num_columns; i++) {
     std::shared_ptr<Tensor> batched_tensor;
-    RETURN_IF_NOT_OK(ConvertRowsToTensor(tensor_row_dequeue, &batched_tensor, batch_size, i, contains_per_batch_map));
+    // the rows may already sit in the batched tensor, then there is nothing to copy
+    if (slab != nullptr) {
+      RETURN_IF_NOT_OK(slab->TakeBatch(*tensor_row_dequeue, i, &batched_tensor));
+    }
+    if (batched_tensor == nullptr) {
+      RETURN_IF_NOT_OK(
+        ConvertRowsToTensor(tensor_row_dequeue, &batched_tensor, batch_size, i, contains_per_batch_map));
+    }
     batched_tensor_row->emplace_back(std::move(batched_tensor));
   }
 
@@ -366,7 +388,8 @@ Status BatchOp::MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchIn
   if (pad_) {
     RETURN_IF_NOT_OK(PadColumns(&tensor_info_pair.first, pad_info_, column_name_id_map_));
   }  // do padding if needed
-  RETURN_IF_NOT_OK(BatchRows(&tensor_info_pair.first, batched_tensor_row, concat_batch, contains_per_batch_map));
+  RETURN_IF_NOT_OK(BatchRows(&tensor_info_pair.first, batched_tensor_row, concat_batch, contains_per_batch_map,
+                             tensor_info_pair.second.slab_));
   return Status::OK();
 }
 
@@ -882,6 +905,32 @@ void BatchOp::SetPythonMp(std::shared_ptr<PythonMultiprocessingRuntime> python_m
   python_mp_ = std::move(python_mp);
 }
 
+Status BatchOp::PrepareOperator() {
+  RETURN_IF_NOT_OK(DatasetOp::PrepareOperator());
+  // The rows must reach the batch unchanged and in fixed-size groups for the map workers to know their slots
+  bool fixed_batch = start_batch_size_ > 1 && !pad_;
+#ifdef ENABLE_PYTHON
+  fixed_batch = fixed_batch && !batch_size_func_ && !batch_map_func_;
+#endif
+  auto *map_op = child_.size() == 1 ? dynamic_cast<MapOp *>(child_[0].get()) : nullptr;
+  if (fixed_batch && map_op != nullptr) {
+    // the rows in flight fill at most the in and out queues of the map workers and the output connector of the map,
+    // more slabs than their batches only come from batches that were dropped or regrouped
+    const int64_t rows_in_flight = static_cast<int64_t>(2 * map_op->NumWorkers() + 1) * map_op->ConnectorCapacity();
+    const auto max_slabs = static_cast<size_t>(rows_in_flight / start_batch_size_ + kMinBatchSlabs);
+    batch_slabs_ = std::make_shared<BatchSlabQueue>(start_batch_size_, max_slabs);
+    map_op->SetBatchSlabs(batch_slabs_);
+  }
+  return Status::OK();
+}
+
+Status BatchOp::Reset() {
+  if (batch_slabs_ != nullptr) {
+    batch_slabs_->Clear();
+  }
+  return ParallelOp::Reset();
+}
+
 Status BatchOp::Launch() {
   // Launch Python multiprocessing. This will create the MP pool and shared memory if needed.
   if (python_mp_) {
@@ -30,6 +30,7 @@
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/batch_slab.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/util/status.h"
 
@@ -53,6 +54,7 @@ struct CBatchInfo {
   int64_t batch_num_;        // i-th batch since the start of current epoch. i starts from 0
   int64_t total_batch_num_;  // i-th batch since the start of first epoch. i starts from 0
   BatchCtrl ctrl_;           // No control=0, EOE=1, EOF=2, Quit=3
+  std::shared_ptr<BatchSlab> slab_;  // the batched tensors the MapOp below produced the rows into, can be nullptr
   const int64_t get_batch_num() const { return batch_num_; }
   const int64_t get_epoch_num() const { return epoch_num_; }
 
@@ -124,10 +126,12 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   // @param TensorRow *batched_tensor_row - dest_table to hold batched rows
   // @param bool concat_batch - whether to keep batch to 1 row or expand dimensions
   // @param bool contains_per_batch_map - whether user has provided per_batch_map
+  // @param const std::shared_ptr<BatchSlab> &slab - the batched tensors the rows were produced into, can be nullptr
   // @notes contains_per_batch_map is passed to this function since some callers require this function to be static
   // @return Status The status code returned
   static Status BatchRows(const std::unique_ptr<TensorQTable> *tensor_row_dequeue, TensorRow *batched_tensor_row,
-                          bool concat_batch = false, bool contains_per_batch_map = false);
+                          bool concat_batch = false, bool contains_per_batch_map = false,
+                          const std::shared_ptr<BatchSlab> &slab = nullptr);
 
   // convert the rows to tensor
   // @param const std::unique_ptr<TensorQTable> *tensor_row_dequeue - table that has the rows for batching
@@ -211,6 +215,15 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
 
   Status ComputeColMap() override;
 
+  // Hand the slabs of the batches to the MapOp below when the batches have a fixed size, so that the map workers
+  // produce the rows straight into the batched tensors
+  // @return Status The status code returned
+  Status PrepareOperator() override;
+
+  // Drop the slabs the MapOp below made for the batches not gathered yet
+  // @return Status The status code returned
+  Status Reset() override;
+
 #ifdef ENABLE_PYTHON
   // Invoke batch size function with current BatchInfo to generate batch size.
   // @return Status The status code returned
@@ -248,7 +261,14 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   ImplementedPullMode PullModeImplementationStatus() const override { return ImplementedPullMode::Implemented; }
 
  private:
+  // Info of the next batch of the current epoch, with the slab its rows were produced into
+  // @param int64_t *batch_num - index of the batch since the last eoe, advanced by one
+  // @param int64_t *cnt - index of the batch since the first epoch, advanced by one
+  // @return the info of the batch
+  CBatchInfo NextBatchInfo(int64_t *batch_num, int64_t *cnt);
+
   bool eoe_received_ = false;
+  std::shared_ptr<BatchSlabQueue> batch_slabs_;  // slabs from the MapOp below, nullptr if the rows are copied
 };
 }  // namespace dataset
 }  // namespace mindspore
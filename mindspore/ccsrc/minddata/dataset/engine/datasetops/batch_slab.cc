@@ -0,0 +1,160 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/batch_slab.h"
+
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+BatchSlab::BatchSlab(int64_t round, int64_t batch, int32_t batch_size)
+    : round_(round), batch_(batch), batch_size_(batch_size) {}
+
+Status BatchSlab::GetSlot(size_t column, int32_t slot, const TensorShape &shape, const DataType &type,
+                          std::shared_ptr<Tensor> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  *out = nullptr;
+  if (slot < 0 || slot >= batch_size_ || !type.IsNumeric() || !shape.known() || shape.NumOfElements() == 0) {
+    return Status::OK();
+  }
+  std::shared_ptr<Tensor> batch;
+  dsize_t slot_size = 0;
+  {
+    std::unique_lock<std::mutex> lock(mux_);
+    if (column >= columns_.size()) {
+      columns_.resize(column + 1);
+    }
+    Column &col = columns_[column];
+    if (col.batch == nullptr) {
+      if (col.taken) {
+        return Status::OK();
+      }
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape.PrependDim(batch_size_), type, &col.batch));
+      col.slot_shape = shape;
+      col.type = type;
+      col.slot_size = shape.NumOfElements() * type.SizeInBytes();
+      col.given.assign(batch_size_, false);
+    }
+    if (col.taken || col.slot_shape != shape || col.type != type) {
+      return Status::OK();
+    }
+    if (!col.given[slot]) {
+      col.given[slot] = true;
+      col.num_given++;
+    }
+    batch = col.batch;
+    slot_size = col.slot_size;
+  }
+  const uchar *data = batch->GetBuffer() + slot * slot_size;
+  return Tensor::CreateFromExternalMemory(shape, type, data, slot_size, std::move(batch), out);
+}
+
+bool BatchSlab::IsSlot(size_t column, int32_t slot, const std::shared_ptr<Tensor> &tensor) {
+  std::unique_lock<std::mutex> lock(mux_);
+  if (tensor == nullptr || column >= columns_.size() || columns_[column].batch == nullptr) {
+    return false;
+  }
+  const Column &col = columns_[column];
+  return tensor->GetBuffer() == col.batch->GetBuffer() + slot * col.slot_size && tensor->shape() == col.slot_shape &&
+         tensor->type() == col.type;
+}
+
+Status BatchSlab::TakeBatch(const std::unique_ptr<TensorQTable> &table, size_t column_index,
+                            std::shared_ptr<Tensor> *out) {
+  RETURN_UNEXPECTED_IF_NULL(table);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  *out = nullptr;
+  const auto num_rows = static_cast<int32_t>(table->size());
+  if (num_rows == 0 || num_rows > batch_size_ || table->front().size() <= column_index) {
+    return Status::OK();
+  }
+  const uchar *first = table->front()[column_index] == nullptr ? nullptr : table->front()[column_index]->GetBuffer();
+  if (first == nullptr) {
+    return Status::OK();
+  }
+  std::unique_lock<std::mutex> lock(mux_);
+  for (auto &col : columns_) {
+    if (col.batch == nullptr || col.batch->GetBuffer() != first) {
+      continue;
+    }
+    // every slot handed out must be held by its own row, otherwise a stray row could still write into the batch
+    if (col.taken || col.num_given != num_rows) {
+      return Status::OK();
+    }
+    for (int32_t row = 0; row < num_rows; ++row) {
+      const std::shared_ptr<Tensor> &tensor = (*table)[row][column_index];
+      if (tensor == nullptr || tensor->GetBuffer() != first + row * col.slot_size ||
+          tensor->shape() != col.slot_shape || tensor->type() != col.type) {
+        return Status::OK();
+      }
+    }
+    col.taken = true;
+    std::shared_ptr<Tensor> batch = std::move(col.batch);
+    if (num_rows == batch_size_) {
+      *out = std::move(batch);
+      return Status::OK();
+    }
+    // the last batch of an epoch may not be full, give a view of the filled slots
+    const uchar *data = batch->GetBuffer();
+    return Tensor::CreateFromExternalMemory(col.slot_shape.PrependDim(num_rows), col.type, data,
+                                            num_rows * col.slot_size, std::move(batch), out);
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<BatchSlab> BatchSlabQueue::NewSlab(int64_t round, int64_t batch) {
+  std::unique_lock<std::mutex> lock(mux_);
+  if (slabs_.size() >= max_slabs_) {
+    return nullptr;
+  }
+  auto slab = std::make_shared<BatchSlab>(round, batch, batch_size_);
+  slabs_.push_back(slab);
+  return slab;
+}
+
+std::shared_ptr<BatchSlab> BatchSlabQueue::PopSlab(int64_t round, int64_t batch) {
+  std::unique_lock<std::mutex> lock(mux_);
+  while (!slabs_.empty()) {
+    const std::shared_ptr<BatchSlab> &front = slabs_.front();
+    if (front->round() > round || (front->round() == round && front->batch() > batch)) {
+      return nullptr;
+    }
+    std::shared_ptr<BatchSlab> slab = std::move(slabs_.front());
+    slabs_.pop_front();
+    if (slab->round() == round && slab->batch() == batch) {
+      return slab;
+    }
+  }
+  return nullptr;
+}
+
+void BatchSlabQueue::EndRound(int64_t round) {
+  std::unique_lock<std::mutex> lock(mux_);
+  while (!slabs_.empty() && slabs_.front()->round() <= round) {
+    slabs_.pop_front();
+  }
+}
+
+void BatchSlabQueue::Clear() {
+  std::unique_lock<std::mutex> lock(mux_);
+  slabs_.clear();
+}
+
+size_t BatchSlabQueue::NumSlabs() {
+  std::unique_lock<std::mutex> lock(mux_);
+  return slabs_.size();
+}
+}  // namespace dataset
+}  // namespace mindspore
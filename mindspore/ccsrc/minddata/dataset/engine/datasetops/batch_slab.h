@@ -0,0 +1,129 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLAB_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLAB_H_
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// The batched tensors of one batch, allocated before its rows are computed. The workers of the MapOp under a BatchOp
+// produce each output column of a row straight into the slot of the row in the batched tensor of the column, and
+// BatchOp takes the batched tensors as they are instead of copying the rows into new ones.
+// The first row reaching a column decides the shape and type of all slots of the column; rows of another shape keep
+// their own tensors and the batch is then copied as usual.
+class BatchSlab {
+ public:
+  // @param round - the number of EOEs the MapOp had seen when it started the batch
+  // @param batch - the index of the batch since the last EOE
+  // @param batch_size - the number of slots of each column
+  BatchSlab(int64_t round, int64_t batch, int32_t batch_size);
+
+  ~BatchSlab() = default;
+
+  int64_t round() const { return round_; }
+
+  int64_t batch() const { return batch_; }
+
+  // Get a tensor which aliases the slot of a row in a column, allocating the batched tensor of the column if needed
+  // @param column - the index of the output column of the map
+  // @param slot - the index of the row in the batch
+  // @param shape - the shape of the tensor of the row
+  // @param type - the type of the tensor of the row
+  // @param out - the tensor of the slot, nullptr if the slot can not hold a tensor of that shape and type
+  // @return Status The status code returned
+  Status GetSlot(size_t column, int32_t slot, const TensorShape &shape, const DataType &type,
+                 std::shared_ptr<Tensor> *out);
+
+  // @return whether the tensor is the slot of the row in the column
+  bool IsSlot(size_t column, int32_t slot, const std::shared_ptr<Tensor> &tensor);
+
+  // Take the batched tensor of a column of the rows of the batch
+  // @param table - the rows of the batch, in order
+  // @param column_index - the index of the column in the rows
+  // @param out - the batched tensor if every row holds its own slot of one column of the slab, otherwise nullptr
+  // @return Status The status code returned
+  Status TakeBatch(const std::unique_ptr<TensorQTable> &table, size_t column_index, std::shared_ptr<Tensor> *out);
+
+ private:
+  struct Column {
+    std::shared_ptr<Tensor> batch;            // the batched tensor, nullptr until the first row reaches the column
+    TensorShape slot_shape = TensorShape::CreateUnknownRankShape();
+    DataType type;
+    dsize_t slot_size = 0;                    // bytes of one slot
+    std::vector<bool> given;                  // slots handed out to the rows
+    int32_t num_given = 0;
+    bool taken = false;                       // whether BatchOp took the batched tensor
+  };
+
+  int64_t round_;
+  int64_t batch_;
+  int32_t batch_size_;
+  std::mutex mux_;
+  std::vector<Column> columns_;
+};
+
+// Hands the slabs from a MapOp to the BatchOp above it, in the order of the batches
+class BatchSlabQueue {
+ public:
+  // @param batch_size - the size of the batches of the BatchOp
+  // @param max_slabs - the number of slabs the MapOp may have made that the BatchOp has not popped yet
+  BatchSlabQueue(int32_t batch_size, size_t max_slabs) : batch_size_(batch_size), max_slabs_(max_slabs) {}
+
+  ~BatchSlabQueue() = default;
+
+  int32_t batch_size() const { return batch_size_; }
+
+  // Called by the MapOp when it dispatches the first row of a batch
+  // @param round - the number of EOEs the MapOp has seen
+  // @param batch - the index of the batch since the last EOE
+  // @return the slab of the batch, nullptr if max_slabs slabs are waiting, the rows of the batch are then copied
+  std::shared_ptr<BatchSlab> NewSlab(int64_t round, int64_t batch);
+
+  // Called by the BatchOp when it has gathered the rows of a batch. Slabs of earlier batches, whose rows were
+  // regrouped, e.g. after a row was skipped, are dropped.
+  // @param round - the number of EOEs the BatchOp has seen
+  // @param batch - the index of the batch since the last EOE
+  // @return the slab of the batch, nullptr if the MapOp made none
+  std::shared_ptr<BatchSlab> PopSlab(int64_t round, int64_t batch);
+
+  // Called by the BatchOp at an EOE. Drops the slabs of the round which no batch took, e.g. the slab of the last
+  // partial batch when drop_remainder is set, so that they do not hold their batched tensors until the next round.
+  // @param round - the number of EOEs the BatchOp had seen before this one
+  void EndRound(int64_t round);
+
+  // Drop all the slabs, called when the BatchOp is reset
+  void Clear();
+
+  // @return the number of slabs the BatchOp has not popped yet
+  size_t NumSlabs();
+
+ private:
+  int32_t batch_size_;
+  size_t max_slabs_;
+  std::mutex mux_;
+  std::deque<std::shared_ptr<BatchSlab>> slabs_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLAB_H_
@@ -223,7 +223,7 @@ Status CacheMergeOp::PrepareOperator() {  // Run any common code from super clas
   // This is a mappable cache op so the id's need to be generated.
   // Construct the cache
   const bool generate_ids = false;
-  Status rc = cache_client_->CreateCache(cache_crc, generate_ids);
+  Status rc = cache_client_->CreateCache(cache_crc, generate_ids, fingerprint_func_);
   if (rc.StatusCode() == StatusCode::kMDDuplicateKey) {
     // We are told the cache has been created already.
     MS_LOG(INFO) << "Cache created already";
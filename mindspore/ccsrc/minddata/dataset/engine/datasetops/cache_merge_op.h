@@ -101,6 +101,10 @@ class CacheMergeOp : public ParallelOp<TensorRow, TensorRow> {
   /// \return Status The status code returned
   Status PrepareOperator() override;
 
+  /// \brief Setter for the function fingerprinting the pipeline cached, which lets a persistent cache be reused
+  ///     across jobs
+  void SetFingerprintFunc(CacheFingerprintFunc fingerprint_func) { fingerprint_func_ = std::move(fingerprint_func); }
+
   /// \brief Main thread to fetch rows from the miss child and assign it to workers
   /// \return Status The status code returned
   Status CacheMissMaster();
@@ -131,6 +135,7 @@ class CacheMergeOp : public ParallelOp<TensorRow, TensorRow> {
   int32_t num_cleaners_;
   std::shared_ptr<CacheClient> cache_client_;
   std::atomic<bool> cache_missing_rows_;
+  CacheFingerprintFunc fingerprint_func_;
 
   QueueList<TensorRow> missWorkers_in_queues_;
 
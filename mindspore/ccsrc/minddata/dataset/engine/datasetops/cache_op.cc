@@ -207,9 +207,9 @@ Status CacheOp::PrepareOperator() {
   // This is a non-mappable cache op so the id's need to be generated.
   // Construct the cache
   const bool generate_ids = true;
-  Status rc = cache_client_->CreateCache(cache_crc, generate_ids);
+  Status rc = cache_client_->CreateCache(cache_crc, generate_ids, fingerprint_func_);
   if (rc.StatusCode() == StatusCode::kMDDuplicateKey) {
-    // We are told the cache has been created already. So we skip the build phase.
+    // We are told the cache has been created (or loaded from a persistent file) already. So we skip the build phase.
     phase_ = Phase::kFetchPhase;
     rc = Status::OK();
   }
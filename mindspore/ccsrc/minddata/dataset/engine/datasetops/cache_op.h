@@ -76,10 +76,15 @@ class CacheOp : public CacheBase, public RandomAccessOp {
   /// \return Status The status code returned
   Status PrepareOperator() override;
 
+  /// \brief Setter for the function fingerprinting the pipeline cached, which lets a persistent cache be reused
+  ///     across jobs
+  void SetFingerprintFunc(CacheFingerprintFunc fingerprint_func) { fingerprint_func_ = std::move(fingerprint_func); }
+
  private:
   WaitPost rows_cache_done_;
   std::atomic<int64_t> num_guys_in_;
   Phase phase_;
+  CacheFingerprintFunc fingerprint_func_;
 
   QueueList<TensorRow> cache_workers_in_queue_;
   /// \brief The main thread will wait until all the rows are cached and will start the handshake with the sampler.
@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_DATASET_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_DATASET_OP_H_
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -282,6 +283,10 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
     return ChildOpConnectorCapacity();
   }
 
+  // \brief Getter function
+  // \return number of bytes which the op does not read or decode because the columns are not used
+  virtual int64_t BytesSkipped() const { return bytes_skipped_.load(std::memory_order_relaxed); }
+
   // \brief Getter function
   // \return connector size of child op
   int32_t ChildOpConnectorSize(int32_t child_index = 0) const { return child_[child_index]->ConnectorSize(); }
@@ -389,6 +394,10 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   // Launch the Op
   virtual Status Launch() { return Status::OK(); }
 
+  // \brief Count the bytes which are not read or decoded because the columns are not used
+  // \param[in] num_bytes The number of bytes skipped
+  void AddBytesSkipped(int64_t num_bytes) { (void)bytes_skipped_.fetch_add(num_bytes, std::memory_order_relaxed); }
+
   enum ImplementedPullMode { NotImplemented = 0, Implemented, DisabledDebugMode };
   /// \brief Gets the implementation status for operator in pull mode
   /// \return implementation status
@@ -411,6 +420,7 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   CallbackManager callback_manager_;                             // Manages callbacks associated with a DatasetOp
   int64_t dataset_size_;                                         // Size of the dataset
   int64_t num_classes_;                                          // Number of classes
+  std::atomic<int64_t> bytes_skipped_{0};                        // Bytes of the columns which are not used
 
  private:
   // Sets the operator id.
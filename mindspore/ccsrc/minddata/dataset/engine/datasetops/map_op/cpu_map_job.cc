@@ -39,8 +39,17 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
     TensorRow input_row = in[row];
     TensorRow result_row;
     for (size_t i = 0; i < ops_.size(); i++) {
-      // Call compute function for cpu
-      Status rc = ops_[i]->Compute(input_row, &result_row);
+      // Call compute function for cpu, the last op writes its output into the batch slot of the row if it has one
+      Status rc;
+      if (batch_slab_ != nullptr && i + 1 == ops_.size()) {
+        rc = ops_[i]->ComputeInto(input_row, &result_row,
+                                  [this](size_t column, const TensorShape &shape, const DataType &type,
+                                         std::shared_ptr<Tensor> *out) {
+                                    return batch_slab_->GetSlot(column, batch_slot_, shape, type, out);
+                                  });
+      } else {
+        rc = ops_[i]->Compute(input_row, &result_row);
+      }
       if (rc.IsError()) {
         std::string op_name = ops_[i]->Name();
         RETURN_IF_NOT_OK(util::RebuildMapErrorMsg(input_row, op_name, &rc));
@@ -51,9 +60,31 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
         input_row = std::move(result_row);
       }
     }
+    if (batch_slab_ != nullptr) {
+      RETURN_IF_NOT_OK(FillBatchSlot(&result_row));
+    }
     out->push_back(std::move(result_row));
   }
   return Status::OK();
 }
+
+Status CpuMapJob::FillBatchSlot(TensorRow *row) {
+  for (size_t column = 0; column < row->size(); column++) {
+    std::shared_ptr<Tensor> &tensor = (*row)[column];
+    if (tensor == nullptr || !tensor->type().IsNumeric() || batch_slab_->IsSlot(column, batch_slot_, tensor)) {
+      continue;
+    }
+    std::shared_ptr<Tensor> slot;
+    RETURN_IF_NOT_OK(batch_slab_->GetSlot(column, batch_slot_, tensor->shape(), tensor->type(), &slot));
+    if (slot == nullptr) {
+      continue;
+    }
+    int ret_code = memcpy_s(slot->GetMutableBuffer(), slot->SizeInBytes(), tensor->GetBuffer(), tensor->SizeInBytes());
+    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "Failed to copy tensor into the batch, got error_t: " +
+                                                    std::to_string(ret_code));
+    tensor = std::move(slot);
+  }
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
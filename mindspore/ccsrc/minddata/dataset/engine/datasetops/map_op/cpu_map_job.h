@@ -45,6 +45,12 @@ class CpuMapJob : public MapJob {
 #endif
 
   MapTargetDevice Type() override { return MapTargetDevice::kCpu; }
+
+ private:
+  // Move the output tensors of the row into its batch slot, copying those the last op did not write there
+  // @param row - the output row of the job
+  // @return Status The status code returned
+  Status FillBatchSlot(TensorRow *row);
 };
 
 }  // namespace dataset
@@ -19,10 +19,12 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/engine/datasetops/batch_slab.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 #include "minddata/dataset/util/status.h"
 
@@ -87,8 +89,18 @@ class MapJob {
 
   virtual MapTargetDevice Type() = 0;
 
+  // Let the job produce the output columns of its row into the slot of the row in a batch
+  // @param slab - the batch of the row
+  // @param slot - the index of the row in the batch
+  void SetBatchSlot(std::shared_ptr<BatchSlab> slab, int32_t slot) {
+    batch_slab_ = std::move(slab);
+    batch_slot_ = slot;
+  }
+
  protected:
   std::vector<std::shared_ptr<TensorOp>> ops_;
+  std::shared_ptr<BatchSlab> batch_slab_;  // the batch the output row goes to, nullptr if the row is not batched
+  int32_t batch_slot_ = -1;
 };
 
 }  // namespace dataset
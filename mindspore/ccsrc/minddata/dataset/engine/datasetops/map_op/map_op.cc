@@ -178,6 +178,9 @@ Status MapOp::operator()() {
   child_iterator_ = std::make_unique<ChildIterator>(this, 0, 0);
   TensorRow new_row;
   RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+  // index of the row since the last eoe and the batch it goes to, when the rows are produced into the batches
+  int64_t batch_row = 0;
+  std::shared_ptr<BatchSlab> batch_slab;
 
   while (!new_row.eof()) {
     if (op_current_repeats_ % GetOpNumRepeatsPerEpoch() == 0) {
@@ -197,6 +200,19 @@ Status MapOp::operator()() {
       // Populate map worker job for a worker to execute
       RETURN_IF_NOT_OK(GenerateWorkerJob(&worker_job, cur_worker_id));
 
+      // Let the worker write the row into its slot of the batch, the BatchOp then takes the batch without a copy
+      if (batch_slabs_ != nullptr) {
+        const int32_t batch_size = batch_slabs_->batch_size();
+        const auto slot = static_cast<int32_t>(batch_row % batch_size);
+        if (slot == 0) {
+          batch_slab = batch_slabs_->NewSlab(op_current_repeats_, batch_row / batch_size);
+        }
+        if (worker_job->jobs.back()->Type() == MapTargetDevice::kCpu) {
+          worker_job->jobs.back()->SetBatchSlot(batch_slab, slot);
+        }
+        batch_row++;
+      }
+
       // Push map worker job to the corresponding worker's queue
       RETURN_IF_NOT_OK(worker_in_queues_[cur_worker_id]->Add(std::move(worker_job)));
 
@@ -207,6 +223,8 @@ Status MapOp::operator()() {
     std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(new_row));
     RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->Add(std::move(worker_job)));
     UpdateRepeatAndEpochCounter();
+    batch_row = 0;
+    batch_slab = nullptr;
     RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
   }
   // End() is commented out because it might never be called due to the lack of EOF when EpochCtrl is -1
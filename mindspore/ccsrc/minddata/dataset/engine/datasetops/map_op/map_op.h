@@ -26,6 +26,7 @@
 #include "minddata/dataset/api/python/python_mp.h"
 #include "minddata/dataset/callback/ds_callback.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/batch_slab.h"
 #include "minddata/dataset/engine/datasetops/map_op/map_job.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -145,6 +146,10 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
   /// \param python_mp PythonMultiprocessingRuntime
   void SetPythonMp(std::shared_ptr<PythonMultiprocessingRuntime> python_mp);
 
+  /// Let the workers produce the output rows straight into the batches of the BatchOp above, see BatchSlab
+  /// \param batch_slabs The queue handing the slabs of the batches to the BatchOp
+  void SetBatchSlabs(std::shared_ptr<BatchSlabQueue> batch_slabs) { batch_slabs_ = std::move(batch_slabs); }
+
   /// Return the list of PIDs of worker processes
   /// \return vector of int
   std::vector<int32_t> GetMPWorkerPIDs() const override;
@@ -180,6 +185,8 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
 
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;  // python multiprocessing instance
 
+  std::shared_ptr<BatchSlabQueue> batch_slabs_;  // slabs of the batches of the BatchOp above, nullptr if none
+
   // Private function for worker/thread to loop continuously. It comprises the main
   // logic of MapOp: getting the data from previous Op, validating user specified column names,
   // applying a list of TensorOps to each of the data, process the results and then
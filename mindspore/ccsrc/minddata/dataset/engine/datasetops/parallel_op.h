@@ -135,7 +135,9 @@ class ParallelOp : public DatasetOp {
     for (int32_t i = 0; i < num_new_workers; i++) {
       Task *new_task;
       RETURN_IF_NOT_OK(tree_->AllTasks()->CreateAsyncTask(
-        Name() + "::WorkerEntry", std::bind(&ParallelOp::WorkerEntry, this, num_workers_), &new_task, id()));
+        Name() + "::WorkerEntry",
+        tree_->PlaceOnNumaNode(std::bind(&ParallelOp::WorkerEntry, this, num_workers_), id(), num_workers_),
+        &new_task, id()));
       CHECK_FAIL_RETURN_UNEXPECTED(new_task != nullptr, "Cannot create a new worker.");
       worker_tasks_.push_back(new_task);
       {
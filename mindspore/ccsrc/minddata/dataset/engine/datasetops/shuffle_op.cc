@@ -16,13 +16,16 @@
 #if defined(_WIN32) || defined(_WIN64)
 #include <stdlib.h>
 #endif
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <random>
 #include <utility>
 
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
 
@@ -45,7 +48,18 @@ ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_con
       rng_(shuffle_seed),
       shuffle_buffer_(std::make_unique<TensorTable>()),
       shuffle_last_row_idx_(0),
-      shuffle_buffer_state_(kShuffleStateInit) {}
+      shuffle_buffer_state_(kShuffleStateInit) {
+  std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  memory_limit_ = cfg->shuffle_memory_limit();
+  if (memory_limit_ > 0 && ShuffleSpill::Supported()) {
+    std::string spill_dir = cfg->shuffle_spill_dir();
+    if (spill_dir.empty()) {
+      const char *tmp_dir = std::getenv("TMPDIR");
+      spill_dir = (tmp_dir != nullptr && *tmp_dir != '\0') ? tmp_dir : "/tmp";
+    }
+    spill_ = std::make_unique<ShuffleSpill>(spill_dir);
+  }
+}
 
 // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
 // itself rather than waiting for the reset driven from operators above it in the pipeline.
@@ -59,7 +73,15 @@ Status ShuffleOp::SelfReset() {
     rng_ = std::mt19937_64(shuffle_seed_);
   }
 
+  if (spill_ != nullptr && spill_->spilled_bytes() > 0) {
+    MS_LOG(INFO) << "Shuffle operator spilled " << spill_->spilled_bytes() << " bytes of rows to disk in "
+                 << spill_->stored_bytes() << " bytes so far, average read-back latency: "
+                 << (spill_->num_reads() > 0 ? spill_read_us_ / spill_->num_reads() : 0) << " us.";
+    spill_->Clear();
+  }
   shuffle_buffer_ = std::make_unique<TensorTable>();
+  spilled_rows_.clear();
+  buffer_bytes_ = 0;
   shuffle_last_row_idx_ = 0;
   shuffle_buffer_state_ = kShuffleStateInit;
   return Status::OK();
@@ -77,12 +99,30 @@ void ShuffleOp::Print(std::ostream &out, bool show_all) const {
     PipelineOp::Print(out, show_all);
     // Then show any custom derived-internal stuff
     out << "\nShuffle size: " << shuffle_size_ << "\nShuffle buffer state: " << shuffle_buffer_state_
-        << "\nShuffle seed: " << shuffle_seed_ << "\n\n";
+        << "\nShuffle seed: " << shuffle_seed_;
+    if (spill_ != nullptr) {
+      out << "\nShuffle memory limit: " << memory_limit_ << "\nSpilled bytes: " << spill_->spilled_bytes()
+          << "\nSpilled bytes on disk: " << spill_->stored_bytes()
+          << "\nSpilled rows read back: " << spill_->num_reads();
+    }
+    out << "\n\n";
   }
 }
 
 // Private function to add a new row to the shuffle buffer.
 Status ShuffleOp::AddRowToShuffleBuffer(TensorRow new_shuffle_row) {
+  // A row which does not fit in the memory limit goes to disk, its slot keeps an empty row and where it is stored.
+  // Only the storage of the rows changes, the slots and the random draws are the same as without a limit.
+  ShuffleSpill::Handle handle;
+  uint64_t row_size = ShuffleSpill::RowSize(new_shuffle_row);
+  if (spill_ != nullptr && buffer_bytes_ + row_size > memory_limit_ && ShuffleSpill::Spillable(new_shuffle_row)) {
+    RETURN_IF_NOT_OK(CollectOpInfoStart(NameWithID(), "SpillWrite"));
+    RETURN_IF_NOT_OK(spill_->Write(new_shuffle_row, &handle));
+    RETURN_IF_NOT_OK(CollectOpInfoEnd(NameWithID(), "SpillWrite", {{"bytes", std::to_string(handle.stored_size)}}));
+    new_shuffle_row = TensorRow();
+  } else {
+    buffer_bytes_ += row_size;
+  }
   // If the last slot of our shuffle buffer was not the full size of the shuffle buffer then we are
   // filling it during the initial fill codepath and thus growing it's size. In that case, we push
   // back the new row to grow our shuffle buffer size by 1.
@@ -91,13 +131,33 @@ Status ShuffleOp::AddRowToShuffleBuffer(TensorRow new_shuffle_row) {
   // selection that was done previously!)
   if (shuffle_last_row_idx_ < (shuffle_size_ - 1)) {
     shuffle_buffer_->push_back(std::move(new_shuffle_row));
+    spilled_rows_.push_back(handle);
     shuffle_last_row_idx_ = (shuffle_buffer_->size()) - 1;
   } else {
-    if (!(*shuffle_buffer_)[shuffle_last_row_idx_].empty()) {
+    if (!(*shuffle_buffer_)[shuffle_last_row_idx_].empty() || spilled_rows_[shuffle_last_row_idx_].segment >= 0) {
       RETURN_STATUS_UNEXPECTED("[Internal ERROR] Last row of shuffle buffer should not be occupied!");
     }
     (*shuffle_buffer_)[shuffle_last_row_idx_] = std::move(new_shuffle_row);
+    spilled_rows_[shuffle_last_row_idx_] = handle;
+  }
+  return Status::OK();
+}
+
+Status ShuffleOp::TakeRowFromShuffleBuffer(int64_t slot, TensorRow *row) {
+  ShuffleSpill::Handle &handle = spilled_rows_[slot];
+  if (handle.segment < 0) {
+    *row = std::move((*shuffle_buffer_)[slot]);
+    uint64_t row_size = ShuffleSpill::RowSize(*row);
+    buffer_bytes_ -= std::min(buffer_bytes_, row_size);
+    return Status::OK();
   }
+  RETURN_IF_NOT_OK(CollectOpInfoStart(NameWithID(), "SpillRead"));
+  auto start = std::chrono::steady_clock::now();
+  RETURN_IF_NOT_OK(spill_->Read(handle, row));
+  spill_read_us_ += static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+  RETURN_IF_NOT_OK(CollectOpInfoEnd(NameWithID(), "SpillRead", {{"bytes", std::to_string(handle.stored_size)}}));
+  handle = ShuffleSpill::Handle();
   return Status::OK();
 }
 
@@ -108,8 +168,7 @@ Status ShuffleOp::GetShuffledRowImpl(TensorRow *const row, bool is_pull_mode) {
   // tensor table. We remove the data from the shuffle buffer, leaving that slot
   // in the table as an empty vector
   int64_t random_slot = rng_() % (shuffle_last_row_idx_ + 1);
-  TensorRow random_row = std::move((*shuffle_buffer_)[random_slot]);
-  *row = std::move(random_row);
+  RETURN_IF_NOT_OK(TakeRowFromShuffleBuffer(random_slot, row));
 
   // Step 2)
   // Take the last row from shuffle buffer, and swap it into the row position that was
@@ -117,6 +176,8 @@ Status ShuffleOp::GetShuffledRowImpl(TensorRow *const row, bool is_pull_mode) {
   // tail of the shuffle buffer.
   if (random_slot != shuffle_last_row_idx_) {
     (*shuffle_buffer_)[random_slot] = std::move((*shuffle_buffer_)[shuffle_last_row_idx_]);
+    spilled_rows_[random_slot] = spilled_rows_[shuffle_last_row_idx_];
+    spilled_rows_[shuffle_last_row_idx_] = ShuffleSpill::Handle();
   }
 
   // Step 3)
@@ -28,6 +28,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
 #include "minddata/dataset/engine/datasetops/pipeline_op.h"
+#include "minddata/dataset/engine/datasetops/shuffle_spill.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -126,6 +127,12 @@ class ShuffleOp : public PipelineOp {
   // @return Status The status code returned
   Status SelfReset();
 
+  // Private function to take the row of a slot out of the shuffle buffer, reading it back if it was spilled.
+  // @param slot - The slot of the shuffle buffer
+  // @param row - The row of the slot
+  // @return Status The status code returned
+  Status TakeRowFromShuffleBuffer(int64_t slot, TensorRow *row);
+
   int32_t shuffle_size_;  // User config for the size of the shuffle buffer (number of rows)
   uint32_t shuffle_seed_;
   bool reshuffle_each_epoch_;
@@ -142,6 +149,13 @@ class ShuffleOp : public PipelineOp {
 
   std::unique_ptr<ChildIterator> child_iterator_;  // An iterator for fetching.
   bool eof_received_{false};                       // flag to indicate if eof is reached in pull mode.
+
+  // Where the rows of the slots of the shuffle buffer are spilled, segment is -1 for the rows held in memory
+  std::vector<ShuffleSpill::Handle> spilled_rows_;
+  std::unique_ptr<ShuffleSpill> spill_;  // nullptr if the rows are all kept in memory
+  uint64_t memory_limit_;                // Bytes of rows kept in memory before spilling, 0 means no limit
+  uint64_t buffer_bytes_{0};             // Bytes of the rows of the shuffle buffer held in memory
+  uint64_t spill_read_us_{0};            // Time spent reading back spilled rows
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,332 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/shuffle_spill.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#ifndef ENABLE_ANDROID
+#include <zlib.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// the written rows are handed to the writeback in blocks of this size, so that they do not pile up in memory
+constexpr uint64_t kWritebackBlockSize = 8 * 1024 * 1024;
+
+// a record is kept compressed only if it saves at least 1/kMinSavingRatio of the row
+constexpr uint64_t kMinSavingRatio = 8;
+
+template <typename T>
+void Append(std::vector<uint8_t> *buffer, const T &value) {
+  const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+  buffer->insert(buffer->end(), bytes, bytes + sizeof(T));
+}
+
+void AppendBytes(std::vector<uint8_t> *buffer, const void *data, uint64_t size) {
+  if (size > 0) {
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    buffer->insert(buffer->end(), bytes, bytes + size);
+  }
+}
+
+// Reads the fields of a serialized row, checking that they stay within the record
+class RecordReader {
+ public:
+  RecordReader(const uint8_t *data, uint64_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  Status Read(T *value) {
+    const uint8_t *bytes = nullptr;
+    RETURN_IF_NOT_OK(Take(sizeof(T), &bytes));
+    (void)std::memcpy(value, bytes, sizeof(T));
+    return Status::OK();
+  }
+
+  Status Take(uint64_t size, const uint8_t **bytes) {
+    CHECK_FAIL_RETURN_UNEXPECTED(size <= size_ - pos_, "[Internal ERROR] Spilled shuffle row is truncated.");
+    *bytes = data_ + pos_;
+    pos_ += size;
+    return Status::OK();
+  }
+
+ private:
+  const uint8_t *data_;
+  uint64_t size_;
+  uint64_t pos_ = 0;
+};
+
+Status CopyRecord(uint8_t *dst, const uint8_t *src, uint64_t size) {
+  if (size < SECUREC_MEM_MAX_LEN) {
+    int ret_code = memcpy_s(dst, size, src, size);
+    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "Failed to copy spilled shuffle row, got error_t: " +
+                                                    std::to_string(ret_code));
+  } else {
+    (void)std::memcpy(dst, src, size);
+  }
+  return Status::OK();
+}
+}  // namespace
+
+ShuffleSpill::ShuffleSpill(std::string dir, uint64_t segment_size)
+    : dir_(std::move(dir)), segment_size_(segment_size) {}
+
+ShuffleSpill::~ShuffleSpill() { Clear(); }
+
+bool ShuffleSpill::Supported() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool ShuffleSpill::Spillable(const TensorRow &row) {
+  return std::all_of(row.begin(), row.end(), [](const std::shared_ptr<Tensor> &tensor) {
+    if (tensor == nullptr || !tensor->shape().known()) {
+      return false;
+    }
+    if (tensor->type().IsNumeric()) {
+      return tensor->HasData() || tensor->Size() == 0;
+    }
+    return tensor->type().IsString() && tensor->HasData();
+  });
+}
+
+uint64_t ShuffleSpill::RowSize(const TensorRow &row) {
+  uint64_t size = 0;
+  for (const auto &tensor : row) {
+    if (tensor != nullptr) {
+      size += static_cast<uint64_t>(tensor->SizeInBytes());
+    }
+  }
+  return size;
+}
+
+void ShuffleSpill::Serialize(const TensorRow &row, std::vector<uint8_t> *buffer) {
+  buffer->clear();
+  Append<int64_t>(buffer, row.getId());
+  const auto &paths = row.getPath();
+  Append<uint32_t>(buffer, static_cast<uint32_t>(paths.size()));
+  for (const auto &path : paths) {
+    Append<uint32_t>(buffer, static_cast<uint32_t>(path.size()));
+    AppendBytes(buffer, path.data(), path.size());
+  }
+  Append<uint32_t>(buffer, static_cast<uint32_t>(row.size()));
+  for (const auto &tensor : row) {
+    Append<uint8_t>(buffer, static_cast<uint8_t>(tensor->type().value()));
+    const auto &dims = tensor->shape().AsVector();
+    Append<uint32_t>(buffer, static_cast<uint32_t>(dims.size()));
+    for (auto dim : dims) {
+      Append<int64_t>(buffer, dim);
+    }
+    const auto size = static_cast<uint64_t>(tensor->SizeInBytes());
+    Append<uint64_t>(buffer, size);
+    AppendBytes(buffer, tensor->GetBuffer(), size);
+  }
+}
+
+Status ShuffleSpill::Deserialize(const uint8_t *data, uint64_t size, TensorRow *row) {
+  RecordReader reader(data, size);
+  int64_t id = 0;
+  RETURN_IF_NOT_OK(reader.Read(&id));
+  uint32_t num_paths = 0;
+  RETURN_IF_NOT_OK(reader.Read(&num_paths));
+  std::vector<std::string> paths;
+  for (uint32_t i = 0; i < num_paths; i++) {
+    uint32_t length = 0;
+    const uint8_t *bytes = nullptr;
+    RETURN_IF_NOT_OK(reader.Read(&length));
+    RETURN_IF_NOT_OK(reader.Take(length, &bytes));
+    (void)paths.emplace_back(reinterpret_cast<const char *>(bytes), length);
+  }
+  uint32_t num_tensors = 0;
+  RETURN_IF_NOT_OK(reader.Read(&num_tensors));
+  TensorRow result;
+  for (uint32_t i = 0; i < num_tensors; i++) {
+    uint8_t type = 0;
+    uint32_t rank = 0;
+    RETURN_IF_NOT_OK(reader.Read(&type));
+    RETURN_IF_NOT_OK(reader.Read(&rank));
+    std::vector<dsize_t> dims(rank);
+    for (auto &dim : dims) {
+      RETURN_IF_NOT_OK(reader.Read(&dim));
+    }
+    uint64_t length = 0;
+    const uint8_t *bytes = nullptr;
+    RETURN_IF_NOT_OK(reader.Read(&length));
+    RETURN_IF_NOT_OK(reader.Take(length, &bytes));
+    std::shared_ptr<Tensor> tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateFromMemory(TensorShape(dims), DataType(static_cast<DataType::Type>(type)), bytes,
+                                              static_cast<dsize_t>(length), &tensor));
+    result.push_back(std::move(tensor));
+  }
+  result.setId(id);
+  result.setPath(paths);
+  *row = std::move(result);
+  return Status::OK();
+}
+
+Status ShuffleSpill::NewSegment(uint64_t min_size) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  Segment segment;
+  segment.size = std::max(segment_size_, min_size);
+  std::string path = dir_ + "/ms_shuffle_spill_XXXXXX";
+  std::vector<char> name(path.begin(), path.end());
+  name.push_back('\0');
+  segment.fd = mkstemp(name.data());
+  CHECK_FAIL_RETURN_UNEXPECTED(segment.fd >= 0,
+                               "Invalid directory, failed to create a shuffle spill file in: " + dir_ +
+                                 ", errno: " + std::to_string(errno) +
+                                 ". Check the directory set by ds.config.set_shuffle_spill_dir.");
+  // nothing is left on disk once the descriptor is closed, even if the process is killed
+  (void)unlink(name.data());
+#if defined(__linux__)
+  // reserve the blocks ahead, a full disk must fail here rather than fault on a write to the mapping
+  int ret = posix_fallocate(segment.fd, 0, static_cast<off_t>(segment.size));
+#else
+  int ret = ftruncate(segment.fd, static_cast<off_t>(segment.size)) == 0 ? 0 : errno;
+#endif
+  if (ret != 0) {
+    (void)close(segment.fd);
+    RETURN_STATUS_UNEXPECTED("Failed to reserve " + std::to_string(segment.size) +
+                             " bytes for the shuffle spill file in: " + dir_ + ", errno: " + std::to_string(ret));
+  }
+  void *addr = mmap(nullptr, segment.size, PROT_READ | PROT_WRITE, MAP_SHARED, segment.fd, 0);
+  if (addr == MAP_FAILED) {
+    (void)close(segment.fd);
+    RETURN_STATUS_UNEXPECTED("[Internal ERROR] Failed to mmap the shuffle spill file, errno: " +
+                             std::to_string(errno));
+  }
+  segment.data = static_cast<uint8_t *>(addr);
+  if (active_ >= 0 && segments_[active_].live == 0) {
+    ReleaseSegment(&segments_[active_]);
+  }
+  segments_.push_back(segment);
+  active_ = static_cast<int32_t>(segments_.size()) - 1;
+  return Status::OK();
+#else
+  RETURN_STATUS_UNEXPECTED("Spilling the shuffle buffer to disk is not supported on this platform.");
+#endif
+}
+
+void ShuffleSpill::ReleaseSegment(Segment *segment) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (segment->data != nullptr && munmap(segment->data, segment->size) != 0) {
+    MS_LOG(WARNING) << "Failed to unmap the shuffle spill file, errno: " << errno;
+  }
+  if (segment->fd >= 0) {
+    (void)close(segment->fd);
+  }
+#endif
+  segment->data = nullptr;
+  segment->fd = -1;
+}
+
+Status ShuffleSpill::Write(const TensorRow &row, Handle *handle) {
+  RETURN_UNEXPECTED_IF_NULL(handle);
+  CHECK_FAIL_RETURN_UNEXPECTED(Spillable(row), "[Internal ERROR] The row can not be spilled to disk.");
+  Serialize(row, &raw_buffer_);
+  Handle result;
+  result.raw_size = raw_buffer_.size();
+  const uint8_t *record = raw_buffer_.data();
+  uint64_t record_size = raw_buffer_.size();
+#ifndef ENABLE_ANDROID
+  uLongf packed_size = compressBound(static_cast<uLong>(raw_buffer_.size()));
+  packed_buffer_.resize(packed_size);
+  if (compress2(packed_buffer_.data(), &packed_size, raw_buffer_.data(), static_cast<uLong>(raw_buffer_.size()),
+                Z_BEST_SPEED) == Z_OK &&
+      packed_size < record_size - record_size / kMinSavingRatio) {
+    record = packed_buffer_.data();
+    record_size = packed_size;
+    result.compressed = true;
+  }
+#endif
+  if (active_ < 0 || segments_[active_].used + record_size > segments_[active_].size) {
+    RETURN_IF_NOT_OK(NewSegment(record_size));
+  }
+  Segment &segment = segments_[active_];
+  if (record_size > 0) {
+    RETURN_IF_NOT_OK(CopyRecord(segment.data + segment.used, record, record_size));
+  }
+  result.segment = active_;
+  result.offset = segment.used;
+  result.stored_size = record_size;
+  segment.used += record_size;
+  segment.live++;
+#if defined(__linux__)
+  if (segment.used - segment.flushed >= kWritebackBlockSize) {
+    // start the writeback of the block now, the dirty pages of the mapping would otherwise stay in memory
+    (void)sync_file_range(segment.fd, static_cast<off_t>(segment.flushed),
+                          static_cast<off_t>(segment.used - segment.flushed), SYNC_FILE_RANGE_WRITE);
+    segment.flushed = segment.used;
+  }
+#endif
+  spilled_bytes_ += result.raw_size;
+  stored_bytes_ += record_size;
+  *handle = result;
+  return Status::OK();
+}
+
+Status ShuffleSpill::Read(const Handle &handle, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  CHECK_FAIL_RETURN_UNEXPECTED(handle.segment >= 0 && handle.segment < static_cast<int32_t>(segments_.size()) &&
+                                 segments_[handle.segment].data != nullptr,
+                               "[Internal ERROR] Invalid handle of spilled shuffle row.");
+  Segment &segment = segments_[handle.segment];
+  CHECK_FAIL_RETURN_UNEXPECTED(handle.offset + handle.stored_size <= segment.used,
+                               "[Internal ERROR] Invalid handle of spilled shuffle row.");
+  const uint8_t *record = segment.data + handle.offset;
+  if (handle.compressed) {
+#ifndef ENABLE_ANDROID
+    raw_buffer_.resize(handle.raw_size);
+    uLongf raw_size = handle.raw_size;
+    CHECK_FAIL_RETURN_UNEXPECTED(uncompress(raw_buffer_.data(), &raw_size, record, handle.stored_size) == Z_OK &&
+                                   raw_size == handle.raw_size,
+                                 "[Internal ERROR] Failed to decompress spilled shuffle row.");
+    RETURN_IF_NOT_OK(Deserialize(raw_buffer_.data(), handle.raw_size, row));
+#else
+    RETURN_STATUS_UNEXPECTED("[Internal ERROR] Compressed shuffle rows are not supported on this platform.");
+#endif
+  } else {
+    RETURN_IF_NOT_OK(Deserialize(record, handle.stored_size, row));
+  }
+  num_reads_++;
+  if (--segment.live == 0 && handle.segment != active_) {
+    ReleaseSegment(&segment);
+  }
+  return Status::OK();
+}
+
+void ShuffleSpill::Clear() {
+  for (auto &segment : segments_) {
+    ReleaseSegment(&segment);
+  }
+  segments_.clear();
+  active_ = -1;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,123 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SHUFFLE_SPILL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SHUFFLE_SPILL_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// The rows of a shuffle buffer which do not fit in its memory budget, kept on local disk. Each row is serialized and
+// compressed on its own and appended to a segment file mapped into memory, so that drawing a spilled row reads and
+// decompresses only that row. The segment files are unlinked as soon as they are created, a segment is unmapped once
+// all of its rows have been read back.
+class ShuffleSpill {
+ public:
+  // Where a spilled row is stored
+  struct Handle {
+    int32_t segment = -1;      // index of the segment, -1 if the row is not spilled
+    uint64_t offset = 0;       // offset of the record in the segment
+    uint64_t stored_size = 0;  // size of the record in the segment
+    uint64_t raw_size = 0;     // size of the serialized row
+    bool compressed = false;   // whether the record is compressed
+  };
+
+  // @param dir - the directory of the segment files
+  // @param segment_size - the size of a segment file, a larger segment is created for a row which does not fit
+  explicit ShuffleSpill(std::string dir, uint64_t segment_size = kDefaultSegmentSize);
+
+  ~ShuffleSpill();
+
+  ShuffleSpill(const ShuffleSpill &) = delete;
+
+  ShuffleSpill &operator=(const ShuffleSpill &) = delete;
+
+  // @return whether rows can be spilled on this platform
+  static bool Supported();
+
+  // @return whether the row can be serialized, rows holding python objects can not
+  static bool Spillable(const TensorRow &row);
+
+  // @return the number of bytes of the tensors of the row
+  static uint64_t RowSize(const TensorRow &row);
+
+  // Write a row to disk
+  // @param row - the row to spill, must be spillable
+  // @param handle - where the row is stored
+  // @return Status The status code returned
+  Status Write(const TensorRow &row, Handle *handle);
+
+  // Read a spilled row back and release its record
+  // @param handle - where the row is stored
+  // @param row - the row read back
+  // @return Status The status code returned
+  Status Read(const Handle &handle, TensorRow *row);
+
+  // Drop all spilled rows
+  void Clear();
+
+  // @return the number of bytes of the serialized rows written since the creation
+  uint64_t spilled_bytes() const { return spilled_bytes_; }
+
+  // @return the number of bytes written to the segment files since the creation
+  uint64_t stored_bytes() const { return stored_bytes_; }
+
+  // @return the number of rows read back since the creation
+  uint64_t num_reads() const { return num_reads_; }
+
+  static constexpr uint64_t kDefaultSegmentSize = 256 * 1024 * 1024;
+
+ private:
+  struct Segment {
+    int fd = -1;
+    uint8_t *data = nullptr;
+    uint64_t size = 0;
+    uint64_t used = 0;
+    uint64_t flushed = 0;  // end of the bytes handed to the writeback
+    int64_t live = 0;      // number of rows of the segment not read back yet
+  };
+
+  // Create a new segment of at least min_size bytes and make it the active one
+  Status NewSegment(uint64_t min_size);
+
+  // Unmap and close a segment
+  void ReleaseSegment(Segment *segment);
+
+  // Serialize the row into buffer
+  static void Serialize(const TensorRow &row, std::vector<uint8_t> *buffer);
+
+  // Deserialize a row from data
+  static Status Deserialize(const uint8_t *data, uint64_t size, TensorRow *row);
+
+  std::string dir_;
+  uint64_t segment_size_;
+  std::vector<Segment> segments_;
+  int32_t active_ = -1;                  // the segment new rows are appended to
+  std::vector<uint8_t> raw_buffer_;      // reused by serialization and decompression
+  std::vector<uint8_t> packed_buffer_;   // reused by compression
+  uint64_t spilled_bytes_ = 0;
+  uint64_t stored_bytes_ = 0;
+  uint64_t num_reads_ = 0;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SHUFFLE_SPILL_H_
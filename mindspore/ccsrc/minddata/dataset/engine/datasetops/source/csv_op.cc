@@ -19,6 +19,7 @@
 #include <fstream>
 #include <iomanip>
 #include <stdexcept>
+#include <unordered_map>
 
 #include "utils/file_utils.h"
 #include "minddata/dataset/core/config_manager.h"
@@ -58,6 +59,8 @@ CsvOp::CsvParser::CsvParser(int32_t worker_id, JaggedConnector *connector, char
       rows_connector_(connector),
       csv_field_delim_(field_delim),
       column_default_(std::move(column_default)),
+      num_columns_(static_cast<int32_t>(column_default_.size())),
+      bytes_skipped_(0),
       cur_state_(START_OF_FILE),
       pos_(0),
       cur_col_(0),
@@ -118,6 +121,14 @@ int CsvOp::CsvParser::PutRecord(int c) {
     err_message_ = ss.str();
     return -1;
   }
+  int32_t out_col = column_ids_.empty() ? cur_col_ : column_ids_[cur_col_];
+  if (out_col < 0) {
+    // the column is not used, so it is not converted
+    bytes_skipped_ += static_cast<int64_t>(pos_);
+    pos_ = 0;
+    cur_col_++;
+    return 0;
+  }
   Status rc;
   switch (column_default_[cur_col_]->type) {
     case CsvOp::INT:
@@ -142,7 +153,7 @@ int CsvOp::CsvParser::PutRecord(int c) {
       }
       break;
   }
-  if (cur_col_ >= cur_row_.size()) {
+  if (out_col >= cur_row_.size()) {
     std::stringstream ss;
     ss << "Invalid columns, the size of column_names should be greater than or equal to the size of columns of "
        << "loading data, but got the size of column_names: " << cur_col_
@@ -150,7 +161,7 @@ int CsvOp::CsvParser::PutRecord(int c) {
     err_message_ = ss.str();
     return -1;
   }
-  cur_row_[cur_col_] = std::move(t);
+  cur_row_[out_col] = std::move(t);
   pos_ = 0;
   cur_col_++;
   return 0;
@@ -325,8 +336,8 @@ void CsvOp::CsvParser::InitSD() {
         {{State::START_OF_FILE, Message::MS_NORMAL},
          {State::UNQUOTE,
           [this](CsvParser &, char c) -> int {
-            TensorRow row(column_default_.size(), nullptr);
-            std::vector<std::string> file_path(column_default_.size(), file_path_);
+            TensorRow row(num_columns_, nullptr);
+            std::vector<std::string> file_path(num_columns_, file_path_);
             row.setPath(file_path);
             this->cur_row_ = std::move(row);
             this->str_buf_[0] = c;
@@ -336,8 +347,8 @@ void CsvOp::CsvParser::InitSD() {
         {{State::START_OF_FILE, Message::MS_DELIM},
          {State::DELIM,
           [this](CsvParser &, char c) -> int {
-            TensorRow row(column_default_.size(), nullptr);
-            std::vector<std::string> file_path(column_default_.size(), file_path_);
+            TensorRow row(num_columns_, nullptr);
+            std::vector<std::string> file_path(num_columns_, file_path_);
             row.setPath(file_path);
             this->cur_row_ = std::move(row);
             return this->PutRecord(c);
@@ -345,8 +356,8 @@ void CsvOp::CsvParser::InitSD() {
         {{State::START_OF_FILE, Message::MS_QUOTE},
          {State::QUOTE,
           [this](CsvParser &, char c) -> int {
-            TensorRow row(column_default_.size(), nullptr);
-            std::vector<std::string> file_path(column_default_.size(), file_path_);
+            TensorRow row(num_columns_, nullptr);
+            std::vector<std::string> file_path(num_columns_, file_path_);
             row.setPath(file_path);
             this->cur_row_ = std::move(row);
             this->pos_ = 0;
@@ -431,8 +442,8 @@ void CsvOp::CsvParser::InitSD() {
          {State::UNQUOTE,
           [this](CsvParser &, char c) -> int {
             if (this->total_rows_ > this->start_offset_ && this->total_rows_ <= this->end_offset_) {
-              TensorRow row(column_default_.size(), nullptr);
-              std::vector<std::string> file_path(column_default_.size(), file_path_);
+              TensorRow row(num_columns_, nullptr);
+              std::vector<std::string> file_path(num_columns_, file_path_);
               row.setPath(file_path);
               this->cur_row_ = std::move(row);
             }
@@ -444,8 +455,8 @@ void CsvOp::CsvParser::InitSD() {
          {State::DELIM,
           [this](CsvParser &, char c) -> int {
             if (this->total_rows_ > this->start_offset_ && this->total_rows_ <= this->end_offset_) {
-              TensorRow row(column_default_.size(), nullptr);
-              std::vector<std::string> file_path(column_default_.size(), file_path_);
+              TensorRow row(num_columns_, nullptr);
+              std::vector<std::string> file_path(num_columns_, file_path_);
               row.setPath(file_path);
               this->cur_row_ = std::move(row);
             }
@@ -455,8 +466,8 @@ void CsvOp::CsvParser::InitSD() {
          {State::QUOTE,
           [this](CsvParser &, char c) -> int {
             if (this->total_rows_ > this->start_offset_ && this->total_rows_ <= this->end_offset_) {
-              TensorRow row(column_default_.size(), nullptr);
-              std::vector<std::string> file_path(column_default_.size(), file_path_);
+              TensorRow row(num_columns_, nullptr);
+              std::vector<std::string> file_path(num_columns_, file_path_);
               row.setPath(file_path);
               this->cur_row_ = std::move(row);
             }
@@ -471,6 +482,9 @@ Status CsvOp::LoadFile(const std::string &file, int64_t start_offset, int64_t en
   RETURN_IF_NOT_OK(csv_parser.InitCsvParser());
   csv_parser.SetStartOffset(start_offset);
   csv_parser.SetEndOffset(end_offset);
+  if (!column_ids_.empty()) {
+    csv_parser.SetColumnIds(column_ids_, static_cast<int32_t>(column_name_id_map_.size()));
+  }
 
   auto realpath = FileUtils::GetRealPath(file.c_str());
   if (!realpath.has_value()) {
@@ -518,6 +532,7 @@ Status CsvOp::LoadFile(const std::string &file, int64_t start_offset, int64_t en
     RETURN_STATUS_UNEXPECTED("Invalid csv, " + file + " parse failed at line " + err_row + " : value out of range.");
   }
   ifs.close();
+  AddBytesSkipped(csv_parser.GetBytesSkipped());
   return Status::OK();
 }
 
@@ -702,25 +717,55 @@ Status CsvOp::ComputeColMap() {
         RETURN_STATUS_UNEXPECTED("Invalid file, failed to get column name list from csv file: " + csv_file);
       }
     }
+
+    if (column_default_list_.size() < column_name_id_map_.size()) {
+      for (int32_t i = column_default_list_.size(); i < column_name_id_map_.size(); i++) {
+        column_default_list_.push_back(std::make_shared<CsvOp::Record<std::string>>(CsvOp::STRING, ""));
+      }
+    }
+
+    if (column_default_list_.size() != column_name_id_map_.size()) {
+      RETURN_STATUS_UNEXPECTED(
+        "Invalid parameter, the size of column_names should be equal to the size of 'column_defaults', but got "
+        " size of 'column_defaults': " +
+        std::to_string(column_default_list_.size()) +
+        ", size of column_names: " + std::to_string(column_name_id_map_.size()));
+    }
+
+    ProjectColMap();
   } else {
     MS_LOG(WARNING) << "Column name map is already set!";
   }
 
-  if (column_default_list_.size() < column_name_id_map_.size()) {
-    for (int32_t i = column_default_list_.size(); i < column_name_id_map_.size(); i++) {
-      column_default_list_.push_back(std::make_shared<CsvOp::Record<std::string>>(CsvOp::STRING, ""));
+  return Status::OK();
+}
+
+void CsvOp::ProjectColMap() {
+  if (columns_to_load_.empty() || columns_to_load_.size() >= column_name_id_map_.size()) {
+    return;
+  }
+  // a missing column is left to the project op to report
+  std::vector<int32_t> column_ids(column_name_id_map_.size(), -1);
+  for (const auto &column : columns_to_load_) {
+    auto iter = column_name_id_map_.find(column);
+    if (iter == column_name_id_map_.end()) {
+      return;
     }
+    column_ids[iter->second] = 0;
   }
-
-  if (column_default_list_.size() != column_name_id_map_.size()) {
-    RETURN_STATUS_UNEXPECTED(
-      "Invalid parameter, the size of column_names should be equal to the size of 'column_defaults', but got "
-      " size of 'column_defaults': " +
-      std::to_string(column_default_list_.size()) +
-      ", size of column_names: " + std::to_string(column_name_id_map_.size()));
+  // the loaded columns keep their order in file
+  int32_t num_columns = 0;
+  for (auto &column_id : column_ids) {
+    if (column_id >= 0) {
+      column_id = num_columns++;
+    }
   }
-
-  return Status::OK();
+  std::unordered_map<std::string, int32_t> column_name_id_map;
+  for (const auto &column : columns_to_load_) {
+    column_name_id_map[column] = column_ids[column_name_id_map_[column]];
+  }
+  column_name_id_map_ = std::move(column_name_id_map);
+  column_ids_ = std::move(column_ids);
 }
 
 Status CsvOp::ColMapAnalyse(const std::string &csv_file_name) {
@@ -86,6 +86,18 @@ class CsvOp : public NonMappableLeafOp {
 
     std::string GetErrorMessage() { return err_message_; }
 
+    /// Set the output column of each column in file, the columns mapped to -1 are skipped without conversion.
+    /// @param column_ids - the output column ids, indexed by the column in file.
+    /// @param num_columns - the number of output columns.
+    void SetColumnIds(std::vector<int32_t> column_ids, int32_t num_columns) {
+      column_ids_ = std::move(column_ids);
+      num_columns_ = num_columns;
+    }
+
+    /// Get the number of bytes of the skipped columns.
+    /// @return int64_t - the number of bytes skipped.
+    int64_t GetBytesSkipped() const { return bytes_skipped_; }
+
    private:
     enum State : uint8_t {
       START_OF_FILE = 0,
@@ -134,6 +146,9 @@ class CsvOp : public NonMappableLeafOp {
     JaggedConnector *rows_connector_;
     const char csv_field_delim_;
     std::vector<std::shared_ptr<CsvOp::BaseRecord>> column_default_;
+    std::vector<int32_t> column_ids_;
+    int32_t num_columns_;
+    int64_t bytes_skipped_;
     State cur_state_;
     size_t pos_;
     int cur_col_;
@@ -187,6 +202,10 @@ class CsvOp : public NonMappableLeafOp {
   // \return DatasetName of the current Op
   virtual std::string DatasetName(bool upper = false) const { return upper ? "CSV" : "csv"; }
 
+  /// Set the columns which are used by the pipeline, the other columns are not converted into tensors.
+  /// @param columns_to_load - the names of the used columns, empty to load all the columns.
+  void SetColumnsToLoad(const std::vector<std::string> &columns_to_load) { columns_to_load_ = columns_to_load; }
+
  protected:
   // Parses a single row and puts the data into a tensor table.
   // @param line - the content of the row.
@@ -235,10 +254,15 @@ class CsvOp : public NonMappableLeafOp {
   // @return bool - whether column name identical in all CSV files
   bool ColumnNameValidate();
 
+  // Private function for keeping only the columns to load in the column name map
+  void ProjectColMap();
+
   std::vector<std::string> csv_files_list_;
   char field_delim_;
   std::vector<std::shared_ptr<CsvOp::BaseRecord>> column_default_list_;
   std::vector<std::string> column_name_list_;
+  std::vector<std::string> columns_to_load_;
+  std::vector<int32_t> column_ids_;  // output column of each column in file, -1 if it is not loaded
   bool check_flag_ = false;
 };
 }  // namespace dataset
@@ -16,6 +16,8 @@
 
 #include "minddata/dataset/engine/datasetops/source/image_folder_op.h"
 
+#include <sys/stat.h>
+
 #include <unordered_set>
 
 #include "utils/ms_utils.h"
@@ -108,6 +110,18 @@ Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   ImageLabelPair pair_ptr = image_label_pairs_[row_id];
   std::shared_ptr<Tensor> image, label;
   RETURN_IF_NOT_OK(Tensor::CreateScalar(pair_ptr->second, &label));
+  if (!load_image_) {
+    // the size of the image is only counted for the profiler, as it costs a stat of the file
+    auto profiling_manager = GlobalContext::profiling_manager();
+    struct stat file_stat;
+    if (profiling_manager != nullptr && profiling_manager->IsProfilingEnable(tree_) &&
+        stat((folder_path_ + (pair_ptr->first)).c_str(), &file_stat) == 0) {
+      AddBytesSkipped(static_cast<int64_t>(file_stat.st_size));
+    }
+    (*trow) = TensorRow(row_id, {std::move(label)});
+    trow->setPath({std::string("")});
+    return Status::OK();
+  }
 #ifdef ENABLE_PYTHON
   RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(folder_path_ + (pair_ptr->first), &image, decrypt_));
 #else
@@ -325,6 +339,7 @@ Status ImageFolderOp::ComputeColMap() {
     for (int32_t i = 0; i < data_schema_->NumColumns(); ++i) {
       column_name_id_map_[data_schema_->Column(i).Name()] = i;
     }
+    load_image_ = column_name_id_map_.find("image") != column_name_id_map_.end();
   } else {
     MS_LOG(WARNING) << "Column name map is already set!";
   }
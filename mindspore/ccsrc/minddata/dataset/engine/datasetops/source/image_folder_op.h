@@ -163,6 +163,7 @@ class ImageFolderOp : public MappableLeafOp {
   std::string folder_path_;  // directory of image folder
   bool recursive_;
   bool decode_;
+  bool load_image_ = true;            // false if only the label column is used, then the images are not read
   std::set<std::string> extensions_;  // extensions allowed
   std::map<std::string, int32_t> class_index_;
   std::unique_ptr<DataSchema> data_schema_;
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <tuple>
 #include <utility>
 
 #include "utils/ms_utils.h"
@@ -37,6 +38,18 @@ using mindrecord::Schema;
 using mindrecord::ShardOperator;
 using mindrecord::ShardReader;
 
+namespace {
+// create a tensor which aliases the mapped page if owner is given, otherwise copy the data into the tensor
+Status CreateTensorFromBlob(const TensorShape &shape, const DataType &type, const unsigned char *data, uint64_t n_bytes,
+                            const std::shared_ptr<mindrecord::ShardMmapFile> &owner, std::shared_ptr<Tensor> *tensor) {
+  auto length = static_cast<dsize_t>(shape.NumOfElements() * type.SizeInBytes());
+  if (owner != nullptr && static_cast<uint64_t>(length) <= n_bytes) {
+    return Tensor::CreateFromExternalMemory(shape, type, data, length, owner, tensor);
+  }
+  return Tensor::CreateFromMemory(shape, type, data, tensor);
+}
+}  // namespace
+
 // Constructor of the MindRecordOp.
 MindRecordOp::MindRecordOp(int32_t num_mind_record_workers, std::vector<std::string> dataset_file, bool load_dataset,
                            int32_t op_connector_queue_size, const std::vector<std::string> &columns_to_load,
@@ -62,6 +75,8 @@ MindRecordOp::MindRecordOp(int32_t num_mind_record_workers, std::vector<std::str
 
 // Private helper method to encapsulate some common construction/reset tasks
 Status MindRecordOp::Init() {
+  shard_reader_->SetMmapMode(GlobalContext::config_manager()->mindrecord_mmap());
+  shard_reader_->SetPrefetchDepth(GlobalContext::config_manager()->io_prefetch_depth());
   RETURN_IF_NOT_OK(shard_reader_->Open(dataset_file_, load_dataset_, num_mind_record_workers_, columns_to_load_,
                                        operators_, num_padded_));
 
@@ -205,35 +220,42 @@ Status MindRecordOp::WorkerEntry(int32_t worker_id) {
 Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, int32_t worker_id) {
   RETURN_UNEXPECTED_IF_NULL(fetched_row);
   *fetched_row = {};
-  auto task_content_ptr = std::make_shared<mindrecord::TASK_CONTENT>(
-    mindrecord::TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, mindrecord::json>>());
-  RETURN_IF_NOT_OK(shard_reader_->GetNextById(row_id, worker_id, &task_content_ptr));
-  auto task_type = task_content_ptr->first;
-  auto tupled_buffer = task_content_ptr->second;
-  if (task_type == mindrecord::TaskType::kPaddedTask) {
-    RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, {}, mindrecord::json(), task_type));
+  if (shard_reader_->IsMmapMode()) {
+    auto task_content_ptr = std::make_shared<mindrecord::MAPPED_TASK_CONTENT>(
+      mindrecord::TaskType::kCommonTask, std::vector<std::tuple<mindrecord::ShardBlobView, mindrecord::json>>());
+    RETURN_IF_NOT_OK(shard_reader_->GetNextMappedById(row_id, worker_id, &task_content_ptr));
+    auto task_type = task_content_ptr->first;
+    if (task_type == mindrecord::TaskType::kPaddedTask) {
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, nullptr, 0, nullptr, mindrecord::json(), task_type));
+    }
+    for (const auto &tupled_row : task_content_ptr->second) {
+      const auto &view = std::get<0>(tupled_row);
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, view.data, view.size, view.file, std::get<1>(tupled_row), task_type));
+    }
+  } else {
+    auto task_content_ptr = std::make_shared<mindrecord::TASK_CONTENT>(
+      mindrecord::TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, mindrecord::json>>());
+    RETURN_IF_NOT_OK(shard_reader_->GetNextById(row_id, worker_id, &task_content_ptr));
+    auto task_type = task_content_ptr->first;
+    if (task_type == mindrecord::TaskType::kPaddedTask) {
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, nullptr, 0, nullptr, mindrecord::json(), task_type));
+    }
+    for (const auto &tupled_row : task_content_ptr->second) {
+      const auto &columns_blob = std::get<0>(tupled_row);
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, columns_blob.data(), columns_blob.size(), nullptr,
+                                     std::get<1>(tupled_row), task_type));
+    }
+  }
+  if (!fetched_row->empty()) {
     std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
     fetched_row->setPath(file_path);
     fetched_row->setId(row_id);
   }
-  if (tupled_buffer.empty()) {
-    return Status::OK();
-  }
-  if (task_type == mindrecord::TaskType::kCommonTask) {
-    for (const auto &tupled_row : tupled_buffer) {
-      std::vector<uint8_t> columns_blob = std::get<0>(tupled_row);
-      mindrecord::json columns_json = std::get<1>(tupled_row);
-      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, columns_blob, columns_json, task_type));
-      std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
-      fetched_row->setPath(file_path);
-      fetched_row->setId(row_id);
-    }
-  }
-
   return Status::OK();
 }
 
-Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
+Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const uint8_t *columns_blob, uint64_t blob_size,
+                                   const std::shared_ptr<mindrecord::ShardMmapFile> &blob_owner,
                                    const mindrecord::json &columns_json, const mindrecord::TaskType task_type) {
   RETURN_UNEXPECTED_IF_NULL(tensor_row);
   for (int32_t i_col = 0; i_col < columns_to_load_.size(); i_col++) {
@@ -271,9 +293,9 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
         data = reinterpret_cast<const unsigned char *>(data_ptr.get());
       }
     } else {
-      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob, columns_json, &data, &data_ptr,
-                                                          &n_bytes, &column_data_type, &column_data_type_size,
-                                                          &column_shape));
+      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob, blob_size, columns_json, &data,
+                                                          &data_ptr, &n_bytes, &column_data_type,
+                                                          &column_data_type_size, &column_shape));
     }
 
     std::shared_ptr<Tensor> tensor;
@@ -284,6 +306,10 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
     CHECK_FAIL_RETURN_UNEXPECTED(column_data_type_size != 0,
                                  "[Internal ERROR] Found memory size of column data type is 0.");
     auto num_elements = n_bytes / column_data_type_size;
+    // the value lives in the mapped page unless it is decoded into data_ptr, alias it if it is aligned for the type
+    bool alias_blob = blob_owner != nullptr && data_ptr == nullptr && data != nullptr && type.IsNumeric() &&
+                      reinterpret_cast<uintptr_t>(data) % type.SizeInBytes() == 0;
+    auto owner = alias_blob ? blob_owner : nullptr;
     if (type == DataType::DE_STRING) {
       std::string s{data, data + n_bytes};
       RETURN_IF_NOT_OK(Tensor::CreateScalar(s, &tensor));
@@ -299,11 +325,11 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
       } else {
         RETURN_IF_NOT_OK(column.MaterializeTensorShape(static_cast<int32_t>(num_elements), &new_shape));
       }
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(new_shape, type, data, &tensor));
+      RETURN_IF_NOT_OK(CreateTensorFromBlob(new_shape, type, data, n_bytes, owner, &tensor));
     } else {
       std::vector<dsize_t> shapeDetails = {static_cast<dsize_t>(num_elements)};
       auto new_shape = TensorShape(shapeDetails);
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(new_shape, type, data, &tensor));
+      RETURN_IF_NOT_OK(CreateTensorFromBlob(new_shape, type, data, n_bytes, owner, &tensor));
     }
     tensor_row->push_back(std::move(tensor));
   }
@@ -111,6 +111,12 @@ class MindRecordOp : public MappableLeafOp {
 
   bool load_dataset() const { return load_dataset_; }
 
+  /// Getter method
+  /// @return Size of the blobs which are not read because none of their columns is loaded
+  int64_t BytesSkipped() const override {
+    return shard_reader_ == nullptr ? 0 : static_cast<int64_t>(shard_reader_->GetBlobBytesSkipped());
+  }
+
   Status Init();
 
   /// Op name getter
@@ -123,8 +129,12 @@ class MindRecordOp : public MappableLeafOp {
   /// Parses a single cell and puts the data into a tensor
   /// @param tensor_row - the tensor row to put the parsed data in
   /// @param columns_blob - the blob data received from the reader
+  /// @param blob_size - the size of the blob data
+  /// @param blob_owner - the mapped file which holds the blob data in mmap mode, tensors alias the blob data if it
+  ///     is not null, otherwise the data is copied
   /// @param columns_json - the data for fields received from the reader
-  Status LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
+  Status LoadTensorRow(TensorRow *tensor_row, const uint8_t *columns_blob, uint64_t blob_size,
+                       const std::shared_ptr<mindrecord::ShardMmapFile> &blob_owner,
                        const mindrecord::json &columns_json, const mindrecord::TaskType task_type);
 
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override {
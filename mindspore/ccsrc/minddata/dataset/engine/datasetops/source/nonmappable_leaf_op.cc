@@ -15,6 +15,8 @@
  */
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 
+#include <utility>
+
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
 #include "minddata/dataset/engine/execution_tree.h"
@@ -45,6 +47,9 @@ NonMappableLeafOp::NonMappableLeafOp(int32_t num_workers, int32_t worker_connect
       prepared_data_{false},
       curr_row_{0},
       workers_done_{0},
+      skip_rows_(0),
+      rows_skipped_(0),
+      rows_to_drop_(0),
       seed_(0) {
   worker_connector_size_ = worker_connector_size;
 }
@@ -67,6 +72,8 @@ Status NonMappableLeafOp::operator()() {
       RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &fetched_row));
       if (fetched_row.eoe()) {
         workers_done++;
+      } else if (SkipRow(&rows_read)) {
+        continue;
       } else if ((compression_type_ == CompressionType::NONE || compression_type_ == CompressionType::GZIP_WITH_COUNT ||
                   compression_type_ == CompressionType::ZLIB_WITH_COUNT) &&
                  (total_rows_ == 0 || rows_read < total_rows_)) {
@@ -171,6 +178,7 @@ Status NonMappableLeafOp::PostEndOfData() {
 // Pushes a control indicator onto the IOBlockQueue for each worker to consume. When the worker
 // pops this control indicator, it will wait until the next epoch starts and then resume execution.
 Status NonMappableLeafOp::PostEndOfEpoch(int32_t queue_index) {
+  RETURN_IF_NOT_OK(SkipPendingBlocks());
   for (int i = 0; i < num_workers_; ++i) {
     std::unique_ptr<FilenameBlock> eoe = std::make_unique<FilenameBlock>(IOBlock::kFlagEOE);
     RETURN_IF_NOT_OK(PushIoBlockQueue((queue_index + i) % num_workers_, std::move(eoe)));
@@ -190,10 +198,118 @@ Status NonMappableLeafOp::PopIoBlockQueue(int32_t index, std::unique_ptr<Filenam
 
 // Pushes an element to a queue in io_block_queues
 Status NonMappableLeafOp::PushIoBlockQueue(int32_t index, std::unique_ptr<FilenameBlock> &&io_block) {
+  if (skip_rows_ > 0 && !io_block->eoe() && !io_block->eof()) {
+    // Hold the block back until the blocks of all the workers are known
+    pending_blocks_.resize(num_workers_);
+    pending_blocks_[index].push_back(std::move(io_block));
+    return Status::OK();
+  }
   RETURN_IF_NOT_OK(io_block_queues_[index]->Add(std::move(io_block)));
   return Status::OK();
 }
 
+Status NonMappableLeafOp::SkipPendingBlocks() {
+  if (skip_rows_ == 0) {
+    return Status::OK();
+  }
+  const int64_t skip_rows = skip_rows_;
+  skip_rows_ = 0;
+  pending_blocks_.resize(num_workers_);
+
+  // Rows of each pending block, and of all the blocks of each worker
+  std::vector<std::vector<int64_t>> block_rows(num_workers_);
+  std::vector<int64_t> worker_rows(num_workers_, 0);
+  bool rows_known = compression_type_ == CompressionType::NONE;
+  for (int32_t i = 0; i < num_workers_ && rows_known; ++i) {
+    for (const auto &block : pending_blocks_[i]) {
+      int64_t rows = block->GetEndOffset() - block->GetStartOffset();
+      if (block->GetStartOffset() == kInvalidOffset) {
+        std::string filename;
+        RETURN_IF_NOT_OK(block->GetFilename(&filename, *filename_index_));
+        rows = NumRowsOfFile(filename);
+      }
+      if (rows < 0) {
+        rows_known = false;
+        break;
+      }
+      block_rows[i].push_back(rows);
+      worker_rows[i] += rows;
+    }
+  }
+
+  if (rows_known) {
+    // Rows taken by the connector in the first `rounds` rounds
+    auto rows_of_rounds = [&worker_rows](int64_t rounds) {
+      int64_t rows = 0;
+      for (auto worker_row : worker_rows) {
+        rows += std::min(worker_row, rounds);
+      }
+      return rows;
+    };
+    // Find the most complete rounds which are not more than the rows to skip
+    int64_t low = 0;
+    int64_t high = *std::max_element(worker_rows.begin(), worker_rows.end());
+    while (low < high) {
+      int64_t mid = low + (high - low + 1) / 2;
+      if (rows_of_rounds(mid) <= skip_rows) {
+        low = mid;
+      } else {
+        high = mid - 1;
+      }
+    }
+    for (int32_t i = 0; i < num_workers_; ++i) {
+      int64_t to_skip = std::min(worker_rows[i], low);
+      std::vector<std::unique_ptr<FilenameBlock>> blocks;
+      for (size_t j = 0; j < pending_blocks_[i].size(); ++j) {
+        auto &block = pending_blocks_[i][j];
+        if (to_skip >= block_rows[i][j]) {
+          to_skip -= block_rows[i][j];
+          continue;
+        }
+        if (to_skip > 0) {
+          int64_t key = 0;
+          RETURN_IF_NOT_OK(block->GetKey(&key));
+          int64_t start_offset = std::max(block->GetStartOffset(), static_cast<int64_t>(0));
+          block = std::make_unique<FilenameBlock>(key, start_offset + to_skip, start_offset + block_rows[i][j],
+                                                  IOBlock::kFlagNone);
+          to_skip = 0;
+        }
+        blocks.push_back(std::move(block));
+      }
+      pending_blocks_[i] = std::move(blocks);
+    }
+    rows_skipped_ = rows_of_rounds(low);
+    rows_to_drop_ = skip_rows - rows_skipped_;
+  } else {
+    rows_to_drop_ = skip_rows;
+  }
+  MS_LOG(INFO) << Name() << " skips " << rows_skipped_ << " rows in its files and drops " << rows_to_drop_
+               << " rows read, to skip the first " << skip_rows << " rows of the epoch.";
+
+  for (int32_t i = 0; i < num_workers_; ++i) {
+    for (auto &block : pending_blocks_[i]) {
+      RETURN_IF_NOT_OK(PushIoBlockQueue(i, std::move(block)));
+    }
+  }
+  pending_blocks_.clear();
+  return Status::OK();
+}
+
+int64_t NonMappableLeafOp::NumRowsOfFile(const std::string &filename) {
+  auto it = filename_numrows_.find(filename);
+  return it != filename_numrows_.end() ? it->second : -1;
+}
+
+bool NonMappableLeafOp::SkipRow(int64_t *rows_read) {
+  *rows_read += rows_skipped_.exchange(0);
+  if (rows_to_drop_ > 0) {
+    --rows_to_drop_;
+    ++(*rows_read);
+    return true;
+  }
+  return false;
+}
+
 // Overrides base class reset method. Cleans up any state info from it's previous execution and
 // reinitializes itself so that it can be executed again, as if it was just created.
 Status NonMappableLeafOp::Reset() {
@@ -345,7 +461,6 @@ Status NonMappableLeafOp::GetNextRowPullMode(TensorRow *const row) {
     return Status::OK();
   }
   TensorRow new_row;
-  RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &new_row));
   // Pull tensor from jagged_rows_connector queue. It has 4 cases:
   // 1) If eoe signal reaches and all workers have finished reading, propagate eoe to the next op and do a self-reset.
   // 2) If eoe signal reaches but not all the workers finishes reading, consume eoe and pull the next non-eoe tensor
@@ -354,16 +469,22 @@ Status NonMappableLeafOp::GetNextRowPullMode(TensorRow *const row) {
   // 4) If maximum count of rows to be read reaches, notify IOBlockQueue thread and worker thread by setting
   //    load_jagged_connector_ and load_io_block_queue_ to false. Then, drain data from jagged_rows_connector queue
   //    until eoe is hit so that no data remains in all queues and they can be reset properly for the new iteration.
-  while (new_row.eoe()) {
-    workers_done_++;
-    if (static_cast<int32_t>(workers_done_) == num_workers_) {
-      RETURN_IF_NOT_OK(ResetAndUpdateRepeat());
-      *row = TensorRow(TensorRow::kFlagEOE);
-      return Status::OK();
-    } else {
-      RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &new_row));
+  // The rows of a reset epoch which are not skipped in the files are dropped before these, as in the push mode.
+  int64_t rows_read = curr_row_;
+  do {
+    RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &new_row));
+    while (new_row.eoe()) {
+      workers_done_++;
+      if (static_cast<int32_t>(workers_done_) == num_workers_) {
+        RETURN_IF_NOT_OK(ResetAndUpdateRepeat());
+        *row = TensorRow(TensorRow::kFlagEOE);
+        return Status::OK();
+      } else {
+        RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &new_row));
+      }
     }
-  }
+  } while (SkipRow(&rows_read));
+  curr_row_ = static_cast<uint32_t>(rows_read);
 
   if (((compression_type_ == CompressionType::NONE || compression_type_ == CompressionType::GZIP_WITH_COUNT ||
         compression_type_ == CompressionType::ZLIB_WITH_COUNT) &&
@@ -396,6 +517,9 @@ Status NonMappableLeafOp::GetNextRowPullMode(TensorRow *const row) {
 }
 
 Status NonMappableLeafOp::ResetAndUpdateRepeat() {
+  // The rows are skipped in the first epoch only
+  rows_skipped_ = 0;
+  rows_to_drop_ = 0;
   if (IsLastIteration()) {
     finished_reading_dataset_ = true;
     NotifyToFillIOBlockQueue();
@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_NONMAPPABLE_LEAF_OP_H_
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -111,6 +112,11 @@ class NonMappableLeafOp : public ParallelOp<TensorRow, TensorRow> {
   /// \return Status The status code returned
   Status GetNextRowPullMode(TensorRow *const row) override;
 
+  /// \brief Set the number of rows to skip at the beginning of the first epoch, when the pipeline is reset. The rows
+  ///     are skipped in the file blocks handed to the workers, so they are not read.
+  /// \param[in] skip_rows Number of rows to skip
+  void SetSkipRows(int64_t skip_rows) { skip_rows_ = skip_rows; }
+
  protected:
   // The entry point for when workers are launched.
   // @param worker_id - the id of the worker that is executing this function.
@@ -146,6 +152,24 @@ class NonMappableLeafOp : public ParallelOp<TensorRow, TensorRow> {
   // @return Status - the error code returned.
   Status PushIoBlockQueue(int32_t index, std::unique_ptr<FilenameBlock> &&io_block);
 
+  /// \brief Push the file blocks held back while there are rows to skip, once all the blocks of the epoch are known.
+  ///     The jagged connector takes a row from each worker in turn, so the rows to skip are the complete rounds of
+  ///     all the workers, which are taken off the front of the blocks of each worker, then a partial round which is
+  ///     dropped by the master thread. If the rows of a block are not known, all the rows are dropped instead.
+  /// \return Status The status code returned
+  Status SkipPendingBlocks();
+
+  /// \brief Number of rows in a file, used to skip the rows of a block which covers the whole file.
+  /// \param[in] filename The file
+  /// \return The number of rows, or -1 if it is not known
+  virtual int64_t NumRowsOfFile(const std::string &filename);
+
+  /// \brief Account for the rows skipped at the beginning of the epoch, called for each row popped from the jagged
+  ///     connector, by the master thread or by GetNextRowPullMode in the pull mode.
+  /// \param[in, out] rows_read Number of rows of the epoch read so far
+  /// \return True if the popped row is to be dropped
+  bool SkipRow(int64_t *rows_read);
+
   // Reads a tf_file file and loads the data into multiple TensorRows.
   // @param filename - the tf_file file to read.
   // @param start_offset - the start offset of file.
@@ -227,6 +251,10 @@ class NonMappableLeafOp : public ParallelOp<TensorRow, TensorRow> {
   bool prepared_data_;     // flag to indicate whether the data is prepared before taking for pull mode
   uint32_t curr_row_;      // current row number count for pull mode
   uint32_t workers_done_;  // how many workers have done the tensors reading work for pull mode
+  int64_t skip_rows_;      // rows to skip at the beginning of the first epoch
+  std::vector<std::vector<std::unique_ptr<FilenameBlock>>> pending_blocks_;  // blocks held back to skip rows
+  std::atomic<int64_t> rows_skipped_;  // rows taken off the blocks, not yet counted by the master thread
+  std::atomic<int64_t> rows_to_drop_;  // rows the master thread drops
 
  private:
   std::vector<int64_t> shuffled_keys_;  // to store shuffled filename indices
@@ -26,6 +26,8 @@
 
 #include "proto/example.pb.h"
 
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
 #include "minddata/dataset/engine/execution_tree.h"
@@ -105,6 +107,23 @@ Status TFReaderOp::Init() {
   int32_t safe_queue_size = static_cast<int32_t>(std::ceil(dataset_files_list_.size() / num_workers_)) + 1;
   io_block_queues_.Init(num_workers_, safe_queue_size);
 
+  // the features are looked up by the names of the columns when the examples are parsed
+  column_names_.clear();
+  feature_ids_.clear();
+  for (int32_t i = 0; i < data_schema_->NumColumns(); ++i) {
+    column_names_.push_back(data_schema_->Column(i).Name());
+  }
+  for (int32_t i = static_cast<int32_t>(column_names_.size()) - 1; i >= 0; --i) {
+    feature_ids_[column_names_[i]] = i;
+  }
+
+  // gzip streams are read by zlib itself, only the other files are read ahead
+  io_prefetch_depth_ = GlobalContext::config_manager()->io_prefetch_depth();
+  if (io_prefetch_depth_ > 0 && compression_type_ != CompressionType::GZIP &&
+      compression_type_ != CompressionType::GZIP_WITH_COUNT) {
+    async_reader_ = std::make_shared<mindrecord::ShardAsyncReader>(
+      std::min(io_prefetch_depth_, mindrecord::kMaxAsyncReadThreads), io_prefetch_depth_);
+  }
   return Status::OK();
 }
 
@@ -145,6 +164,8 @@ Status TFReaderOp::operator()() {
       RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &fetched_row));
       if (fetched_row.eoe()) {
         workers_done++;
+      } else if (SkipRow(&rows_read)) {
+        continue;
       } else if ((compression_type_ == CompressionType::NONE || compression_type_ == CompressionType::GZIP_WITH_COUNT ||
                   compression_type_ == CompressionType::ZLIB_WITH_COUNT) &&
                  (total_rows_ == 0 || rows_read < total_rows_)) {
@@ -226,6 +247,17 @@ Status TFReaderOp::operator()() {
   return Status::OK();
 }
 
+int64_t TFReaderOp::NumRowsOfFile(const std::string &filename) {
+  auto it = filename_numrows_.find(filename);
+  if (it != filename_numrows_.end()) {
+    return it->second;
+  }
+  // Only the record headers are read to count the rows
+  int64_t num = CountTotalRowsSectioned({filename}, 0, 1, compression_type_);
+  filename_numrows_[filename] = num;
+  return num;
+}
+
 Status TFReaderOp::CalculateNumRowsPerShard() {
   if (!equal_rows_per_shard_) {
     return Status::OK();
@@ -280,17 +312,24 @@ Status TFReaderOp::ParsingWorkerEntry(int32_t worker_id) {
 Status TFReaderOp::ParseExample(const TensorRow &raw_bytes, TensorRow *parsed_row) {
   auto filename = raw_bytes.getPath()[0];
   auto itr = raw_bytes[0]->begin<std::string_view>();
-  dataengine::Example tf_record_example;
-  CHECK_FAIL_RETURN_UNEXPECTED(tf_record_example.ParseFromString(static_cast<std::string>(*itr)),
-                               "TFReaderOp: failed to parse example in tfrecord file: " + filename +
-                                 ". Perhaps the version of protobuf is not compatible. The example bytes is " +
-                                 static_cast<std::string>(*itr));
 
   auto num_columns = data_schema_->NumColumns();
   TensorRow parsed_example(num_columns, nullptr);
   std::vector<std::string> file_path(num_columns, filename);
   parsed_example.setPath(file_path);
-  RETURN_IF_NOT_OK(LoadExample(&tf_record_example, &parsed_example));
+
+  // Only the features of the columns are decoded from the serialized example. The examples which the wire parser
+  // does not accept are deserialized by protobuf, which also reports the errors of the malformed ones.
+  bool handled = false;
+  RETURN_IF_NOT_OK(LoadExampleFromWire(*itr, &parsed_example, &handled));
+  if (!handled) {
+    dataengine::Example tf_record_example;
+    CHECK_FAIL_RETURN_UNEXPECTED(tf_record_example.ParseFromArray((*itr).data(), static_cast<int>((*itr).size())),
+                                 "TFReaderOp: failed to parse example in tfrecord file: " + filename +
+                                   ". Perhaps the version of protobuf is not compatible. The example bytes is " +
+                                   static_cast<std::string>(*itr));
+    RETURN_IF_NOT_OK(LoadExample(&tf_record_example, &parsed_example));
+  }
 
   *parsed_row = std::move(parsed_example);
   return Status::OK();
@@ -333,15 +372,15 @@ Status TFReaderOp::SendRecordBytesRow(const std::string &filename, const std::st
 
 Status TFReaderOp::HelperLoadNonCompFile(const std::string &filename, int64_t start_offset, int64_t end_offset,
                                          int32_t worker_id, const std::string &realpath_value) {
-  std::ifstream reader;
-  reader.open(realpath_value, std::ios::in);
-  if (!reader) {
+  mindrecord::ShardPrefetchStream reader(async_reader_, kTFRecordPrefetchChunkSize, io_prefetch_depth_);
+  if (reader.Open(realpath_value).IsError()) {
     RETURN_STATUS_UNEXPECTED("Invalid file, " + filename + " open failed: permission denied!");
   }
 
   int64_t rows_total = 0;
+  uint64_t read_size = 0;
 
-  while (reader.peek() != EOF) {
+  while (!reader.Eof()) {
     if (!GetLoadJaggedConnector()) {
       break;
     }
@@ -349,29 +388,27 @@ Status TFReaderOp::HelperLoadNonCompFile(const std::string &filename, int64_t st
 
     // read length
     std::streamsize record_length = 0;
-    (void)reader.read(reinterpret_cast<char *>(&record_length), kTFRecordRecLenSize);
+    RETURN_IF_NOT_OK(reader.Read(&record_length, kTFRecordRecLenSize, &read_size));
 
     // ignore crc header
-    (void)reader.ignore(kTFRecordHeadFootSize);
-
-    // read serialized Example
-    std::string serialized_example;
-    serialized_example.resize(static_cast<size_t>(record_length));
-    (void)reader.read(&serialized_example[0], record_length);
+    reader.Skip(kTFRecordHeadFootSize);
 
     if (start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset)) {
-      auto s = SendRecordBytesRow(filename, serialized_example, worker_id);
-      if (s != Status::OK()) {
-        reader.close();
-        return s;
-      }
+      // read serialized Example
+      std::string serialized_example;
+      serialized_example.resize(static_cast<size_t>(record_length));
+      RETURN_IF_NOT_OK(reader.Read(&serialized_example[0], static_cast<uint64_t>(record_length), &read_size));
+      RETURN_IF_NOT_OK(SendRecordBytesRow(filename, serialized_example, worker_id));
+    } else {
+      // the rows of other shards are not copied out
+      reader.Skip(static_cast<uint64_t>(record_length));
     }
 
     // ignore crc footer
-    (void)reader.ignore(static_cast<std::streamsize>(kTFRecordHeadFootSize));
+    reader.Skip(kTFRecordHeadFootSize);
     rows_total++;
   }
-  reader.close();
+  reader.Close();
   return Status::OK();
 }
 
@@ -457,14 +494,14 @@ Status TFReaderOp::HelperLoadCompZLIBFile(const std::string &filename, int64_t s
                                           int32_t worker_id, const std::string &realpath_value) {
   // ZLIB stream setup (based on zlib.h tutorial)
   ZLIBStreamInf zlib_stream;
-  std::ifstream reader(realpath_value, std::ios::in | std::ios::binary);
-  if (!reader) {
+  mindrecord::ShardPrefetchStream reader(async_reader_, kTFRecordPrefetchChunkSize, io_prefetch_depth_);
+  if (reader.Open(realpath_value).IsError()) {
     RETURN_STATUS_UNEXPECTED("Invalid file, " + filename + " open failed: permission denied!");
   }
 
   zlib_stream.inflate_status = inflateInit(&zlib_stream.strm);
   if (zlib_stream.inflate_status != Z_OK) {
-    reader.close();
+    reader.Close();
     RETURN_STATUS_UNEXPECTED("Failed to initialize inflate stream for ZLIB for file " + filename + "!");
   }
 
@@ -482,8 +519,13 @@ Status TFReaderOp::HelperLoadCompZLIBFile(const std::string &filename, int64_t s
     }
     RETURN_IF_INTERRUPTED();
 
-    (void)reader.read(zlib_stream.input_stream, kZLIBChunkSize);
-    zlib_stream.strm.avail_in = static_cast<unsigned int>(reader.gcount());
+    uint64_t read_size = 0;
+    auto rc = reader.Read(zlib_stream.input_stream, kZLIBChunkSize, &read_size);
+    if (rc.IsError()) {
+      (void)inflateEnd(&zlib_stream.strm);
+      return rc;
+    }
+    zlib_stream.strm.avail_in = static_cast<unsigned int>(read_size);
     if (zlib_stream.strm.avail_in == 0) {
       break;
     }
@@ -499,7 +541,7 @@ Status TFReaderOp::HelperLoadCompZLIBFile(const std::string &filename, int64_t s
       // inflate the stream
       auto s = HelperInflateZLIB(&zlib_stream, filename);
       if (s != Status::OK()) {
-        reader.close();
+        reader.Close();
         return s;
       }
       if (zlib_stream.left_to_read != 0) {
@@ -509,7 +551,7 @@ Status TFReaderOp::HelperLoadCompZLIBFile(const std::string &filename, int64_t s
       // Process inflated data depending on read flag
       s = HelperProcessZLIBData(&zlib_stream, &rows_read, &rows_total, filename, start_offset, end_offset, worker_id);
       if (s != Status::OK()) {
-        reader.close();
+        reader.Close();
         return s;
       }
       zlib_stream.read_flag = (zlib_stream.read_flag + 1) %
@@ -519,12 +561,12 @@ Status TFReaderOp::HelperLoadCompZLIBFile(const std::string &filename, int64_t s
 
   (void)inflateEnd(&zlib_stream.strm);
   if (zlib_stream.inflate_status != Z_STREAM_END && rows_read < end_offset) {
-    reader.close();
+    reader.Close();
     RETURN_STATUS_UNEXPECTED("Decompression of ZLIB file failed for file " + filename + "!");
   }
 
   if (compression_type_ == CompressionType::ZLIB && rows_read < end_offset) {
-    reader.close();
+    reader.Close();
     std::string errMsg = "This tfrecord file: " + filename +
                          ", does not meet minimum rows per shard requirement: " + std::to_string(total_rows_) +
                          " and " + std::to_string(static_cast<int>(total_rows_ / num_devices_)) +
@@ -532,7 +574,7 @@ Status TFReaderOp::HelperLoadCompZLIBFile(const std::string &filename, int64_t s
                          " number of rows in this file.";
     RETURN_STATUS_UNEXPECTED(errMsg);
   }
-  reader.close();
+  reader.Close();
   return Status::OK();
 }
 
@@ -694,7 +736,9 @@ Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const dataengine::Feature
       break;
     }
     case dataengine::Feature::KindCase::kInt64List: {
-      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, column_values_list, &num_elements, &ts));
+      const dataengine::Int64List &int64_list = column_values_list.int64_list();
+      num_elements = int64_list.value_size();
+      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, int64_list.value().data(), num_elements, &ts));
       break;
     }
     case dataengine::Feature::KindCase::KIND_NOT_SET: {
@@ -714,6 +758,221 @@ Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const dataengine::Feature
   return Status::OK();
 }
 
+// Parses the columns of a single row from the wire format and puts the data into a tensor table.
+Status TFReaderOp::LoadExampleFromWire(const std::string_view &serialized_example, TensorRow *out_row, bool *handled) {
+  RETURN_UNEXPECTED_IF_NULL(handled);
+  *handled = false;
+  parsed::Example example;
+  if (!dataset::ParseExample(serialized_example, &example)) {
+    return Status::OK();
+  }
+
+  // A feature which appears more than once takes the last value, the same as the protobuf map.
+  std::vector<parsed::Feature *> features(column_names_.size(), nullptr);
+  int64_t bytes_skipped = 0;
+  for (auto iter = example.rbegin(); iter != example.rend(); ++iter) {
+    auto feature_id = feature_ids_.find(iter->first);
+    if (feature_id == feature_ids_.end()) {
+      // the features which are not in columns_list are never decoded
+      bytes_skipped += static_cast<int64_t>(iter->second.ByteSize());
+    } else if (features[feature_id->second] == nullptr) {
+      features[feature_id->second] = &iter->second;
+    }
+  }
+
+  auto num_columns = static_cast<int32_t>(column_names_.size());
+  for (int32_t col = 0; col < num_columns; ++col) {
+    const ColDescriptor &current_col = data_schema_->Column(col);
+    parsed::Feature *feature = features[feature_ids_.find(column_names_[col])->second];
+    if (feature == nullptr) {
+      RETURN_STATUS_UNEXPECTED("Invalid columns_list, column name: " + current_col.Name() +
+                               " does not exist in tfrecord file, check tfrecord files.");
+    }
+    RETURN_IF_NOT_OK(LoadFeatureFromWire(out_row, feature, current_col, col, handled));
+    if (!*handled) {
+      return Status::OK();
+    }
+  }
+  AddBytesSkipped(bytes_skipped);
+  return Status::OK();
+}
+
+// Parses a single cell from the wire format and puts the data into a tensor table.
+Status TFReaderOp::LoadFeatureFromWire(TensorRow *tensor_row, parsed::Feature *feature,
+                                       const ColDescriptor &current_col, int32_t col, bool *handled) {
+  *handled = false;
+  DataType example_type;
+  if (feature->ParseDataType(&example_type).IsError()) {
+    return Status::OK();
+  }
+
+  std::shared_ptr<Tensor> ts;
+  switch (example_type.value()) {
+    case DataType::DE_STRING: {
+      RETURN_IF_NOT_OK(LoadBytesListFromWire(current_col, *feature, &ts, handled));
+      break;
+    }
+    case DataType::DE_FLOAT32: {
+      RETURN_IF_NOT_OK(LoadFloatListFromWire(current_col, *feature, &ts, handled));
+      break;
+    }
+    case DataType::DE_INT64: {
+      RETURN_IF_NOT_OK(LoadIntListFromWire(current_col, *feature, &ts, handled));
+      break;
+    }
+    case DataType::DE_UNKNOWN: {
+      // a feature without a value list is left to the protobuf path, which reports it
+      return Status::OK();
+    }
+    default: {
+      std::string err_msg =
+        "Unrecognized datatype, column type in tfrecord file must be uint8, int64 or float32, check tfrecord file.";
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+  }
+
+  if (*handled) {
+    (*tensor_row)[col] = std::move(ts);
+  }
+  return Status::OK();
+}
+
+Status TFReaderOp::LoadBytesListFromWire(const ColDescriptor &current_col, const parsed::Feature &feature,
+                                         std::shared_ptr<Tensor> *tensor, bool *handled) {
+  if (current_col.Type() != DataType::DE_UINT8 && current_col.Type() != DataType::DE_INT8 &&
+      current_col.Type() != DataType::DE_STRING) {
+    std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                          " should be int8, uint8 or string, but got " + current_col.Type().ToString();
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+
+  std::vector<std::string> bytes_list;
+  if (!feature.ParseBytesList(&bytes_list)) {
+    return Status::OK();
+  }
+  auto num_elements = static_cast<int32_t>(bytes_list.size());
+
+  if (current_col.Type() == DataType::DE_STRING) {
+    TensorShape shape = TensorShape::CreateScalar();
+    RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &shape));
+    RETURN_IF_NOT_OK(Tensor::CreateFromVector(bytes_list, shape, tensor));
+    *handled = true;
+    return Status::OK();
+  }
+
+  uint64_t max_size = 0;
+  for (const auto &bytes : bytes_list) {
+    max_size = std::max<uint64_t>(max_size, bytes.size());
+  }
+  int64_t pad_size = 0;
+  RETURN_IF_NOT_OK(GetBytesListPadSize(current_col, max_size, &pad_size));
+  if (max_size > static_cast<uint64_t>(pad_size)) {
+    // leave the elements which do not fit to the protobuf path
+    return Status::OK();
+  }
+
+  // every element is padded with spaces to pad_size
+  TensorShape current_shape = TensorShape::CreateScalar();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements * pad_size, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+  unsigned char *current_tensor_addr = (*tensor)->GetMutableBuffer();
+  for (const auto &bytes : bytes_list) {
+    if (!bytes.empty()) {
+      int ret_code = memcpy_s(current_tensor_addr, pad_size, bytes.data(), bytes.size());
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "memcpy_s failed when reading bytesList element into Tensor");
+    }
+    auto chars_to_pad = pad_size - static_cast<int64_t>(bytes.size());
+    if (chars_to_pad > 0) {
+      int ret_code = memset_s(current_tensor_addr + bytes.size(), chars_to_pad, static_cast<int>(' '), chars_to_pad);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "memset_s failed when padding Tensor");
+    }
+    current_tensor_addr += pad_size;
+  }
+  *handled = true;
+  return Status::OK();
+}
+
+Status TFReaderOp::LoadFloatListFromWire(const ColDescriptor &current_col, const parsed::Feature &feature,
+                                         std::shared_ptr<Tensor> *tensor, bool *handled) {
+  if (current_col.Type() != DataType::DE_FLOAT32) {
+    std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                          " should be float32, but got " + current_col.Type().ToString();
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+
+  int num_elements = 0;
+  if (!feature.GetNumElementsInFloatList(&num_elements)) {
+    return Status::OK();
+  }
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+  if (num_elements > 0) {
+    // the values are parsed straight into the buffer of the tensor
+    LimitedArraySlice<float> float_list(reinterpret_cast<float *>((*tensor)->GetMutableBuffer()),
+                                        static_cast<size_t>(num_elements));
+    if (!feature.ParseFloatList(&float_list)) {
+      return Status::OK();
+    }
+  }
+  *handled = true;
+  return Status::OK();
+}
+
+// Parses a serialized int64 list straight into the buffer of the tensor as type T, a value out of the range of T
+// fails the parse and the row goes through the protobuf path, which keeps the cast of the values
+template <typename T>
+bool TFReaderOp::ParseIntListFromWire(const parsed::Feature &feature, int num_elements,
+                                      const std::shared_ptr<Tensor> &tensor) {
+  LimitedArraySlice<T> int_list(reinterpret_cast<T *>(tensor->GetMutableBuffer()), static_cast<size_t>(num_elements));
+  return feature.ParseInt64List(&int_list);
+}
+
+Status TFReaderOp::LoadIntListFromWire(const ColDescriptor &current_col, const parsed::Feature &feature,
+                                       std::shared_ptr<Tensor> *tensor, bool *handled) {
+  if (!(current_col.Type().IsInt())) {
+    std::string err_msg = "Invalid column type, the column type of " + current_col.Name() + " should be int, but got " +
+                          current_col.Type().ToString();
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+
+  int num_elements = 0;
+  if (!feature.GetNumElementsInInt64List(&num_elements)) {
+    return Status::OK();
+  }
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+  if (num_elements == 0) {
+    *handled = true;
+    return Status::OK();
+  }
+
+  if (current_col.Type() == DataType::DE_UINT64) {
+    *handled = ParseIntListFromWire<uint64_t>(feature, num_elements, *tensor);
+  } else if (current_col.Type() == DataType::DE_INT64) {
+    *handled = ParseIntListFromWire<int64_t>(feature, num_elements, *tensor);
+  } else if (current_col.Type() == DataType::DE_UINT32) {
+    *handled = ParseIntListFromWire<uint32_t>(feature, num_elements, *tensor);
+  } else if (current_col.Type() == DataType::DE_INT32) {
+    *handled = ParseIntListFromWire<int32_t>(feature, num_elements, *tensor);
+  } else if (current_col.Type() == DataType::DE_UINT16) {
+    *handled = ParseIntListFromWire<uint16_t>(feature, num_elements, *tensor);
+  } else if (current_col.Type() == DataType::DE_INT16) {
+    *handled = ParseIntListFromWire<int16_t>(feature, num_elements, *tensor);
+  } else if (current_col.Type() == DataType::DE_UINT8) {
+    *handled = ParseIntListFromWire<uint8_t>(feature, num_elements, *tensor);
+  } else if (current_col.Type() == DataType::DE_INT8) {
+    *handled = ParseIntListFromWire<int8_t>(feature, num_elements, *tensor);
+  } else {
+    std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                          " should be uint64, int64, uint32, int32, uint16, int16, uint8 or int8, but got " +
+                          current_col.Type().ToString();
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  return Status::OK();
+}
+
 Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
                                  int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   // kBytesList can map to the following DE types ONLY!
@@ -746,7 +1005,20 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
 #endif
   }
 
-  int64_t pad_size = max_size;
+  int64_t pad_size = 0;
+  RETURN_IF_NOT_OK(GetBytesListPadSize(current_col, max_size, &pad_size));
+
+  // know how many elements there are and the total bytes, create tensor here:
+  TensorShape current_shape = TensorShape::CreateScalar();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape((*num_elements) * pad_size, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, current_shape, current_col.Type(), pad_size, tensor));
+
+  return Status::OK();
+}
+
+Status TFReaderOp::GetBytesListPadSize(const ColDescriptor &current_col, uint64_t max_size, int64_t *pad_size) {
+  RETURN_UNEXPECTED_IF_NULL(pad_size);
+  *pad_size = static_cast<int64_t>(max_size);
 
   // if user provides a shape in the form of [-1, d1, 2d, ... , dn], we need to pad to d1 * d2 * ... * dn
   if (current_col.HasShape()) {
@@ -762,7 +1034,7 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
         }
         new_pad_size *= cur_shape[i];
       }
-      pad_size = new_pad_size;
+      *pad_size = new_pad_size;
     } else {
       if (cur_shape.known() && cur_shape.NumOfElements() != max_size) {
         std::string err_msg = "Data dimensions of '" + current_col.Name() +
@@ -773,12 +1045,6 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
       }
     }
   }
-
-  // know how many elements there are and the total bytes, create tensor here:
-  TensorShape current_shape = TensorShape::CreateScalar();
-  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape((*num_elements) * pad_size, &current_shape));
-  RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, current_shape, current_col.Type(), pad_size, tensor));
-
   return Status::OK();
 }
 
@@ -788,7 +1054,7 @@ Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataeng
   // DE_FLOAT32
   if (current_col.Type() != DataType::DE_FLOAT32) {
     std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
-                          " should be string, but got " + current_col.Type().ToString();
+                          " should be float32, but got " + current_col.Type().ToString();
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
@@ -806,24 +1072,24 @@ Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataeng
 }
 
 // Determines which template type to use and calls LoadIntList
-Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                                     int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
+Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const int64_t *int64_list, int32_t num_elements,
+                                     std::shared_ptr<Tensor> *tensor) {
   if (current_col.Type() == DataType::DE_UINT64) {
-    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, int64_list, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT64) {
-    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, int64_list, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT32) {
-    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, int64_list, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT32) {
-    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, int64_list, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT16) {
-    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, int64_list, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT16) {
-    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, int64_list, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT8) {
-    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, int64_list, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT8) {
-    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, int64_list, num_elements, tensor));
   } else {
     std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
                           " should be uint64, int64, uint32, int32, uint16, int16, uint8 or int8, but got " +
@@ -837,29 +1103,23 @@ Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dat
 // Reads values from a bytes list and casts the value to type T, must be an integral type
 // compatible with int64_t
 template <typename T>
-Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                               int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
+Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const int64_t *int64_list, int32_t num_elements,
+                               std::shared_ptr<Tensor> *tensor) {
   if (!(current_col.Type().IsInt())) {
     std::string err_msg = "Invalid column type, the column type of " + current_col.Name() + " should be int, but got " +
                           current_col.Type().ToString();
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::Int64List &int64_list = column_values_list.int64_list();
-
-  // Identify how many values we have and then create a local array of these
-  // to deserialize into
-  *num_elements = int64_list.value_size();
-
   // know how many elements there are, create tensor here:
   TensorShape current_shape = TensorShape::CreateUnknownRankShape();
-  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
   RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
 
   int64_t i = 0;
   auto it = (*tensor)->begin<T>();
   for (; it != (*tensor)->end<T>(); i++, ++it) {
-    T element = static_cast<T>(int64_list.value(i));
+    T element = static_cast<T>(int64_list[i]);
     *it = element;
   }
 
@@ -26,6 +26,8 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 #include <map>
@@ -38,6 +40,8 @@
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/jagged_connector.h"
+#include "minddata/dataset/kernels/data/example_parser.h"
+#include "minddata/mindrecord/include/shard_async_reader.h"
 
 namespace dataengine {
 class Example;
@@ -50,6 +54,7 @@ namespace dataset {
 const std::streamsize kTFRecordRecLenSize = sizeof(int64_t);
 const std::streamsize kTFRecordHeadFootSize = sizeof(int32_t);  // header has same size with footer
 const std::streamsize kZLIBChunkSize = 16384;
+const uint64_t kTFRecordPrefetchChunkSize = 1048576;  // size of each read ahead of the records being loaded
 
 template <typename T>
 class Queue;
@@ -288,6 +293,39 @@ class TFReaderOp : public NonMappableLeafOp {
   Status LoadFeature(TensorRow *tensor_row, const dataengine::Feature &column_values_list,
                      const ColDescriptor &current_col, int32_t col);
 
+  /// \brief Parse the columns of the schema from the wire format of a serialized example. The features which are
+  ///     not in the schema are skipped without being decoded.
+  /// \param[in] serialized_example The serialized example.
+  /// \param[out] out_row The row to put the parsed data in.
+  /// \param[out] handled False if the example has to be parsed by protobuf instead, e.g. it is malformed.
+  /// \return Status code.
+  Status LoadExampleFromWire(const std::string_view &serialized_example, TensorRow *out_row, bool *handled);
+
+  /// \brief Parse a single cell from the wire format and put it into the row.
+  /// \param[in] feature The serialized feature of the cell.
+  /// \param[in] current_col The column descriptor containing the expected shape and type of the data.
+  /// \param[out] handled False if the feature has to be parsed by protobuf instead.
+  /// \return Status code.
+  Status LoadFeatureFromWire(TensorRow *tensor_row, parsed::Feature *feature, const ColDescriptor &current_col,
+                             int32_t col, bool *handled);
+
+  /// \brief Read the values of a serialized bytes list into a tensor.
+  static Status LoadBytesListFromWire(const ColDescriptor &current_col, const parsed::Feature &feature,
+                                      std::shared_ptr<Tensor> *tensor, bool *handled);
+
+  /// \brief Read the values of a serialized float list straight into a tensor.
+  static Status LoadFloatListFromWire(const ColDescriptor &current_col, const parsed::Feature &feature,
+                                      std::shared_ptr<Tensor> *tensor, bool *handled);
+
+  /// \brief Read the values of a serialized int64 list straight into a tensor of the column type.
+  static Status LoadIntListFromWire(const ColDescriptor &current_col, const parsed::Feature &feature,
+                                    std::shared_ptr<Tensor> *tensor, bool *handled);
+
+  /// \brief Parse the values of a serialized int64 list into the buffer of the tensor as type T.
+  template <typename T>
+  static bool ParseIntListFromWire(const parsed::Feature &feature, int num_elements,
+                                   const std::shared_ptr<Tensor> &tensor);
+
   /// Reads values from a bytes list
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
   /// @param column_values_list - the cell that contains the bytes list to read from.
@@ -296,6 +334,13 @@ class TFReaderOp : public NonMappableLeafOp {
   static Status LoadBytesList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
                               int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
+  /// Gets the size which each element of a bytes list is padded to
+  /// @param current_col - the column descriptor containing the expected shape and type of the data.
+  /// @param max_size - the size of the longest element in the bytes list.
+  /// @param pad_size - the size to pad to.
+  /// @return Status - the error code returned.
+  static Status GetBytesListPadSize(const ColDescriptor &current_col, uint64_t max_size, int64_t *pad_size);
+
   /// Reads values from a float list
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
   /// @param column_values_list - the cell that contains the float list to read from.
@@ -308,22 +353,22 @@ class TFReaderOp : public NonMappableLeafOp {
   /// Reads values from a bytes list and casts the value to type T, must be an integral
   /// type compatible with int64_t
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
-  /// @param column_values_list - the cell that contains the int list to read from.
+  /// @param int64_list - the values of the int list.
   /// @Param num_elements - number of values in the int list.
   /// @param tensor - the tensor we read the values into.
   /// @return Status - the error code returned.
   template <typename T>
-  Status LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                     int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
+  Status LoadIntList(const ColDescriptor &current_col, const int64_t *int64_list, int32_t num_elements,
+                     std::shared_ptr<Tensor> *tensor);
 
   /// Determines which template type to use and calls LoadIntList
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
-  /// @param column_values_list - the cell that contains the int list to read from.
-  /// @Param numElements - number of values in the int list.
+  /// @param int64_list - the values of the int list.
+  /// @Param num_elements - number of values in the int list.
   /// @param tensor - the tensor we read the values into.
   /// @return Status - the error code returned.
-  Status LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                           int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
+  Status LoadIntListSwitch(const ColDescriptor &current_col, const int64_t *int64_list, int32_t num_elements,
+                           std::shared_ptr<Tensor> *tensor);
 
   /// Reads one row of data from a tf file and creates a schema based on that row
   /// @return Status - the error code returned.
@@ -357,6 +402,11 @@ class TFReaderOp : public NonMappableLeafOp {
   // @return Status - the error code returned.
   Status CalculateNumRowsPerShard() override;
 
+  /// \brief Base-class override, counts the rows of the files not counted yet.
+  /// \param[in] filename The file
+  /// \return The number of rows, or -1 if it is not known
+  int64_t NumRowsOfFile(const std::string &filename) override;
+
   /// Private function for computing the assignment of the column name map.
   /// @return - Status
   Status ComputeColMap() override;
@@ -366,6 +416,10 @@ class TFReaderOp : public NonMappableLeafOp {
   std::unique_ptr<DataSchema> data_schema_;
   bool equal_rows_per_shard_;
   bool decode_;  // whether to parse the proto
+  int32_t io_prefetch_depth_ = 0;                               // number of reads kept in flight
+  std::shared_ptr<mindrecord::ShardAsyncReader> async_reader_;  // reads the files ahead, shared by the workers
+  std::vector<std::string> column_names_;                       // names of the columns to parse
+  std::unordered_map<std::string_view, int32_t> feature_ids_;   // first column of each name, refers to column_names_
 };
 }  // namespace dataset
 }  // namespace mindspore
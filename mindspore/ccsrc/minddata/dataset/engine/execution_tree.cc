@@ -22,6 +22,7 @@
 #include "minddata/dataset/engine/datasetops/data_queue_op.h"
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
 #include "minddata/dataset/engine/perf/info_collector.h"
+#include "minddata/dataset/util/run_slots.h"
 #include "minddata/dataset/util/task_manager.h"
 #ifdef WITH_BACKEND
 #include "mindspore/core/utils/numa_interface.h"
@@ -38,15 +39,23 @@ ExecutionTree::ExecutionTree(std::shared_ptr<ConfigManager> cfg)
     : rank_id_(cfg->rank_id()),
       numa_enable_(cfg->numa_enable()),
       handle_(nullptr),
+      numa_placement_(cfg->numa_placement()),
+      num_numa_nodes_(1),
+      device_numa_node_(0),
       id_count_(0),
       tree_state_(kDeTStateInit),
-      prepare_flags_(0) {
+      prepare_flags_(0),
+      executor_mode_(cfg->executor_mode()) {
   tg_ = std::make_unique<TaskGroup>();
   root_ = nullptr;
   unique_id_ = Services::GetUniqueID();
 }
 #else
-ExecutionTree::ExecutionTree() : id_count_(0), tree_state_(kDeTStateInit), prepare_flags_(0) {
+ExecutionTree::ExecutionTree()
+    : id_count_(0),
+      tree_state_(kDeTStateInit),
+      prepare_flags_(0),
+      executor_mode_(GlobalContext::config_manager()->executor_mode()) {
   tg_ = std::make_unique<TaskGroup>();
   root_ = nullptr;
   unique_id_ = Services::GetUniqueID();
@@ -174,6 +183,11 @@ Status ExecutionTree::Launch() {
     RETURN_IF_NOT_OK(NumaBind(handle_.get(), rank_id_));
     MS_LOG(INFO) << "Numa bind memory and cpu successful.";
   }
+  // On top of the process level bind, the numa placement binds each thread of the tree to a numa node of its own,
+  // see PlaceOnNumaNode.
+  if (numa_placement_ != NumaPlacement::kNone) {
+    RETURN_IF_NOT_OK(PrepareNumaPlacement());
+  }
 #endif
   int32_t thread_num = get_nprocs();
   if (thread_num == 0) {
@@ -195,6 +209,14 @@ Status ExecutionTree::Launch() {
   std::ostringstream ss;
   ss << *this;
   MS_LOG(DEBUG) << "Printing the tree before launch tasks:\n" << ss.str();
+  // Under the shared executor, the threads of the tree take turns on as many run slots as the cpus the process may
+  // use. A thread hands its slot over whenever it blocks on a connector, so the ops still wait on each other through
+  // the capacity of the connectors, but the threads no longer preempt one another.
+  if (executor_mode_ == ExecutorMode::kShared) {
+    int32_t num_slots = RunSlots::CpuQuota();
+    tg_->SetRunSlots(std::make_shared<RunSlots>(num_slots));
+    MS_LOG(INFO) << "Shared executor: the threads of the tree run on " << num_slots << " run slots.";
+  }
   for (auto itr = this->begin(); itr != this->end(); ++itr) {
     // An inlined operator is one that has an output connector size of 0, and it does not
     // require a thread to execute.  Instead, the work of this operator is executed inlined
@@ -204,7 +226,8 @@ Status ExecutionTree::Launch() {
     itr->state_ = DatasetOp::OpState::kDeOpRunning;
     itr->Launch();
     if (!itr->inlined()) {
-      RETURN_IF_NOT_OK(tg_->CreateAsyncTask(itr->NameWithID(), std::ref(*itr), nullptr, itr->id()));
+      RETURN_IF_NOT_OK(
+        tg_->CreateAsyncTask(itr->NameWithID(), PlaceOnNumaNode(std::ref(*itr), itr->id()), nullptr, itr->id()));
       // Set if this task group has data queue op
       if (itr->Name() == kDeviceQueueOp) {
         tg_->HasDataQueue(true);
@@ -251,7 +274,8 @@ Status ExecutionTree::LaunchWorkers(int32_t num_workers, std::function<Status(ui
   worker_tasks->resize(num_workers);
   for (size_t i = 0; i < num_workers; ++i) {
     Task *task = nullptr;
-    RETURN_IF_NOT_OK(tg_->CreateAsyncTask(name, std::bind(func, i), &task, operator_id));
+    RETURN_IF_NOT_OK(
+      tg_->CreateAsyncTask(name, PlaceOnNumaNode(std::bind(func, i), operator_id, i), &task, operator_id));
     CHECK_FAIL_RETURN_UNEXPECTED(task != nullptr, "Failed to create a new worker");
     (*worker_tasks)[i] = task;
   }
@@ -266,6 +290,58 @@ Status ExecutionTree::LaunchWorkers(int32_t num_workers, std::function<Status(ui
   return LaunchWorkers(num_workers, func, &tasks, name, operator_id);
 }
 
+std::function<Status()> ExecutionTree::PlaceOnNumaNode(std::function<Status()> func, int32_t operator_id,
+                                                      int32_t worker_id) const {
+#if defined(WITH_BACKEND) && !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__) && !defined(ENABLE_ANDROID)
+  if (numa_placement_ == NumaPlacement::kNone || handle_ == nullptr) {
+    return func;
+  }
+  // The binding is done by the thread itself, since the memory policy only applies to the calling thread. Once the
+  // thread runs on the node, the tensors it allocates are backed by the memory of the node on first touch.
+  int32_t node_id = NumaNodeOf(operator_id, worker_id);
+  std::shared_ptr<void> handle = handle_;
+  return [func = std::move(func), handle = std::move(handle), node_id]() -> Status {
+    RETURN_IF_NOT_OK(NumaBindThread(handle.get(), node_id));
+    return func();
+  };
+#else
+  return func;
+#endif
+}
+
+#ifdef WITH_BACKEND
+Status ExecutionTree::PrepareNumaPlacement() {
+  if (handle_ == nullptr) {
+    handle_ = GetNumaAdapterHandle();
+    if (handle_ == nullptr) {
+      RETURN_STATUS_UNEXPECTED("Numa package (libnuma.so) not found.");
+    }
+  }
+  RETURN_IF_NOT_OK(GetNumaNodeCount(handle_.get(), &num_numa_nodes_));
+  if (num_numa_nodes_ <= 1) {
+    MS_LOG(INFO) << "There is only one numa node, the threads of the pipeline are not placed.";
+    numa_placement_ = NumaPlacement::kNone;
+    return Status::OK();
+  }
+  // Same node as the process level bind of NumaBind
+  device_numa_node_ = rank_id_ >= 0 ? rank_id_ % num_numa_nodes_ : 0;
+  MS_LOG(INFO) << "Numa placement: " << static_cast<int32_t>(numa_placement_) << ", numa nodes: " << num_numa_nodes_
+               << ", numa node of the device: " << device_numa_node_ << ".";
+  return Status::OK();
+}
+
+int32_t ExecutionTree::NumaNodeOf(int32_t operator_id, int32_t worker_id) const {
+  // The main thread of an op and the threads of the root, which hand the rows to the device or to the consumer of
+  // the pipeline, stay next to the device. So does everything under the kDevice policy.
+  if (numa_placement_ != NumaPlacement::kSpread || worker_id < 0 || root_ == nullptr || root_->id() == operator_id) {
+    return device_numa_node_;
+  }
+  // The workers of an op are dealt over the nodes starting from the one of the device, so that an op with fewer
+  // workers than nodes keeps them all next to the device.
+  return (device_numa_node_ + worker_id) % num_numa_nodes_;
+}
+#endif
+
 // Walks the tree to perform modifications to the tree in post-order to get it ready for execution.
 Status ExecutionTree::Prepare(bool is_pull_mode) {
   if (root_ == nullptr) {
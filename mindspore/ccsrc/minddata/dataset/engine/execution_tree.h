@@ -180,6 +180,15 @@ class ExecutionTree {
   Status LaunchWorkers(int32_t num_workers, std::function<Status(uint32_t)> func, std::string name = "",
                        int32_t operator_id = -1);
 
+  /// \brief Wrap the entry function of a thread of an operator so that the thread first binds itself to the numa node
+  ///     chosen for it by the numa placement policy. The function is returned as is if there is no placement.
+  /// \param func - The function entry point that the thread will execute
+  /// \param operator_id - The id of the operator owning the thread
+  /// \param worker_id - The id of the worker, or -1 for the main thread of the operator
+  /// \return The function to pass to the TaskGroup
+  std::function<Status()> PlaceOnNumaNode(std::function<Status()> func, int32_t operator_id,
+                                          int32_t worker_id = -1) const;
+
   /// \brief Getter method
   /// \return shared_ptr to the root operator
   std::shared_ptr<DatasetOp> root() const { return root_; }
@@ -230,12 +239,25 @@ class ExecutionTree {
   void PrintNode(std::ostream &out, const std::shared_ptr<DatasetOp> &dataset_op, std::string indent, bool last,
                  bool detailed) const;
 
+#ifdef WITH_BACKEND
+  /// \brief Find the numa nodes of the host and the one of the device before the threads are launched.
+  /// \return Status The status code returned
+  Status PrepareNumaPlacement();
+
+  /// \brief Choose the numa node of a thread.
+  /// \param operator_id - The id of the operator owning the thread
+  /// \param worker_id - The id of the worker, or -1 for the main thread of the operator
+  /// \return The id of the numa node
+  int32_t NumaNodeOf(int32_t operator_id, int32_t worker_id) const;
+#endif
+
   std::unique_ptr<TaskGroup> tg_;    // Class for worker management
   std::shared_ptr<DatasetOp> root_;  // The root node of the tree
   int32_t id_count_;                 // Counter for generating operator id's
   TreeState tree_state_;             // Tracking the current tree state
   uint32_t prepare_flags_;           // Flags used during tree prepare
   std::string unique_id_;            // A unique identifier for the tree
+  ExecutorMode executor_mode_;       // How the threads of the tree are executed
 
 #ifdef WITH_BACKEND
   // Constructor for if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
@@ -246,6 +268,9 @@ class ExecutionTree {
   int32_t rank_id_;
   bool numa_enable_;
   std::shared_ptr<void> handle_;
+  NumaPlacement numa_placement_;  // How the threads of the tree are placed on numa nodes
+  int32_t num_numa_nodes_;        // Number of numa nodes of the host, known once the tree is launched
+  int32_t device_numa_node_;      // The numa node of the device the tree feeds
 #endif
 };
 }  // namespace dataset
@@ -18,6 +18,7 @@
 
 #include "minddata/dataset/engine/opt/pass.h"
 #include "minddata/dataset/engine/datasetops/cache_merge_op.h"
+#include "minddata/dataset/engine/serdes.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -43,6 +44,14 @@ Status CacheMergeNode::Build(std::vector<std::shared_ptr<DatasetOp>> *node_ops)
   RETURN_IF_NOT_OK(cache_->Build());
   std::shared_ptr<DatasetOp> merge_op = nullptr;
   RETURN_IF_NOT_OK(cache_->CreateCacheMergeOp(num_workers_, connector_que_size_, &merge_op));
+  // The pipeline of the cache miss stream keys the cache if the server persists it. It is only fingerprinted then.
+  CHECK_FAIL_RETURN_UNEXPECTED(children_.size() == CacheMergeOp::kNumChildren,
+                               "Internal error. CacheMergeNode requires 2 children, but got: " +
+                                 std::to_string(children_.size()));
+  std::shared_ptr<DatasetNode> child = children_[CacheMergeOp::kCacheMissChildIdx];
+  std::static_pointer_cast<CacheMergeOp>(merge_op)->SetFingerprintFunc([child](CacheFingerprint *fingerprint) {
+    return Serdes::Fingerprint(child, &fingerprint->pipeline, &fingerprint->source);
+  });
   merge_op->SetTotalRepeats(GetTotalRepeats());
   merge_op->SetNumRepeatsPerEpoch(GetNumRepeatsPerEpoch());
   node_ops->push_back(merge_op);
@@ -18,6 +18,7 @@
 
 #include "minddata/dataset/engine/datasetops/cache_op.h"
 #include "minddata/dataset/engine/opt/pass.h"
+#include "minddata/dataset/engine/serdes.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -47,6 +48,11 @@ Status CacheNode::Build(std::vector<std::shared_ptr<DatasetOp>> *node_ops) {
   RETURN_IF_NOT_OK(cache_->Build());
   std::shared_ptr<DatasetOp> cache_op = nullptr;
   RETURN_IF_NOT_OK(cache_->CreateCacheOp(num_workers_, connector_que_size_, sampler_, &cache_op));
+  // The pipeline below keys the cache if the server persists it. It is only fingerprinted then.
+  std::shared_ptr<DatasetNode> child = children_[0];
+  std::static_pointer_cast<CacheOp>(cache_op)->SetFingerprintFunc([child](CacheFingerprint *fingerprint) {
+    return Serdes::Fingerprint(child, &fingerprint->pipeline, &fingerprint->source);
+  });
   cache_op->SetTotalRepeats(GetTotalRepeats());
   cache_op->SetNumRepeatsPerEpoch(GetNumRepeatsPerEpoch());
   node_ops->push_back(cache_op);
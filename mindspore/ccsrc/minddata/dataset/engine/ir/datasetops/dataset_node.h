@@ -469,8 +469,18 @@ class NonMappableSourceNode : public DatasetNode {
 
   void SetSkipSteps(int64_t skip_steps) { skip_steps_ = skip_steps; }
 
+  /// \brief Whether the leaf op can skip the first rows of the epoch by itself, without reading them, when the
+  ///     pipeline is reset. This requires that the leaf op is the op producing the rows, with no shuffle op over it.
+  /// \return True if SetSkipRows can be used in place of a skip node over this node
+  virtual bool SupportsSkipRows() const { return false; }
+
+  /// \brief Set the number of rows the leaf op skips at the beginning of its first epoch
+  /// \param[in] skip_rows Number of rows to skip
+  void SetSkipRows(int64_t skip_rows) { skip_rows_ = skip_rows; }
+
  protected:
   int64_t skip_steps_ = 0;
+  int64_t skip_rows_ = 0;
 };
 }  // namespace dataset
 }  // namespace mindspore
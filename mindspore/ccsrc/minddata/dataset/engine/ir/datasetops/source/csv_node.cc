@@ -20,6 +20,7 @@
 #include <utility>
 
 #include "minddata/dataset/engine/datasetops/source/csv_op.h"
+#include "minddata/dataset/engine/opt/pass.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -51,6 +52,7 @@ std::shared_ptr<DatasetNode> CSVNode::Copy() {
                                         shuffle_, num_shards_, shard_id_, cache_);
   (void)node->SetNumWorkers(num_workers_);
   (void)node->SetConnectorQueueSize(connector_que_size_);
+  node->SetColumnsToLoad(columns_to_load_);
   return node;
 }
 
@@ -110,6 +112,7 @@ Status CSVNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_ops) {
   std::shared_ptr<CsvOp> csv_op = std::make_shared<CsvOp>(
     sorted_dataset_files, field_delim_, column_default_list, column_names_, num_workers_, num_samples_,
     worker_connector_size_, connector_que_size_, shuffle_files, num_shards_, shard_id_);
+  csv_op->SetColumnsToLoad(columns_to_load_);
 
   RETURN_IF_NOT_OK(csv_op->Init());
 
@@ -231,5 +234,21 @@ Status CSVNode::MakeSimpleProducer() {
   num_samples_ = 0;
   return Status::OK();
 }
+
+// Visitor accepting method for IRNodePass
+Status CSVNode::Accept(IRNodePass *p, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+  // Downcast shared pointer then call visitor
+  return p->Visit(shared_from_base<CSVNode>(), modified);
+}
+
+// Visitor accepting method for IRNodePass
+Status CSVNode::AcceptAfter(IRNodePass *const p, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+  // Downcast shared pointer then call visitor
+  return p->VisitAfter(shared_from_base<CSVNode>(), modified);
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -107,6 +107,11 @@ class CSVNode : public NonMappableSourceNode {
   ShuffleMode Shuffle() const { return shuffle_; }
   int32_t NumShards() const { return num_shards_; }
   int32_t ShardId() const { return shard_id_; }
+  const std::vector<std::string> &ColumnsToLoad() const { return columns_to_load_; }
+
+  /// \brief Setter function for the columns which are used by the pipeline, the other columns are not converted
+  /// \param[in] columns_to_load The names of the used columns, empty to load all the columns
+  void SetColumnsToLoad(const std::vector<std::string> &columns_to_load) { columns_to_load_ = columns_to_load; }
 
   /// \brief Get the arguments of node
   /// \param[out] out_json JSON string of all attributes
@@ -135,6 +140,18 @@ class CSVNode : public NonMappableSourceNode {
   /// \return Status of the function
   Status MakeSimpleProducer() override;
 
+  /// \brief Base-class override for accepting IRNodePass visitor
+  /// \param[in] p The node to visit
+  /// \param[out] modified Indicator if the node was modified
+  /// \return Status of the node visit
+  Status Accept(IRNodePass *p, bool *const modified) override;
+
+  /// \brief Base-class override for accepting IRNodePass visitor
+  /// \param[in] p The node to visit
+  /// \param[out] modified Indicator if the node was modified
+  /// \return Status of the node visit
+  Status AcceptAfter(IRNodePass *const p, bool *const modified) override;
+
  private:
   std::vector<std::string> dataset_files_;
   char field_delim_;
@@ -144,6 +161,7 @@ class CSVNode : public NonMappableSourceNode {
   ShuffleMode shuffle_;
   int32_t num_shards_;
   int32_t shard_id_;
+  std::vector<std::string> columns_to_load_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -16,6 +16,7 @@
 
 #include "minddata/dataset/engine/ir/datasetops/source/image_folder_node.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <set>
@@ -24,6 +25,7 @@
 #include <vector>
 
 #include "minddata/dataset/engine/datasetops/source/image_folder_op.h"
+#include "minddata/dataset/engine/opt/pass.h"
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/engine/serdes.h"
 #endif
@@ -70,6 +72,7 @@ std::shared_ptr<DatasetNode> ImageFolderNode::Copy() {
 #endif
   (void)node->SetNumWorkers(num_workers_);
   (void)node->SetConnectorQueueSize(connector_que_size_);
+  node->SetColumnsToLoad(columns_to_load_);
   return node;
 }
 
@@ -91,7 +94,13 @@ Status ImageFolderNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const nod
   // This arg is exist in ImageFolderOp, but not externalized (in Python API).
   std::unique_ptr<DataSchema> schema = std::make_unique<DataSchema>();
   TensorShape scalar = TensorShape::CreateScalar();
-  RETURN_IF_NOT_OK(schema->AddColumn(ColDescriptor("image", DataType(DataType::DE_UINT8), TensorImpl::kFlexible, 1)));
+  // The image column is left out when only the label column is used, so that the images are not read.
+  bool load_image = columns_to_load_.empty() ||
+                    std::find(columns_to_load_.begin(), columns_to_load_.end(), "image") != columns_to_load_.end();
+  if (load_image) {
+    RETURN_IF_NOT_OK(
+      schema->AddColumn(ColDescriptor("image", DataType(DataType::DE_UINT8), TensorImpl::kFlexible, 1)));
+  }
   RETURN_IF_NOT_OK(
     schema->AddColumn(ColDescriptor("label", DataType(DataType::DE_INT32), TensorImpl::kFlexible, 0, &scalar)));
   std::shared_ptr<SamplerRT> sampler_rt = nullptr;
@@ -189,5 +198,21 @@ Status ImageFolderNode::from_json(nlohmann::json json_obj, std::shared_ptr<Datas
   return Status::OK();
 }
 #endif
+
+// Visitor accepting method for IRNodePass
+Status ImageFolderNode::Accept(IRNodePass *p, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+  // Downcast shared pointer then call visitor
+  return p->Visit(shared_from_base<ImageFolderNode>(), modified);
+}
+
+// Visitor accepting method for IRNodePass
+Status ImageFolderNode::AcceptAfter(IRNodePass *const p, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+  // Downcast shared pointer then call visitor
+  return p->VisitAfter(shared_from_base<ImageFolderNode>(), modified);
+}
 }  // namespace dataset
 }  // namespace mindspore
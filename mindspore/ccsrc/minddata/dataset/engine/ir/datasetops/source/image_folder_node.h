@@ -86,6 +86,12 @@ class ImageFolderNode : public MappableSourceNode {
   bool Recursive() const { return recursive_; }
   const std::map<std::string, int32_t> &ClassIndexing() const { return class_indexing_; }
   const std::set<std::string> &Exts() const { return exts_; }
+  const std::vector<std::string> &ColumnsToLoad() const { return columns_to_load_; }
+
+  /// \brief Setter function for the columns which are used by the pipeline, the images are not read if only the
+  ///     label column is used
+  /// \param[in] columns_to_load The names of the used columns, empty to load all the columns
+  void SetColumnsToLoad(const std::vector<std::string> &columns_to_load) { columns_to_load_ = columns_to_load; }
 
   /// \brief Get the arguments of node
   /// \param[out] out_json JSON string of all attributes
@@ -107,6 +113,18 @@ class ImageFolderNode : public MappableSourceNode {
   /// \brief Sampler setter
   void SetSampler(std::shared_ptr<SamplerObj> sampler) override { sampler_ = sampler; }
 
+  /// \brief Base-class override for accepting IRNodePass visitor
+  /// \param[in] p The node to visit
+  /// \param[out] modified Indicator if the node was modified
+  /// \return Status of the node visit
+  Status Accept(IRNodePass *p, bool *const modified) override;
+
+  /// \brief Base-class override for accepting IRNodePass visitor
+  /// \param[in] p The node to visit
+  /// \param[out] modified Indicator if the node was modified
+  /// \return Status of the node visit
+  Status AcceptAfter(IRNodePass *const p, bool *const modified) override;
+
  private:
   std::string dataset_dir_;
   bool decode_;
@@ -114,6 +132,7 @@ class ImageFolderNode : public MappableSourceNode {
   std::shared_ptr<SamplerObj> sampler_;
   std::map<std::string, int32_t> class_indexing_;
   std::set<std::string> exts_;
+  std::vector<std::string> columns_to_load_;
 #ifdef ENABLE_PYTHON
   py::function decrypt_;
 #endif
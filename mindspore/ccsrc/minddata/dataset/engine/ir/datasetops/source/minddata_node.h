@@ -86,6 +86,14 @@ class MindDataNode : public MappableSourceNode {
   Status GetDatasetSize(const std::shared_ptr<DatasetSizeGetter> &size_getter, bool estimate,
                         int64_t *dataset_size) override;
 
+  /// \brief Getter functions
+  const std::vector<std::string> &ColumnsList() const { return columns_list_; }
+  const nlohmann::json &PaddedSample() const { return padded_sample_; }
+
+  /// \brief Setter function for the columns to read from the mindrecord files
+  /// \param[in] columns_list The names of the columns to read, empty to read all the columns
+  void SetColumnsList(const std::vector<std::string> &columns_list) { columns_list_ = columns_list; }
+
   /// \brief Sampler getter
   /// \return SamplerObj of the current node
   std::shared_ptr<SamplerObj> Sampler() override { return sampler_; }
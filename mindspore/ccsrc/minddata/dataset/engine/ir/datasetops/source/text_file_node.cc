@@ -102,6 +102,7 @@ Status TextFileNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_o
     shuffle_op->Skip(skip_steps_);
     node_ops->push_back(shuffle_op);
   }
+  text_file_op->SetSkipRows(skip_rows_);
   text_file_op->SetTotalRepeats(GetTotalRepeats());
   text_file_op->SetNumRepeatsPerEpoch(GetNumRepeatsPerEpoch());
   // Add TextFileOp
@@ -110,6 +111,10 @@ Status TextFileNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_o
   return Status::OK();
 }
 
+bool TextFileNode::SupportsSkipRows() const {
+  return shuffle_ != ShuffleMode::kGlobal && !IsCached() && !IsDescendantOfCache();
+}
+
 // Get the shard id of node
 Status TextFileNode::GetShardId(int32_t *shard_id) {
   *shard_id = shard_id_;
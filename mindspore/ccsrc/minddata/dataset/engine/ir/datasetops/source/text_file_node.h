@@ -104,6 +104,11 @@ class TextFileNode : public NonMappableSourceNode {
   /// \return Status of the function
   Status MakeSimpleProducer() override;
 
+  /// \brief Base-class override, the TextFile op skips the rows of a reset epoch in its files, unless they are globally
+  ///     shuffled, or cached.
+  /// \return True if SetSkipRows can be used in place of a skip node over this node
+  bool SupportsSkipRows() const override;
+
  private:
   std::vector<std::string> dataset_files_;
   int32_t num_samples_;
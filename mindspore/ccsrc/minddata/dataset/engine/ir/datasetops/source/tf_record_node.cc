@@ -227,6 +227,7 @@ Status TFRecordNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_o
     shuffle_op->Skip(skip_steps_);
     node_ops->push_back(shuffle_op);
   }
+  tf_reader_op->SetSkipRows(skip_rows_);
   tf_reader_op->SetTotalRepeats(GetTotalRepeats());
   tf_reader_op->SetNumRepeatsPerEpoch(GetNumRepeatsPerEpoch());
   // Add TFReaderOp
@@ -234,6 +235,10 @@ Status TFRecordNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_o
   return Status::OK();
 }
 
+bool TFRecordNode::SupportsSkipRows() const {
+  return shuffle_ != ShuffleMode::kGlobal && compression_type_.empty() && !IsCached() && !IsDescendantOfCache();
+}
+
 // Get the shard id of node
 Status TFRecordNode::GetShardId(int32_t *const shard_id) {
   *shard_id = shard_id_;
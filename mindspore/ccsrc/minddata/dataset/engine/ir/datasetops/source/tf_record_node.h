@@ -117,6 +117,10 @@ class TFRecordNode : public NonMappableSourceNode {
   /// \param[in] decode Whether to decode.
   void SetDecode(bool decode) { decode_ = decode; }
 
+  /// \brief Set the columns to read from the tfrecord files
+  /// \param[in] columns_list The names of the columns to read, empty to read all the columns
+  void SetColumnsList(const std::vector<std::string> &columns_list) { columns_list_ = columns_list; }
+
   /// \brief Create DataSchema object with the input.
   /// \param[out] data_schema The output data schema.
   Status CreateDataSchema(DataSchema *data_schema);
@@ -135,6 +139,7 @@ class TFRecordNode : public NonMappableSourceNode {
   ShuffleMode Shuffle() const { return shuffle_; }
   int32_t NumShards() const { return num_shards_; }
   bool ShardEqualRows() const { return shard_equal_rows_; }
+  bool Decode() const { return decode_; }
 
   /// \brief Get the arguments of node
   /// \param[out] out_json JSON string of all attributes
@@ -163,6 +168,11 @@ class TFRecordNode : public NonMappableSourceNode {
   /// \return Status of the function
   Status MakeSimpleProducer() override;
 
+  /// \brief Base-class override, the TFRecord op skips the rows of a reset epoch in its files, unless they are globally
+  ///     shuffled or compressed, or cached.
+  /// \return True if SetSkipRows can be used in place of a skip node over this node
+  bool SupportsSkipRows() const override;
+
   /// \brief Base-class override for accepting IRNodePass visitor
   /// \param[in] p The node to visit
   /// \param[out] modified Indicator if the node was modified
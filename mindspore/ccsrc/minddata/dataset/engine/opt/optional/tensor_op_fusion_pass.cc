@@ -16,6 +16,7 @@
 
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -23,12 +24,39 @@
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
+#include "minddata/dataset/kernels/ir/vision/center_crop_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/horizontal_flip_ir.h"
+#include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_pad_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/random_horizontal_flip_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
+#include "minddata/dataset/kernels/ir/vision/resize_ir.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// a chain is only fused when it holds at least two operations
+constexpr size_t kMinChainLength = 2;
+
+// the stages of a chain which is fused into a Decode, in the order they appear in the chain
+enum class FusionStage { kGeometric = 0, kNormalize = 1, kLayout = 2 };
+
+// the operations which can be fused into a preceding Decode
+const std::map<std::string, FusionStage> kDecodeFusionRules = {
+  {vision::kRandomResizedCropOperation, FusionStage::kGeometric},
+  {vision::kResizeOperation, FusionStage::kGeometric},
+  {vision::kCenterCropOperation, FusionStage::kGeometric},
+  {vision::kHorizontalFlipOperation, FusionStage::kGeometric},
+  {vision::kRandomHorizontalFlipOperation, FusionStage::kGeometric},
+  {vision::kNormalizeOperation, FusionStage::kNormalize},
+  {vision::kHwcToChwOperation, FusionStage::kLayout},
+};
+}  // namespace
 
 Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modified) {
   RETURN_UNEXPECTED_IF_NULL(node);
@@ -51,20 +79,138 @@ Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modi
   }  // end of temporary code, needs to be deleted when tensorOperation's pybind completes
 
   // logic below is for non-prebuilt TensorOperation
-  pattern = {vision::kDecodeOperation, vision::kRandomResizedCropOperation};
-  itr = std::search(ops.begin(), ops.end(), pattern.begin(), pattern.end(),
-                    [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
+  std::vector<std::shared_ptr<TensorOperation>> fused_ops;
+  size_t i = 0;
+  while (i < ops.size()) {
+    std::shared_ptr<TensorOperation> fused_op;
+    size_t end = MatchDecodeChain(ops, i);
+    if (end - i >= kMinChainLength) {
+      std::vector<std::shared_ptr<TensorOperation>> chain(ops.begin() + i, ops.begin() + end);
+      RETURN_IF_NOT_OK(LowerDecodeChain(chain, &fused_op));
+    } else if ((end = MatchNormalizeChain(ops, i)) - i >= kMinChainLength) {
+      std::vector<std::shared_ptr<TensorOperation>> chain(ops.begin() + i, ops.begin() + end);
+      RETURN_IF_NOT_OK(LowerNormalizeChain(chain, &fused_op));
+    } else {
+      fused_ops.push_back(ops[i]);
+      ++i;
+      continue;
+    }
+    fused_ops.push_back(fused_op);
+    i = end;
+  }
 
   // return here if no pattern is found
-  RETURN_OK_IF_TRUE(itr == ops.end());
-  auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>((itr + 1)->get());
-  RETURN_UNEXPECTED_IF_NULL(fused_ir);
-  // fuse the two ops
-  (*itr) = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
-  ops.erase(itr + 1);
-  node->setOperations(ops);
+  RETURN_OK_IF_TRUE(fused_ops.size() == ops.size());
+  node->setOperations(fused_ops);
   *modified = true;
   return Status::OK();
 }
+
+size_t TensorOpFusionPass::MatchDecodeChain(const std::vector<std::shared_ptr<TensorOperation>> &ops, size_t begin) {
+  if (ops[begin] == nullptr || ops[begin]->Name() != vision::kDecodeOperation ||
+      ops[begin]->Type() != MapTargetDevice::kCpu) {
+    return begin;
+  }
+  size_t end = begin + 1;
+  FusionStage last_stage = FusionStage::kGeometric;
+  for (; end < ops.size(); ++end) {
+    if (ops[end] == nullptr || ops[end]->Type() != MapTargetDevice::kCpu) {
+      break;
+    }
+    auto rule = kDecodeFusionRules.find(ops[end]->Name());
+    // the geometric operations may repeat, the pixel operations follow them once each
+    if (rule == kDecodeFusionRules.end() || rule->second < last_stage ||
+        (rule->second == last_stage && last_stage != FusionStage::kGeometric)) {
+      break;
+    }
+    last_stage = rule->second;
+  }
+  return end;
+}
+
+Status TensorOpFusionPass::LowerDecodeChain(const std::vector<std::shared_ptr<TensorOperation>> &chain,
+                                            std::shared_ptr<TensorOperation> *fused_op) {
+  RETURN_UNEXPECTED_IF_NULL(fused_op);
+  // a Decode followed by a RandomResizedCrop only keeps its dedicated kernel
+  if (chain.size() == kMinChainLength && chain[1]->Name() == vision::kRandomResizedCropOperation) {
+    auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>(chain[1].get());
+    RETURN_UNEXPECTED_IF_NULL(fused_ir);
+    *fused_op = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
+    return Status::OK();
+  }
+  *fused_op = std::make_shared<vision::FusedDecodeOperation>(chain);
+  return Status::OK();
+}
+
+size_t TensorOpFusionPass::MatchNormalizeChain(const std::vector<std::shared_ptr<TensorOperation>> &ops,
+                                               size_t begin) {
+  if (ops[begin] == nullptr || ops[begin]->Type() != MapTargetDevice::kCpu) {
+    return begin;
+  }
+  // the type written by the Normalize, a TypeCast after it is only fused if it gives the same values
+  std::string dtype;
+  if (ops[begin]->Name() == vision::kNormalizeOperation) {
+    auto *normalize = dynamic_cast<vision::NormalizeOperation *>(ops[begin].get());
+    if (normalize == nullptr || !normalize->IsHwc()) {
+      return begin;
+    }
+    dtype = "float32";
+  } else if (ops[begin]->Name() == vision::kNormalizePadOperation) {
+    auto *normalize_pad = dynamic_cast<vision::NormalizePadOperation *>(ops[begin].get());
+    if (normalize_pad == nullptr || !normalize_pad->IsHwc()) {
+      return begin;
+    }
+    dtype = normalize_pad->DType();
+  } else {
+    return begin;
+  }
+  size_t end = begin + 1;
+  if (end < ops.size() && ops[end] != nullptr && ops[end]->Type() == MapTargetDevice::kCpu &&
+      ops[end]->Name() == vision::kHwcToChwOperation) {
+    ++end;
+  }
+  if (end < ops.size() && ops[end] != nullptr && ops[end]->Name() == transforms::kTypeCastOperation) {
+    auto *type_cast = dynamic_cast<transforms::TypeCastOperation *>(ops[end].get());
+    if (type_cast != nullptr && (type_cast->GetDataType() == DataType::DE_FLOAT16 ||
+                                 (type_cast->GetDataType() == DataType::DE_FLOAT32 && dtype == "float32"))) {
+      ++end;
+    }
+  }
+  return end;
+}
+
+Status TensorOpFusionPass::LowerNormalizeChain(const std::vector<std::shared_ptr<TensorOperation>> &chain,
+                                               std::shared_ptr<TensorOperation> *fused_op) {
+  RETURN_UNEXPECTED_IF_NULL(fused_op);
+  std::vector<float> mean;
+  std::vector<float> std;
+  std::string dtype = "float32";
+  bool pad = false;
+  if (chain[0]->Name() == vision::kNormalizePadOperation) {
+    auto *normalize_pad = dynamic_cast<vision::NormalizePadOperation *>(chain[0].get());
+    RETURN_UNEXPECTED_IF_NULL(normalize_pad);
+    mean = normalize_pad->Mean();
+    std = normalize_pad->Std();
+    dtype = normalize_pad->DType();
+    pad = true;
+  } else {
+    auto *normalize = dynamic_cast<vision::NormalizeOperation *>(chain[0].get());
+    RETURN_UNEXPECTED_IF_NULL(normalize);
+    mean = normalize->Mean();
+    std = normalize->Std();
+  }
+  bool to_chw = false;
+  for (size_t i = 1; i < chain.size(); ++i) {
+    if (chain[i]->Name() == vision::kHwcToChwOperation) {
+      to_chw = true;
+    } else {
+      auto *type_cast = dynamic_cast<transforms::TypeCastOperation *>(chain[i].get());
+      RETURN_UNEXPECTED_IF_NULL(type_cast);
+      dtype = type_cast->GetDataType().ToString();
+    }
+  }
+  *fused_op = std::make_shared<vision::FusedNormalizeOperation>(mean, std, pad, to_chw, dtype);
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
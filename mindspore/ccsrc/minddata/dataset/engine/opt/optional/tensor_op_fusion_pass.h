@@ -17,20 +17,50 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 
 #include <memory>
+#include <vector>
 #include "minddata/dataset/engine/opt/pass.h"
 
 namespace mindspore {
 namespace dataset {
+class TensorOperation;
 
 /// \class TensorOpFusionPass tensor_op_fusion_pass.h
 /// \brief And optional optimization pass identifying and fusing
-///     tensor ops within MapOp
+///     tensor ops within MapOp. A Decode followed by a chain of crop, resize, flip, normalize
+///     and HWC2CHW operations is fused into one operation, and so is a Normalize followed by HWC2CHW
+///     and TypeCast.
 class TensorOpFusionPass : public IRNodePass {
   /// \brief Identifies and fuses tensor ops within MapOp
   /// \param[in] node The node being visited
   /// \param[in, out] *modified indicates whether the node has been visited
   /// \return Status The status code returned
   Status Visit(std::shared_ptr<MapNode> node, bool *const modified) override;
+
+  /// \brief Find the end of the chain of operations which can be fused into the Decode
+  /// \param[in] ops The operations of the MapNode
+  /// \param[in] begin The index of the Decode
+  /// \return The index past the last operation of the chain, begin + 1 if nothing follows the Decode
+  static size_t MatchDecodeChain(const std::vector<std::shared_ptr<TensorOperation>> &ops, size_t begin);
+
+  /// \brief Lower a chain of operations starting with a Decode into one operation
+  /// \param[in] chain The chain of operations
+  /// \param[out] fused_op The fused operation
+  /// \return Status The status code returned
+  static Status LowerDecodeChain(const std::vector<std::shared_ptr<TensorOperation>> &chain,
+                                 std::shared_ptr<TensorOperation> *fused_op);
+
+  /// \brief Find the end of a Normalize or NormalizePad on an HWC image followed by HWC2CHW and/or TypeCast
+  /// \param[in] ops The operations of the MapNode
+  /// \param[in] begin The index of the Normalize
+  /// \return The index past the last operation of the chain, begin if ops[begin] can not start a chain
+  static size_t MatchNormalizeChain(const std::vector<std::shared_ptr<TensorOperation>> &ops, size_t begin);
+
+  /// \brief Lower a chain of operations starting with a Normalize into one FusedNormalize operation
+  /// \param[in] chain The chain of operations
+  /// \param[out] fused_op The fused operation
+  /// \return Status The status code returned
+  static Status LowerNormalizeChain(const std::vector<std::shared_ptr<TensorOperation>> &chain,
+                                    std::shared_ptr<TensorOperation> *fused_op);
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -37,6 +37,8 @@
 #include "minddata/dataset/engine/ir/datasetops/shuffle_node.h"
 #include "minddata/dataset/engine/ir/datasetops/skip_node.h"
 #ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/ir/datasetops/source/csv_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/image_folder_node.h"
 #include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
 #endif
 #ifdef ENABLE_PYTHON
@@ -148,6 +150,14 @@ Status IRNodePass::VisitAfter(std::shared_ptr<ConcatNode> node, bool *const modi
   return VisitAfter(std::static_pointer_cast<DatasetNode>(node), modified);
 }
 #ifndef ENABLE_ANDROID
+Status IRNodePass::Visit(std::shared_ptr<CSVNode> node, bool *const modified) {
+  return Visit(std::static_pointer_cast<NonMappableSourceNode>(node), modified);
+}
+Status IRNodePass::VisitAfter(std::shared_ptr<CSVNode> node, bool *const modified) {
+  return VisitAfter(std::static_pointer_cast<NonMappableSourceNode>(node), modified);
+}
+#endif
+#ifndef ENABLE_ANDROID
 Status IRNodePass::Visit(std::shared_ptr<CacheLookupNode> node, bool *const modified) {
   return Visit(std::static_pointer_cast<DatasetNode>(node), modified);
 }
@@ -187,6 +197,14 @@ Status IRNodePass::VisitAfter(std::shared_ptr<GeneratorNode> node, bool *const m
   return VisitAfter(std::static_pointer_cast<MappableSourceNode>(node), modified);
 }
 #endif
+#ifndef ENABLE_ANDROID
+Status IRNodePass::Visit(std::shared_ptr<ImageFolderNode> node, bool *const modified) {
+  return Visit(std::static_pointer_cast<MappableSourceNode>(node), modified);
+}
+Status IRNodePass::VisitAfter(std::shared_ptr<ImageFolderNode> node, bool *const modified) {
+  return VisitAfter(std::static_pointer_cast<MappableSourceNode>(node), modified);
+}
+#endif
 Status IRNodePass::Visit(std::shared_ptr<MapNode> node, bool *const modified) {
   return Visit(std::static_pointer_cast<DatasetNode>(node), modified);
 }
@@ -168,6 +168,10 @@ class IRNodePass : public IRPass {
   virtual Status VisitAfter(std::shared_ptr<BuildVocabNode> node, bool *const modified);
   virtual Status Visit(std::shared_ptr<ConcatNode> node, bool *const modified);
   virtual Status VisitAfter(std::shared_ptr<ConcatNode> node, bool *const modified);
+#ifndef ENABLE_ANDROID
+  virtual Status Visit(std::shared_ptr<CSVNode> node, bool *const modified);
+  virtual Status VisitAfter(std::shared_ptr<CSVNode> node, bool *const modified);
+#endif
 #ifndef ENABLE_ANDROID
   virtual Status Visit(std::shared_ptr<CacheMergeNode> node, bool *const modified);
   virtual Status VisitAfter(std::shared_ptr<CacheMergeNode> node, bool *const modified);
@@ -183,6 +187,10 @@ class IRNodePass : public IRPass {
 #ifdef ENABLE_PYTHON
   virtual Status Visit(std::shared_ptr<GeneratorNode> node, bool *const modified);
   virtual Status VisitAfter(std::shared_ptr<GeneratorNode> node, bool *const modified);
+#endif
+#ifndef ENABLE_ANDROID
+  virtual Status Visit(std::shared_ptr<ImageFolderNode> node, bool *const modified);
+  virtual Status VisitAfter(std::shared_ptr<ImageFolderNode> node, bool *const modified);
 #endif
   virtual Status Visit(std::shared_ptr<MapNode> node, bool *const modified);
   virtual Status VisitAfter(std::shared_ptr<MapNode> node, bool *const modified);
@@ -0,0 +1,136 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "minddata/dataset/engine/opt/pre/projection_pushdown_pass.h"
+
+#include <algorithm>
+
+#include "minddata/dataset/engine/ir/datasetops/dataset_node.h"
+#include "minddata/dataset/engine/ir/datasetops/epoch_ctrl_node.h"
+#include "minddata/dataset/engine/ir/datasetops/project_node.h"
+#include "minddata/dataset/engine/ir/datasetops/repeat_node.h"
+#include "minddata/dataset/engine/ir/datasetops/shuffle_node.h"
+#include "minddata/dataset/engine/ir/datasetops/skip_node.h"
+#ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/ir/datasetops/source/csv_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/image_folder_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
+#endif
+#include "minddata/dataset/engine/ir/datasetops/source/tf_record_node.h"
+#include "minddata/dataset/engine/ir/datasetops/take_node.h"
+
+namespace mindspore {
+namespace dataset {
+// activate the pushdown with the columns of the project node, an inner project node replaces the columns
+Status ProjectionPushdownPass::Visit(std::shared_ptr<ProjectNode> node, bool *const modified) {
+  active_ = !node->IsCached();
+  project_columns_ = node->Columns();
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<RepeatNode> node, bool *const modified) {
+  PassThrough(node);
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<SkipNode> node, bool *const modified) {
+  PassThrough(node);
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<TakeNode> node, bool *const modified) {
+  PassThrough(node);
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<ShuffleNode> node, bool *const modified) {
+  PassThrough(node);
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<EpochCtrlNode> node, bool *const modified) {
+  PassThrough(node);
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<TFRecordNode> node, bool *const modified) {
+  // without decode the leaf produces the serialized examples only, which are parsed by a map node later
+  if (active_ && !node->IsCached() && node->Decode() && NarrowsColumns(node->ColumnsList())) {
+    node->SetColumnsList(project_columns_);
+    *modified = true;
+  }
+  active_ = false;
+  return Status::OK();
+}
+
+#ifndef ENABLE_ANDROID
+Status ProjectionPushdownPass::Visit(std::shared_ptr<MindDataNode> node, bool *const modified) {
+  // a padded sample has to contain all the columns in columns_list, which is checked by the node
+  if (active_ && !node->IsCached() && node->PaddedSample() == nullptr && NarrowsColumns(node->ColumnsList())) {
+    node->SetColumnsList(project_columns_);
+    *modified = true;
+  }
+  active_ = false;
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<CSVNode> node, bool *const modified) {
+  // the column names are only known when the header is read, so the unknown columns are left to the project op
+  if (active_ && !node->IsCached() && NarrowsColumns(node->ColumnsToLoad())) {
+    node->SetColumnsToLoad(project_columns_);
+    *modified = true;
+  }
+  active_ = false;
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<ImageFolderNode> node, bool *const modified) {
+  // the label is known from the directory, so only a projection to the label saves the read of the image
+  if (active_ && !node->IsCached() && project_columns_ == std::vector<std::string>{"label"} &&
+      node->ColumnsToLoad() != project_columns_) {
+    node->SetColumnsToLoad(project_columns_);
+    *modified = true;
+  }
+  active_ = false;
+  return Status::OK();
+}
+#endif
+
+Status ProjectionPushdownPass::Visit(std::shared_ptr<DatasetNode> node, bool *const modified) {
+  active_ = false;
+  return Status::OK();
+}
+
+void ProjectionPushdownPass::PassThrough(const std::shared_ptr<DatasetNode> &node) {
+  // a cache above the leaf holds all the columns which the leaf produces
+  if (node->IsCached()) {
+    active_ = false;
+  }
+}
+
+bool ProjectionPushdownPass::NarrowsColumns(const std::vector<std::string> &columns_list) const {
+  if (columns_list.empty()) {
+    return true;
+  }
+  // a projected column which is not read is left to the project op to report
+  return project_columns_.size() < columns_list.size() &&
+         std::all_of(project_columns_.begin(), project_columns_.end(), [&columns_list](const std::string &col) {
+           return std::find(columns_list.begin(), columns_list.end(), col) != columns_list.end();
+         });
+}
+}  // namespace dataset
+}  // namespace mindspore
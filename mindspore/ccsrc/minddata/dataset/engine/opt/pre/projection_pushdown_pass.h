@@ -0,0 +1,141 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_PROJECTION_PUSHDOWN_PASS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_PROJECTION_PUSHDOWN_PASS_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "minddata/dataset/engine/opt/pass.h"
+
+namespace mindspore {
+namespace dataset {
+#ifndef ENABLE_ANDROID
+class CSVNode;
+#endif
+class DatasetNode;
+class EpochCtrlNode;
+#ifndef ENABLE_ANDROID
+class ImageFolderNode;
+class MindDataNode;
+#endif
+class ProjectNode;
+class RepeatNode;
+class ShuffleNode;
+class SkipNode;
+class TakeNode;
+class TFRecordNode;
+
+/// \class ProjectionPushdownPass projection_pushdown_pass.h
+/// \brief This is a node pass that pushes the columns of a ProjectNode down into the leaf node below it, so that
+///     the leaf does not read or decode the columns which are dropped by the projection anyway. The ProjectNode
+///     is kept to fix the order of the columns. Only the nodes which neither add, rename nor consume columns
+///     (Repeat, Skip, Take, Shuffle and EpochCtrl) may sit between the ProjectNode and the leaf.
+class ProjectionPushdownPass : public IRNodePass {
+ public:
+  /// \brief Constructor
+  ProjectionPushdownPass() = default;
+
+  /// \brief Destructor
+  ~ProjectionPushdownPass() override = default;
+
+  /// \brief Start a projection pushdown from a ProjectNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<ProjectNode> node, bool *const modified) override;
+
+  /// \brief Let the projection pass through a RepeatNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<RepeatNode> node, bool *const modified) override;
+
+  /// \brief Let the projection pass through a SkipNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<SkipNode> node, bool *const modified) override;
+
+  /// \brief Let the projection pass through a TakeNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<TakeNode> node, bool *const modified) override;
+
+  /// \brief Let the projection pass through a ShuffleNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<ShuffleNode> node, bool *const modified) override;
+
+  /// \brief Let the projection pass through an EpochCtrlNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<EpochCtrlNode> node, bool *const modified) override;
+
+  /// \brief Push the projection into the columns_list of a TFRecordNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<TFRecordNode> node, bool *const modified) override;
+
+#ifndef ENABLE_ANDROID
+  /// \brief Push the projection into the columns_list of a MindDataNode
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<MindDataNode> node, bool *const modified) override;
+
+  /// \brief Push the projection into a CSVNode, the dropped columns are not converted
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<CSVNode> node, bool *const modified) override;
+
+  /// \brief Push the projection into an ImageFolderNode, the images are not read if only the label is used
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<ImageFolderNode> node, bool *const modified) override;
+#endif
+
+  /// \brief Stop the projection pushdown at any other node
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<DatasetNode> node, bool *const modified) override;
+
+ private:
+  /// \brief Keep the projection active below the node, unless the node is cached
+  /// \param[in] node The node being visited
+  void PassThrough(const std::shared_ptr<DatasetNode> &node);
+
+  /// \brief Check whether the projected columns are all in the columns the leaf already reads
+  /// \param[in] columns_list The columns the leaf reads, empty if it reads all the columns
+  /// \return True if the projection narrows the columns of the leaf
+  bool NarrowsColumns(const std::vector<std::string> &columns_list) const;
+
+  bool active_ = false;                       // whether a ProjectNode is above the current node
+  std::vector<std::string> project_columns_;  // the columns of the active ProjectNode
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_PROJECTION_PUSHDOWN_PASS_H_
@@ -112,6 +112,13 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<MapNode> node, bool *c
 
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<NonMappableSourceNode> node, bool *const modified) {
   node->SetSkipSteps(skip_steps_);
+  if (skip_count_ > 0 && node->SupportsSkipRows()) {
+    // The leaf op skips the rows in the files it reads, rather than reading them to drop them in a skip op
+    MS_LOG(INFO) << "Skipping " << skip_count_ << " rows in " << node->Name() << ".";
+    node->SetSkipRows(skip_count_);
+    skip_count_ = 0;
+    return Status::OK();
+  }
   return InsertSkipNode(node);
 }
 
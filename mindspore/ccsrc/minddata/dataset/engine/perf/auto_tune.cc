@@ -53,6 +53,8 @@ AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
       phase_3_ID_(0),
       avg_batch_time(0.0),
       phase_3_prev_avg_(0.0),
+      strategy_(GlobalContext::config_manager()->autotune_strategy()),
+      model_stable_count_(0),
       save_autoconfig_(GlobalContext::config_manager()->save_autoconfig()) {
   max_workers_ = GlobalContext::config_manager()->num_cpu_threads();
   autotune_json_filepath_ = GlobalContext::config_manager()->get_autotune_json_filepath();
@@ -166,6 +168,9 @@ Status AutoTune::SaveAutotuneConfig(const std::string &file_name) {
     remark_value += " Dataset Pipeline is not the bottleneck. No configuration changes were made by Dataset AutoTune.";
   }
   out_json["remark"] = remark_value;
+  if (!model_json_.empty()) {
+    out_json["model"] = model_json_;
+  }
   RETURN_IF_NOT_OK(Serdes::SaveJSONToFile(out_json, file_name, true));
   return Status::OK();
 }
@@ -473,6 +478,15 @@ Status AutoTune::TrackPipelineTime() {
 
 Status AutoTune::RunIteration() {
   RETURN_IF_NOT_OK(TrackPipelineTime());
+  if (strategy_ == AutoTuneStrategy::kModel) {
+    // The model sizes the connectors along with the workers, there is no memory phase
+    if (AT_phase_ == AutoTunePhase::kAutoTunePhaseTime) {
+      RETURN_IF_NOT_OK(AnalyseModel());
+    } else {
+      AT_phase_ = AutoTunePhase::kAutoTuneEnd;
+    }
+    return Status::OK();
+  }
   if (AT_phase_ == AutoTunePhase::kAutoTunePhaseTime) {
     RETURN_IF_NOT_OK(AnalyseTime());
   } else if (AT_phase_ == AutoTunePhase::kAutoTunePhaseMemory) {
@@ -660,6 +674,128 @@ Status AutoTune::AnalyseTime() {
   return Status::OK();
 }
 
+Status AutoTune::GetOpsStat(std::vector<PipelineModel::OpStat> *ops_stat) {
+  std::map<int32_t, int32_t> ops_num_workers;
+  RETURN_IF_NOT_OK(GetOpsNumWorker(&ops_num_workers));
+  std::map<int32_t, double> out_ops_queue_util;
+  std::map<int32_t, double> in_ops_queue_util;
+  RETURN_IF_NOT_OK(GetOpsQueueUtil(&out_ops_queue_util, &in_ops_queue_util));
+  std::map<int32_t, double> ops_cpu_util;
+  RETURN_IF_NOT_OK(GetOpsCpuUtil(&ops_cpu_util));
+  for (const auto &[op_id, op] : ops_) {
+    PipelineModel::OpStat stat{};
+    stat.op_id = op_id;
+    stat.name = op->NameWithID();
+    DatasetOp *parent = nullptr;
+    op->Parent(&parent, 0);
+    stat.parent_id = parent == nullptr ? -1 : parent->id();
+    stat.tunable = std::find(parallel_ops_ids_.begin(), parallel_ops_ids_.end(), op_id) != parallel_ops_ids_.end() &&
+                   !SkipOpsCheck(op_id) && op->Name() != "DataQueueOp";
+    stat.num_workers = ops_num_workers[op_id];
+    stat.connector_capacity = op->inlined() ? 0 : op->ConnectorCapacity();
+    stat.connector_size = out_ops_queue_util[op_id] < 0 ? 0 : out_ops_queue_util[op_id] * stat.connector_capacity;
+    stat.cpu_util = ops_cpu_util[op_id];
+    stat.in_queue_util = in_ops_queue_util[op_id];
+    stat.out_queue_util = out_ops_queue_util[op_id];
+    ops_stat->push_back(std::move(stat));
+  }
+  return Status::OK();
+}
+
+Status AutoTune::GetMemoryInfo(double *process_memory_mb, double *available_memory_mb) {
+  *process_memory_mb = 0;
+  *available_memory_mb = -1;
+#ifndef ENABLE_ANDROID
+  std::vector<float> process_memory;
+  std::vector<float> available_memory;
+  if (mode_ == AutoTuneMode::kAutoTuneModeEpoch) {
+    RETURN_IF_NOT_OK(profiling_manager_->GetMainProcessMemoryInfoByEpoch(ProcessMemoryMetric::kRSS,
+                                                                         cur_epoch_running_, &process_memory));
+    RETURN_IF_NOT_OK(profiling_manager_->GetSystemMemoryInfoByEpoch(SystemMemoryMetric::kMemoryAvailable,
+                                                                    cur_epoch_running_, &available_memory));
+  } else if (mode_ == AutoTuneMode::kAutoTuneModeStep) {
+    RETURN_IF_NOT_OK(profiling_manager_->GetMainProcessMemoryInfoByStep(
+      ProcessMemoryMetric::kRSS, last_step_autotuned_, cur_step_running_ - 1, &process_memory));
+    RETURN_IF_NOT_OK(profiling_manager_->GetSystemMemoryInfoByStep(
+      SystemMemoryMetric::kMemoryAvailable, last_step_autotuned_, cur_step_running_ - 1, &available_memory));
+  }
+  *process_memory_mb = Mean(process_memory);
+  if (!available_memory.empty()) {
+    *available_memory_mb = Mean(available_memory);
+  }
+#endif
+  return Status::OK();
+}
+
+Status AutoTune::AnalyseModel() {
+  std::vector<int32_t> batch_times;
+  if (mode_ == AutoTuneMode::kAutoTuneModeEpoch) {
+    RETURN_IF_NOT_OK(profiling_manager_->GetBatchTimeByEpoch(cur_epoch_running_ - 1, &batch_times));
+  } else if (mode_ == AutoTuneMode::kAutoTuneModeStep) {
+    RETURN_IF_NOT_OK(profiling_manager_->GetBatchTimeByStep(last_step_autotuned_, cur_step_running_ - 1, &batch_times));
+  }
+  double batch_time = Mean(batch_times);
+  if (batch_time <= 0) {
+    MS_LOG(INFO) << "No batch time is profiled yet, skip the pipeline model.";
+    return Status::OK();
+  }
+  std::vector<PipelineModel::OpStat> ops_stat;
+  RETURN_IF_NOT_OK(GetOpsStat(&ops_stat));
+  double process_memory_mb = 0;
+  double available_memory_mb = -1;
+  RETURN_IF_NOT_OK(GetMemoryInfo(&process_memory_mb, &available_memory_mb));
+
+  PipelineModel model(max_workers_, MIN_QUEUE_SIZE, MAX_QUEUE_SIZE);
+  RETURN_IF_NOT_OK(model.Build(std::move(ops_stat), batch_time, process_memory_mb));
+  // The workers of the ops which are not tuned are taken out of the budget
+  int32_t worker_budget = max_workers_;
+  for (const auto &op : model.Ops()) {
+    if (!op.tunable) {
+      worker_budget -= op.num_workers;
+    }
+  }
+  double memory_budget_mb = -1;
+  if (available_memory_mb >= 0) {
+    memory_budget_mb = process_memory_mb + available_memory_mb * MODEL_MEMORY_BUDGET_RATIO;
+  }
+  // When the device waits on the pipeline it is made as fast as the budgets allow, otherwise it only keeps a
+  // headroom over the consumer, and the workers it does not need are given back.
+  bool is_bottleneck = false;
+  RETURN_IF_NOT_OK(IsDSaBottleneck(&is_bottleneck));
+  double target_throughput = is_bottleneck ? -1 : model.Throughput() * (1 + MODEL_THROUGHPUT_HEADROOM);
+  RETURN_IF_NOT_OK(model.Solve(worker_budget, max_workers_, memory_budget_mb, target_throughput));
+  model_json_ = model.ToJson();
+  MS_LOG(INFO) << "Pipeline model: throughput " << model.Throughput() << " batches/s, predicted "
+               << model.PredictedThroughput() << " batches/s.";
+  MS_LOG(DEBUG) << "Pipeline model: " << model_json_.dump();
+
+  bool changed = false;
+  const auto &ops = model.Ops();
+  const auto &plan = model.Plan();
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (!ops[i].tunable) {
+      continue;
+    }
+    if (plan[i].num_workers != ops[i].num_workers) {
+      int32_t requested_workers = plan[i].num_workers;
+      RETURN_IF_NOT_OK(RequestNumWorkerChange(ops[i].op_id, ops[i].num_workers, &requested_workers));
+      changed = true;
+    }
+    if (plan[i].connector_capacity != ops[i].connector_capacity) {
+      RETURN_IF_NOT_OK(
+        RequestConnectorCapacityChange(ops[i].op_id, ops[i].connector_capacity, plan[i].connector_capacity));
+      changed = true;
+    }
+  }
+  // Done once the model keeps asking for the configuration the pipeline already runs with
+  model_stable_count_ = changed ? 0 : model_stable_count_ + 1;
+  if (model_stable_count_ >= MODEL_STABLE_ITERATIONS) {
+    MS_LOG(INFO) << "Pipeline model is stable, AutoTune is done.";
+    AT_phase_ = AutoTunePhase::kAutoTuneEnd;
+  }
+  return Status::OK();
+}
+
 bool AutoTune::MemoryPhaseCompareMetric(double prev_avg, double cur_avg) {
   double lower_bound = prev_avg - (prev_avg * MEMORY_COMPARISON_LOWER_BOUND_PERCENT);
   // If cur_avg worse than lower bound - negative impact on performance
@@ -27,6 +27,7 @@
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/engine/tree_adapter.h"
 #include "minddata/dataset/engine/tree_modifier.h"
+#include "minddata/dataset/engine/perf/pipeline_model.h"
 #include "minddata/dataset/engine/perf/profiling.h"
 
 namespace mindspore {
@@ -155,6 +156,10 @@ class AutoTune {
   const float MEMORY_COMPARISON_LOWER_BOUND_PERCENT = 0.02;
   const float QUEUE_REDUCTION_PERCENTAGE_EPOCH = 0.5;
   const float QUEUE_REDUCTION_PERCENTAGE_STEP = 0.8;
+  // Model specifics
+  const int32_t MODEL_STABLE_ITERATIONS = 2;
+  const double MODEL_THROUGHPUT_HEADROOM = 0.2;
+  const double MODEL_MEMORY_BUDGET_RATIO = 0.5;
 
   /// Get the out connector capacity of the operator
   /// \param[in] op_id operator id
@@ -192,6 +197,22 @@ class AutoTune {
   /// \return Status code
   Status AnalyseMemory();
 
+  /// AutoTune algorithm of AutoTuneStrategy::kModel, which solves a model of the pipeline for the number of workers
+  /// and the connector capacity of all the ops at once
+  /// \return Status code
+  Status AnalyseModel();
+
+  /// Collect the profiling data of each op for the pipeline model
+  /// \param[out] ops_stat the profiling data of each op
+  /// \return Status code
+  Status GetOpsStat(std::vector<PipelineModel::OpStat> *ops_stat);
+
+  /// Get the memory used by the process and the memory available on the host
+  /// \param[out] process_memory_mb memory used by the process
+  /// \param[out] available_memory_mb memory available on the host, -1 if unknown
+  /// \return Status code
+  Status GetMemoryInfo(double *process_memory_mb, double *available_memory_mb);
+
   /// Send a ChangeRequest to the operator to update the number of workers
   /// \param op_id operator ID
   /// \param old_workers Old number of workers for logging purposes
@@ -289,6 +310,12 @@ class AutoTune {
   double phase_3_prev_avg_;
   std::vector<int32_t> OP_values;
 
+  // AutoTuneStrategy::kModel
+  AutoTuneStrategy strategy_;
+  int32_t model_stable_count_;
+  /// Exported model of the last iteration
+  nlohmann::json model_json_;
+
   /// True if should save AutoTune configuration
   bool save_autoconfig_;
 
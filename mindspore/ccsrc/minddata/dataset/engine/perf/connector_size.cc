@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <utility>
 
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/engine/execution_tree.h"
@@ -47,9 +48,14 @@ Status ConnectorSize::Sample() {
   // Tree Iterator is in PostOrder (leaf first, e.g., 3,2,1)
   // reverse the order of the vector to get the root first.
   std::reverse(cur_row.begin(), cur_row.end());
+  std::vector<int64_t> bytes_skipped;
+  (void)std::transform(tree_->begin(), tree_->end(), std::back_inserter(bytes_skipped),
+                       [](const DatasetOp &op) { return op.BytesSkipped(); });
+  std::reverse(bytes_skipped.begin(), bytes_skipped.end());
   std::lock_guard<std::mutex> guard(lock_);
   // Push new row of sample
   sample_table_.push_back(cur_row);
+  bytes_skipped_ = std::move(bytes_skipped);
   (void)ts_.emplace_back(ProfilingTime::GetCurMilliSecond());
   return Status::OK();
 }
@@ -100,6 +106,10 @@ Status ConnectorSize::SaveToFile(const std::string &dir_path, const std::string
     if (ops_data[idx]["metrics"].contains("output_queue") && ops_data[idx]["op_type"] != "DataQueueOp") {
       ops_data[idx]["metrics"]["output_queue"]["size"] = cur_queue_size;
     }
+    // only the sources which skip unused columns report the bytes they do not read or decode
+    if (idx < bytes_skipped_.size() && bytes_skipped_[idx] > 0) {
+      ops_data[idx]["metrics"]["bytes_skipped"] = bytes_skipped_[idx];
+    }
   }
 
   // Discard the content of the file when opening.
@@ -127,6 +137,7 @@ Status ConnectorSize::Init() {
 void ConnectorSize::Clear() {
   ts_.clear();
   sample_table_.clear();
+  bytes_skipped_.clear();
   initial_nodes_data.clear();
 }
 
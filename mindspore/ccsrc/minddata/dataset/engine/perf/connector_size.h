@@ -79,6 +79,7 @@ class ConnectorSize : public Sampling {
   ExecutionTree *tree_ = nullptr;          // ExecutionTree pointer
   ConnectorSizeSampleTable sample_table_;  // Dataset structure to store all samples of connector size sampling
   Timestamps ts_;                          // time of sample
+  std::vector<int64_t> bytes_skipped_;     // latest bytes skipped of each op, which are not read or decoded
 };
 
 }  // namespace dataset
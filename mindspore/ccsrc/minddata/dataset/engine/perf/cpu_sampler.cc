@@ -28,6 +28,7 @@
 
 #include "minddata/dataset/api/python/pybind_conversion.h"
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/util/path.h"
 #include "utils/file_utils.h"
@@ -46,6 +47,7 @@ int32_t SystemInfo::num_cpu_ = 0;
 #endif
 
 constexpr uint64_t kBInMB = 1024;  // Constant for kByte to MByte division conversion
+constexpr float kBytesInMB = 1024.0 * 1024.0;  // Constant for Byte to MByte division conversion
 
 Status SystemInfo::ParseCpuInfo(const std::string &str) {
   SystemStat system_cpu_stat;
@@ -487,6 +489,10 @@ Status CpuSampler::Sample() {
     op_info.CalculateOperatorUtilization();
   }
 
+  // Sample the pool of the tensor buffers, if the global context uses one
+  auto buffer_pool = std::dynamic_pointer_cast<BufferPool>(GlobalContext::Instance()->mem_pool());
+  (void)tensor_pool_info_.emplace_back(buffer_pool != nullptr ? buffer_pool->GetStats() : BufferPoolStats());
+
   // Get sampling time.
   (void)ts_.emplace_back(ProfilingTime::GetCurMilliSecond());
 
@@ -571,6 +577,7 @@ void CpuSampler::Clear() {
   main_thread_cpu_info_.reset();
   main_process_info_.reset();
   op_info_by_id_.clear();
+  tensor_pool_info_.clear();
   fetched_all_python_multiprocesses_ = false;
 }
 
@@ -633,6 +640,21 @@ Status CpuSampler::SaveToFile(const std::string &dir_path, const std::string &ra
                                   {"available_sys_memory_mbytes", mem_avail},
                                   {"used_sys_memory_mbytes", mem_used}};
 
+  std::vector<float> pool_in_use, pool_cached;
+  std::vector<uint64_t> pool_allocs, pool_hits, pool_sys_allocs;
+  for (const auto &stats : tensor_pool_info_) {
+    (void)pool_in_use.emplace_back(static_cast<float>(stats.bytes_in_use) / kBytesInMB);
+    (void)pool_cached.emplace_back(static_cast<float>(stats.bytes_cached) / kBytesInMB);
+    (void)pool_allocs.emplace_back(stats.num_allocations);
+    (void)pool_hits.emplace_back(stats.num_thread_hits + stats.num_central_hits);
+    (void)pool_sys_allocs.emplace_back(stats.num_system_allocs);
+  }
+  output["tensor_pool_info"] = {{"in_use_mbytes", pool_in_use},
+                                {"cached_mbytes", pool_cached},
+                                {"allocations", pool_allocs},
+                                {"reused_allocations", pool_hits},
+                                {"system_allocations", pool_sys_allocs}};
+
   // Discard the content of the file when opening.
   std::ofstream os(file_path, std::ios::out | std::ios::trunc);
   os << output;
@@ -23,6 +23,7 @@
 #include <nlohmann/json.hpp>
 #include "minddata/dataset/engine/perf/profiling.h"
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
+#include "minddata/dataset/util/buffer_pool.h"
 
 namespace mindspore {
 namespace dataset {
@@ -209,6 +210,7 @@ class CpuSampler : public Sampling {
   std::shared_ptr<ThreadCpuInfo> main_thread_cpu_info_;
   std::shared_ptr<ProcessInfo> main_process_info_;
   std::unordered_map<int32_t, MDOperatorCpuInfo> op_info_by_id_;
+  std::vector<BufferPoolStats> tensor_pool_info_;  // counters of the pool of the tensor buffers at each sampling point
   Path GetFileName(const std::string &dir_path, const std::string &rank_id) override;
 };
 }  // namespace dataset
@@ -0,0 +1,178 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/perf/pipeline_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+PipelineModel::PipelineModel(int32_t num_cpus, int32_t min_queue_size, int32_t max_queue_size)
+    : num_cpus_(num_cpus),
+      min_queue_size_(min_queue_size),
+      max_queue_size_(max_queue_size),
+      throughput_(0),
+      predicted_throughput_(0),
+      target_throughput_(-1),
+      mb_per_row_(0),
+      worker_budget_(0),
+      memory_budget_mb_(-1) {}
+
+Status PipelineModel::Build(std::vector<OpStat> ops, double batch_time_ms, double process_memory_mb) {
+  CHECK_FAIL_RETURN_UNEXPECTED(batch_time_ms > 0, "No batch is profiled, the pipeline can not be modelled.");
+  ops_ = std::move(ops);
+  throughput_ = kMsPerSecond / batch_time_ms;
+  predicted_throughput_ = throughput_;
+  plan_.clear();
+  plan_.reserve(ops_.size());
+  double rows_in_flight = 0;
+  for (const auto &op : ops_) {
+    OpPlan plan{};
+    plan.saturated = op.num_workers > 0 && op.connector_capacity > 0 && op.in_queue_util >= kFedQueueUtil &&
+                     op.out_queue_util < kFullQueueUtil;
+    double cpu_cores = op.cpu_util / kPercent * num_cpus_;
+    plan.demand = std::max((plan.saturated ? op.num_workers : cpu_cores) / throughput_, kMinDemand);
+    plan.num_workers = op.num_workers;
+    plan.connector_capacity = op.connector_capacity;
+    plan_.push_back(plan);
+    rows_in_flight += std::max(op.connector_size, 0.0) + op.num_workers;
+  }
+  mb_per_row_ = rows_in_flight > 0 ? process_memory_mb / rows_in_flight : 0;
+  return Status::OK();
+}
+
+int32_t PipelineModel::ParentIndex(size_t i) const {
+  int32_t parent_id = ops_[i].parent_id;
+  while (parent_id >= 0) {
+    auto it = std::find_if(ops_.begin(), ops_.end(), [parent_id](const OpStat &op) { return op.op_id == parent_id; });
+    if (it == ops_.end()) {
+      return -1;
+    }
+    // An inlined op runs in the thread pulling from it, so the rows go to the op above it
+    if (it->connector_capacity > 0) {
+      return static_cast<int32_t>(it - ops_.begin());
+    }
+    parent_id = it->parent_id;
+  }
+  return -1;
+}
+
+double PipelineModel::Rate(size_t i) const { return plan_[i].num_workers / plan_[i].demand; }
+
+Status PipelineModel::Solve(int32_t worker_budget, int32_t max_workers, double memory_budget_mb,
+                            double target_throughput) {
+  CHECK_FAIL_RETURN_UNEXPECTED(plan_.size() == ops_.size(), "The pipeline model is not built.");
+  worker_budget_ = worker_budget;
+  memory_budget_mb_ = memory_budget_mb;
+  target_throughput_ = target_throughput;
+  // Start from one worker each, then hand the budget to the op limiting the pipeline until the target is reached
+  std::vector<size_t> tunable;
+  int32_t used = 0;
+  for (size_t i = 0; i < ops_.size(); ++i) {
+    if (ops_[i].tunable && ops_[i].num_workers > 0) {
+      plan_[i].num_workers = 1;
+      tunable.push_back(i);
+      ++used;
+    } else {
+      plan_[i].num_workers = ops_[i].num_workers;
+    }
+  }
+  if (tunable.empty()) {
+    return Status::OK();
+  }
+  auto slowest = [this, &tunable]() {
+    return *std::min_element(tunable.begin(), tunable.end(), [this](size_t a, size_t b) { return Rate(a) < Rate(b); });
+  };
+  while (true) {
+    size_t bottleneck = slowest();
+    if (target_throughput_ >= 0 && Rate(bottleneck) >= target_throughput_) {
+      break;
+    }
+    if (used >= worker_budget_ || plan_[bottleneck].num_workers >= max_workers) {
+      break;
+    }
+    ++plan_[bottleneck].num_workers;
+    ++used;
+  }
+  predicted_throughput_ = Rate(slowest());
+  if (target_throughput_ >= 0) {
+    predicted_throughput_ = std::min(predicted_throughput_, target_throughput_);
+  }
+
+  // A connector holds enough rows for the workers on its busier end, so that neither end waits on the other
+  int64_t fixed_rows = 0;
+  int64_t tunable_rows = 0;
+  for (size_t i = 0; i < ops_.size(); ++i) {
+    fixed_rows += plan_[i].num_workers;
+    if (std::find(tunable.begin(), tunable.end(), i) == tunable.end()) {
+      fixed_rows += plan_[i].connector_capacity;
+      continue;
+    }
+    int32_t parent = ParentIndex(i);
+    int32_t consumer_workers = parent >= 0 ? std::max(plan_[parent].num_workers, 1) : 1;
+    int32_t capacity = kRowsPerWorker * std::max(consumer_workers, plan_[i].num_workers);
+    plan_[i].connector_capacity = std::clamp(capacity, min_queue_size_, max_queue_size_);
+    tunable_rows += plan_[i].connector_capacity;
+  }
+  // Then the connectors of the tunable ops share what is left of the memory budget
+  if (mb_per_row_ > 0 && memory_budget_mb_ >= 0 && (fixed_rows + tunable_rows) * mb_per_row_ > memory_budget_mb_) {
+    double scale = std::max(memory_budget_mb_ / mb_per_row_ - fixed_rows, 0.0) / tunable_rows;
+    for (auto i : tunable) {
+      auto capacity = static_cast<int32_t>(std::floor(plan_[i].connector_capacity * scale));
+      plan_[i].connector_capacity = std::max(capacity, min_queue_size_);
+    }
+  }
+  return Status::OK();
+}
+
+nlohmann::json PipelineModel::ToJson() const {
+  nlohmann::json out;
+  out["throughput"] = throughput_;
+  out["predicted_throughput"] = predicted_throughput_;
+  out["target_throughput"] = target_throughput_;
+  out["worker_budget"] = worker_budget_;
+  out["memory_budget_mb"] = memory_budget_mb_;
+  out["mb_per_row"] = mb_per_row_;
+  nlohmann::json ops = nlohmann::json::array();
+  for (size_t i = 0; i < ops_.size(); ++i) {
+    const auto &op = ops_[i];
+    nlohmann::json item;
+    item["op_id"] = op.op_id;
+    item["name"] = op.name;
+    item["parent_id"] = op.parent_id;
+    item["tunable"] = op.tunable;
+    item["num_workers"] = op.num_workers;
+    item["connector_capacity"] = op.connector_capacity;
+    item["connector_size"] = op.connector_size;
+    item["cpu_util"] = op.cpu_util;
+    item["in_queue_util"] = op.in_queue_util;
+    item["out_queue_util"] = op.out_queue_util;
+    if (i < plan_.size()) {
+      item["saturated"] = plan_[i].saturated;
+      item["demand"] = plan_[i].demand;
+      item["planned_num_workers"] = plan_[i].num_workers;
+      item["planned_connector_capacity"] = plan_[i].connector_capacity;
+    }
+    ops.push_back(std::move(item));
+  }
+  out["ops"] = std::move(ops);
+  return out;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,134 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_MODEL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_MODEL_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A throughput model of a dataset pipeline, built from the profiling data of an interval, which is solved
+/// for the number of workers and the connector capacity of every op at once.
+///
+/// Each op is modelled as a station of identical workers. Its demand is the number of worker-seconds it spends per
+/// batch produced by the pipeline:
+///  - an op whose input connector is fed and whose output connector is not full is saturated, all its workers were
+///    busy, so the demand is num_workers / throughput, which also accounts for the time the workers wait for I/O;
+///  - any other op waited on its neighbours, only the cpu it used is known, so the demand is cpu_cores / throughput.
+/// The throughput an op can sustain with w workers is then w / demand, and the one of the pipeline is the smallest
+/// of them. The workers of a core budget are handed one at a time to the op which limits the pipeline, so the
+/// solution is the same whatever the current configuration is, and AutoTune does not oscillate between two of them.
+/// Connectors are sized after the workers on both of their ends, then scaled down to fit a memory budget.
+class PipelineModel {
+ public:
+  /// \brief The profiling data of an op over the interval.
+  struct OpStat {
+    int32_t op_id;
+    std::string name;
+    int32_t parent_id;           // -1 for the root
+    bool tunable;                // whether the workers and connector of the op can be changed
+    int32_t num_workers;         // 0 if the op has no workers
+    int32_t connector_capacity;  // 0 for an inlined op
+    double connector_size;       // average number of rows in the output connector
+    double cpu_util;             // percentage of all the cpus of the host used by the threads of the op
+    double in_queue_util;        // average utilization of the input connector, in [0, 1]
+    double out_queue_util;       // average utilization of the output connector, in [0, 1]
+  };
+
+  /// \brief The configuration the model solved for an op.
+  struct OpPlan {
+    double demand;  // worker-seconds per batch
+    bool saturated;
+    int32_t num_workers;
+    int32_t connector_capacity;
+  };
+
+  /// \brief Constructor
+  /// \param num_cpus Number of cpus of the host, the unit of the cpu utilization.
+  /// \param min_queue_size Smallest connector capacity.
+  /// \param max_queue_size Largest connector capacity.
+  PipelineModel(int32_t num_cpus, int32_t min_queue_size, int32_t max_queue_size);
+
+  ~PipelineModel() = default;
+
+  /// \brief Build the model.
+  /// \param ops The profiling data of each op.
+  /// \param batch_time_ms Average time between two batches produced by the pipeline.
+  /// \param process_memory_mb Memory used by the process, which is spread over the rows in flight to estimate the
+  ///     memory of a row.
+  /// \return Status object, an error if there is not enough data to model the pipeline.
+  Status Build(std::vector<OpStat> ops, double batch_time_ms, double process_memory_mb);
+
+  /// \brief Solve the model.
+  /// \param worker_budget Number of workers to share among the tunable ops.
+  /// \param max_workers Largest number of workers of an op.
+  /// \param memory_budget_mb Memory the rows in flight may use.
+  /// \param target_throughput Batches per second the consumer takes, there is no need to go faster. A negative
+  ///     value means as fast as possible.
+  /// \return Status object
+  Status Solve(int32_t worker_budget, int32_t max_workers, double memory_budget_mb, double target_throughput);
+
+  /// \return The ops of the model, in the order given to Build.
+  const std::vector<OpStat> &Ops() const { return ops_; }
+
+  /// \return The solution, one plan for each op.
+  const std::vector<OpPlan> &Plan() const { return plan_; }
+
+  /// \return Batches per second measured over the interval.
+  double Throughput() const { return throughput_; }
+
+  /// \return Batches per second the solution is expected to reach.
+  double PredictedThroughput() const { return predicted_throughput_; }
+
+  /// \brief Export the model and its solution for offline inspection.
+  nlohmann::json ToJson() const;
+
+ private:
+  /// \return The index of the op consuming the output of the op at index i, or -1.
+  int32_t ParentIndex(size_t i) const;
+
+  /// \return Batches per second the op at index i sustains with the workers of its plan.
+  double Rate(size_t i) const;
+
+  constexpr static double kMsPerSecond = 1000.0;
+  constexpr static double kPercent = 100.0;
+  constexpr static double kMinDemand = 1e-6;
+  // An op is saturated when its input connector is at least this full and its output connector at most
+  constexpr static double kFedQueueUtil = 0.5;
+  constexpr static double kFullQueueUtil = 0.9;
+  // Rows a connector holds for each worker of the busier of its two ends
+  constexpr static int32_t kRowsPerWorker = 2;
+
+  int32_t num_cpus_;
+  int32_t min_queue_size_;
+  int32_t max_queue_size_;
+  std::vector<OpStat> ops_;
+  std::vector<OpPlan> plan_;
+  double throughput_;
+  double predicted_throughput_;
+  double target_throughput_;
+  double mb_per_row_;
+  int32_t worker_budget_;
+  double memory_budget_mb_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_MODEL_H_
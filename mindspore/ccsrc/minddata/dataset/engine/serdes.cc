@@ -15,9 +15,12 @@
  */
 #include "minddata/dataset/engine/serdes.h"
 
+#include <sys/stat.h>
+
 #include <fstream>
 #include <iomanip>
 #include <stack>
+#include <string_view>
 
 #include "include/common/utils/utils.h"
 #include "minddata/dataset/core/pybind_support.h"
@@ -27,6 +30,7 @@
 #include "mindspore/lite/src/common/file_utils.h"
 #endif
 #include "minddata/dataset/kernels/image/dvpp/acl_adapter.h"
+#include "minddata/dataset/util/path.h"
 
 namespace mindspore {
 namespace dataset {
@@ -310,6 +314,8 @@ Serdes::InitializeFuncPtr() {
   }
 #endif
   ops_ptr[vision::kEqualizeOperation] = &(vision::EqualizeOperation::from_json);
+  ops_ptr[vision::kFusedDecodeOperation] = &(vision::FusedDecodeOperation::from_json);
+  ops_ptr[vision::kFusedNormalizeOperation] = &(vision::FusedNormalizeOperation::from_json);
   ops_ptr[vision::kGaussianBlurOperation] = &(vision::GaussianBlurOperation::from_json);
   ops_ptr[vision::kHorizontalFlipOperation] = &(vision::HorizontalFlipOperation::from_json);
   ops_ptr[vision::kHwcToChwOperation] = &(vision::HwcToChwOperation::from_json);
@@ -414,6 +420,90 @@ Status Serdes::UpdateOptimizedIRTreeJSON(nlohmann::json *serialized_json,
   return RecurseUpdateOptimizedIRTreeJSON(serialized_json, &op_id, op_map);
 }
 
+namespace {
+// 64-bit FNV-1a, which unlike std::hash gives the same value in every process
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+uint64_t Fnv1a(std::string_view bytes) {
+  uint64_t hash = kFnvOffsetBasis;
+  for (char c : bytes) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * kFnvPrime;
+  }
+  return hash;
+}
+
+// Drop the fields which do not change the rows produced, so that they can be tuned without invalidating the cache
+void RemoveVolatileFields(nlohmann::json *node) {
+  if (node->is_object()) {
+    (void)node->erase("num_parallel_workers");
+    (void)node->erase("connector_queue_size");
+    (void)node->erase("cache");
+  }
+  if (node->is_structured()) {
+    for (auto &child : *node) {
+      RemoveVolatileFields(&child);
+    }
+  }
+}
+
+// Add the path, size and modification time of a file, or of all the files under a directory. The hashes are summed
+// so that the result does not depend on the order of the directory entries.
+void AddSourceFile(const std::string &path, uint64_t *source_fp) {
+  struct stat st {};
+  if (lstat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+    Path dir(path);
+    auto it = Path::DirIterator::OpenDirectory(&dir);
+    while (it != nullptr && it->HasNext()) {
+      AddSourceFile(it->Next().ToString(), source_fp);
+    }
+    return;
+  }
+  std::string entry = path;
+  if (stat(path.c_str(), &st) == 0) {
+    entry += ":" + std::to_string(st.st_size) + ":" + std::to_string(st.st_mtime);
+  }
+  *source_fp += Fnv1a(entry);
+}
+
+void AddSourceFiles(const nlohmann::json &node, uint64_t *source_fp) {
+  if (node.is_object()) {
+    for (const char *key : {"dataset_dir", "dataset_file", "dataset_files", "annotation_file"}) {
+      auto it = node.find(key);
+      if (it == node.end()) {
+        continue;
+      }
+      if (it->is_string()) {
+        AddSourceFile(it->get<std::string>(), source_fp);
+      } else if (it->is_array()) {
+        for (const auto &file : *it) {
+          if (file.is_string()) {
+            AddSourceFile(file.get<std::string>(), source_fp);
+          }
+        }
+      }
+    }
+  }
+  if (node.is_structured()) {
+    for (const auto &child : node) {
+      AddSourceFiles(child, source_fp);
+    }
+  }
+}
+}  // namespace
+
+Status Serdes::Fingerprint(const std::shared_ptr<DatasetNode> &node, uint64_t *pipeline_fp, uint64_t *source_fp) {
+  RETURN_UNEXPECTED_IF_NULL(pipeline_fp);
+  RETURN_UNEXPECTED_IF_NULL(source_fp);
+  nlohmann::json serialized;
+  RETURN_IF_NOT_OK(SaveToJSON(node, "", &serialized));
+  RemoveVolatileFields(&serialized);
+  *pipeline_fp = Fnv1a(serialized.dump());
+  *source_fp = 0;
+  AddSourceFiles(serialized, source_fp);
+  return Status::OK();
+}
+
 bool IsDatasetOpMatchIRNode(std::string_view ir_node_name, std::string_view dataset_op_name) {
   // Helper function to match IR Node name to its dataset op name
   if (ir_node_name == kSyncWaitNode) {
@@ -90,6 +90,8 @@
 #include "minddata/dataset/kernels/ir/vision/cutout_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
 #include "minddata/dataset/kernels/ir/vision/equalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/gaussian_blur_ir.h"
 #include "minddata/dataset/kernels/ir/vision/horizontal_flip_ir.h"
 #include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
@@ -160,6 +162,15 @@ class Serdes {
   static Status UpdateOptimizedIRTreeJSON(nlohmann::json *serialized_json,
                                           const std::map<int32_t, std::shared_ptr<DatasetOp>> &op_map);
 
+  /// \brief Function to fingerprint an IR tree, which is the key of a persistent cache of its rows
+  /// \param[in] node The root of the IR tree
+  /// \param[out] pipeline_fp The hash of the serialized IR tree, without the fields which do not change the rows
+  ///     (num_parallel_workers, connector_queue_size and cache)
+  /// \param[out] source_fp The hash of the paths, sizes and modification times of the files read by the source nodes,
+  ///     which changes with the data of the pipeline
+  /// \return Status The status code returned
+  static Status Fingerprint(const std::shared_ptr<DatasetNode> &node, uint64_t *pipeline_fp, uint64_t *source_fp);
+
   /// \brief function to de-serialize JSON file to IR tree
   /// \param[in] json_filepath input path of json file
   /// \param[out] ds The deserialized dataset
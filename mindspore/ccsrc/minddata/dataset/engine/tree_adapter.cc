@@ -37,6 +37,9 @@
 #include "minddata/dataset/engine/opt/pre/input_validation_pass.h"
 #include "minddata/dataset/engine/opt/pre/insert_map_pass.h"
 #include "minddata/dataset/engine/opt/pre/node_removal_pass.h"
+#ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/opt/pre/projection_pushdown_pass.h"
+#endif
 #include "minddata/dataset/engine/opt/pre/skip_pushdown_pass.h"
 #include "minddata/dataset/engine/perf/info_collector.h"
 
@@ -63,6 +66,9 @@ Status TreeAdapter::PrePass(const std::shared_ptr<DatasetNode> &ir) {
   (void)actions.emplace_back(std::make_unique<CacheValidationPass>());
   (void)actions.emplace_back(std::make_unique<NodeRemovalPass>());
   (void)actions.emplace_back(std::make_unique<InsertMapPass>());
+#ifndef ENABLE_ANDROID
+  (void)actions.emplace_back(std::make_unique<ProjectionPushdownPass>());
+#endif
   if (usage_ == kDeReset) {
     (void)actions.emplace_back(std::make_unique<AddSkipPass>());
     if (GlobalContext::config_manager()->fast_recovery()) {
@@ -293,6 +293,25 @@ enum class DATASET_API ErrorSamplesMode {
   kSkip = 2      ///< Erroneous sample is skipped
 };
 
+/// \brief Possible strategies of the dataset AutoTune.
+enum class DATASET_API AutoTuneStrategy {
+  kHeuristic = 0,  ///< Ops are adjusted one at a time after the utilization of their connectors and cpu
+  kModel = 1       ///< A throughput model of the pipeline is solved for the workers and connectors of all the ops
+};
+
+/// \brief Possible policies to place the threads of a dataset pipeline on numa nodes.
+enum class DATASET_API NumaPlacement {
+  kNone = 0,    ///< Threads are scheduled on any numa node
+  kDevice = 1,  ///< All the threads run on the numa node of the device, next to the consumer of the pipeline
+  kSpread = 2   ///< The workers of each op are spread over the numa nodes, the root op stays on the device node
+};
+
+/// \brief Possible modes to execute the threads of a dataset pipeline.
+enum class DATASET_API ExecutorMode {
+  kThreadPerOp = 0,  ///< Every thread of the pipeline is scheduled by the operating system as soon as it is runnable
+  kShared = 1        ///< The threads of the pipeline share a number of run slots sized to the cpu quota of the process
+};
+
 /// \brief Convenience function to check bitmask for a 32bit int
 /// \param[in] bits a 32bit int to be tested
 /// \param[in] bitMask a 32bit int representing bit mask
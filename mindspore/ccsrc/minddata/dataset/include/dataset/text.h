@@ -33,6 +33,7 @@ namespace mindspore {
 namespace dataset {
 class TensorOperation;
 class Vectors;
+class VocabTrie;
 
 using WordIdType = int32_t;
 using WordType = std::string;
@@ -155,6 +156,10 @@ class Vocab {
   /// \return A unordered_map of word2id.
   const std::unordered_map<WordType, WordIdType> &GetVocab() const { return word2id_; }
 
+  /// \brief Return a read-only trie of the vocab for the lookups of the text operations, built on the first call.
+  /// \return A trie of word2id.
+  std::shared_ptr<const VocabTrie> GetTrie() const;
+
   /// \brief Constructor.
   Vocab() = default;
 
@@ -167,6 +172,7 @@ class Vocab {
  private:
   std::unordered_map<WordType, WordIdType> word2id_;
   std::unordered_map<WordIdType, WordType> id2word_;
+  mutable std::shared_ptr<const VocabTrie> trie_;
 };
 
 /// \brief SentencePiece object that is used to do words segmentation.
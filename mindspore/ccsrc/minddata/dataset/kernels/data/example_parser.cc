@@ -0,0 +1,195 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/data/example_parser.h"
+
+namespace mindspore::dataset {
+namespace protobuf = ::google::protobuf;
+
+uint8_t PeekTag(protobuf::io::CodedInputStream *stream) {
+  if (stream == nullptr) {
+    MS_EXCEPTION(RuntimeError) << "CodedInputStream is nullptr.";
+  }
+  const void *ptr;
+  int size;
+  if (!stream->GetDirectBufferPointer(&ptr, &size)) {
+    return 0;
+  }
+  return *static_cast<const uint8_t *>(ptr);
+}
+
+bool SkipExtraneousTag(protobuf::io::CodedInputStream *stream) {
+  uint32_t data;
+  uint64_t dummy;
+  constexpr uint32_t kVarint = 0;
+  constexpr uint32_t kFixed64 = 1;
+  constexpr uint32_t kLengthDelimited = 2;
+  constexpr uint32_t kGroupBegin = 3;
+  constexpr uint32_t kGroupEnd = 4;
+  constexpr uint32_t kFixed32 = 5;
+  switch (stream->ReadTag() & 0x7) {
+    case kVarint:  // varint
+      return stream->ReadVarint32(&data);
+    case kFixed64:  // fixed64
+      return stream->ReadLittleEndian64(&dummy);
+    case kLengthDelimited:  // length delimited
+      if (!stream->ReadVarint32(&data)) {
+        return false;
+      }
+      stream->Skip(static_cast<int>(data));
+      return true;
+    case kGroupBegin:  // group begin
+    case kGroupEnd:    // group end
+      return false;    // groups not supported.
+    case kFixed32:     // fixed32
+      return stream->ReadLittleEndian32(&data);
+    default:
+      return false;
+  }
+  return false;  // unrecognized tag type
+}
+
+bool ParseString(protobuf::io::CodedInputStream *stream, StringPiece *result) {
+  if (stream == nullptr) {
+    return false;
+  }
+  if (result == nullptr) {
+    return false;
+  }
+  uint32_t length;
+  if (!stream->ReadVarint32(&length)) {
+    return false;
+  }
+  if (length == 0) {
+    *result = StringPiece(nullptr, 0);
+    return true;
+  }
+  const void *stream_alias;
+  int stream_size;
+  if (!stream->GetDirectBufferPointer(&stream_alias, &stream_size)) {
+    return false;
+  }
+  if (static_cast<uint32_t>(stream_size) < length) {
+    return false;
+  }
+  *result = StringPiece(static_cast<const char *>(stream_alias), length);
+  stream->Skip(static_cast<int>(length));
+  return true;
+}
+
+bool ParseFeatureMapEntry(protobuf::io::CodedInputStream *stream, parsed::FeatureMapEntry *feature_map_entry) {
+  if (stream == nullptr) {
+    return false;
+  }
+  if (feature_map_entry == nullptr) {
+    return false;
+  }
+  uint32_t length;
+  if (!stream->ReadVarint32(&length)) {
+    return false;
+  }
+  const auto limit = stream->PushLimit(static_cast<int>(length));
+
+  // Protobufs allow an arbitrary order for the key and value fields.
+  for (int n = 0; n <= 1; ++n) {
+    constexpr uint32_t kNameTag = 1;
+    constexpr uint32_t kFeatureTag = 2;
+    switch (stream->ReadTag()) {
+      case kDelimitedTag(kNameTag):
+        if (!ParseString(stream, &feature_map_entry->first)) {
+          return false;
+        }
+        break;
+
+      case kDelimitedTag(kFeatureTag): {
+        StringPiece feature_string_piece;
+        if (!ParseString(stream, &feature_string_piece)) {
+          return false;
+        }
+        feature_map_entry->second = parsed::Feature(feature_string_piece);
+        break;
+      }
+
+      default:
+        return false;
+    }
+  }
+
+  if (!stream->ExpectAtEnd()) {
+    return false;
+  }
+  stream->PopLimit(limit);
+  return true;
+}
+
+bool ParseFeatures(protobuf::io::CodedInputStream *stream, parsed::Example *example) {
+  if (stream == nullptr) {
+    return false;
+  }
+  if (example == nullptr) {
+    return false;
+  }
+  uint32_t length;
+  if (!stream->ReadVarint32(&length)) {
+    return false;
+  }
+  const auto limit = stream->PushLimit(static_cast<int>(length));
+  while (!stream->ExpectAtEnd()) {
+    parsed::FeatureMapEntry feature_map_entry;
+    if (!stream->ExpectTag(kDelimitedTag(1))) {
+      return false;
+    }
+    if (!ParseFeatureMapEntry(stream, &feature_map_entry)) {
+      return false;
+    }
+    example->push_back(std::move(feature_map_entry));
+  }
+  stream->PopLimit(limit);
+  return true;
+}
+
+bool ParseExample(protobuf::io::CodedInputStream *stream, parsed::Example *example) {
+  if (stream == nullptr) {
+    return false;
+  }
+  if (example == nullptr) {
+    return false;
+  }
+  // Loop over the input stream which may contain multiple serialized Example
+  // protos merged together as strings. This behavior is consistent with Proto's
+  // ParseFromString when string representations are concatenated.
+  while (!stream->ExpectAtEnd()) {
+    if (!stream->ExpectTag(kDelimitedTag(1))) {
+      if (!SkipExtraneousTag(stream)) {
+        return false;
+      }
+    } else {
+      if (!ParseFeatures(stream, example)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool ParseExample(const StringPiece &serialized, parsed::Example *example) {
+  if (example == nullptr) {
+    return false;
+  }
+  protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized.data()),
+                                        static_cast<int>(serialized.size()));
+  return ParseExample(&stream, example);
+}
+}  // namespace mindspore::dataset
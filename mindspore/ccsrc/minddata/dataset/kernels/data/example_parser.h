@@ -0,0 +1,487 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_DATA_EXAMPLE_PARSER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_DATA_EXAMPLE_PARSER_H_
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/core/data_type.h"
+#include "minddata/dataset/util/status.h"
+#include "utils/log_adapter.h"
+
+// Parsers of the wire format of serialized tf.train.Example, which locate the features without deserializing the
+// whole message and decode the value lists of the wanted features only.
+namespace mindspore::dataset {
+constexpr bool kLittleEndian = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+constexpr int32_t kNumFloatBytes = 4;
+
+using StringPiece = std::string_view;
+
+template <typename T>
+class LimitedArraySlice {
+ public:
+  using value_type = T;
+
+  LimitedArraySlice(T *begin, size_t num_elements) : current_(begin), begin_(begin), end_(begin + num_elements) {}
+
+  /// \brief Get the left space in the slice.
+  int64_t EndDistance() const { return end_ - current_; }
+
+  /// \brief Push value to back of slice. If the slice is full, only change the
+  /// total number without modify the data.
+  void push_back(T &&value) {
+    if (EndDistance() > 0) {
+      *current_ = std::move(value);
+    }
+    ++current_;
+  }
+
+  /// \brief Construct an element at the back of slice and return a mutable
+  /// reference to the new element.
+  T &construct_at_end() {
+    if (EndDistance() <= 0) {
+      MS_EXCEPTION(RuntimeError) << "LimitedArraySlice has no space left.";
+    }
+    return *(current_++);
+  }
+
+  /// \brief Get the mutable reference to the last element in slice.
+  T &back() { return *(current_ - 1); }
+
+  /// \brief Get the number of elements in slice.
+  size_t size() const { return std::min(current_ - begin_, end_ - begin_); }
+
+  /// \brief Resize the slice to the given size by advancing the pointer to
+  /// the current element.
+  void resize(size_t size) { current_ = begin_ + size; }
+
+  /// \brief Get the data buffer.
+  T *data() { return begin_; }
+
+ private:
+  T *current_;
+  T *begin_;
+  T *end_;
+};
+
+inline float BitCastToFloat(uint32_t bits) {
+  float value;
+  (void)std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/// \brief Convert an int64 value to type T, false if the value is out of the range of T.
+template <typename T>
+bool CastInt64(int64_t value, T *result) {
+  static_assert(std::is_integral_v<T>, "CastInt64 only converts to integer types.");
+  if constexpr (std::is_signed_v<T>) {
+    if (value < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+        value > static_cast<int64_t>(std::numeric_limits<T>::max())) {
+      return false;
+    }
+  } else {
+    if (value < 0 || static_cast<uint64_t>(value) > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+      return false;
+    }
+  }
+  *result = static_cast<T>(value);
+  return true;
+}
+
+uint8_t PeekTag(google::protobuf::io::CodedInputStream *stream);
+
+constexpr uint8_t kVarintTag(const uint32_t tag) { return (tag << 3) | 0; }
+constexpr uint8_t kDelimitedTag(const uint32_t tag) { return (tag << 3) | 2; }
+constexpr uint8_t kFixed32Tag(const uint32_t tag) { return (tag << 3) | 5; }
+
+namespace parsed {
+class Feature {
+ public:
+  Feature() = default;
+  explicit Feature(const StringPiece &serialized) : serialized_(serialized) {}
+
+  Status ParseDataType(DataType *dtype) {
+    RETURN_UNEXPECTED_IF_NULL(dtype);
+    if (serialized_.empty()) {
+      *dtype = DataType(DataType::DE_UNKNOWN);
+      return Status::OK();
+    }
+    const auto oneof_tag = static_cast<uint8_t>(*serialized_.data());
+    serialized_.remove_prefix(1);
+    constexpr uint8_t kStringTag = 1;
+    constexpr uint8_t kFloat32Tag = 2;
+    constexpr uint8_t kInt64Tag = 3;
+    switch (oneof_tag) {
+      case kDelimitedTag(kStringTag):
+        *dtype = DataType(DataType::DE_STRING);
+        break;
+      case kDelimitedTag(kFloat32Tag):
+        *dtype = DataType(DataType::DE_FLOAT32);
+        break;
+      case kDelimitedTag(kInt64Tag):
+        *dtype = DataType(DataType::DE_INT64);
+        break;
+      default:
+        // Initialize variable to avoid compiler warning
+        *dtype = DataType(DataType::DE_UNKNOWN);
+        RETURN_STATUS_UNEXPECTED("Unsupported datatype.");
+    }
+    return Status::OK();
+  }
+
+  bool GetNumElementsInBytesList(int *num_elements) const {
+    if (num_elements == nullptr) {
+      return false;
+    }
+    google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
+                                                  static_cast<int>(serialized_.size()));
+    uint32_t length = 0;
+    if (!stream.ReadVarint32(&length)) {
+      return false;
+    }
+    const auto limit = stream.PushLimit(static_cast<int>(length));
+    *num_elements = 0;
+    while (!stream.ExpectAtEnd()) {
+      if (!stream.ExpectTag(kDelimitedTag(1))) {
+        return false;
+      }
+      uint32_t bytes_length = 0;
+      if (!stream.ReadVarint32(&bytes_length)) {
+        return false;
+      }
+      if (!stream.Skip(static_cast<int>(bytes_length))) {
+        return false;
+      }
+      ++*num_elements;
+    }
+    stream.PopLimit(limit);
+    return true;
+  }
+
+  bool GetNumElementsInFloatList(int *num_elements) const {
+    if (num_elements == nullptr) {
+      return false;
+    }
+    google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
+                                                  static_cast<int>(serialized_.size()));
+    uint32_t length = 0;
+    if (!stream.ReadVarint32(&length)) {
+      return false;
+    }
+    const auto limit = stream.PushLimit(static_cast<int>(length));
+    *num_elements = 0;
+    if (!stream.ExpectAtEnd()) {
+      const uint8_t peek_tag = PeekTag(&stream);
+      if (peek_tag == kDelimitedTag(1)) {  // packed
+        if (!stream.ExpectTag(kDelimitedTag(1))) {
+          return false;
+        }
+        uint32_t packed_length = 0;
+        if (!stream.ReadVarint32(&packed_length)) {
+          return false;
+        }
+        *num_elements = static_cast<int>(packed_length / kNumFloatBytes);
+      } else if (peek_tag == kFixed32Tag(1)) {  // non-packed, a tag and a value for each element
+        *num_elements = stream.BytesUntilLimit() / (1 + kNumFloatBytes);
+      } else {
+        return false;
+      }
+    }
+    stream.PopLimit(limit);
+    return true;
+  }
+
+  bool GetNumElementsInInt64List(int *num_elements) const {
+    if (num_elements == nullptr) {
+      return false;
+    }
+    google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
+                                                  static_cast<int>(serialized_.size()));
+    uint32_t length = 0;
+    if (!stream.ReadVarint32(&length)) {
+      return false;
+    }
+    const auto limit = stream.PushLimit(static_cast<int>(length));
+    *num_elements = 0;
+    if (!stream.ExpectAtEnd()) {
+      const uint8_t peek_tag = PeekTag(&stream);
+      if (peek_tag != kDelimitedTag(1) && peek_tag != kVarintTag(1)) {
+        return false;
+      }
+      // varints have no fixed size, so they have to be walked to be counted
+      uint64_t n;  // There is no API for int64
+      if (peek_tag == kDelimitedTag(1)) {           // packed
+        if (!stream.ExpectTag(kDelimitedTag(1))) {  // packed tag
+          return false;
+        }
+        uint32_t packed_length = 0;
+        if (!stream.ReadVarint32(&packed_length)) {
+          return false;
+        }
+        const auto packed_limit = stream.PushLimit(static_cast<int>(packed_length));
+        while (!stream.ExpectAtEnd()) {
+          if (!stream.ReadVarint64(&n)) {
+            return false;
+          }
+          ++*num_elements;
+        }
+        stream.PopLimit(packed_limit);
+      } else {  // non-packed
+        while (!stream.ExpectAtEnd()) {
+          if (!stream.ExpectTag(kVarintTag(1)) || !stream.ReadVarint64(&n)) {
+            return false;
+          }
+          ++*num_elements;
+        }
+      }
+    }
+    stream.PopLimit(limit);
+    return true;
+  }
+
+  static std::string *construct_at_end(LimitedArraySlice<std::string> *bytes_list) {
+    if (bytes_list->EndDistance() <= 0) {
+      return nullptr;
+    }
+    return &bytes_list->construct_at_end();
+  }
+
+  static std::string *construct_at_end(std::vector<std::string> *bytes_list) { return &bytes_list->emplace_back(); }
+
+  template <typename Result>
+  bool ParseBytesList(Result *bytes_list) const {
+    if (bytes_list == nullptr) {
+      return false;
+    }
+
+    google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
+                                                  static_cast<int>(serialized_.size()));
+
+    uint32_t length;
+    if (!stream.ReadVarint32(&length)) {
+      return false;
+    }
+    const auto limit = stream.PushLimit(static_cast<int>(length));
+
+    while (!stream.ExpectAtEnd()) {
+      if (!stream.ExpectTag(kDelimitedTag(1))) {
+        return false;
+      }
+      // parse string
+      uint32_t bytes_length;
+      if (!stream.ReadVarint32(&bytes_length)) {
+        return false;
+      }
+      std::string *bytes = construct_at_end(bytes_list);
+      if (bytes == nullptr) {
+        return false;
+      }
+      bytes->resize(bytes_length);
+      if (!stream.ReadRaw(bytes->data(), static_cast<int>(bytes_length))) {
+        return false;
+      }
+    }
+    stream.PopLimit(limit);
+    return true;
+  }
+
+  template <typename Result>
+  bool ParseFloatList(Result *float_list) const {
+    if (float_list == nullptr) {
+      return false;
+    }
+    google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
+                                                  static_cast<int>(serialized_.size()));
+    uint32_t length;
+    if (!stream.ReadVarint32(&length)) {
+      return false;
+    }
+    const auto limit = stream.PushLimit(static_cast<int>(length));
+
+    if (!stream.ExpectAtEnd()) {
+      const uint8_t peek_tag = PeekTag(&stream);
+      if (peek_tag != kDelimitedTag(1) && peek_tag != kFixed32Tag(1)) {
+        return false;
+      }
+
+      if (peek_tag == kDelimitedTag(1)) {           // packed
+        if (!stream.ExpectTag(kDelimitedTag(1))) {  // packed tag
+          return false;
+        }
+        uint32_t packed_length;
+        if (!stream.ReadVarint32(&packed_length)) {
+          return false;
+        }
+        const auto packed_limit = stream.PushLimit(static_cast<int>(packed_length));
+
+        // Store the initial size to know the offset we have to start writing
+        // data from before resizing the output "vector".
+        const size_t initial_size = float_list->size();
+        float_list->resize(initial_size + packed_length / kNumFloatBytes);
+
+        // If the result data type is float and we are on a little endian
+        // machine then we can simply memcpy the data from the proto into the
+        // result vector.
+        if (kLittleEndian && sizeof(typename Result::value_type) == kNumFloatBytes) {
+          // Calculate the length of the buffer available what can be less than
+          // what we requested in resize in case of a LimitedArraySlice.
+          const uint32_t bytes_to_copy =
+            std::min(static_cast<uint32_t>((float_list->size() - initial_size) * kNumFloatBytes), packed_length);
+          if (!stream.ReadRaw(float_list->data() + initial_size, bytes_to_copy)) {
+            return false;
+          }
+        } else {
+          int64_t index = initial_size;
+          while (!stream.ExpectAtEnd()) {
+            uint32_t buffer32;
+            if (!stream.ReadLittleEndian32(&buffer32)) {
+              return false;
+            }
+            if (index < float_list->size()) {
+              float_list->data()[index] = BitCastToFloat(buffer32);
+              ++index;
+            }
+          }
+        }
+
+        stream.PopLimit(packed_limit);
+      } else {  // non-packed
+        const size_t initial_size = float_list->size();
+        // 1 byte for the tag (`1` encoded as Variant32) and kNumFloatBytes for
+        // the value.
+        const int64_t num_elements = stream.BytesUntilLimit() / (1 + kNumFloatBytes);
+        float_list->resize(initial_size + num_elements);
+        int64_t index = initial_size;
+        while (!stream.ExpectAtEnd()) {
+          if (!stream.ExpectTag(kFixed32Tag(1))) {
+            return false;
+          }
+          uint32_t buffer32;
+          if (!stream.ReadLittleEndian32(&buffer32)) {
+            return false;
+          }
+          float_list->data()[index] = BitCastToFloat(buffer32);
+          ++index;
+        }
+      }
+    }
+
+    stream.PopLimit(limit);
+    return true;
+  }
+
+  /// \brief Parse the values of an int64 list, false if one of them is out of the range of the value type of Result.
+  template <typename Result>
+  bool ParseInt64List(Result *int64_list) const {
+    if (int64_list == nullptr) {
+      return false;
+    }
+    google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
+                                                  static_cast<int>(serialized_.size()));
+    uint32_t length;
+    if (!stream.ReadVarint32(&length)) {
+      return false;
+    }
+    const auto limit = stream.PushLimit(static_cast<int>(length));
+
+    if (!stream.ExpectAtEnd()) {
+      const uint8_t peek_tag = PeekTag(&stream);
+      if (peek_tag != kDelimitedTag(1) && peek_tag != kVarintTag(1)) {
+        return false;
+      }
+      if (peek_tag == kDelimitedTag(1)) {           // packed
+        if (!stream.ExpectTag(kDelimitedTag(1))) {  // packed tag
+          return false;
+        }
+        uint32_t packed_length;
+        if (!stream.ReadVarint32(&packed_length)) {
+          return false;
+        }
+        const auto packed_limit = stream.PushLimit(static_cast<int>(packed_length));
+
+        while (!stream.ExpectAtEnd()) {
+          uint64_t n;  // There is no API for int64
+          if (!stream.ReadVarint64(&n)) {
+            return false;
+          }
+          typename Result::value_type value;
+          if (!CastInt64(static_cast<int64_t>(n), &value)) {
+            return false;
+          }
+          int64_list->push_back(std::move(value));
+        }
+
+        stream.PopLimit(packed_limit);
+      } else {  // non-packed
+        while (!stream.ExpectAtEnd()) {
+          if (!stream.ExpectTag(kVarintTag(1))) {
+            return false;
+          }
+          uint64_t n;  // There is no API for int64
+          if (!stream.ReadVarint64(&n)) {
+            return false;
+          }
+          typename Result::value_type value;
+          if (!CastInt64(static_cast<int64_t>(n), &value)) {
+            return false;
+          }
+          int64_list->push_back(std::move(value));
+        }
+      }
+    }
+    stream.PopLimit(limit);
+    return true;
+  }
+
+  // Size of the serialized feature which is not parsed yet.
+  size_t ByteSize() const { return serialized_.size(); }
+
+ private:
+  StringPiece serialized_;
+};
+
+using FeatureMapEntry = std::pair<StringPiece, Feature>;
+using Example = std::vector<FeatureMapEntry>;
+}  // namespace parsed
+
+/// \brief Skip the field at the current position of stream.
+bool SkipExtraneousTag(google::protobuf::io::CodedInputStream *stream);
+
+/// \brief Read a length delimited field as a view of the underlying buffer.
+bool ParseString(google::protobuf::io::CodedInputStream *stream, StringPiece *result);
+
+/// \brief Read one entry of the feature map, the feature is not decoded.
+bool ParseFeatureMapEntry(google::protobuf::io::CodedInputStream *stream, parsed::FeatureMapEntry *feature_map_entry);
+
+/// \brief Read all the entries of a Features message.
+bool ParseFeatures(google::protobuf::io::CodedInputStream *stream, parsed::Example *example);
+
+/// \brief Split the serialized Example into its feature map entries, which refer to the serialized bytes.
+bool ParseExample(google::protobuf::io::CodedInputStream *stream, parsed::Example *example);
+
+bool ParseExample(const StringPiece &serialized, parsed::Example *example);
+}  // namespace mindspore::dataset
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_DATA_EXAMPLE_PARSER_H_
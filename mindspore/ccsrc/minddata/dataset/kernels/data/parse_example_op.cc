@@ -20,507 +20,21 @@
 #include <algorithm>
 #include <memory>
 
-#include "absl/base/casts.h"
 #include "absl/container/inlined_vector.h"
 #include "proto/example.pb.h"
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/kernels/data/example_parser.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 
 namespace mindspore::dataset {
 namespace protobuf = ::google::protobuf;
 
-constexpr bool kLittleEndian = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
 constexpr size_t kInlinedVectorSize = 4;
 
 template <typename T>
 using SmallVector = absl::InlinedVector<T, kInlinedVectorSize>;
-using StringPiece = std::string_view;
-
-template <typename T>
-class LimitedArraySlice {
- public:
-  using value_type = T;
-
-  LimitedArraySlice(T *begin, size_t num_elements) : current_(begin), begin_(begin), end_(begin + num_elements) {}
-
-  /// \brief Get the left space in the slice.
-  int64_t EndDistance() const { return end_ - current_; }
-
-  /// \brief Push value to back of slice. If the slice is full, only change the
-  /// total number without modify the data.
-  void push_back(T &&value) {
-    if (EndDistance() > 0) {
-      *current_ = std::move(value);
-    }
-    ++current_;
-  }
-
-  /// \brief Construct an element at the back of slice and return a mutable
-  /// reference to the new element.
-  T &construct_at_end() {
-    if (EndDistance() <= 0) {
-      MS_EXCEPTION(RuntimeError) << "LimitedArraySlice has no space left.";
-    }
-    return *(current_++);
-  }
-
-  /// \brief Get the mutable reference to the last element in slice.
-  T &back() { return *(current_ - 1); }
-
-  /// \brief Get the number of elements in slice.
-  size_t size() const { return std::min(current_ - begin_, end_ - begin_); }
-
-  /// \brief Resize the slice to the given size by advancing the pointer to
-  /// the current element.
-  void resize(size_t size) { current_ = begin_ + size; }
-
-  /// \brief Get the data buffer.
-  T *data() { return begin_; }
-
- private:
-  T *current_;
-  T *begin_;
-  T *end_;
-};
-
-uint8_t PeekTag(protobuf::io::CodedInputStream *stream) {
-  if (stream == nullptr) {
-    MS_EXCEPTION(RuntimeError) << "CodedInputStream is nullptr.";
-  }
-  const void *ptr;
-  int size;
-  if (!stream->GetDirectBufferPointer(&ptr, &size)) {
-    return 0;
-  }
-  return *static_cast<const uint8_t *>(ptr);
-}
-
-constexpr uint8_t kVarintTag(const uint32_t tag) { return (tag << 3) | 0; }
-constexpr uint8_t kDelimitedTag(const uint32_t tag) { return (tag << 3) | 2; }
-constexpr uint8_t kFixed32Tag(const uint32_t tag) { return (tag << 3) | 5; }
-
-namespace parsed {
-class Feature {
- public:
-  Feature() = default;
-  explicit Feature(const StringPiece &serialized) : serialized_(serialized) {}
-
-  Status ParseDataType(DataType *dtype) {
-    RETURN_UNEXPECTED_IF_NULL(dtype);
-    if (serialized_.empty()) {
-      *dtype = DataType(DataType::DE_UNKNOWN);
-      return Status::OK();
-    }
-    const auto oneof_tag = static_cast<uint8_t>(*serialized_.data());
-    serialized_.remove_prefix(1);
-    constexpr uint8_t kStringTag = 1;
-    constexpr uint8_t kFloat32Tag = 2;
-    constexpr uint8_t kInt64Tag = 3;
-    switch (oneof_tag) {
-      case kDelimitedTag(kStringTag):
-        *dtype = DataType(DataType::DE_STRING);
-        break;
-      case kDelimitedTag(kFloat32Tag):
-        *dtype = DataType(DataType::DE_FLOAT32);
-        break;
-      case kDelimitedTag(kInt64Tag):
-        *dtype = DataType(DataType::DE_INT64);
-        break;
-      default:
-        // Initialize variable to avoid compiler warning
-        *dtype = DataType(DataType::DE_UNKNOWN);
-        RETURN_STATUS_UNEXPECTED("Unsupported datatype.");
-    }
-    return Status::OK();
-  }
-
-  bool GetNumElementsInBytesList(int *num_elements) const {
-    if (num_elements == nullptr) {
-      return false;
-    }
-    protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
-                                          static_cast<int>(serialized_.size()));
-    uint32_t length = 0;
-    if (!stream.ReadVarint32(&length)) {
-      return false;
-    }
-    const auto limit = stream.PushLimit(static_cast<int>(length));
-    *num_elements = 0;
-    while (!stream.ExpectAtEnd()) {
-      if (!stream.ExpectTag(kDelimitedTag(1))) {
-        return false;
-      }
-      uint32_t bytes_length = 0;
-      if (!stream.ReadVarint32(&bytes_length)) {
-        return false;
-      }
-      if (!stream.Skip(static_cast<int>(bytes_length))) {
-        return false;
-      }
-      ++*num_elements;
-    }
-    stream.PopLimit(limit);
-    return true;
-  }
-
-  static std::string *construct_at_end(LimitedArraySlice<std::string> *bytes_list) {
-    if (bytes_list->EndDistance() <= 0) {
-      return nullptr;
-    }
-    return &bytes_list->construct_at_end();
-  }
-
-  static std::string *construct_at_end(std::vector<std::string> *bytes_list) { return &bytes_list->emplace_back(); }
-
-  template <typename Result>
-  bool ParseBytesList(Result *bytes_list) const {
-    if (bytes_list == nullptr) {
-      return false;
-    }
-
-    protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
-                                          static_cast<int>(serialized_.size()));
-
-    uint32_t length;
-    if (!stream.ReadVarint32(&length)) {
-      return false;
-    }
-    const auto limit = stream.PushLimit(static_cast<int>(length));
-
-    while (!stream.ExpectAtEnd()) {
-      if (!stream.ExpectTag(kDelimitedTag(1))) {
-        return false;
-      }
-      // parse string
-      uint32_t bytes_length;
-      if (!stream.ReadVarint32(&bytes_length)) {
-        return false;
-      }
-      std::string *bytes = construct_at_end(bytes_list);
-      if (bytes == nullptr) {
-        return false;
-      }
-      bytes->resize(bytes_length);
-      if (!stream.ReadRaw(bytes->data(), static_cast<int>(bytes_length))) {
-        return false;
-      }
-    }
-    stream.PopLimit(limit);
-    return true;
-  }
-
-  template <typename Result>
-  bool ParseFloatList(Result *float_list) const {
-    if (float_list == nullptr) {
-      return false;
-    }
-    protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
-                                          static_cast<int>(serialized_.size()));
-    uint32_t length;
-    if (!stream.ReadVarint32(&length)) {
-      return false;
-    }
-    const auto limit = stream.PushLimit(static_cast<int>(length));
-
-    if (!stream.ExpectAtEnd()) {
-      const uint8_t peek_tag = PeekTag(&stream);
-      if (peek_tag != kDelimitedTag(1) && peek_tag != kFixed32Tag(1)) {
-        return false;
-      }
-
-      constexpr int32_t kNumFloatBytes = 4;
-      if (peek_tag == kDelimitedTag(1)) {           // packed
-        if (!stream.ExpectTag(kDelimitedTag(1))) {  // packed tag
-          return false;
-        }
-        uint32_t packed_length;
-        if (!stream.ReadVarint32(&packed_length)) {
-          return false;
-        }
-        const auto packed_limit = stream.PushLimit(static_cast<int>(packed_length));
-
-        // Store the initial size to know the offset we have to start writing
-        // data from before resizing the output "vector".
-        const size_t initial_size = float_list->size();
-        float_list->resize(initial_size + packed_length / kNumFloatBytes);
-
-        // If the result data type is float and we are on a little endian
-        // machine then we can simply memcpy the data from the proto into the
-        // result vector.
-        if (kLittleEndian && sizeof(typename Result::value_type) == kNumFloatBytes) {
-          // Calculate the length of the buffer available what can be less than
-          // what we requested in resize in case of a LimitedArraySlice.
-          const uint32_t bytes_to_copy =
-            std::min(static_cast<uint32_t>((float_list->size() - initial_size) * kNumFloatBytes), packed_length);
-          if (!stream.ReadRaw(float_list->data() + initial_size, bytes_to_copy)) {
-            return false;
-          }
-        } else {
-          int64_t index = initial_size;
-          while (!stream.ExpectAtEnd()) {
-            uint32_t buffer32;
-            if (!stream.ReadLittleEndian32(&buffer32)) {
-              return false;
-            }
-            if (index < float_list->size()) {
-              float_list->data()[index] = absl::bit_cast<float>(buffer32);
-              ++index;
-            }
-          }
-        }
-
-        stream.PopLimit(packed_limit);
-      } else {  // non-packed
-        const size_t initial_size = float_list->size();
-        // 1 byte for the tag (`1` encoded as Variant32) and kNumFloatBytes for
-        // the value.
-        const int64_t num_elements = stream.BytesUntilLimit() / (1 + kNumFloatBytes);
-        float_list->resize(initial_size + num_elements);
-        int64_t index = initial_size;
-        while (!stream.ExpectAtEnd()) {
-          if (!stream.ExpectTag(kFixed32Tag(1))) {
-            return false;
-          }
-          uint32_t buffer32;
-          if (!stream.ReadLittleEndian32(&buffer32)) {
-            return false;
-          }
-          float_list->data()[index] = absl::bit_cast<float>(buffer32);
-          ++index;
-        }
-      }
-    }
-
-    stream.PopLimit(limit);
-    return true;
-  }
-
-  template <typename Result>
-  bool ParseInt64List(Result *int64_list) const {
-    if (int64_list == nullptr) {
-      return false;
-    }
-    protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized_.data()),
-                                          static_cast<int>(serialized_.size()));
-    uint32_t length;
-    if (!stream.ReadVarint32(&length)) {
-      return false;
-    }
-    const auto limit = stream.PushLimit(static_cast<int>(length));
-
-    if (!stream.ExpectAtEnd()) {
-      const uint8_t peek_tag = PeekTag(&stream);
-      if (peek_tag != kDelimitedTag(1) && peek_tag != kVarintTag(1)) {
-        return false;
-      }
-      if (peek_tag == kDelimitedTag(1)) {           // packed
-        if (!stream.ExpectTag(kDelimitedTag(1))) {  // packed tag
-          return false;
-        }
-        uint32_t packed_length;
-        if (!stream.ReadVarint32(&packed_length)) {
-          return false;
-        }
-        const auto packed_limit = stream.PushLimit(static_cast<int>(packed_length));
-
-        while (!stream.ExpectAtEnd()) {
-          uint64_t n;  // There is no API for int64
-          if (!stream.ReadVarint64(&n)) {
-            return false;
-          }
-          int64_list->push_back(static_cast<int64_t>(n));
-        }
-
-        stream.PopLimit(packed_limit);
-      } else {  // non-packed
-        while (!stream.ExpectAtEnd()) {
-          if (!stream.ExpectTag(kVarintTag(1))) {
-            return false;
-          }
-          uint64_t n;  // There is no API for int64
-          if (!stream.ReadVarint64(&n)) {
-            return false;
-          }
-          int64_list->push_back(static_cast<int64_t>(n));
-        }
-      }
-    }
-    stream.PopLimit(limit);
-    return true;
-  }
-
- private:
-  StringPiece serialized_;
-};
-
-using FeatureMapEntry = std::pair<StringPiece, Feature>;
-using Example = std::vector<FeatureMapEntry>;
-}  // namespace parsed
-
-inline bool SkipExtraneousTag(protobuf::io::CodedInputStream *stream) {
-  uint32_t data;
-  uint64_t dummy;
-  constexpr uint32_t kVarint = 0;
-  constexpr uint32_t kFixed64 = 1;
-  constexpr uint32_t kLengthDelimited = 2;
-  constexpr uint32_t kGroupBegin = 3;
-  constexpr uint32_t kGroupEnd = 4;
-  constexpr uint32_t kFixed32 = 5;
-  switch (stream->ReadTag() & 0x7) {
-    case kVarint:  // varint
-      return stream->ReadVarint32(&data);
-    case kFixed64:  // fixed64
-      return stream->ReadLittleEndian64(&dummy);
-    case kLengthDelimited:  // length delimited
-      if (!stream->ReadVarint32(&data)) {
-        return false;
-      }
-      stream->Skip(static_cast<int>(data));
-      return true;
-    case kGroupBegin:  // group begin
-    case kGroupEnd:    // group end
-      return false;    // groups not supported.
-    case kFixed32:     // fixed32
-      return stream->ReadLittleEndian32(&data);
-    default:
-      return false;
-  }
-  return false;  // unrecognized tag type
-}
-
-bool ParseString(protobuf::io::CodedInputStream *stream, StringPiece *result) {
-  if (stream == nullptr) {
-    return false;
-  }
-  if (result == nullptr) {
-    return false;
-  }
-  uint32_t length;
-  if (!stream->ReadVarint32(&length)) {
-    return false;
-  }
-  if (length == 0) {
-    *result = StringPiece(nullptr, 0);
-    return true;
-  }
-  const void *stream_alias;
-  int stream_size;
-  if (!stream->GetDirectBufferPointer(&stream_alias, &stream_size)) {
-    return false;
-  }
-  if (static_cast<uint32_t>(stream_size) < length) {
-    return false;
-  }
-  *result = StringPiece(static_cast<const char *>(stream_alias), length);
-  stream->Skip(static_cast<int>(length));
-  return true;
-}
-
-bool ParseFeatureMapEntry(protobuf::io::CodedInputStream *stream, parsed::FeatureMapEntry *feature_map_entry) {
-  if (stream == nullptr) {
-    return false;
-  }
-  if (feature_map_entry == nullptr) {
-    return false;
-  }
-  uint32_t length;
-  if (!stream->ReadVarint32(&length)) {
-    return false;
-  }
-  const auto limit = stream->PushLimit(static_cast<int>(length));
-
-  // Protobufs allow an arbitrary order for the key and value fields.
-  for (int n = 0; n <= 1; ++n) {
-    constexpr uint32_t kNameTag = 1;
-    constexpr uint32_t kFeatureTag = 2;
-    switch (stream->ReadTag()) {
-      case kDelimitedTag(kNameTag):
-        if (!ParseString(stream, &feature_map_entry->first)) {
-          return false;
-        }
-        break;
-
-      case kDelimitedTag(kFeatureTag): {
-        StringPiece feature_string_piece;
-        if (!ParseString(stream, &feature_string_piece)) {
-          return false;
-        }
-        feature_map_entry->second = parsed::Feature(feature_string_piece);
-        break;
-      }
-
-      default:
-        return false;
-    }
-  }
-
-  if (!stream->ExpectAtEnd()) {
-    return false;
-  }
-  stream->PopLimit(limit);
-  return true;
-}
-
-bool ParseFeatures(protobuf::io::CodedInputStream *stream, parsed::Example *example) {
-  if (stream == nullptr) {
-    return false;
-  }
-  if (example == nullptr) {
-    return false;
-  }
-  uint32_t length;
-  if (!stream->ReadVarint32(&length)) {
-    return false;
-  }
-  const auto limit = stream->PushLimit(static_cast<int>(length));
-  while (!stream->ExpectAtEnd()) {
-    parsed::FeatureMapEntry feature_map_entry;
-    if (!stream->ExpectTag(kDelimitedTag(1))) {
-      return false;
-    }
-    if (!ParseFeatureMapEntry(stream, &feature_map_entry)) {
-      return false;
-    }
-    example->push_back(std::move(feature_map_entry));
-  }
-  stream->PopLimit(limit);
-  return true;
-}
-
-bool ParseExample(protobuf::io::CodedInputStream *stream, parsed::Example *example) {
-  if (stream == nullptr) {
-    return false;
-  }
-  if (example == nullptr) {
-    return false;
-  }
-  // Loop over the input stream which may contain multiple serialized Example
-  // protos merged together as strings. This behavior is consistent with Proto's
-  // ParseFromString when string representations are concatenated.
-  while (!stream->ExpectAtEnd()) {
-    if (!stream->ExpectTag(kDelimitedTag(1))) {
-      if (!SkipExtraneousTag(stream)) {
-        return false;
-      }
-    } else {
-      if (!ParseFeatures(stream, example)) {
-        return false;
-      }
-    }
-  }
-  return true;
-}
-
-bool ParseExample(const StringPiece &serialized, parsed::Example *example) {
-  if (example == nullptr) {
-    return false;
-  }
-  protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(serialized.data()),
-                                        static_cast<int>(serialized.size()));
-  return ParseExample(&stream, example);
-}
 
 template <typename T>
 class TensorVector {
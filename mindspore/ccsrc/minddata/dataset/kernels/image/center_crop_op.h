@@ -43,6 +43,10 @@ class CenterCropOp : public TensorOp {
 
   std::string Name() const override { return kCenterCropOp; }
 
+  int32_t CropHeight() const { return crop_het_; }
+
+  int32_t CropWidth() const { return crop_wid_; }
+
  private:
   Status CenterCropImg(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) const;
 
@@ -0,0 +1,371 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/fused_decode_op.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "minddata/dataset/core/cv_tensor.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/normalize_kernel.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
+#include "minddata/dataset/kernels/image/random_horizontal_flip_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// the largest denominator of the scaled IDCT of libjpeg
+constexpr int kMaxScaleDenom = 8;
+
+// Resize the image into a new buffer, the image may be a view of a larger image.
+Status ResizeImage(const cv::Mat &image, int32_t output_h, int32_t output_w, InterpolationMode mode,
+                   std::shared_ptr<CVTensor> *buffer) {
+  if (mode == InterpolationMode::kCubicPil) {
+    // the PIL cubic resize only works on a whole tensor
+    std::shared_ptr<CVTensor> input;
+    RETURN_IF_NOT_OK(CVTensor::CreateFromMat(image, kDefaultImageRank, &input));
+    std::shared_ptr<Tensor> output;
+    RETURN_IF_NOT_OK(Resize(input, &output, output_h, output_w, 0, 0, mode));
+    *buffer = CVTensor::AsCVTensor(output);
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK(CVTensor::CreateEmpty(TensorShape({output_h, output_w, image.channels()}),
+                                         DataType(DataType::DE_UINT8), buffer));
+  try {
+    cv::resize(image, (*buffer)->mat(), cv::Size(output_w, output_h), 0, 0, GetCVInterpolationMode(mode));
+  } catch (const cv::Exception &e) {
+    RETURN_STATUS_UNEXPECTED("FusedDecode: " + std::string(e.what()));
+  }
+  return Status::OK();
+}
+
+// Crop the center of the image as a view, the image is padded with zeros first like CenterCropOp if it is smaller.
+Status CenterCropImage(int32_t crop_h, int32_t crop_w, cv::Mat *image, std::shared_ptr<CVTensor> *buffer) {
+  int32_t top = crop_h - image->rows;
+  int32_t left = crop_w - image->cols;
+  if (top > 0 || left > 0) {
+    const int32_t kMaxPadScale = 3;
+    CHECK_FAIL_RETURN_UNEXPECTED(
+      top < image->rows * kMaxPadScale && left < image->cols * kMaxPadScale,
+      "CenterCrop: Padding size cannot be more than 3 times of the original image size, got top padding: " +
+        std::to_string(top) + ", left padding: " + std::to_string(left) + ", while the original image size: " +
+        std::to_string(image->rows) + ", " + std::to_string(image->cols));
+    top = std::max(top, 0);
+    left = std::max(left, 0);
+    std::shared_ptr<CVTensor> padded;
+    RETURN_IF_NOT_OK(CVTensor::CreateEmpty(TensorShape({image->rows + top, image->cols + left, image->channels()}),
+                                           DataType(DataType::DE_UINT8), &padded));
+    const int32_t kDivisorOfHalf = 2;
+    try {
+      cv::copyMakeBorder(*image, padded->mat(), (top + 1) / kDivisorOfHalf, top / kDivisorOfHalf,
+                         (left + 1) / kDivisorOfHalf, left / kDivisorOfHalf, cv::BORDER_CONSTANT, cv::Scalar());
+    } catch (const cv::Exception &e) {
+      RETURN_STATUS_UNEXPECTED("FusedDecode: " + std::string(e.what()));
+    }
+    *buffer = std::move(padded);
+    *image = (*buffer)->mat();
+  }
+  *image = (*image)(cv::Rect((image->cols - crop_w) / 2, (image->rows - crop_h) / 2, crop_w, crop_h));
+  return Status::OK();
+}
+
+// Copy the pixels of the image in HWC or CHW order.
+void CopyPixels(const cv::Mat &image, bool chw, uint8_t *out) {
+  const int height = image.rows;
+  const int width = image.cols;
+  const int channels = image.channels();
+  const int64_t plane = static_cast<int64_t>(height) * width;
+  for (int row = 0; row < height; ++row) {
+    const uint8_t *src = image.ptr<uint8_t>(row);
+    uint8_t *dst = out + static_cast<int64_t>(row) * width * (chw ? 1 : channels);
+    for (int col = 0; col < width; ++col) {
+      for (int ch = 0; ch < channels; ++ch) {
+        if (chw) {
+          dst[ch * plane + col] = src[col * channels + ch];
+        } else {
+          dst[col * channels + ch] = src[col * channels + ch];
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+FusedDecodeOp::FusedDecodeOp(const std::vector<std::shared_ptr<TensorOp>> &ops) : ops_(ops) {
+  is_deterministic_ = std::all_of(ops_.begin(), ops_.end(),
+                                  [](const auto &op) { return op == nullptr || op->Deterministic(); });
+  InitStages();
+}
+
+void FusedDecodeOp::Print(std::ostream &out) const {
+  out << Name() << ":";
+  for (const auto &op : ops_) {
+    if (op != nullptr) {
+      out << " " << op->Name();
+    }
+  }
+}
+
+void FusedDecodeOp::InitStages() {
+  fusible_ = false;
+  stages_.clear();
+  if (ops_.empty() || std::any_of(ops_.begin(), ops_.end(), [](const auto &op) { return op == nullptr; })) {
+    return;
+  }
+  auto decode = std::dynamic_pointer_cast<DecodeOp>(ops_[0]);
+  if (decode == nullptr || !decode->IsRgbFormat()) {
+    return;
+  }
+  size_t i = 1;
+  for (; i < ops_.size(); ++i) {
+    const std::string name = ops_[i]->Name();
+    if (name == kRandomCropAndResizeOp) {
+      stages_.push_back(Stage::kRandomResizedCrop);
+    } else if (name == kResizeOp) {
+      stages_.push_back(Stage::kResize);
+    } else if (name == kCenterCropOp) {
+      stages_.push_back(Stage::kCenterCrop);
+    } else if (name == kHorizontalFlipOp) {
+      stages_.push_back(Stage::kHorizontalFlip);
+    } else if (name == kRandomHorizontalFlipOp) {
+      stages_.push_back(Stage::kRandomHorizontalFlip);
+    } else {
+      break;
+    }
+  }
+  if (i < ops_.size() && ops_[i]->Name() == kNormalizeOp) {
+    auto normalize = std::dynamic_pointer_cast<NormalizeOp>(ops_[i]);
+    if (normalize == nullptr || !normalize->IsHwc() || normalize->Mean().size() != normalize->Std().size()) {
+      return;
+    }
+    mean_ = normalize->Mean();
+    std_ = normalize->Std();
+    // a single mean and std is applied to all the channels
+    if (mean_.size() == 1) {
+      mean_.resize(kDefaultImageChannel, mean_[0]);
+      std_.resize(kDefaultImageChannel, std_[0]);
+    }
+    if (mean_.size() != kDefaultImageChannel) {
+      return;
+    }
+    normalize_ = true;
+    ++i;
+  }
+  if (i < ops_.size() && ops_[i]->Name() == kHwcToChwOp) {
+    hwc_to_chw_ = true;
+    ++i;
+  }
+  fusible_ = i == ops_.size();
+}
+
+void FusedDecodeOp::SetSeed(uint32_t seed) {
+  for (auto &op : ops_) {
+    if (op != nullptr) {
+      op->SetSeed(seed);
+    }
+  }
+}
+
+Status FusedDecodeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  std::vector<TensorShape> in_shapes = inputs;
+  for (auto &op : ops_) {
+    RETURN_UNEXPECTED_IF_NULL(op);
+    RETURN_IF_NOT_OK(op->OutputShape(in_shapes, outputs));
+    in_shapes = std::move(outputs);  // outputs become empty after move
+  }
+  outputs = std::move(in_shapes);
+  return Status::OK();
+}
+
+Status FusedDecodeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  std::vector<DataType> in_types = inputs;
+  for (auto &op : ops_) {
+    RETURN_UNEXPECTED_IF_NULL(op);
+    RETURN_IF_NOT_OK(op->OutputType(in_types, outputs));
+    in_types = std::move(outputs);  // outputs become empty after move
+  }
+  outputs = std::move(in_types);
+  return Status::OK();
+}
+
+Status FusedDecodeOp::Compute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  if (!fusible_ || input.size() != 1 || input[0] == nullptr || input[0]->Rank() != 1 || !IsNonEmptyJPEG(input[0])) {
+    return ComputeUnfused(input, output);
+  }
+  output->resize(1);
+  return ComputeFused(input[0], nullptr, &(*output)[0]);
+}
+
+Status FusedDecodeOp::ComputeInto(const TensorRow &input, TensorRow *output, const OutputAllocator &allocate) {
+  IO_CHECK_VECTOR(input, output);
+  if (!fusible_ || input.size() != 1 || input[0] == nullptr || input[0]->Rank() != 1 || !IsNonEmptyJPEG(input[0])) {
+    return ComputeUnfused(input, output);
+  }
+  output->resize(1);
+  return ComputeFused(input[0], allocate, &(*output)[0]);
+}
+
+Status FusedDecodeOp::ComputeUnfused(const TensorRow &input, TensorRow *output) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!ops_.empty(), "FusedDecode: transform list should not be empty.");
+  TensorRow in_rows = input;
+  for (auto &op : ops_) {
+    RETURN_UNEXPECTED_IF_NULL(op);
+    RETURN_IF_NOT_OK(op->Compute(in_rows, output));
+    in_rows = std::move(*output);  // after move, *output become empty
+  }
+  (*output) = std::move(in_rows);
+  return Status::OK();
+}
+
+Status FusedDecodeOp::ComputeFused(const std::shared_ptr<Tensor> &input, const OutputAllocator &allocate,
+                                   std::shared_ptr<Tensor> *output) {
+  int w_in = 0;
+  int h_in = 0;
+  RETURN_IF_NOT_OK(GetJpegImageInfo(input, &w_in, &h_in));
+
+  // A leading crop is decoded only, and the resize right after it is done by the scaled IDCT in part.
+  size_t stage = 0;
+  int x = 0;
+  int y = 0;
+  int crop_w = 0;  // all zero decodes the whole image
+  int crop_h = 0;
+  int32_t resize_h = 0;  // zero if the decode is not followed by a resize
+  int32_t resize_w = 0;
+  InterpolationMode interpolation = InterpolationMode::kLinear;
+  if (!stages_.empty() && stages_[0] == Stage::kRandomResizedCrop) {
+    auto op = std::static_pointer_cast<RandomCropAndResizeOp>(ops_[1]);
+    RETURN_IF_NOT_OK(op->GetCropBox(h_in, w_in, &x, &y, &crop_h, &crop_w));
+    resize_h = op->TargetHeight();
+    resize_w = op->TargetWidth();
+    interpolation = op->Interpolation();
+    stage = 1;
+  } else {
+    if (!stages_.empty() && stages_[0] == Stage::kCenterCrop) {
+      auto op = std::static_pointer_cast<CenterCropOp>(ops_[1]);
+      // a crop larger than the image is padded by the stage later
+      if (op->CropHeight() <= h_in && op->CropWidth() <= w_in) {
+        crop_h = op->CropHeight();
+        crop_w = op->CropWidth();
+        x = (w_in - crop_w) / 2;
+        y = (h_in - crop_h) / 2;
+        stage = 1;
+      }
+    }
+    if (stage < stages_.size() && stages_[stage] == Stage::kResize) {
+      auto op = std::static_pointer_cast<ResizeOp>(ops_[stage + 1]);
+      RETURN_IF_NOT_OK(op->ComputeOutputSize(crop_h == 0 ? h_in : crop_h, crop_w == 0 ? w_in : crop_w, &resize_h,
+                                             &resize_w));
+      interpolation = op->Interpolation();
+      stage++;
+    }
+  }
+
+  // the scaled image is still no smaller than the resized one
+  int scale_denom = 1;
+  if (resize_h > 0 && resize_w > 0) {
+    const int roi_h = crop_h == 0 ? h_in : crop_h;
+    const int roi_w = crop_w == 0 ? w_in : crop_w;
+    while (scale_denom < kMaxScaleDenom && roi_h >= resize_h * scale_denom * 2 && roi_w >= resize_w * scale_denom * 2) {
+      scale_denom *= 2;
+    }
+  }
+
+  std::shared_ptr<Tensor> decoded;
+  RETURN_IF_NOT_OK(JpegCropAndDecode(input, &decoded, x, y, crop_w, crop_h, scale_denom));
+  std::shared_ptr<CVTensor> buffer = CVTensor::AsCVTensor(decoded);
+  cv::Mat image = buffer->mat();
+  if (resize_h > 0 && (image.rows != resize_h || image.cols != resize_w)) {
+    RETURN_IF_NOT_OK(ResizeImage(image, resize_h, resize_w, interpolation, &buffer));
+    image = buffer->mat();
+  }
+
+  for (; stage < stages_.size(); ++stage) {
+    const auto &op = ops_[stage + 1];
+    switch (stages_[stage]) {
+      case Stage::kRandomResizedCrop: {
+        auto crop_op = std::static_pointer_cast<RandomCropAndResizeOp>(op);
+        RETURN_IF_NOT_OK(crop_op->GetCropBox(image.rows, image.cols, &x, &y, &crop_h, &crop_w));
+        RETURN_IF_NOT_OK(ResizeImage(image(cv::Rect(x, y, crop_w, crop_h)), crop_op->TargetHeight(),
+                                     crop_op->TargetWidth(), crop_op->Interpolation(), &buffer));
+        image = buffer->mat();
+        break;
+      }
+      case Stage::kResize: {
+        auto resize_op = std::static_pointer_cast<ResizeOp>(op);
+        RETURN_IF_NOT_OK(resize_op->ComputeOutputSize(image.rows, image.cols, &resize_h, &resize_w));
+        if (image.rows != resize_h || image.cols != resize_w) {
+          RETURN_IF_NOT_OK(ResizeImage(image, resize_h, resize_w, resize_op->Interpolation(), &buffer));
+          image = buffer->mat();
+        }
+        break;
+      }
+      case Stage::kCenterCrop: {
+        auto crop_op = std::static_pointer_cast<CenterCropOp>(op);
+        RETURN_IF_NOT_OK(CenterCropImage(crop_op->CropHeight(), crop_op->CropWidth(), &image, &buffer));
+        break;
+      }
+      case Stage::kHorizontalFlip:
+      case Stage::kRandomHorizontalFlip:
+        // the image is owned by this op, so it is flipped in place
+        if (stages_[stage] == Stage::kHorizontalFlip ||
+            std::static_pointer_cast<RandomHorizontalFlipOp>(op)->DrawFlip()) {
+          cv::flip(image, image, 1);
+        }
+        break;
+    }
+  }
+
+  if (!normalize_ && !hwc_to_chw_ && image.data == buffer->mat().data && image.rows == buffer->mat().rows &&
+      image.cols == buffer->mat().cols) {
+    *output = buffer;
+    return Status::OK();
+  }
+  return WriteOutput(image, allocate, output);
+}
+
+Status FusedDecodeOp::WriteOutput(const cv::Mat &image, const OutputAllocator &allocate,
+                                  std::shared_ptr<Tensor> *output) const {
+  if (!normalize_ && !hwc_to_chw_) {
+    std::shared_ptr<CVTensor> output_cv;
+    RETURN_IF_NOT_OK(CVTensor::CreateFromMat(image, kDefaultImageRank, &output_cv));
+    *output = output_cv;
+    return Status::OK();
+  }
+  const dsize_t height = image.rows;
+  const dsize_t width = image.cols;
+  const dsize_t channels = image.channels();
+  TensorShape shape = hwc_to_chw_ ? TensorShape({channels, height, width}) : TensorShape({height, width, channels});
+  if (normalize_) {
+    RETURN_IF_NOT_OK(CreateOutput(allocate, 0, shape, DataType(DataType::DE_FLOAT32), output));
+    NormalizeKernel kernel(mean_, std_, false, hwc_to_chw_, false);
+    kernel.Run(image.ptr<uint8_t>(0), static_cast<int64_t>(image.step[0]), height, width,
+               (*output)->GetMutableBuffer());
+  } else {
+    RETURN_IF_NOT_OK(CreateOutput(allocate, 0, shape, DataType(DataType::DE_UINT8), output));
+    auto *out = reinterpret_cast<uint8_t *>((*output)->GetMutableBuffer());
+    CopyPixels(image, hwc_to_chw_, out);
+  }
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
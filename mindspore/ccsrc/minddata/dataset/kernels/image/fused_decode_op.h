@@ -0,0 +1,92 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_DECODE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_DECODE_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <opencv2/core/mat.hpp>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief Decode followed by a chain of crop, resize, flip, normalize and HWC2CHW ops, run as one kernel.
+///     For a jpeg image only the crop box of the leading crop is decoded, and the scaled IDCT of libjpeg shrinks
+///     the image when it is resized down anyway. Crops are views of the image, flips are done in place, and the
+///     normalized CHW output is written in one pass, so no full size intermediate image is allocated.
+///     Other images, or chains which can not be fused, run the ops one by one.
+class FusedDecodeOp : public TensorOp {
+ public:
+  /// \brief Constructor
+  /// \param[in] ops The built ops of the chain, the first one is the DecodeOp
+  explicit FusedDecodeOp(const std::vector<std::shared_ptr<TensorOp>> &ops);
+
+  ~FusedDecodeOp() override = default;
+
+  void Print(std::ostream &out) const override;
+
+  Status Compute(const TensorRow &input, TensorRow *output) override;
+
+  Status ComputeInto(const TensorRow &input, TensorRow *output, const OutputAllocator &allocate) override;
+
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kFusedDecodeOp; }
+
+  void SetSeed(uint32_t seed) override;
+
+  const std::vector<std::shared_ptr<TensorOp>> &GetOps() const { return ops_; }
+
+ private:
+  enum class Stage { kRandomResizedCrop, kResize, kCenterCrop, kHorizontalFlip, kRandomHorizontalFlip };
+
+  /// \brief Check the chain and collect the stages, the chain is run op by op if it can not be fused
+  void InitStages();
+
+  /// \brief Run the ops one by one
+  Status ComputeUnfused(const TensorRow &input, TensorRow *output);
+
+  /// \brief Decode the jpeg image and apply the stages of the chain
+  /// \param[in] input The jpeg image
+  /// \param[in] allocate Gives the memory of the output image, can be empty
+  /// \param[out] output The output image
+  Status ComputeFused(const std::shared_ptr<Tensor> &input, const OutputAllocator &allocate,
+                      std::shared_ptr<Tensor> *output);
+
+  /// \brief Write the image to the output tensor, normalized and transposed to CHW if the chain asks for it
+  /// \param[in] image The image, which may be a view of a larger image
+  /// \param[in] allocate Gives the memory of the output image, can be empty
+  /// \param[out] output The output tensor
+  Status WriteOutput(const cv::Mat &image, const OutputAllocator &allocate, std::shared_ptr<Tensor> *output) const;
+
+  std::vector<std::shared_ptr<TensorOp>> ops_;
+  std::vector<Stage> stages_;  // geometric stages after the decode, ops_[i + 1] is the op of stages_[i]
+  bool fusible_ = false;       // whether the chain can be fused
+  bool normalize_ = false;     // whether the geometric stages are followed by a Normalize
+  bool hwc_to_chw_ = false;    // whether the chain ends with a HWC2CHW
+  std::vector<float> mean_;    // mean of each channel of the Normalize
+  std::vector<float> std_;     // std of each channel of the Normalize
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_DECODE_OP_H_
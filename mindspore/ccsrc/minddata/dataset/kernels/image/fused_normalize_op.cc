@@ -0,0 +1,140 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+
+#include <utility>
+
+#include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/normalize_kernel.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+FusedNormalizeOp::FusedNormalizeOp(std::vector<float> mean, std::vector<float> std, bool pad, bool to_chw,
+                                   std::string dtype)
+    : mean_(std::move(mean)), std_(std::move(std)), pad_(pad), to_chw_(to_chw), dtype_(std::move(dtype)) {}
+
+Status FusedNormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  return ComputeFused(input, nullptr, output);
+}
+
+Status FusedNormalizeOp::ComputeInto(const TensorRow &input, TensorRow *output, const OutputAllocator &allocate) {
+  IO_CHECK_VECTOR(input, output);
+  CHECK_FAIL_RETURN_UNEXPECTED(input.size() == 1, "The op is OneToOne, can only accept one tensor as input.");
+  output->resize(1);
+  return ComputeFused(input[0], allocate, &(*output)[0]);
+}
+
+Status FusedNormalizeOp::ComputeFused(const std::shared_ptr<Tensor> &input, const OutputAllocator &allocate,
+                                      std::shared_ptr<Tensor> *output) {
+  RETURN_UNEXPECTED_IF_NULL(input);
+  RETURN_IF_NOT_OK(ValidateImageRank("Normalize", input->Rank()));
+  if (input->type() != DataType::DE_UINT8 && input->type() != DataType::DE_FLOAT32) {
+    return ComputeUnfused(input, output);
+  }
+  const dsize_t height = input->shape()[0];
+  const dsize_t width = input->shape()[1];
+  const dsize_t channels = input->Rank() == kDefaultImageRank ? input->shape()[kChannelIndexHWC] : 1;
+  CHECK_FAIL_RETURN_UNEXPECTED(std_.size() == mean_.size(),
+                               "Normalize: mean and std vectors are not of same size, got size of std: " +
+                                 std::to_string(std_.size()) + ", and mean size: " + std::to_string(mean_.size()));
+  std::vector<float> mean = mean_;
+  std::vector<float> std = std_;
+  // caller provided 1 mean/std value and there is more than one channel --> duplicate mean/std value
+  if (mean.size() == 1 && channels > 1) {
+    mean.resize(channels, mean[0]);
+    std.resize(channels, std[0]);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(channels == static_cast<dsize_t>(mean.size()),
+                               "Normalize: number of channels does not match the size of mean and std vectors, got "
+                               "channels: " +
+                                 std::to_string(channels) + ", size of mean: " + std::to_string(mean.size()));
+
+  const bool to_fp16 = dtype_ == "float16";
+  NormalizeKernel kernel(mean, std, pad_, to_chw_, to_fp16);
+  const dsize_t out_channels = kernel.OutputChannels();
+  TensorShape shape({height, width});
+  if (pad_ || input->Rank() == kDefaultImageRank) {
+    shape = to_chw_ ? TensorShape({out_channels, height, width}) : TensorShape({height, width, out_channels});
+  }
+  RETURN_IF_NOT_OK(CreateOutput(allocate, 0, shape, DataType(dtype_), output));
+  void *dst = (*output)->GetMutableBuffer();
+  RETURN_UNEXPECTED_IF_NULL(dst);
+  if (input->type() == DataType::DE_UINT8) {
+    kernel.Run(reinterpret_cast<const uint8_t *>(input->GetBuffer()), width * channels, height, width, dst);
+  } else {
+    kernel.Run(reinterpret_cast<const float *>(input->GetBuffer()), width * channels, height, width, dst);
+  }
+  return Status::OK();
+}
+
+Status FusedNormalizeOp::ComputeUnfused(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) const {
+  std::shared_ptr<Tensor> image;
+  if (pad_) {
+    RETURN_IF_NOT_OK(NormalizePad(input, &image, mean_, std_, dtype_, true));
+  } else {
+    RETURN_IF_NOT_OK(Normalize(input, &image, mean_, std_, true));
+  }
+  if (to_chw_) {
+    RETURN_IF_NOT_OK(HwcToChw(image, &image));
+  }
+  if (image->type() != DataType(dtype_)) {
+    RETURN_IF_NOT_OK(TypeCast(image, &image, DataType(dtype_)));
+  }
+  *output = std::move(image);
+  return Status::OK();
+}
+
+Status FusedNormalizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  outputs.clear();
+  CHECK_FAIL_RETURN_UNEXPECTED(!inputs.empty(), "FusedNormalize: inputs cannot be empty.");
+  const TensorShape &image_shape = inputs[0];
+  if (image_shape.Rank() == kMinImageRank && !pad_) {
+    (void)outputs.emplace_back(image_shape);
+  } else if (image_shape.Rank() == kMinImageRank || image_shape.Rank() == kDefaultImageRank) {
+    const dsize_t channels = image_shape.Rank() == kDefaultImageRank ? image_shape[kChannelIndexHWC] : 1;
+    const dsize_t out_channels = channels + (pad_ ? 1 : 0);
+    (void)outputs.emplace_back(to_chw_ ? TensorShape({out_channels, image_shape[0], image_shape[1]})
+                                       : TensorShape({image_shape[0], image_shape[1], out_channels}));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(!outputs.empty(),
+                               "FusedNormalize: invalid input shape, expected 2D or 3D input, but got input "
+                               "dimension is:" +
+                                 std::to_string(image_shape.Rank()));
+  return Status::OK();
+}
+
+Status FusedNormalizeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  outputs[0] = DataType(dtype_);
+  return Status::OK();
+}
+
+void FusedNormalizeOp::Print(std::ostream &out) const {
+  out << Name() << ", mean: {";
+  for (const auto &m : mean_) {
+    out << m << ", ";
+  }
+  out << "}, std: {";
+  for (const auto &s : std_) {
+    out << s << ", ";
+  }
+  out << "}, pad: " << pad_ << ", to_chw: " << to_chw_ << ", dtype: " << dtype_ << std::endl;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,73 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief Normalize an HWC image, optionally pad it with a channel of zeros, transpose it to CHW and write it as
+///     float32 or float16, in one vectorized pass. Replaces Normalize or NormalizePad followed by HWC2CHW and TypeCast.
+///     uint8 and float32 images use the vectorized kernel, images of other types run the ops one by one.
+class FusedNormalizeOp : public TensorOp {
+ public:
+  /// \brief Constructor
+  /// \param[in] mean The mean of each channel
+  /// \param[in] std The standard deviation of each channel
+  /// \param[in] pad Whether to append a channel of zeros, like NormalizePad
+  /// \param[in] to_chw Whether to transpose the image to CHW
+  /// \param[in] dtype The output type, float32 or float16
+  FusedNormalizeOp(std::vector<float> mean, std::vector<float> std, bool pad, bool to_chw,
+                   std::string dtype = "float32");
+
+  ~FusedNormalizeOp() override = default;
+
+  void Print(std::ostream &out) const override;
+
+  Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  Status ComputeInto(const TensorRow &input, TensorRow *output, const OutputAllocator &allocate) override;
+
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kFusedNormalizeOp; }
+
+ private:
+  /// \brief Run the vectorized kernel into the output given by allocate, falls back to ComputeUnfused
+  Status ComputeFused(const std::shared_ptr<Tensor> &input, const OutputAllocator &allocate,
+                      std::shared_ptr<Tensor> *output);
+
+  /// \brief Run Normalize or NormalizePad, HWC2CHW and TypeCast one by one
+  Status ComputeUnfused(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) const;
+
+  std::vector<float> mean_;
+  std::vector<float> std_;
+  bool pad_;
+  bool to_chw_;
+  std::string dtype_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
@@ -518,7 +518,7 @@ void JpegErrorExitCustom(j_common_ptr cinfo) {
 }
 
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x, int crop_y,
-                         int crop_w, int crop_h) {
+                         int crop_w, int crop_h, int scale_denom) {
   struct jpeg_decompress_struct cinfo {};
   auto DestroyDecompressAndReturnError = [&cinfo](const std::string &err) {
     jpeg_destroy_decompress(&cinfo);
@@ -532,11 +532,23 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
     JpegSetSource(&cinfo, input->GetBuffer(), input->SizeInBytes());
     (void)jpeg_read_header(&cinfo, TRUE);
     RETURN_IF_NOT_OK(JpegSetColorSpace(&cinfo));
+    if (scale_denom > 1) {
+      // the scaled IDCT skips the high frequencies instead of decoding the full size image and shrinking it later
+      cinfo.scale_num = 1;
+      cinfo.scale_denom = static_cast<unsigned int>(scale_denom);
+    }
     jpeg_calc_output_dimensions(&cinfo);
     RETURN_IF_NOT_OK(CheckJpegExit(&cinfo));
   } catch (std::runtime_error &e) {
     return DestroyDecompressAndReturnError(e.what());
   }
+  if (scale_denom > 1 && !(crop_x == 0 && crop_y == 0 && crop_w == 0 && crop_h == 0)) {
+    // map the crop box onto the scaled image
+    crop_x /= scale_denom;
+    crop_y /= scale_denom;
+    crop_w = std::max(1, std::min(crop_w / scale_denom, static_cast<int>(cinfo.output_width) - crop_x));
+    crop_h = std::max(1, std::min(crop_h / scale_denom, static_cast<int>(cinfo.output_height) - crop_y));
+  }
   CHECK_FAIL_RETURN_UNEXPECTED((std::numeric_limits<int32_t>::max() - crop_w) > crop_x,
                                "JpegCropAndDecode: addition(crop x and crop width) out of bounds, got crop x:" +
                                  std::to_string(crop_x) + ", and crop width:" + std::to_string(crop_w));
@@ -169,8 +169,14 @@ bool IsNonEmptyPNG(const std::shared_ptr<Tensor> &input);
 
 void JpegSetSource(j_decompress_ptr c_info, const void *data, int64_t data_size);
 
+/// \brief Decode the crop of a jpeg image, only the rows and MCU columns covering the crop are decoded
+/// \param input: Tensor containing the not decoded jpeg image
+/// \param output: Decoded crop of shape <H,W,C> and type DE_UINT8
+/// \param x, y, w, h: the crop box on the image, all zero to decode the whole image
+/// \param scale_denom: 1, 2, 4 or 8, the image is downscaled by the IDCT of libjpeg with this factor, the crop box is
+///     still given on the original image
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x = 0, int y = 0,
-                         int w = 0, int h = 0);
+                         int w = 0, int h = 0, int scale_denom = 1);
 
 /// \brief Returns Rescaled image
 /// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
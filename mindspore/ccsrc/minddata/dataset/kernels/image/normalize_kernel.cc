@@ -0,0 +1,353 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/normalize_kernel.h"
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MD_NORMALIZE_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define MD_NORMALIZE_NEON
+#include <arm_neon.h>
+#endif
+
+#include "base/float16.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// the widest vector has 16 floats, the mean and std patterns hold channels * kMaxLanes values so that every vector
+// load of them starts at a multiple of the vector width and never wraps around
+constexpr int64_t kMaxLanes = 16;
+
+using NormalizeU8Func = void (*)(const uint8_t *src, float *dst, int64_t count, const float *mean, const float *std,
+                                 int64_t period);
+using NormalizeF32Func = void (*)(const float *src, float *dst, int64_t count, const float *mean, const float *std,
+                                  int64_t period);
+using ToFp16Func = void (*)(const float *src, float16 *dst, int64_t count);
+
+struct NormalizeFuncs {
+  NormalizeU8Func normalize_u8;
+  NormalizeF32Func normalize_f32;
+  ToFp16Func to_fp16;
+};
+
+template <typename T>
+void NormalizeScalar(const T *src, float *dst, int64_t begin, int64_t count, const float *mean, const float *std,
+                     int64_t period) {
+  int64_t p = begin % period;
+  for (int64_t i = begin; i < count; ++i) {
+    dst[i] = (static_cast<float>(src[i]) - mean[p]) / std[p];
+    if (++p == period) {
+      p = 0;
+    }
+  }
+}
+
+void ToFp16Scalar(const float *src, float16 *dst, int64_t begin, int64_t count) {
+  for (int64_t i = begin; i < count; ++i) {
+    dst[i] = static_cast<float16>(src[i]);
+  }
+}
+
+void NormalizeU8Default(const uint8_t *src, float *dst, int64_t count, const float *mean, const float *std,
+                        int64_t period) {
+  NormalizeScalar(src, dst, 0, count, mean, std, period);
+}
+
+void NormalizeF32Default(const float *src, float *dst, int64_t count, const float *mean, const float *std,
+                         int64_t period) {
+  NormalizeScalar(src, dst, 0, count, mean, std, period);
+}
+
+void ToFp16Default(const float *src, float16 *dst, int64_t count) { ToFp16Scalar(src, dst, 0, count); }
+
+#ifdef MD_NORMALIZE_X86
+constexpr int64_t kAvxLanes = 8;
+constexpr int64_t kAvx512Lanes = 16;
+
+__attribute__((target("avx2"))) void NormalizeU8Avx2(const uint8_t *src, float *dst, int64_t count,
+                                                     const float *mean, const float *std, int64_t period) {
+  int64_t i = 0;
+  int64_t p = 0;
+  for (; i + kAvxLanes <= count; i += kAvxLanes) {
+    __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i));
+    __m256 value = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+    value = _mm256_div_ps(_mm256_sub_ps(value, _mm256_loadu_ps(mean + p)), _mm256_loadu_ps(std + p));
+    _mm256_storeu_ps(dst + i, value);
+    p += kAvxLanes;
+    if (p == period) {
+      p = 0;
+    }
+  }
+  NormalizeScalar(src, dst, i, count, mean, std, period);
+}
+
+__attribute__((target("avx2"))) void NormalizeF32Avx2(const float *src, float *dst, int64_t count, const float *mean,
+                                                      const float *std, int64_t period) {
+  int64_t i = 0;
+  int64_t p = 0;
+  for (; i + kAvxLanes <= count; i += kAvxLanes) {
+    __m256 value = _mm256_loadu_ps(src + i);
+    value = _mm256_div_ps(_mm256_sub_ps(value, _mm256_loadu_ps(mean + p)), _mm256_loadu_ps(std + p));
+    _mm256_storeu_ps(dst + i, value);
+    p += kAvxLanes;
+    if (p == period) {
+      p = 0;
+    }
+  }
+  NormalizeScalar(src, dst, i, count, mean, std, period);
+}
+
+__attribute__((target("avx2,f16c"))) void ToFp16Avx2(const float *src, float16 *dst, int64_t count) {
+  int64_t i = 0;
+  for (; i + kAvxLanes <= count; i += kAvxLanes) {
+    __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), half);
+  }
+  ToFp16Scalar(src, dst, i, count);
+}
+
+__attribute__((target("avx512f"))) void NormalizeU8Avx512(const uint8_t *src, float *dst, int64_t count,
+                                                          const float *mean, const float *std, int64_t period) {
+  int64_t i = 0;
+  int64_t p = 0;
+  for (; i + kAvx512Lanes <= count; i += kAvx512Lanes) {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m512 value = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes));
+    value = _mm512_div_ps(_mm512_sub_ps(value, _mm512_loadu_ps(mean + p)), _mm512_loadu_ps(std + p));
+    _mm512_storeu_ps(dst + i, value);
+    p += kAvx512Lanes;
+    if (p == period) {
+      p = 0;
+    }
+  }
+  NormalizeScalar(src, dst, i, count, mean, std, period);
+}
+
+__attribute__((target("avx512f"))) void NormalizeF32Avx512(const float *src, float *dst, int64_t count,
+                                                           const float *mean, const float *std, int64_t period) {
+  int64_t i = 0;
+  int64_t p = 0;
+  for (; i + kAvx512Lanes <= count; i += kAvx512Lanes) {
+    __m512 value = _mm512_loadu_ps(src + i);
+    value = _mm512_div_ps(_mm512_sub_ps(value, _mm512_loadu_ps(mean + p)), _mm512_loadu_ps(std + p));
+    _mm512_storeu_ps(dst + i, value);
+    p += kAvx512Lanes;
+    if (p == period) {
+      p = 0;
+    }
+  }
+  NormalizeScalar(src, dst, i, count, mean, std, period);
+}
+
+__attribute__((target("avx512f"))) void ToFp16Avx512(const float *src, float16 *dst, int64_t count) {
+  int64_t i = 0;
+  for (; i + kAvx512Lanes <= count; i += kAvx512Lanes) {
+    __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), half);
+  }
+  ToFp16Scalar(src, dst, i, count);
+}
+
+bool CpuSupportsF16c() {
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+  return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_F16C) != 0;
+}
+#endif
+
+#ifdef MD_NORMALIZE_NEON
+constexpr int64_t kNeonLanes = 4;
+constexpr int64_t kNeonStep = 8;
+
+void NormalizeU8Neon(const uint8_t *src, float *dst, int64_t count, const float *mean, const float *std,
+                     int64_t period) {
+  int64_t i = 0;
+  int64_t p = 0;
+  for (; i + kNeonStep <= count; i += kNeonStep) {
+    uint16x8_t words = vmovl_u8(vld1_u8(src + i));
+    float32x4_t low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(words)));
+    float32x4_t high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(words)));
+    low = vdivq_f32(vsubq_f32(low, vld1q_f32(mean + p)), vld1q_f32(std + p));
+    high = vdivq_f32(vsubq_f32(high, vld1q_f32(mean + p + kNeonLanes)), vld1q_f32(std + p + kNeonLanes));
+    vst1q_f32(dst + i, low);
+    vst1q_f32(dst + i + kNeonLanes, high);
+    p += kNeonStep;
+    if (p == period) {
+      p = 0;
+    }
+  }
+  NormalizeScalar(src, dst, i, count, mean, std, period);
+}
+
+void NormalizeF32Neon(const float *src, float *dst, int64_t count, const float *mean, const float *std,
+                      int64_t period) {
+  int64_t i = 0;
+  int64_t p = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    float32x4_t value = vld1q_f32(src + i);
+    vst1q_f32(dst + i, vdivq_f32(vsubq_f32(value, vld1q_f32(mean + p)), vld1q_f32(std + p)));
+    p += kNeonLanes;
+    if (p == period) {
+      p = 0;
+    }
+  }
+  NormalizeScalar(src, dst, i, count, mean, std, period);
+}
+
+void ToFp16Neon(const float *src, float16 *dst, int64_t count) {
+  int64_t i = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    vst1_f16(reinterpret_cast<float16_t *>(dst + i), vcvt_f16_f32(vld1q_f32(src + i)));
+  }
+  ToFp16Scalar(src, dst, i, count);
+}
+#endif
+
+NormalizeFuncs SelectNormalizeFuncs() {
+  NormalizeFuncs funcs = {NormalizeU8Default, NormalizeF32Default, ToFp16Default};
+#ifdef MD_NORMALIZE_X86
+  if (__builtin_cpu_supports("avx512f")) {
+    funcs = {NormalizeU8Avx512, NormalizeF32Avx512, ToFp16Avx512};
+  } else if (__builtin_cpu_supports("avx2")) {
+    funcs = {NormalizeU8Avx2, NormalizeF32Avx2, CpuSupportsF16c() ? ToFp16Avx2 : ToFp16Default};
+  }
+#elif defined(MD_NORMALIZE_NEON)
+  funcs = {NormalizeU8Neon, NormalizeF32Neon, ToFp16Neon};
+#endif
+  return funcs;
+}
+
+const NormalizeFuncs &GetNormalizeFuncs() {
+  static const NormalizeFuncs funcs = SelectNormalizeFuncs();
+  return funcs;
+}
+
+// dst[c * plane + x] = src[x * channels + c]
+void SplitChannels(const float *src, int64_t width, int64_t channels, float *dst, int64_t plane) {
+  int64_t x = 0;
+#ifdef MD_NORMALIZE_NEON
+  constexpr int64_t kRgbChannels = 3;
+  if (channels == kRgbChannels) {
+    for (; x + kNeonLanes <= width; x += kNeonLanes) {
+      float32x4x3_t rgb = vld3q_f32(src + x * kRgbChannels);
+      vst1q_f32(dst + x, rgb.val[0]);
+      vst1q_f32(dst + plane + x, rgb.val[1]);
+      vst1q_f32(dst + 2 * plane + x, rgb.val[2]);
+    }
+  }
+#endif
+  for (int64_t c = 0; c < channels; ++c) {
+    float *dst_plane = dst + c * plane;
+    for (int64_t i = x; i < width; ++i) {
+      dst_plane[i] = src[i * channels + c];
+    }
+  }
+}
+
+// copy the pixels of src and append a zero to each of them
+void InterleavePad(const float *src, int64_t width, int64_t channels, float *dst) {
+  for (int64_t x = 0; x < width; ++x) {
+    std::copy(src + x * channels, src + (x + 1) * channels, dst + x * (channels + 1));
+    dst[x * (channels + 1) + channels] = 0.0F;
+  }
+}
+
+void NormalizeRow(const uint8_t *src, float *dst, int64_t count, const float *mean, const float *std,
+                  int64_t period) {
+  GetNormalizeFuncs().normalize_u8(src, dst, count, mean, std, period);
+}
+
+void NormalizeRow(const float *src, float *dst, int64_t count, const float *mean, const float *std, int64_t period) {
+  GetNormalizeFuncs().normalize_f32(src, dst, count, mean, std, period);
+}
+}  // namespace
+
+NormalizeKernel::NormalizeKernel(const std::vector<float> &mean, const std::vector<float> &std, bool pad, bool to_chw,
+                                 bool to_fp16)
+    : channels_(static_cast<int64_t>(mean.size())), pad_(pad), to_chw_(to_chw), to_fp16_(to_fp16) {
+  mean_pattern_.reserve(channels_ * kMaxLanes);
+  std_pattern_.reserve(channels_ * kMaxLanes);
+  for (int64_t i = 0; i < kMaxLanes; ++i) {
+    mean_pattern_.insert(mean_pattern_.end(), mean.begin(), mean.end());
+    std_pattern_.insert(std_pattern_.end(), std.begin(), std.end());
+  }
+}
+
+void NormalizeKernel::Run(const uint8_t *src, int64_t src_step, int64_t height, int64_t width, void *dst) const {
+  RunImpl(src, src_step, height, width, dst);
+}
+
+void NormalizeKernel::Run(const float *src, int64_t src_step, int64_t height, int64_t width, void *dst) const {
+  RunImpl(src, src_step, height, width, dst);
+}
+
+template <typename T>
+void NormalizeKernel::RunImpl(const T *src, int64_t src_step, int64_t height, int64_t width, void *dst) const {
+  const int64_t count = width * channels_;
+  const int64_t out_channels = OutputChannels();
+  const int64_t plane = height * width;
+  const auto period = static_cast<int64_t>(mean_pattern_.size());
+  auto *dst_f32 = static_cast<float *>(dst);
+  auto *dst_f16 = static_cast<float16 *>(dst);
+  // a float32 HWC image without padding is normalized straight into the output, other layouts go through a row
+  const bool direct = !pad_ && !to_chw_ && !to_fp16_;
+  std::vector<float> normalized(direct ? 0 : count);
+  std::vector<float> packed(to_fp16_ ? width * out_channels : 0);
+
+  if (pad_ && to_chw_) {
+    if (to_fp16_) {
+      std::fill(dst_f16 + channels_ * plane, dst_f16 + out_channels * plane, static_cast<float16>(0.0F));
+    } else {
+      std::fill(dst_f32 + channels_ * plane, dst_f32 + out_channels * plane, 0.0F);
+    }
+  }
+  for (int64_t row = 0; row < height; ++row) {
+    const T *src_row = src + row * src_step;
+    if (direct) {
+      NormalizeRow(src_row, dst_f32 + row * count, count, mean_pattern_.data(), std_pattern_.data(), period);
+      continue;
+    }
+    NormalizeRow(src_row, normalized.data(), count, mean_pattern_.data(), std_pattern_.data(), period);
+    if (!to_fp16_) {
+      if (to_chw_) {
+        SplitChannels(normalized.data(), width, channels_, dst_f32 + row * width, plane);
+      } else {
+        InterleavePad(normalized.data(), width, channels_, dst_f32 + row * width * out_channels);
+      }
+      continue;
+    }
+    // float16 output, lay the row out in float32 first and convert it
+    if (to_chw_) {
+      SplitChannels(normalized.data(), width, channels_, packed.data(), width);
+      for (int64_t c = 0; c < channels_; ++c) {
+        GetNormalizeFuncs().to_fp16(packed.data() + c * width, dst_f16 + c * plane + row * width, width);
+      }
+    } else if (pad_) {
+      InterleavePad(normalized.data(), width, channels_, packed.data());
+      GetNormalizeFuncs().to_fp16(packed.data(), dst_f16 + row * width * out_channels, width * out_channels);
+    } else {
+      GetNormalizeFuncs().to_fp16(normalized.data(), dst_f16 + row * count, count);
+    }
+  }
+}
+}  // namespace dataset
+}  // namespace mindspore
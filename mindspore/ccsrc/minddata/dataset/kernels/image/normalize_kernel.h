@@ -0,0 +1,70 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_NORMALIZE_KERNEL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_NORMALIZE_KERNEL_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace mindspore {
+namespace dataset {
+/// \brief Vectorized kernel doing Normalize, the zero channel of NormalizePad, HWC2CHW and the cast to float32 or
+///     float16 in one pass over an HWC image. The instruction set (AVX-512, AVX2 or NEON) is chosen once at runtime,
+///     a scalar loop is used on other CPUs. Each value is computed as (pixel - mean) / std in float32, so the output
+///     is the same as the one of the ops run one by one.
+class NormalizeKernel {
+ public:
+  /// \brief Constructor
+  /// \param[in] mean The mean of each channel
+  /// \param[in] std The standard deviation of each channel
+  /// \param[in] pad Whether to append a channel of zeros, like NormalizePad
+  /// \param[in] to_chw Whether to write the output in CHW layout
+  /// \param[in] to_fp16 Whether to write float16 instead of float32
+  NormalizeKernel(const std::vector<float> &mean, const std::vector<float> &std, bool pad, bool to_chw, bool to_fp16);
+
+  ~NormalizeKernel() = default;
+
+  /// \brief Number of channels of the input image
+  int64_t Channels() const { return channels_; }
+
+  /// \brief Number of channels of the output image
+  int64_t OutputChannels() const { return channels_ + (pad_ ? 1 : 0); }
+
+  /// \brief Normalize an HWC image
+  /// \param[in] src The first pixel of the image
+  /// \param[in] src_step The number of elements between the starts of two rows of the image
+  /// \param[in] height The height of the image
+  /// \param[in] width The width of the image
+  /// \param[out] dst The output buffer, of height * width * OutputChannels() float32 or float16
+  void Run(const uint8_t *src, int64_t src_step, int64_t height, int64_t width, void *dst) const;
+
+  void Run(const float *src, int64_t src_step, int64_t height, int64_t width, void *dst) const;
+
+ private:
+  template <typename T>
+  void RunImpl(const T *src, int64_t src_step, int64_t height, int64_t width, void *dst) const;
+
+  int64_t channels_;
+  bool pad_;
+  bool to_chw_;
+  bool to_fp16_;
+  // mean and std repeated to cover a whole number of vectors, the channel of a value is its index modulo channels_
+  std::vector<float> mean_pattern_;
+  std::vector<float> std_pattern_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_NORMALIZE_KERNEL_H_
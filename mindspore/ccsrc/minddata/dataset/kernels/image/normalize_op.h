@@ -38,6 +38,12 @@ class NormalizeOp : public TensorOp {
 
   std::string Name() const override { return kNormalizeOp; }
 
+  const std::vector<float> &Mean() const { return mean_; }
+
+  const std::vector<float> &Std() const { return std_; }
+
+  bool IsHwc() const { return is_hwc_; }
+
  private:
   std::vector<float> mean_;
   std::vector<float> std_;
@@ -52,6 +52,12 @@ class RandomCropAndResizeOp : public RandomTensorOp {
 
   Status GetCropBox(int h_in, int w_in, int *x, int *y, int *crop_height, int *crop_width);
 
+  int32_t TargetHeight() const { return target_height_; }
+
+  int32_t TargetWidth() const { return target_width_; }
+
+  InterpolationMode Interpolation() const { return interpolation_; }
+
   std::string Name() const override { return kRandomCropAndResizeOp; }
 
   uint32_t NumInput() override { return 1; }
@@ -43,6 +43,9 @@ class RandomHorizontalFlipOp : public RandomTensorOp {
 
   std::string Name() const override { return kRandomHorizontalFlipOp; }
 
+  // Draws whether the next image is flipped, for the kernels which apply the flip themselves
+  bool DrawFlip() { return distribution_(random_generator_); }
+
   uint32_t NumInput() override { return 1; }
 
   uint32_t NumOutput() override { return 1; }
@@ -56,6 +56,15 @@ class ResizeOp : public TensorOp {
 
   static TensorShape ComputeOutputShape(const TensorShape &input, int32_t output_h, int32_t output_w);
 
+  // Computes the size of the resized image.
+  // @param input_h: the height of the input image.
+  // @param input_w: the width of the input image.
+  // @param output_h: the height of the resized image.
+  // @param output_w: the width of the resized image.
+  Status ComputeOutputSize(int32_t input_h, int32_t input_w, int32_t *output_h, int32_t *output_w) const;
+
+  InterpolationMode Interpolation() const { return interpolation_; }
+
   std::string Name() const override { return kResizeOp; }
 
  protected:
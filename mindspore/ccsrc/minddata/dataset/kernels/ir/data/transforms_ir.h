@@ -323,6 +323,8 @@ class TypeCastOperation : public TensorOperation {
 
   static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
 
+  const DataType &GetDataType() const { return data_type_; }
+
  private:
   DataType data_type_;
 };
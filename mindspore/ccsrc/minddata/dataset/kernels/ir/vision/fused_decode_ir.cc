@@ -0,0 +1,77 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/ir/vision/fused_decode_ir.h"
+
+#include <algorithm>
+
+#ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/serdes.h"
+#include "minddata/dataset/kernels/image/fused_decode_op.h"
+#endif
+#include "minddata/dataset/kernels/ir/validators.h"
+#include "minddata/dataset/util/validators.h"
+
+namespace mindspore {
+namespace dataset {
+namespace vision {
+#ifndef ENABLE_ANDROID
+// FusedDecodeOperation
+FusedDecodeOperation::FusedDecodeOperation(const std::vector<std::shared_ptr<TensorOperation>> &transforms)
+    : transforms_(transforms) {}
+
+FusedDecodeOperation::~FusedDecodeOperation() = default;
+
+std::string FusedDecodeOperation::Name() const { return kFusedDecodeOperation; }
+
+Status FusedDecodeOperation::ValidateParams() {
+  RETURN_IF_NOT_OK(ValidateVectorTransforms("FusedDecode", transforms_));
+  return Status::OK();
+}
+
+std::shared_ptr<TensorOp> FusedDecodeOperation::Build() {
+  std::vector<std::shared_ptr<TensorOp>> tensor_ops;
+  (void)std::transform(transforms_.begin(), transforms_.end(), std::back_inserter(tensor_ops),
+                       [](const auto &op) -> std::shared_ptr<TensorOp> { return op->Build(); });
+  return std::make_shared<FusedDecodeOp>(tensor_ops);
+}
+
+Status FusedDecodeOperation::to_json(nlohmann::json *out_json) {
+  RETURN_UNEXPECTED_IF_NULL(out_json);
+  auto transforms = nlohmann::json::array();
+  for (auto &tensor_operation : transforms_) {
+    nlohmann::json tensor_op, args;
+    RETURN_IF_NOT_OK(tensor_operation->to_json(&args));
+    tensor_op["tensor_op_params"] = args;
+    tensor_op["tensor_op_name"] = tensor_operation->Name();
+    transforms.push_back(tensor_op);
+  }
+  (*out_json)["transforms"] = transforms;
+  return Status::OK();
+}
+
+Status FusedDecodeOperation::from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation) {
+  RETURN_UNEXPECTED_IF_NULL(operation);
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "transforms", kFusedDecodeOperation));
+  nlohmann::json transforms = op_params["transforms"];
+  std::vector<std::shared_ptr<TensorOperation>> operations;
+  RETURN_IF_NOT_OK(Serdes::ConstructTensorOps(transforms, &operations));
+  *operation = std::make_shared<vision::FusedDecodeOperation>(operations);
+  return Status::OK();
+}
+#endif
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_DECODE_IR_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_DECODE_IR_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/api/status.h"
+#include "minddata/dataset/kernels/ir/tensor_operation.h"
+
+namespace mindspore {
+namespace dataset {
+namespace vision {
+constexpr char kFusedDecodeOperation[] = "FusedDecode";
+
+/// \brief A Decode followed by a chain of crop, resize, flip, normalize and HWC2CHW operations, which is made by
+///     TensorOpFusionPass and runs as one kernel.
+class FusedDecodeOperation : public TensorOperation {
+ public:
+  /// \brief Constructor
+  /// \param[in] transforms The chain of operations, the first one is the Decode
+  explicit FusedDecodeOperation(const std::vector<std::shared_ptr<TensorOperation>> &transforms);
+
+  ~FusedDecodeOperation() override;
+
+  std::shared_ptr<TensorOp> Build() override;
+
+  Status ValidateParams() override;
+
+  std::string Name() const override;
+
+  Status to_json(nlohmann::json *out_json) override;
+
+  static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
+
+  const std::vector<std::shared_ptr<TensorOperation>> &Transforms() const { return transforms_; }
+
+ private:
+  std::vector<std::shared_ptr<TensorOperation>> transforms_;
+};
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_DECODE_IR_H_
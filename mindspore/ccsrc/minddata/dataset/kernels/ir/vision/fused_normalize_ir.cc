@@ -0,0 +1,80 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
+
+#ifndef ENABLE_ANDROID
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+#endif
+#include "minddata/dataset/kernels/ir/validators.h"
+#include "minddata/dataset/util/validators.h"
+
+namespace mindspore {
+namespace dataset {
+namespace vision {
+#ifndef ENABLE_ANDROID
+// FusedNormalizeOperation
+FusedNormalizeOperation::FusedNormalizeOperation(const std::vector<float> &mean, const std::vector<float> &std,
+                                                 bool pad, bool to_chw, const std::string &dtype)
+    : mean_(mean), std_(std), pad_(pad), to_chw_(to_chw), dtype_(dtype) {}
+
+FusedNormalizeOperation::~FusedNormalizeOperation() = default;
+
+std::string FusedNormalizeOperation::Name() const { return kFusedNormalizeOperation; }
+
+Status FusedNormalizeOperation::ValidateParams() {
+  RETURN_IF_NOT_OK(ValidateVectorMeanStd("FusedNormalize", mean_, std_));
+  if (dtype_ != "float32" && dtype_ != "float16") {
+    std::string err_msg = "FusedNormalize: dtype must be float32 or float16, but got: " + dtype_;
+    LOG_AND_RETURN_STATUS_SYNTAX_ERROR(err_msg);
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<TensorOp> FusedNormalizeOperation::Build() {
+  return std::make_shared<FusedNormalizeOp>(mean_, std_, pad_, to_chw_, dtype_);
+}
+
+Status FusedNormalizeOperation::to_json(nlohmann::json *out_json) {
+  RETURN_UNEXPECTED_IF_NULL(out_json);
+  nlohmann::json args;
+  args["mean"] = mean_;
+  args["std"] = std_;
+  args["pad"] = pad_;
+  args["to_chw"] = to_chw_;
+  args["dtype"] = dtype_;
+  *out_json = args;
+  return Status::OK();
+}
+
+Status FusedNormalizeOperation::from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation) {
+  RETURN_UNEXPECTED_IF_NULL(operation);
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "mean", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "std", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "pad", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "to_chw", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "dtype", kFusedNormalizeOperation));
+  std::vector<float> mean = op_params["mean"];
+  std::vector<float> std = op_params["std"];
+  bool pad = op_params["pad"];
+  bool to_chw = op_params["to_chw"];
+  std::string dtype = op_params["dtype"];
+  *operation = std::make_shared<vision::FusedNormalizeOperation>(mean, std, pad, to_chw, dtype);
+  return Status::OK();
+}
+#endif
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
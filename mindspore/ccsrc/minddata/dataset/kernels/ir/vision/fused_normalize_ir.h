@@ -0,0 +1,66 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_NORMALIZE_IR_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_NORMALIZE_IR_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/api/status.h"
+#include "minddata/dataset/kernels/ir/tensor_operation.h"
+
+namespace mindspore {
+namespace dataset {
+namespace vision {
+constexpr char kFusedNormalizeOperation[] = "FusedNormalize";
+
+/// \brief A Normalize or NormalizePad on an HWC image followed by HWC2CHW and/or TypeCast, which is made by
+///     TensorOpFusionPass and runs as one vectorized kernel.
+class FusedNormalizeOperation : public TensorOperation {
+ public:
+  /// \brief Constructor
+  /// \param[in] mean The mean of each channel
+  /// \param[in] std The standard deviation of each channel
+  /// \param[in] pad Whether to append a channel of zeros, like NormalizePad
+  /// \param[in] to_chw Whether to transpose the image to CHW
+  /// \param[in] dtype The output type, float32 or float16
+  FusedNormalizeOperation(const std::vector<float> &mean, const std::vector<float> &std, bool pad, bool to_chw,
+                          const std::string &dtype);
+
+  ~FusedNormalizeOperation() override;
+
+  std::shared_ptr<TensorOp> Build() override;
+
+  Status ValidateParams() override;
+
+  std::string Name() const override;
+
+  Status to_json(nlohmann::json *out_json) override;
+
+  static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
+
+ private:
+  std::vector<float> mean_;
+  std::vector<float> std_;
+  bool pad_;
+  bool to_chw_;
+  std::string dtype_;
+};
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_NORMALIZE_IR_H_
@@ -51,6 +51,12 @@ class NormalizeOperation : public TensorOperation {
 
   MapTargetDevice Type() override;
 
+  const std::vector<float> &Mean() const { return mean_; }
+
+  const std::vector<float> &Std() const { return std_; }
+
+  bool IsHwc() const { return is_hwc_; }
+
  private:
   std::vector<float> mean_;
   std::vector<float> std_;
@@ -49,6 +49,14 @@ class NormalizePadOperation : public TensorOperation {
 
   static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
 
+  const std::vector<float> &Mean() const { return mean_; }
+
+  const std::vector<float> &Std() const { return std_; }
+
+  const std::string &DType() const { return dtype_; }
+
+  bool IsHwc() const { return is_hwc_; }
+
  private:
   std::vector<float> mean_;
   std::vector<float> std_;
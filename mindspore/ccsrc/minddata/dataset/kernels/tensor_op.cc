@@ -46,6 +46,23 @@ Status TensorOp::Compute(const TensorRow &input, TensorRow *output) {
   RETURN_STATUS_UNEXPECTED("Is this TensorOp oneToOne? If no, please implement this Compute() in the derived class.");
 }
 
+Status TensorOp::ComputeInto(const TensorRow &input, TensorRow *output, const OutputAllocator &allocate) {
+  return Compute(input, output);
+}
+
+Status TensorOp::CreateOutput(const OutputAllocator &allocate, size_t column, const TensorShape &shape,
+                              const DataType &type, std::shared_ptr<Tensor> *output) {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  *output = nullptr;
+  if (allocate) {
+    RETURN_IF_NOT_OK(allocate(column, shape, type, output));
+  }
+  if (*output == nullptr) {
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, type, output));
+  }
+  return Status::OK();
+}
+
 Status TensorOp::Compute(const std::shared_ptr<DeviceTensor> &input, std::shared_ptr<DeviceTensor> *output) {
   IO_CHECK(input, output);
   RETURN_STATUS_UNEXPECTED(
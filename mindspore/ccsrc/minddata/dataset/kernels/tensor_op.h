@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_TENSOR_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_TENSOR_OP_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -98,6 +99,8 @@ constexpr char kDvppResizedCropOp[] = "DvppResizedCropOp";
 constexpr char kDvppVerticalFlipOp[] = "DvppVerticalFlipOp";
 constexpr char kEqualizeOp[] = "EqualizeOp";
 constexpr char kEraseOp[] = "EraseOp";
+constexpr char kFusedDecodeOp[] = "FusedDecodeOp";
+constexpr char kFusedNormalizeOp[] = "FusedNormalizeOp";
 constexpr char kGaussianBlurOp[] = "GaussianBlurOp";
 constexpr char kHorizontalFlipOp[] = "HorizontalFlipOp";
 constexpr char kHwcToChwOp[] = "HWC2CHWOp";
@@ -254,6 +257,11 @@ constexpr char kPyFuncOp[] = "PyFuncOp";
 constexpr char kPluginOp[] = "PluginOp";
 constexpr char kNoOp[] = "NoOp";
 
+// Gives the tensor an op writes its output column into, e.g. the slot of the row in a batch allocated ahead by
+// BatchOp. Sets out to nullptr when the caller has no memory for that shape and type, the op allocates it itself then.
+using OutputAllocator = std::function<Status(size_t column, const TensorShape &shape, const DataType &type,
+                                             std::shared_ptr<Tensor> *out)>;
+
 // A class that does a computation on a Tensor
 class TensorOp {
  public:
@@ -287,6 +295,15 @@ class TensorOp {
   // @return Status
   virtual Status Compute(const TensorRow &input, TensorRow *output);
 
+  // Perform an operation like Compute, but write the output tensors into the memory given by allocate, so the caller
+  // needs no copy of the result. Ops which allocate their output in one place override it, the default calls Compute
+  // and leaves the output where Compute put it.
+  // @param input is a vector of shared_ptr to Tensor (pass by const reference).
+  // @param output is the address to an empty vector of shared_ptr to Tensor.
+  // @param allocate gives the memory of each output column.
+  // @return Status
+  virtual Status ComputeInto(const TensorRow &input, TensorRow *output, const OutputAllocator &allocate);
+
   // Perform an operation on one DeviceTensor and produce one DeviceTensor. This is for 1-to-1 column MapOp
   // @param input shares the ownership of the DeviceTensor (increase the ref count).
   // @param output the address to a shared_ptr where the result will be placed.
@@ -352,6 +369,16 @@ class TensorOp {
   virtual void SetSeed(uint32_t seed) {}
 
  protected:
+  // Create an output tensor in the memory given by allocate if it has some, otherwise allocate a new one
+  // @param allocate gives the memory of the output column, can be empty.
+  // @param column the index of the output column.
+  // @param shape the shape of the output tensor.
+  // @param type the type of the output tensor.
+  // @param output the address to a shared_ptr where the tensor will be placed.
+  // @return Status
+  static Status CreateOutput(const OutputAllocator &allocate, size_t column, const TensorShape &shape,
+                             const DataType &type, std::shared_ptr<Tensor> *output);
+
   bool is_deterministic_{true};
 };
 
@@ -18,8 +18,10 @@
 
 #include <algorithm>
 #include <string>
+#include <string_view>
 
 #include "minddata/dataset/core/pybind_support.h"
+#include "minddata/dataset/core/string_tensor_builder.h"
 #include "minddata/dataset/kernels/data/slice_op.h"
 #include "minddata/dataset/kernels/data/concatenate_op.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
@@ -34,6 +36,34 @@ Status SlidingWindowHelper(const std::shared_ptr<Tensor> &input, std::shared_ptr
     return Tensor::CreateEmpty(TensorShape({0}), input->type(), output);
   }
 
+  if (input->Rank() == 1) {
+    // copy each window straight into the output instead of slicing and concatenating tensors
+    const dsize_t num_windows = out_shape[0];
+    if (input->type().IsString()) {
+      StringTensorBuilder windows;
+      windows.Reserve(num_windows * width, input->SizeInBytes() * width);
+      auto first = input->begin<std::string_view>();
+      for (dsize_t i = 0; i < num_windows; i++) {
+        auto item = first + i;
+        for (uint32_t j = 0; j < width; j++, ++item) {
+          windows.Append(*item);
+        }
+      }
+      return windows.Build(out_shape, input->type(), output);
+    }
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(out_shape, input->type(), output));
+    const dsize_t type_size = input->type().SizeInBytes();
+    const dsize_t window_size = type_size * width;
+    const uchar *src = input->GetBuffer();
+    uchar *dst = (*output)->GetMutableBuffer();
+    for (dsize_t i = 0; i < num_windows; i++) {
+      int ret_code = memcpy_s(dst + i * window_size, window_size, src + i * type_size, window_size);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "SlidingWindow: failed to copy data, ret code: " +
+                                                      std::to_string(ret_code) + ".");
+    }
+    return Status::OK();
+  }
+
   axis = Tensor::HandleNeg(axis, input->shape().Size());
   int32_t axis_end = input->shape()[axis];
   std::shared_ptr<Tensor> tmp;
@@ -25,12 +25,12 @@ JiebaTokenizerOp::JiebaTokenizerOp(const std::string &hmm_path, const std::strin
   jieba_parser_ = std::make_unique<cppjieba::Jieba>(mp_dict_path_, hmm_model_path_, "");
 }
 
-Status JiebaTokenizerOp::Tokenize(std::string_view sentence_v, std::vector<std::string> *words,
+Status JiebaTokenizerOp::Tokenize(std::string_view sentence_v, StringTensorBuilder *words,
                                   std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
   std::string sentence{sentence_v};
 
   if (sentence == "") {
-    (void)words->emplace_back("");
+    words->Append("");
   } else {
     std::vector<cppjieba::Word> tmp;
     if (jieba_mode_ == JiebaMode::kMp) {
@@ -45,8 +45,8 @@ Status JiebaTokenizerOp::Tokenize(std::string_view sentence_v, std::vector<std::
         std::make_unique<cppjieba::MixSegment>(jieba_parser_->GetDictTrie(), jieba_parser_->GetHMMModel());
       mix_seg->Cut(sentence, tmp, true);
     }
-    GetStringsFromWords(tmp, *words);
-    for (auto item : tmp) {
+    for (const auto &item : tmp) {
+      words->Append(item.word);
       offsets_start->push_back(static_cast<uint32_t>(item.offset));
       offsets_limit->push_back(static_cast<uint32_t>(item.offset + item.word.length()));
     }
@@ -48,7 +48,7 @@ class JiebaTokenizerOp : public TokenizerOp {
         << mp_dict_path_;
   }
 
-  Status Tokenize(std::string_view sentence_v, std::vector<std::string> *words, std::vector<uint32_t> *offsets_start,
+  Status Tokenize(std::string_view sentence_v, StringTensorBuilder *words, std::vector<uint32_t> *offsets_start,
                   std::vector<uint32_t> *offsets_limit) override;
 
   // @word the word to be added to the JiebaTokenizer.
@@ -17,6 +17,9 @@
 #include "minddata/dataset/text/kernels/ngram_op.h"
 
 #include <algorithm>
+#include <string_view>
+
+#include "minddata/dataset/core/string_tensor_builder.h"
 
 namespace mindspore {
 namespace dataset {
@@ -35,9 +38,9 @@ Status NgramOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Te
   CHECK_FAIL_RETURN_UNEXPECTED(input->type() == DataType::DE_STRING && input->Rank() == 1,
                                "Ngram: input is not a 1D data with string datatype.");
   std::vector<int32_t> offsets;                 // offsets for each str
-  std::vector<std::string> res;                 // holds the result of ngrams
+  StringTensorBuilder res;                      // holds the result of ngrams
   std::string str_buffer;                       // concat all pad tokens with string interleaved with separators
-  res.reserve(input->shape().NumOfElements());  // this should be more than enough
+  res.Reserve(input->shape().NumOfElements(), 0);  // this should be more than enough
   offsets.reserve(1 + l_len_ + r_len_ + input->shape().NumOfElements());
   str_buffer.reserve(l_pad_with_sp_.size() * l_len_ + r_pad_with_sp_.size() * r_len_ + input->SizeInBytes());
   offsets.push_back(str_buffer.size());  // insert 0 as the starting pos
@@ -55,22 +58,23 @@ Status NgramOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Te
     offsets.push_back((str_buffer += r_pad_with_sp_).size());
   }
 
+  // the ngrams are views of the buffer, copied once into the output tensor
+  const std::string_view buffer_view(str_buffer);
   for (auto n : ngrams_) {
     CHECK_FAIL_RETURN_UNEXPECTED(n > 0, "Ngram: The element in the container 'ngrams' cannot be negative.\n");
     int32_t start_ind = l_len_ - std::min(l_len_, n - 1);
     int32_t end_ind = offsets.size() - r_len_ + std::min(r_len_, n - 1);
     if (end_ind - start_ind <= n) {
-      (void)res.emplace_back(std::string());  // push back empty string
+      res.Append("");  // push back empty string
     } else {
       CHECK_FAIL_RETURN_UNEXPECTED(end_ind - n >= 0, "Ngram: get offsets failed.");
 
       for (int ind = start_ind; ind < end_ind - n; ind++) {
-        (void)res.emplace_back(str_buffer.substr(offsets[ind], offsets[ind + n] - offsets[ind] - separator_.size()));
+        res.Append(buffer_view.substr(offsets[ind], offsets[ind + n] - offsets[ind] - separator_.size()));
       }
     }
   }
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(res, TensorShape({static_cast<dsize_t>(res.size())}), output));
-  return Status::OK();
+  return res.Build(output);
 }
 
 void NgramOp::Print(std::ostream &out) const {
@@ -40,11 +40,11 @@ Status RegexTokenizerOp::GetUnicodeSubstr(const icu::UnicodeString &input, const
   return Status::OK();
 }
 
-Status RegexTokenizerOp::GetRegexTokens(const std::string &text, std::vector<std::string> *out_tokens,
+Status RegexTokenizerOp::GetRegexTokens(const std::string &text, StringTensorBuilder *out_tokens,
                                         std::vector<uint32_t> *offsets_start,
                                         std::vector<uint32_t> *offsets_limit) const {
   UErrorCode status = U_ZERO_ERROR;
-  out_tokens->clear();
+  out_tokens->Clear();
   icu::RegexMatcher token_matcher(delim_pattern_, 0, status);
   CHECK_FAIL_RETURN_UNEXPECTED(U_SUCCESS(status),
                                "RegexTokenizer: create ICU RegexMatcher failed, you may input one error pattern");
@@ -71,7 +71,7 @@ Status RegexTokenizerOp::GetRegexTokens(const std::string &text, std::vector<std
       uint32_t token_offset = 0;
       RETURN_IF_NOT_OK(GetUnicodeSubstr(utext, token_start_index, token_len, &token));
       token_offset = token.length();
-      (void)out_tokens->emplace_back(std::move(token));
+      out_tokens->Append(token);
       offsets_start->push_back(static_cast<uint32_t>(text_start_index));
       offsets_limit->push_back(static_cast<uint32_t>(text_start_index + token_offset));
       text_start_index += token_offset;
@@ -86,7 +86,7 @@ Status RegexTokenizerOp::GetRegexTokens(const std::string &text, std::vector<std
       delim_matcher.reset(delim_str);
       delim_str_offset = delim_utf8_str.length();
       if (keep_delim_ && delim_matcher.matches(status) && U_SUCCESS(status)) {
-        (void)out_tokens->emplace_back(std::move(delim_utf8_str));
+        out_tokens->Append(delim_utf8_str);
         offsets_start->push_back(static_cast<uint32_t>(text_start_index));
         offsets_limit->push_back(static_cast<uint32_t>(text_start_index + delim_str_offset));
       }
@@ -100,14 +100,14 @@ Status RegexTokenizerOp::GetRegexTokens(const std::string &text, std::vector<std
     uint32_t temp_offset = 0;
     RETURN_IF_NOT_OK(GetUnicodeSubstr(utext, token_start_index, utext.length() - token_start_index, &temp));
     temp_offset = temp.length();
-    (void)out_tokens->emplace_back(std::move(temp));
+    out_tokens->Append(temp);
     offsets_start->push_back(static_cast<uint32_t>(text_start_index));
     offsets_limit->push_back(static_cast<uint32_t>(text_start_index + temp_offset));
   }
   return Status::OK();
 }
 
-Status RegexTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+Status RegexTokenizerOp::Tokenize(std::string_view str, StringTensorBuilder *splits,
                                   std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
   RETURN_IF_NOT_OK(GetRegexTokens(std::string(str.data(), str.size()), splits, offsets_start, offsets_limit));
 
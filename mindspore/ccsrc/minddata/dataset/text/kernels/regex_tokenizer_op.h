@@ -42,13 +42,13 @@ class RegexTokenizerOp : public TokenizerOp {
 
   ~RegexTokenizerOp() override = default;
 
-  Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+  Status Tokenize(std::string_view str, StringTensorBuilder *splits, std::vector<uint32_t> *offsets_start,
                   std::vector<uint32_t> *offsets_limit) override;
 
  protected:
   Status GetUnicodeSubstr(const icu::UnicodeString &input, const int &start, const int &len, std::string *out_utf8,
                           icu::UnicodeString *out_unicode = nullptr) const;
-  Status GetRegexTokens(const std::string &text, std::vector<std::string> *out_tokens,
+  Status GetRegexTokens(const std::string &text, StringTensorBuilder *out_tokens,
                         std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
 
   std::string Name() const override { return kRegexTokenizerOp; }
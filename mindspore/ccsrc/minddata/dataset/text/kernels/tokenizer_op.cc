@@ -30,15 +30,15 @@ Status TokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
   RETURN_IF_NOT_OK(input[0]->GetItemAt(&str, {}));
   std::shared_ptr<Tensor> token_tensor;
   std::vector<uint32_t> offsets_start, offsets_limit;
-  std::vector<std::string> splits;
+  StringTensorBuilder splits;
   RETURN_IF_NOT_OK(Tokenize(str, &splits, &offsets_start, &offsets_limit));
 
   if (splits.empty()) {
-    (void)splits.emplace_back("");
+    splits.Append("");
     offsets_start.push_back(0);
     offsets_limit.push_back(0);
   }
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(splits, &token_tensor));
+  RETURN_IF_NOT_OK(splits.Build(&token_tensor));
   output->push_back(token_tensor);
   if (with_offsets_) {
     RETURN_IF_NOT_OK(AppendOffsetsHelper(offsets_start, offsets_limit, output));
@@ -19,6 +19,7 @@
 #include <vector>
 #include <string>
 
+#include "minddata/dataset/core/string_tensor_builder.h"
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 #include "minddata/dataset/util/status.h"
@@ -34,7 +35,14 @@ class TokenizerOp : public TensorOp {
 
   ~TokenizerOp() override = default;
 
-  virtual Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+  /// \brief Split a string into tokens.
+  /// \param[in] str The string to split.
+  /// \param[out] splits The builder the tokens are appended to, tokens which are substrings of str can be appended
+  ///     as views of it.
+  /// \param[out] offsets_start The start of each token in str.
+  /// \param[out] offsets_limit The end of each token in str.
+  /// \return Status code.
+  virtual Status Tokenize(std::string_view str, StringTensorBuilder *splits, std::vector<uint32_t> *offsets_start,
                           std::vector<uint32_t> *offsets_limit) {
     return Status::OK();
   }
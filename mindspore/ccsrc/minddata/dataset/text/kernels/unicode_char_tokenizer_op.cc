@@ -29,7 +29,7 @@ using cppjieba::RuneStrArray;
 namespace mindspore {
 namespace dataset {
 
-Status UnicodeCharTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+Status UnicodeCharTokenizerOp::Tokenize(std::string_view str, StringTensorBuilder *splits,
                                         std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
   RETURN_UNEXPECTED_IF_NULL(splits);
   RETURN_UNEXPECTED_IF_NULL(offsets_start);
@@ -38,13 +38,12 @@ Status UnicodeCharTokenizerOp::Tokenize(std::string_view str, std::vector<std::s
   if (!DecodeRunesInString(str.data(), str.size(), runes)) {
     RETURN_STATUS_UNEXPECTED("UnicodeCharTokenizer: Decode utf8 string failed.");
   }
-  std::vector<std::string> words(runes.size());
+  splits->Reserve(runes.size(), str.size());
   for (size_t i = 0; i < runes.size(); i++) {
     offsets_start->push_back(runes[i].offset);
     offsets_limit->push_back(runes[i].offset + runes[i].len);
-    words[i] = str.substr(runes[i].offset, runes[i].len);
+    splits->Append(str.substr(runes[i].offset, runes[i].len));
   }
-  *splits = std::move(words);
   return Status::OK();
 }
 }  // namespace dataset
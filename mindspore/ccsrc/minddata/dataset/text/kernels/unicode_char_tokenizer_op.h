@@ -33,7 +33,7 @@ class UnicodeCharTokenizerOp : public TokenizerOp {
 
   ~UnicodeCharTokenizerOp() override = default;
 
-  Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+  Status Tokenize(std::string_view str, StringTensorBuilder *splits, std::vector<uint32_t> *offsets_start,
                   std::vector<uint32_t> *offsets_limit) override;
 
   std::string Name() const override { return kUnicodeCharTokenizerOp; }
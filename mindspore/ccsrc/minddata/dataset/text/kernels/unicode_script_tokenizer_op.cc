@@ -33,7 +33,7 @@ namespace dataset {
 
 const bool UnicodeScriptTokenizerOp::kDefKeepWhitespace = false;
 
-Status UnicodeScriptTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+Status UnicodeScriptTokenizerOp::Tokenize(std::string_view str, StringTensorBuilder *splits,
                                           std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
   RETURN_UNEXPECTED_IF_NULL(splits);
   RETURN_UNEXPECTED_IF_NULL(offsets_start);
@@ -65,8 +65,7 @@ Status UnicodeScriptTokenizerOp::Tokenize(std::string_view str, std::vector<std:
       if (keep_whitespace_ || !was_space) {
         offsets_start->push_back(static_cast<uint32_t>(start));
         offsets_limit->push_back(static_cast<uint32_t>(start + len));
-        std::string temp(str.substr(start, len));
-        (void)splits->emplace_back(std::move(temp));
+        splits->Append(str.substr(start, len));
       }
       start = runes[i].offset;
       len = runes[i].len;
@@ -80,8 +79,7 @@ Status UnicodeScriptTokenizerOp::Tokenize(std::string_view str, std::vector<std:
   if (len > 0 && (keep_whitespace_ || !was_space)) {
     offsets_start->push_back(static_cast<uint32_t>(start));
     offsets_limit->push_back(static_cast<uint32_t>(start + len));
-    std::string temp(str.substr(start, len));
-    (void)splits->emplace_back(std::move(temp));
+    splits->Append(str.substr(start, len));
   }
 
   return Status::OK();
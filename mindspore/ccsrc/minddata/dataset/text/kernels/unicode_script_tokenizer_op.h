@@ -37,7 +37,7 @@ class UnicodeScriptTokenizerOp : public TokenizerOp {
 
   ~UnicodeScriptTokenizerOp() override = default;
 
-  Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+  Status Tokenize(std::string_view str, StringTensorBuilder *splits, std::vector<uint32_t> *offsets_start,
                   std::vector<uint32_t> *offsets_limit) override;
 
   std::string Name() const override { return kUnicodeScriptTokenizerOp; }
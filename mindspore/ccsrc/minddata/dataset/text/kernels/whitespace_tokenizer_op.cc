@@ -27,7 +27,7 @@ using cppjieba::RuneStrArray;
 
 namespace mindspore {
 namespace dataset {
-Status WhitespaceTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+Status WhitespaceTokenizerOp::Tokenize(std::string_view str, StringTensorBuilder *splits,
                                        std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
   RETURN_UNEXPECTED_IF_NULL(splits);
   RETURN_UNEXPECTED_IF_NULL(offsets_start);
@@ -44,8 +44,7 @@ Status WhitespaceTokenizerOp::Tokenize(std::string_view str, std::vector<std::st
       if (len > 0) {
         offsets_start->push_back(static_cast<uint32_t>(start));
         offsets_limit->push_back(static_cast<uint32_t>(start + len));
-        std::string temp(str.substr(start, len));
-        (void)splits->emplace_back(std::move(temp));
+        splits->Append(str.substr(start, len));
         len = 0;
       }
     } else {
@@ -58,11 +57,10 @@ Status WhitespaceTokenizerOp::Tokenize(std::string_view str, std::vector<std::st
   if (len > 0) {
     offsets_start->push_back(static_cast<uint32_t>(start));
     offsets_limit->push_back(static_cast<uint32_t>(start + len));
-    std::string temp(str.substr(start, len));
-    (void)splits->emplace_back(std::move(temp));
+    splits->Append(str.substr(start, len));
   }
   if (splits->empty()) {
-    (void)splits->emplace_back("");
+    splits->Append("");
     offsets_start->push_back(0);
     offsets_limit->push_back(0);
   }
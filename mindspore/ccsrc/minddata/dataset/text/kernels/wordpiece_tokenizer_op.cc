@@ -35,62 +35,71 @@ WordpieceTokenizerOp::WordpieceTokenizerOp(const std::shared_ptr<Vocab> &vocab,
       max_bytes_per_token_(max_bytes_per_token),
       unknown_token_(unknown_token) {}
 
-Status WordpieceTokenizerOp::LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start,
-                                        bool *out_found, int *out_end) const {
+Status WordpieceTokenizerOp::LookupWord(const VocabTrie &trie, std::string_view input_token, const RuneStrArray &runes,
+                                        const int start, bool *out_found, int *out_end) const {
   CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && start < input_token.size(), "WordpieceTokenizer: LookupWord Out of range");
   *out_found = false;
-  for (int i = runes.size() - 1; i >= 0; i--) {
-    *out_end = runes[i].offset + runes[i].len;
-    int len = *out_end - start;
-    std::string word = input_token.substr(start, len);
-    if (start > 0) {
-      word = suffix_indicator_ + word;
+  // walk the subword rune by rune from start, the last rune ending a word of the vocab ends the longest match
+  VocabTrie::State state = VocabTrie::kRoot;
+  if (start > 0 && !trie.Walk(suffix_indicator_, &state)) {
+    return Status::OK();
+  }
+  int walked = start;
+  for (const auto &rune : runes) {
+    int end = static_cast<int>(rune.offset + rune.len);
+    if (end <= start) {
+      continue;
     }
-    if (vocab_->TokensToIds(word) != Vocab::kNoTokenExists) {
-      *out_found = true;
+    if (!trie.Walk(input_token.substr(walked, end - walked), &state)) {
       break;
     }
+    walked = end;
+    if (trie.Value(state) != Vocab::kNoTokenExists) {
+      *out_found = true;
+      *out_end = end;
+    }
   }
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::FoundNoToken(const std::string &input_token, const uint32_t &basic_start,
-                                          std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
+Status WordpieceTokenizerOp::FoundNoToken(std::string_view input_token, const uint32_t &basic_start,
+                                          StringTensorBuilder *out_tokens, std::vector<uint32_t> *offsets_start,
                                           std::vector<uint32_t> *offsets_limit) const {
-  out_tokens->clear();
   offsets_start->push_back(basic_start);
   if (unknown_token_.empty()) {
-    (void)out_tokens->emplace_back(input_token);
+    out_tokens->Append(input_token);
     offsets_limit->push_back(basic_start + input_token.length());
   } else {
-    (void)out_tokens->emplace_back(unknown_token_);
+    out_tokens->Append(unknown_token_);
     offsets_limit->push_back(basic_start + input_token.length());
   }
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::AddSubword(const std::string &input_token, const int &start, const int &end,
-                                        std::vector<std::string> *out_tokens) const {
+Status WordpieceTokenizerOp::AddSubword(std::string_view input_token, const int &start, const int &end,
+                                        StringTensorBuilder *out_tokens) const {
   CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && end > start && end <= static_cast<int>(input_token.size()),
                                "Out of range");
-  std::string subword = input_token.substr(start, end - start);
+  std::string_view subword = input_token.substr(start, end - start);
   if (start > 0) {
-    subword = suffix_indicator_ + subword;
+    out_tokens->Append(suffix_indicator_, subword);
+  } else {
+    out_tokens->Append(subword);
   }
-  (void)out_tokens->emplace_back(subword);
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uint32_t &basic_start,
-                                       std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
+Status WordpieceTokenizerOp::GetTokens(const VocabTrie &trie, std::string_view input_token,
+                                       const uint32_t &basic_start, StringTensorBuilder *out_tokens,
+                                       std::vector<uint32_t> *offsets_start,
                                        std::vector<uint32_t> *offsets_limit) const {
   if (input_token.size() > static_cast<int>(max_bytes_per_token_)) {
     offsets_start->push_back(basic_start);
     if (!unknown_token_.empty()) {
       offsets_limit->push_back(basic_start + unknown_token_.size());
-      (void)out_tokens->emplace_back(unknown_token_);
+      out_tokens->Append(unknown_token_);
     } else {
-      (void)out_tokens->emplace_back(input_token);
+      out_tokens->Append(input_token);
       offsets_limit->push_back(basic_start + input_token.size());
     }
     return Status::OK();
@@ -99,16 +108,19 @@ Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uin
   if (!DecodeRunesInString(input_token.data(), input_token.size(), runes)) {
     RETURN_STATUS_UNEXPECTED("WordpieceTokenizer: Decode utf8 string failed.");
   }
+  // the subwords of this token found so far are dropped if the rest of it can not be split
+  const size_t first_subword = out_tokens->size();
   int end = 0;
   for (int start = 0; start < static_cast<int>(input_token.size());) {
     bool found = false;
-    RETURN_IF_NOT_OK(LookupWord(input_token, runes, start, &found, &end));
+    RETURN_IF_NOT_OK(LookupWord(trie, input_token, runes, start, &found, &end));
     if (found) {
       RETURN_IF_NOT_OK(AddSubword(input_token, start, end, out_tokens));
       offsets_start->push_back(static_cast<uint32_t>(basic_start + start));
       offsets_limit->push_back(static_cast<uint32_t>(basic_start + end));
       start = end;
     } else {
+      out_tokens->Truncate(first_subword);
       return FoundNoToken(input_token, basic_start, out_tokens, offsets_start, offsets_limit);
     }
   }
@@ -121,26 +133,26 @@ Status WordpieceTokenizerOp::Compute(const TensorRow &input, TensorRow *output)
     RETURN_STATUS_UNEXPECTED(
       "WordpieceTokenizer: The input shape should be 1D scalar the input datatype should be string.");
   }
+  RETURN_UNEXPECTED_IF_NULL(vocab_);
+  std::shared_ptr<const VocabTrie> trie = vocab_->GetTrie();
   dsize_t count = 0;
-  std::vector<std::string> out_tokens;
+  StringTensorBuilder out_tokens;
   std::vector<uint32_t> offsets_start, offsets_limit;
   std::shared_ptr<Tensor> token_tensor;
   for (auto iter = input[0]->begin<std::string_view>(); iter != input[0]->end<std::string_view>(); iter++) {
     uint32_t basic_start = 0;
-    std::vector<std::string> temp_tokens;
     if (with_offsets_ && input.size() == 3) {
       RETURN_IF_NOT_OK(input[1]->GetItemAt<uint32_t>(&basic_start, {count}));
     }
-    RETURN_IF_NOT_OK(GetTokens(std::string(*iter), basic_start, &temp_tokens, &offsets_start, &offsets_limit));
-    out_tokens.insert(out_tokens.end(), temp_tokens.begin(), temp_tokens.end());
+    RETURN_IF_NOT_OK(GetTokens(*trie, *iter, basic_start, &out_tokens, &offsets_start, &offsets_limit));
     count++;
   }
   if (out_tokens.empty()) {
-    (void)out_tokens.emplace_back("");
+    out_tokens.Append("");
     offsets_start.push_back(0);
     offsets_limit.push_back(0);
   }
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(out_tokens, &token_tensor));
+  RETURN_IF_NOT_OK(out_tokens.Build(&token_tensor));
   output->push_back(token_tensor);
   if (with_offsets_) {
     RETURN_IF_NOT_OK(AppendOffsetsHelper(offsets_start, offsets_limit, output));
@@ -26,6 +26,7 @@
 #include "minddata/dataset/include/dataset/text.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 #include "minddata/dataset/text/kernels/tokenizer_op.h"
+#include "minddata/dataset/text/vocab_trie.h"
 #include "minddata/dataset/util/status.h"
 
 using cppjieba::DecodeRunesInString;
@@ -47,14 +48,15 @@ class WordpieceTokenizerOp : public TokenizerOp {
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
  protected:
-  Status AddSubword(const std::string &input_token, const int &start, const int &end,
-                    std::vector<std::string> *out_tokens) const;
-  Status FoundNoToken(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
+  Status AddSubword(std::string_view input_token, const int &start, const int &end,
+                    StringTensorBuilder *out_tokens) const;
+  Status FoundNoToken(std::string_view input_token, const uint32_t &basic_start, StringTensorBuilder *out_tokens,
                       std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
-  Status LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start, bool *out_found,
-                    int *out_end) const;
-  Status GetTokens(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
-                   std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
+  Status LookupWord(const VocabTrie &trie, std::string_view input_token, const RuneStrArray &runes, const int start,
+                    bool *out_found, int *out_end) const;
+  Status GetTokens(const VocabTrie &trie, std::string_view input_token, const uint32_t &basic_start,
+                   StringTensorBuilder *out_tokens, std::vector<uint32_t> *offsets_start,
+                   std::vector<uint32_t> *offsets_limit) const;
 
   std::string Name() const override { return kWordpieceTokenizerOp; }
 
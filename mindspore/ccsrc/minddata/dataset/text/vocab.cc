@@ -19,6 +19,7 @@
 #include <unordered_set>
 
 #include "minddata/dataset/include/dataset/text.h"
+#include "minddata/dataset/text/vocab_trie.h"
 #include "minddata/dataset/util/log_adapter.h"
 #include "minddata/dataset/util/status.h"
 #include "utils/file_utils.h"
@@ -64,9 +65,20 @@ std::vector<WordType> Vocab::IdsToTokens(const std::vector<WordIdType> &ids) {
 void Vocab::AppendWord(const std::string &word) {
   if (word2id_.find(word) == word2id_.end()) {
     word2id_[word] = static_cast<WordIdType>(word2id_.size());
+    std::atomic_store(&trie_, std::shared_ptr<const VocabTrie>());
   }
 }
 
+std::shared_ptr<const VocabTrie> Vocab::GetTrie() const {
+  // the operations sharing the vocab may build the trie at the same time, each one gets a whole trie
+  auto trie = std::atomic_load(&trie_);
+  if (trie == nullptr) {
+    trie = std::make_shared<const VocabTrie>(word2id_);
+    std::atomic_store(&trie_, trie);
+  }
+  return trie;
+}
+
 Status Vocab::BuildFromUnorderedMap(const std::unordered_map<WordType, WordIdType> &words,
                                     std::shared_ptr<Vocab> *vocab) {
   if (vocab == nullptr) {
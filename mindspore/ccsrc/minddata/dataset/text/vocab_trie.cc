@@ -0,0 +1,129 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/text/vocab_trie.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// The check of the root, which is used but owned by no node
+constexpr int32_t kRootCheck = -2;
+// Once this ratio of the slots scanned by a base search is used, the next searches start after them
+constexpr double kDenseRatio = 0.95;
+}  // namespace
+
+VocabTrie::VocabTrie(const std::unordered_map<WordType, WordIdType> &word2id) {
+  // sort the words by bytes, so that the words under a node are a range and their next bytes are in order
+  std::vector<std::pair<std::string_view, WordIdType>> words(word2id.begin(), word2id.end());
+  std::sort(words.begin(), words.end());
+
+  // a node of the trie being built, holding the words [begin, end) whose first depth bytes lead to it
+  struct Node {
+    size_t begin;
+    size_t end;
+    size_t depth;
+    State state;
+  };
+  Reserve(1);
+  units_[kRoot] = {0, kRootCheck};
+  std::vector<Node> pending = {{0, words.size(), 0, kRoot}};
+  std::vector<int32_t> codes;
+  std::vector<std::pair<size_t, size_t>> ranges;
+  while (!pending.empty()) {
+    Node node = pending.back();
+    pending.pop_back();
+    // the code of a word is 0 if it ends at the node, or its next byte plus 1
+    codes.clear();
+    ranges.clear();
+    for (size_t i = node.begin; i < node.end; ++i) {
+      const std::string_view &word = words[i].first;
+      int32_t code = word.size() == node.depth ? 0 : static_cast<uint8_t>(word[node.depth]) + 1;
+      if (codes.empty() || codes.back() != code) {
+        codes.push_back(code);
+        ranges.emplace_back(i, i + 1);
+      } else {
+        ranges.back().second = i + 1;
+      }
+    }
+    if (codes.empty()) {
+      continue;
+    }
+    int32_t base = FindBase(codes);
+    units_[node.state].base = base;
+    for (size_t i = 0; i < codes.size(); ++i) {
+      State child = base + codes[i];
+      units_[child].check = node.state;
+      if (codes[i] == 0) {
+        units_[child].base = words[ranges[i].first].second;
+      } else {
+        pending.push_back({ranges[i].first, ranges[i].second, node.depth + 1, child});
+      }
+    }
+  }
+  // drop the free slots at the end
+  size_t size = units_.size();
+  while (size > 1 && units_[size - 1].check == kFree) {
+    --size;
+  }
+  units_.resize(size);
+  units_.shrink_to_fit();
+}
+
+int32_t VocabTrie::FindBase(const std::vector<int32_t> &codes) {
+  // the children of a node need the slots base + code, base must be positive to keep them off the root
+  const int32_t start = std::max(next_check_pos_, codes.front() + 1);
+  int32_t pos = start - 1;
+  int32_t first_free = -1;
+  int32_t num_used = 0;
+  int32_t base;
+  while (true) {
+    ++pos;
+    Reserve(static_cast<size_t>(pos) + 1);
+    if (units_[pos].check != kFree) {
+      ++num_used;
+      continue;
+    }
+    if (first_free < 0) {
+      first_free = pos;
+    }
+    base = pos - codes.front();
+    Reserve(static_cast<size_t>(base) + codes.back() + 1);
+    if (std::all_of(codes.begin() + 1, codes.end(),
+                    [this, base](int32_t code) { return units_[base + code].check == kFree; })) {
+      break;
+    }
+  }
+  // skip the dense slots next time, otherwise each search scans them again
+  if (num_used >= kDenseRatio * (pos - next_check_pos_ + 1)) {
+    next_check_pos_ = pos;
+  } else if (start == next_check_pos_) {
+    next_check_pos_ = first_free;
+  }
+  return base;
+}
+
+void VocabTrie::Reserve(size_t size) {
+  if (units_.size() < size) {
+    // grow geometrically, the base searches probe the slots past the end one by one
+    units_.resize(std::max(size, units_.size() * 2), Unit{0, kFree});
+  }
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,103 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/include/dataset/text.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A read-only double-array trie over the bytes of the words of a vocab.
+///     All nodes share one array of units. The child of the node in slot s by the byte c is in slot base(s) + c + 1 if
+///     the check of that slot is s, and the id of the word ending at s is the base of slot base(s) if its check is s.
+///     Looking up a word walks one unit per byte without building a string, and walking a string byte by byte gives
+///     all of its prefixes in the vocab, which is what the longest match of the wordpiece tokenizer needs.
+class VocabTrie {
+ public:
+  /// \brief A node of the trie, the prefix of the words walked so far.
+  using State = int32_t;
+
+  static constexpr State kRoot = 0;
+
+  /// \brief Constructor.
+  /// \param[in] word2id The words and ids of a vocab, the ids should not be negative.
+  explicit VocabTrie(const std::unordered_map<WordType, WordIdType> &word2id);
+
+  ~VocabTrie() = default;
+
+  /// \brief Walk the bytes of a string from a node.
+  /// \param[in] bytes The bytes to walk.
+  /// \param[in, out] state The node to start from, the node reached if the walk succeeds.
+  /// \return Whether some word of the vocab starts with the prefix of state followed by bytes.
+  bool Walk(std::string_view bytes, State *state) const {
+    State s = *state;
+    for (char c : bytes) {
+      auto t = static_cast<size_t>(units_[s].base) + static_cast<uint8_t>(c) + 1;
+      if (t >= units_.size() || units_[t].check != s) {
+        return false;
+      }
+      s = static_cast<State>(t);
+    }
+    *state = s;
+    return true;
+  }
+
+  /// \brief Get the id of the word ending at a node.
+  /// \param[in] state The node.
+  /// \return The id of the word, or Vocab::kNoTokenExists if the prefix of state is not a word of the vocab.
+  WordIdType Value(State state) const {
+    auto t = static_cast<size_t>(units_[state].base);
+    return t < units_.size() && units_[t].check == state ? units_[t].base : Vocab::kNoTokenExists;
+  }
+
+  /// \brief Get the id of a word.
+  /// \param[in] word The word to look up.
+  /// \return The id of the word, or Vocab::kNoTokenExists if word is not in the vocab.
+  WordIdType Find(std::string_view word) const {
+    State state = kRoot;
+    return Walk(word, &state) ? Value(state) : Vocab::kNoTokenExists;
+  }
+
+  /// \return The number of bytes of the units.
+  size_t SizeInBytes() const { return units_.size() * sizeof(Unit); }
+
+ private:
+  struct Unit {
+    int32_t base;   // first slot of the children of a node, or the id of a word in a terminal slot
+    int32_t check;  // the node owning the slot, kFree if the slot is unused
+  };
+
+  static constexpr int32_t kFree = -1;
+
+  // Find the first base for which the slots of all codes are free, growing the units if needed
+  int32_t FindBase(const std::vector<int32_t> &codes);
+
+  // Resize the units to hold at least size slots
+  void Reserve(size_t size);
+
+  std::vector<Unit> units_;
+  int32_t next_check_pos_ = 1;  // slots before it are almost all used, the search of a base starts from it
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
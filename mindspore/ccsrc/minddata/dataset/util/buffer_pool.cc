@@ -0,0 +1,362 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/buffer_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "./securec.h"
+#include "minddata/dataset/util/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Every block starts with a header, the caller gets the memory right after it
+struct BlockHeader {
+  uint64_t size;        // usable bytes of the block
+  uint32_t size_class;  // size class of the block, kLargeClass if it is not cached
+  uint32_t magic;
+};
+constexpr size_t kHeaderSize = sizeof(BlockHeader);
+static_assert(kHeaderSize == 16, "The header must keep the memory of the caller 16 bytes aligned.");
+constexpr uint32_t kBlockMagic = 0x4D444250;  // "MDBP"
+
+// size classes: 64 bytes, then four classes per power of two up to 128MB
+constexpr int kMinClassShift = 6;
+constexpr int kMaxClassShift = 27;
+constexpr int kClassesPerDoubling = 4;
+constexpr int kStepShift = 2;  // log2(kClassesPerDoubling)
+constexpr size_t kNumClasses = (kMaxClassShift - kMinClassShift) * kClassesPerDoubling + 1;
+constexpr uint32_t kLargeClass = std::numeric_limits<uint32_t>::max();
+constexpr size_t kMaxClassSize = static_cast<size_t>(1) << kMaxClassShift;
+
+// only blocks up to this size are cached by the threads, each thread keeps at most kThreadCacheBytes of a class
+constexpr size_t kMaxThreadCachedSize = 256 * 1024;
+constexpr size_t kThreadCacheBytes = 256 * 1024;
+constexpr size_t kMinThreadCacheBlocks = 4;
+
+int HighestBit(size_t n) {
+  int bit = -1;
+  while (n != 0) {
+    n >>= 1;
+    ++bit;
+  }
+  return bit;
+}
+
+// the index of the smallest size class holding n bytes, n must not exceed kMaxClassSize
+size_t ClassIndex(size_t n) {
+  if (n <= (static_cast<size_t>(1) << kMinClassShift)) {
+    return 0;
+  }
+  const int shift = HighestBit(n - 1);  // 2^shift < n <= 2^(shift + 1)
+  const size_t step = static_cast<size_t>(1) << (shift - kStepShift);
+  const size_t k = (n - 1 - (static_cast<size_t>(1) << shift)) / step + 1;
+  return static_cast<size_t>(shift - kMinClassShift) * kClassesPerDoubling + k;
+}
+
+size_t ClassSize(size_t index) {
+  if (index == 0) {
+    return static_cast<size_t>(1) << kMinClassShift;
+  }
+  const size_t shift = kMinClassShift + (index - 1) / kClassesPerDoubling;
+  const size_t k = (index - 1) % kClassesPerDoubling + 1;
+  return (static_cast<size_t>(1) << shift) + k * (static_cast<size_t>(1) << (shift - kStepShift));
+}
+
+size_t ThreadCacheCapacity(size_t index) { return std::max(kMinThreadCacheBlocks, kThreadCacheBytes / ClassSize(index)); }
+
+BlockHeader *HeaderOf(void *p) { return reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(p) - kHeaderSize); }
+}  // namespace
+
+// The free lists shared by all threads and the counters of the pool. It is shared with the thread caches, so that
+// a thread which exits after the pool is destroyed can still return its blocks.
+class BufferPool::Central {
+ public:
+  explicit Central(uint64_t max_cached_bytes) : lists_(kNumClasses), max_cached_bytes_(max_cached_bytes) {}
+
+  ~Central() { Trim(); }
+
+  // @return a free block of the size class, or nullptr if there is none
+  void *Pop(size_t index) {
+    FreeList &list = lists_[index];
+    std::lock_guard<std::mutex> guard(list.mutex);
+    if (list.blocks.empty()) {
+      return nullptr;
+    }
+    void *block = list.blocks.back();
+    list.blocks.pop_back();
+    cached_bytes_ -= ClassSize(index);
+    return block;
+  }
+
+  // Keep a free block for reuse, or return it to the system if the pool caches too much already
+  void Push(size_t index, void *block) {
+    const size_t size = ClassSize(index);
+    if (cached_bytes_.load(std::memory_order_relaxed) + size > max_cached_bytes_) {
+      free(block);
+      return;
+    }
+    FreeList &list = lists_[index];
+    std::lock_guard<std::mutex> guard(list.mutex);
+    list.blocks.push_back(block);
+    cached_bytes_ += size;
+  }
+
+  void Trim() {
+    for (size_t index = 0; index < lists_.size(); ++index) {
+      FreeList &list = lists_[index];
+      std::lock_guard<std::mutex> guard(list.mutex);
+      for (void *block : list.blocks) {
+        free(block);
+      }
+      cached_bytes_ -= list.blocks.size() * ClassSize(index);
+      list.blocks.clear();
+    }
+  }
+
+  std::atomic<bool> alive_{true};
+  std::atomic<uint64_t> num_allocations_{0};
+  std::atomic<uint64_t> num_thread_hits_{0};
+  std::atomic<uint64_t> num_central_hits_{0};
+  std::atomic<uint64_t> num_system_allocs_{0};
+  std::atomic<uint64_t> bytes_in_use_{0};
+  std::atomic<uint64_t> thread_cached_bytes_{0};
+  std::atomic<uint64_t> cached_bytes_{0};
+
+ private:
+  struct FreeList {
+    std::mutex mutex;
+    std::vector<void *> blocks;
+  };
+
+  std::vector<FreeList> lists_;
+  uint64_t max_cached_bytes_;
+};
+
+// The free lists of the small size classes owned by one thread
+class BufferPool::ThreadCache {
+ public:
+  explicit ThreadCache(std::shared_ptr<Central> central) : central_(std::move(central)), lists_(kNumClasses) {}
+
+  ~ThreadCache() {
+    for (size_t index = 0; index < lists_.size(); ++index) {
+      for (void *block : lists_[index]) {
+        central_->thread_cached_bytes_ -= ClassSize(index);
+        central_->Push(index, block);
+      }
+    }
+  }
+
+  const Central *central() const { return central_.get(); }
+
+  void *Pop(size_t index) {
+    std::vector<void *> &list = lists_[index];
+    if (list.empty()) {
+      return nullptr;
+    }
+    void *block = list.back();
+    list.pop_back();
+    central_->thread_cached_bytes_ -= ClassSize(index);
+    return block;
+  }
+
+  void Push(size_t index, void *block) {
+    std::vector<void *> &list = lists_[index];
+    list.push_back(block);
+    central_->thread_cached_bytes_ += ClassSize(index);
+    // when the cache is full, hand half of it over to the other threads
+    const size_t capacity = ThreadCacheCapacity(index);
+    if (list.size() > capacity) {
+      const size_t keep = capacity / 2;
+      for (size_t i = keep; i < list.size(); ++i) {
+        central_->thread_cached_bytes_ -= ClassSize(index);
+        central_->Push(index, list[i]);
+      }
+      list.resize(keep);
+    }
+  }
+
+ private:
+  std::shared_ptr<Central> central_;
+  std::vector<std::vector<void *>> lists_;
+};
+
+namespace {
+// The thread caches of the current thread, one per pool. The pointers are trivially destructible thread locals, so
+// that a tensor freed while the thread exits, after the caches are gone, can still tell it must bypass them.
+struct ThreadCacheList {
+  std::vector<std::unique_ptr<BufferPool::ThreadCache>> caches;
+};
+thread_local ThreadCacheList *t_cache_list = nullptr;
+thread_local bool t_cache_list_destroyed = false;
+
+struct ThreadCacheListOwner {
+  ~ThreadCacheListOwner() {
+    t_cache_list_destroyed = true;
+    delete t_cache_list;
+    t_cache_list = nullptr;
+  }
+};
+thread_local ThreadCacheListOwner t_cache_list_owner;
+
+// @return the cache of the current thread for the pool, or nullptr if the thread is exiting
+BufferPool::ThreadCache *GetThreadCache(const std::shared_ptr<BufferPool::Central> &central) {
+  if (t_cache_list_destroyed) {
+    return nullptr;
+  }
+  if (t_cache_list == nullptr) {
+    (void)&t_cache_list_owner;  // make sure the owner is constructed and frees the list when the thread exits
+    t_cache_list = new ThreadCacheList();
+  }
+  auto &caches = t_cache_list->caches;
+  for (auto &cache : caches) {
+    if (cache->central() == central.get()) {
+      return cache.get();
+    }
+  }
+  // drop the caches of the pools which are destroyed, this returns their blocks
+  (void)caches.erase(std::remove_if(caches.begin(), caches.end(),
+                                    [](const std::unique_ptr<BufferPool::ThreadCache> &cache) {
+                                      return !cache->central()->alive_.load(std::memory_order_relaxed);
+                                    }),
+                     caches.end());
+  caches.push_back(std::make_unique<BufferPool::ThreadCache>(central));
+  return caches.back().get();
+}
+}  // namespace
+
+BufferPool::BufferPool(uint64_t max_cached_bytes) : central_(std::make_shared<Central>(max_cached_bytes)) {}
+
+BufferPool::~BufferPool() {
+  central_->alive_ = false;
+  central_->Trim();
+}
+
+Status BufferPool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  CHECK_FAIL_RETURN_UNEXPECTED(n <= std::numeric_limits<size_t>::max() - kHeaderSize,
+                               "BufferPool: the size to allocate is too large: " + std::to_string(n));
+  const size_t total = n + kHeaderSize;
+  void *block = nullptr;
+  if (total > kMaxClassSize) {
+    RETURN_IF_NOT_OK(DeMalloc(total, &block, false));
+    *HeaderOf(static_cast<uint8_t *>(block) + kHeaderSize) = {n, kLargeClass, kBlockMagic};
+    central_->num_system_allocs_++;
+    central_->num_allocations_++;
+    central_->bytes_in_use_ += total;
+    *p = static_cast<uint8_t *>(block) + kHeaderSize;
+    return Status::OK();
+  }
+
+  const size_t index = ClassIndex(total);
+  const size_t size = ClassSize(index);
+  if (size <= kMaxThreadCachedSize) {
+    ThreadCache *cache = GetThreadCache(central_);
+    if (cache != nullptr && (block = cache->Pop(index)) != nullptr) {
+      central_->num_thread_hits_++;
+    }
+  }
+  if (block == nullptr && (block = central_->Pop(index)) != nullptr) {
+    central_->num_central_hits_++;
+  }
+  if (block == nullptr) {
+    RETURN_IF_NOT_OK(DeMalloc(size, &block, false));
+    *HeaderOf(static_cast<uint8_t *>(block) + kHeaderSize) = {size - kHeaderSize, static_cast<uint32_t>(index),
+                                                              kBlockMagic};
+    central_->num_system_allocs_++;
+  }
+  central_->num_allocations_++;
+  central_->bytes_in_use_ += size;
+  *p = static_cast<uint8_t *>(block) + kHeaderSize;
+  return Status::OK();
+}
+
+Status BufferPool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (*p == nullptr) {
+    return Allocate(new_sz, p);
+  }
+  if (new_sz <= HeaderOf(*p)->size) {
+    // the block is large enough already
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  if (old_sz > 0) {
+    errno_t err = memcpy_s(q, new_sz, *p, old_sz);
+    if (err != EOK) {
+      Deallocate(q);
+      RETURN_STATUS_UNEXPECTED("BufferPool: failed to copy the block, errno: " + std::to_string(err));
+    }
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+void BufferPool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  BlockHeader *header = HeaderOf(p);
+  if (header->magic != kBlockMagic) {
+    MS_LOG(ERROR) << "[Internal ERROR] BufferPool: the block to free was not allocated by the pool.";
+    return;
+  }
+  void *block = header;
+  if (header->size_class == kLargeClass) {
+    central_->bytes_in_use_ -= header->size + kHeaderSize;
+    free(block);
+    return;
+  }
+  const size_t index = header->size_class;
+  const size_t size = ClassSize(index);
+  central_->bytes_in_use_ -= size;
+  if (size <= kMaxThreadCachedSize) {
+    ThreadCache *cache = GetThreadCache(central_);
+    if (cache != nullptr) {
+      cache->Push(index, block);
+      return;
+    }
+  }
+  central_->Push(index, block);
+}
+
+uint64_t BufferPool::get_max_size() const { return std::numeric_limits<uint64_t>::max(); }
+
+int BufferPool::PercentFree() const { return 100; }
+
+BufferPoolStats BufferPool::GetStats() const {
+  BufferPoolStats stats;
+  stats.num_allocations = central_->num_allocations_.load(std::memory_order_relaxed);
+  stats.num_thread_hits = central_->num_thread_hits_.load(std::memory_order_relaxed);
+  stats.num_central_hits = central_->num_central_hits_.load(std::memory_order_relaxed);
+  stats.num_system_allocs = central_->num_system_allocs_.load(std::memory_order_relaxed);
+  stats.bytes_in_use = central_->bytes_in_use_.load(std::memory_order_relaxed);
+  stats.bytes_cached = central_->cached_bytes_.load(std::memory_order_relaxed) +
+                       central_->thread_cached_bytes_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void BufferPool::Trim() { central_->Trim(); }
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,80 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_BUFFER_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+// A snapshot of the counters of a BufferPool
+struct BufferPoolStats {
+  uint64_t num_allocations = 0;     // number of blocks handed out
+  uint64_t num_thread_hits = 0;     // blocks taken from the cache of the allocating thread
+  uint64_t num_central_hits = 0;    // blocks taken from the free lists shared by all threads
+  uint64_t num_system_allocs = 0;   // blocks obtained from malloc
+  uint64_t bytes_in_use = 0;        // bytes of the blocks which are handed out
+  uint64_t bytes_cached = 0;        // bytes of the free blocks kept by the pool for reuse
+};
+
+// A MemoryPool which recycles the buffers of the tensors. Blocks are rounded up to size classes, four per power of
+// two, and freed blocks are kept in per size class free lists instead of being returned to the system. Small blocks
+// are first cached by the thread which frees them so the map and batch workers allocate without taking a lock; large
+// blocks, like the buffers of batches, go to the free lists shared by all threads, as they are usually freed by
+// another thread than the one which allocated them. Once the free lists hold more than the cache limit, freed blocks
+// are returned to the system. Blocks larger than the largest size class are not cached at all.
+class BufferPool : public MemoryPool {
+ public:
+  // @param max_cached_bytes - the limit of the bytes of free blocks kept by the pool
+  explicit BufferPool(uint64_t max_cached_bytes = kDefaultMaxCachedBytes);
+
+  ~BufferPool() override;
+
+  BufferPool(const BufferPool &) = delete;
+
+  BufferPool &operator=(const BufferPool &) = delete;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override;
+
+  // @return a snapshot of the counters of the pool
+  BufferPoolStats GetStats() const;
+
+  // Return the free blocks of the shared free lists to the system
+  void Trim();
+
+  static constexpr uint64_t kDefaultMaxCachedBytes = 2ULL * 1024 * 1024 * 1024;
+
+  class Central;
+  class ThreadCache;
+
+ private:
+  std::shared_ptr<Central> central_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_BUFFER_POOL_H_
@@ -15,6 +15,7 @@
  */
 #include "minddata/dataset/util/cond_var.h"
 
+#include "minddata/dataset/util/run_slots.h"
 #include "minddata/dataset/util/services.h"
 #include "minddata/dataset/util/task_manager.h"
 
@@ -23,6 +24,37 @@ namespace dataset {
 CondVar::CondVar() : svc_(nullptr), my_name_(Services::GetUniqueID()) {}
 
 Status CondVar::Wait(std::unique_lock<std::mutex> *lck, const std::function<bool()> &pred) {
+  RunSlots *run_slots = RunSlots::Current();
+  if (run_slots == nullptr || pred()) {
+    return DoWait(lck, pred);
+  }
+  // The thread is about to block, so its run slot goes to another thread of the group. The slot is taken back
+  // without holding the lock, since the thread holding a slot may need the lock to wake us up.
+  Status rc;
+  do {
+    run_slots->Release();
+    rc = DoWait(lck, pred);
+    lck->unlock();
+    run_slots->Acquire();
+    lck->lock();
+  } while (rc.IsOk() && !pred());
+  return rc;
+}
+
+Status CondVar::WaitFor(std::unique_lock<std::mutex> *lck, int64_t duration) {
+  RunSlots *run_slots = RunSlots::Current();
+  if (run_slots == nullptr) {
+    return DoWaitFor(lck, duration);
+  }
+  run_slots->Release();
+  Status rc = DoWaitFor(lck, duration);
+  lck->unlock();
+  run_slots->Acquire();
+  lck->lock();
+  return rc;
+}
+
+Status CondVar::DoWait(std::unique_lock<std::mutex> *lck, const std::function<bool()> &pred) {
   try {
     if (svc_ != nullptr) {
       // If this cv registers with a global resource tracking, then wait unconditionally.
@@ -45,7 +77,7 @@ Status CondVar::Wait(std::unique_lock<std::mutex> *lck, const std::function<bool
   return Status::OK();
 }
 
-Status CondVar::WaitFor(std::unique_lock<std::mutex> *lck, int64_t duration) {
+Status CondVar::DoWaitFor(std::unique_lock<std::mutex> *lck, int64_t duration) {
   try {
     if (svc_ != nullptr) {
       // If this cv registers with a global resource tracking, then wait unconditionally.
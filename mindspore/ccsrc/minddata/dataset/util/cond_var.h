@@ -58,6 +58,10 @@ class CondVar : public IntrpResource {
   std::shared_ptr<IntrpService> svc_;
 
  private:
+  Status DoWait(std::unique_lock<std::mutex> *lck, const std::function<bool()> &pred);
+
+  Status DoWaitFor(std::unique_lock<std::mutex> *lck, int64_t duration);
+
   std::string my_name_;
 };
 }  // namespace dataset
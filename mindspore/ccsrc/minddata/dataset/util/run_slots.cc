@@ -0,0 +1,131 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/run_slots.h"
+
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__ANDROID__) && !defined(ANDROID) && !defined(__APPLE__)
+#include <sched.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+thread_local RunSlots *gMyRunSlots = nullptr;
+
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__ANDROID__) && !defined(ANDROID) && !defined(__APPLE__)
+// Read the first whitespace separated fields of a file, false if the file can not be read
+bool ReadFields(const std::string &path, std::string *first, std::string *second) {
+  std::ifstream fs(path, std::ios::in);
+  if (!fs.is_open()) {
+    return false;
+  }
+  fs >> *first;
+  if (second != nullptr) {
+    fs >> *second;
+  }
+  return !fs.bad() && !first->empty();
+}
+
+// The cpu quota of the cgroup as quota and period in microseconds, false if there is no quota
+bool ReadCgroupQuota(const std::string &cgroup_root, int64_t *quota, int64_t *period) {
+  std::string quota_str;
+  std::string period_str;
+  // cgroup v2: "max 100000" when there is no quota, "150000 100000" for 1.5 cpus
+  if (ReadFields(cgroup_root + "/cpu.max", &quota_str, &period_str)) {
+    if (quota_str == "max") {
+      return false;
+    }
+  } else {
+    // cgroup v1: the quota is -1 when there is none
+    const std::string v1_dir = cgroup_root + "/cpu";
+    if (!ReadFields(v1_dir + "/cpu.cfs_quota_us", &quota_str, nullptr) ||
+        !ReadFields(v1_dir + "/cpu.cfs_period_us", &period_str, nullptr)) {
+      return false;
+    }
+  }
+  *quota = std::strtoll(quota_str.c_str(), nullptr, 10);
+  *period = std::strtoll(period_str.c_str(), nullptr, 10);
+  return *quota > 0 && *period > 0;
+}
+#endif
+}  // namespace
+
+RunSlots::RunSlots(int32_t num_slots) : num_slots_(std::max(num_slots, 1)), num_running_(0), num_overruns_(0) {}
+
+void RunSlots::Acquire() {
+  std::unique_lock<std::mutex> lck(mux_);
+  if (!cv_.wait_for(lck, std::chrono::milliseconds(kMaxWaitMs), [this]() { return num_running_ < num_slots_; })) {
+    ++num_overruns_;
+  }
+  ++num_running_;
+}
+
+void RunSlots::Release() {
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    --num_running_;
+  }
+  cv_.notify_one();
+}
+
+int32_t RunSlots::NumRunning() {
+  std::unique_lock<std::mutex> lck(mux_);
+  return num_running_;
+}
+
+int64_t RunSlots::NumOverruns() {
+  std::unique_lock<std::mutex> lck(mux_);
+  return num_overruns_;
+}
+
+void RunSlots::Enter(RunSlots *run_slots) {
+  gMyRunSlots = run_slots;
+  if (run_slots != nullptr) {
+    run_slots->Acquire();
+  }
+}
+
+void RunSlots::Leave() {
+  if (gMyRunSlots != nullptr) {
+    gMyRunSlots->Release();
+    gMyRunSlots = nullptr;
+  }
+}
+
+RunSlots *RunSlots::Current() { return gMyRunSlots; }
+
+int32_t RunSlots::CpuQuota(const std::string &cgroup_root) {
+  auto num_cpus = static_cast<int64_t>(std::thread::hardware_concurrency());
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__ANDROID__) && !defined(ANDROID) && !defined(__APPLE__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    num_cpus = CPU_COUNT(&cpu_set);
+  }
+  int64_t quota = 0;
+  int64_t period = 0;
+  if (ReadCgroupQuota(cgroup_root, &quota, &period)) {
+    num_cpus = std::min(num_cpus, (quota + period - 1) / period);
+  }
+#endif
+  return static_cast<int32_t>(std::max(num_cpus, static_cast<int64_t>(1)));
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RUN_SLOTS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RUN_SLOTS_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace mindspore {
+namespace dataset {
+/// \brief A bound on the number of threads of a TaskGroup which run at the same time.
+///
+/// A thread of the group holds a slot while it computes, and hands it over to a waiting thread of the group when it
+/// blocks on a CondVar, which is what a Connector, a Queue or a WaitPost waits on. With as many slots as cpus, the
+/// group never has more runnable threads than the cpus it may use, so the threads run until they block instead of
+/// being preempted, and a cpu quota is not exhausted by threads which are then throttled all together. The capacity
+/// of the connectors still decides which thread blocks, so the backpressure of the pipeline is unchanged.
+///
+/// A thread waiting for a slot longer than kMaxWaitMs runs anyway over the bound. The slot holders may be blocked on
+/// a lock which is not a CondVar, such as the GIL, held by the waiting thread, and they would never hand over.
+class RunSlots {
+ public:
+  /// \brief Constructor
+  /// \param num_slots Number of threads which run at the same time.
+  explicit RunSlots(int32_t num_slots);
+
+  ~RunSlots() = default;
+
+  RunSlots(const RunSlots &) = delete;
+  RunSlots &operator=(const RunSlots &) = delete;
+
+  /// \brief Take a slot, waiting for one to be handed over.
+  void Acquire();
+
+  /// \brief Hand the slot over to a waiting thread.
+  void Release();
+
+  /// \return Number of threads which run at the same time.
+  int32_t NumSlots() const { return num_slots_; }
+
+  /// \return Number of threads holding a slot, which is more than the slots if some run over the bound.
+  int32_t NumRunning();
+
+  /// \return Number of times a thread ran over the bound after waiting kMaxWaitMs.
+  int64_t NumOverruns();
+
+  /// \brief Take a slot for the calling thread, which then hands it over whenever it blocks on a CondVar.
+  /// \param run_slots The slots of the group of the thread, or nullptr if the threads of the group are not bound.
+  static void Enter(RunSlots *run_slots);
+
+  /// \brief Hand the slot of the calling thread over for good, before the thread exits.
+  static void Leave();
+
+  /// \return The slots of the calling thread, or nullptr.
+  static RunSlots *Current();
+
+  /// \brief Number of cpus the process may use, that is the cpus it is affine to, further limited by the cpu quota of
+  ///     its cgroup (cpu.max for cgroup v2, cpu.cfs_quota_us and cpu.cfs_period_us for cgroup v1). A fractional quota
+  ///     is rounded up.
+  /// \param cgroup_root The mount point of the cgroup file system.
+  /// \return The number of cpus, at least 1.
+  static int32_t CpuQuota(const std::string &cgroup_root = "/sys/fs/cgroup");
+
+ private:
+  constexpr static int64_t kMaxWaitMs = 100;
+
+  const int32_t num_slots_;
+  int32_t num_running_;
+  int64_t num_overruns_;
+  std::mutex mux_;
+  std::condition_variable cv_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RUN_SLOTS_H_
@@ -45,6 +45,9 @@ void Task::operator()() {
   native_handle_ = pthread_self();
   thread_id_ = syscall(SYS_gettid);
 #endif
+  // Keep the slots alive until the thread is done with them, even if the group drops them meanwhile.
+  std::shared_ptr<RunSlots> run_slots = MyTaskGroup()->GetRunSlots();
+  RunSlots::Enter(run_slots.get());
   try {
     // Previously there is a timing hole where the thread is spawn but hit error immediately before we can set
     // the TaskGroup pointer and register. We move the registration logic to here (after we spawn) so we can
@@ -81,6 +84,7 @@ void Task::operator()() {
     MS_LOG(INFO) << rc_;
     ShutdownGroup();
   }
+  RunSlots::Leave();
 }
 
 void Task::ShutdownGroup() {  // Wake up watch dog and shutdown the engine.
@@ -25,9 +25,11 @@
 #include <memory>
 #include <string>
 #include <set>
+#include <utility>
 #include "minddata/dataset/util/allocator.h"
 #include "minddata/dataset/util/intrp_service.h"
 #include "minddata/dataset/util/lock.h"
+#include "minddata/dataset/util/run_slots.h"
 #include "minddata/dataset/util/services.h"
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/util/task.h"
@@ -155,6 +157,13 @@ class TaskGroup : public Service {
 
   void HasDataQueue(bool has_dataqueue) { has_dataqueue_ = has_dataqueue; }
 
+  /// \brief Bound the number of tasks of the group running at the same time. It applies to the tasks created
+  ///     afterwards.
+  /// \param run_slots The slots shared by the tasks, or nullptr to not bound them.
+  void SetRunSlots(std::shared_ptr<RunSlots> run_slots) { run_slots_ = std::move(run_slots); }
+
+  std::shared_ptr<RunSlots> GetRunSlots() const { return run_slots_; }
+
  private:
   Status rc_;
   bool has_dataqueue_;
@@ -163,6 +172,7 @@ class TaskGroup : public Service {
   RWLock rw_lock_;
   List<Task> grp_list_;
   std::shared_ptr<IntrpService> intrp_svc_;
+  std::shared_ptr<RunSlots> run_slots_;
 };
 
 namespace this_thread {
@@ -0,0 +1,213 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_ASYNC_READER_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_ASYNC_READER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+// upper bound of the I/O threads of one async reader
+const int32_t kMaxAsyncReadThreads = 16;
+
+/// \brief A file which supports positional reads from multiple threads at the same time.
+class MINDRECORD_API ShardPositionalFile {
+ public:
+  ShardPositionalFile() = default;
+
+  ~ShardPositionalFile();
+
+  ShardPositionalFile(const ShardPositionalFile &) = delete;
+  ShardPositionalFile &operator=(const ShardPositionalFile &) = delete;
+
+  /// \brief open the file for reading
+  /// \param[in] file_path the path of the file
+  /// \param[out] file_ptr the opened file
+  /// \return Status the status of Status
+  static Status Open(const std::string &file_path, std::shared_ptr<ShardPositionalFile> *file_ptr);
+
+  /// \brief read the range [offset, offset + size) of the file, the buffer is shorter than size at the end of file
+  Status ReadAt(uint64_t offset, uint64_t size, std::vector<uint8_t> *buffer) const;
+
+  /// \brief get the size of the file when it is opened
+  uint64_t Size() const { return size_; }
+
+  /// \brief get the path of the file
+  const std::string &GetPath() const { return path_; }
+
+ private:
+  std::string path_;
+  uint64_t size_ = 0;
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd_ = -1;
+#else
+  mutable std::mutex mtx_;  // the stream is shared by all the readers
+  mutable std::ifstream fin_;
+#endif
+};
+
+/// \brief Reads ranges of files in the background on a pool of I/O threads, so that the consumers only wait for
+///     reads which are not finished yet. The number of reads which are queued, running or finished but not taken
+///     is bounded by the in-flight depth, new reads are rejected until the consumers take the finished ones.
+///
+///     Reads are identified by the file and the offset. The backend is a positional read on each I/O thread,
+///     which works on every file system and needs no kernel support beyond pread.
+class MINDRECORD_API ShardAsyncReader {
+ public:
+  /// \brief statistics of the reader
+  struct Stats {
+    uint64_t submitted = 0;     // reads accepted by TrySubmit
+    uint64_t rejected = 0;      // reads rejected by TrySubmit because the depth is exhausted
+    uint64_t ready_hits = 0;    // reads which are finished when they are taken
+    uint64_t pending_hits = 0;  // reads which the consumer has to wait for
+    uint64_t cancelled = 0;     // reads which are never taken
+  };
+
+  /// \brief constructor
+  /// \param[in] num_threads number of I/O threads
+  /// \param[in] max_in_flight the in-flight depth
+  ShardAsyncReader(int32_t num_threads, int32_t max_in_flight);
+
+  ~ShardAsyncReader();
+
+  ShardAsyncReader(const ShardAsyncReader &) = delete;
+  ShardAsyncReader &operator=(const ShardAsyncReader &) = delete;
+
+  /// \brief queue a read of [offset, offset + size) of file
+  /// \return false if the depth is exhausted or the reader is stopped, true if the read is queued or already exists
+  bool TrySubmit(const std::shared_ptr<ShardPositionalFile> &file, uint64_t offset, uint64_t size);
+
+  /// \brief take the result of a read queued by TrySubmit, wait for it if it is running. A read which is still
+  ///     waiting in the queue is dropped instead, as reading it in the calling thread is faster than waiting.
+  /// \param[out] buffer the data which is read
+  /// \param[out] found false if the read is not available, the caller should read the data by itself
+  /// \return Status the error of the read
+  Status Take(const std::shared_ptr<ShardPositionalFile> &file, uint64_t offset, uint64_t size,
+              std::vector<uint8_t> *buffer, bool *found);
+
+  /// \brief drop the read if it is not taken yet
+  void Cancel(const std::shared_ptr<ShardPositionalFile> &file, uint64_t offset);
+
+  /// \brief drop all the reads which are not taken yet, e.g. when the reading order is reset
+  void Clear();
+
+  /// \brief stop the I/O threads, the reads which are not finished are dropped
+  void Stop();
+
+  /// \brief get the in-flight depth
+  int32_t GetMaxInFlight() const { return max_in_flight_; }
+
+  /// \brief get a snapshot of the statistics
+  Stats GetStats();
+
+ private:
+  struct ReadRequest {
+    std::shared_ptr<ShardPositionalFile> file;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+    bool started = false;
+    bool done = false;
+    bool cancelled = false;
+    Status status;
+    std::vector<uint8_t> buffer;
+  };
+
+  using RequestKey = std::pair<const ShardPositionalFile *, uint64_t>;
+
+  void IOThread();
+
+  // drop the request which is found by iter, mtx_ must be held
+  void EraseRequest(std::map<RequestKey, std::shared_ptr<ReadRequest>>::iterator iter);
+
+  int32_t max_in_flight_;
+  bool stop_ = false;
+  std::mutex mtx_;
+  std::condition_variable cv_request_;
+  std::condition_variable cv_done_;
+  std::deque<std::shared_ptr<ReadRequest>> queue_;
+  std::map<RequestKey, std::shared_ptr<ReadRequest>> requests_;  // requests which are not taken
+  std::vector<std::thread> threads_;
+  Stats stats_;
+};
+
+/// \brief Sequential reader of one file which keeps the following chunks of the file read ahead on an async
+///     reader. Without an async reader the chunks are read on demand, like a buffered stream.
+class MINDRECORD_API ShardPrefetchStream {
+ public:
+  /// \brief constructor
+  /// \param[in] async_reader the reader which reads ahead, nullptr to read on demand
+  /// \param[in] chunk_size the size of each read
+  /// \param[in] depth the number of chunks to keep in flight, bounded by the depth of async reader
+  ShardPrefetchStream(std::shared_ptr<ShardAsyncReader> async_reader, uint64_t chunk_size, int32_t depth);
+
+  ~ShardPrefetchStream();
+
+  ShardPrefetchStream(const ShardPrefetchStream &) = delete;
+  ShardPrefetchStream &operator=(const ShardPrefetchStream &) = delete;
+
+  /// \brief open the file and start reading ahead
+  Status Open(const std::string &file_path);
+
+  /// \brief read up to size bytes into dst
+  /// \param[out] read_size the number of bytes read, less than size only at the end of file
+  Status Read(void *dst, uint64_t size, uint64_t *read_size);
+
+  /// \brief skip size bytes
+  void Skip(uint64_t size);
+
+  /// \brief whether the end of file is reached
+  bool Eof() const { return file_ == nullptr || pos_ >= file_->Size(); }
+
+  /// \brief stop reading ahead and close the file
+  void Close();
+
+ private:
+  // make the chunk which contains pos_ the current chunk
+  Status LoadChunk();
+
+  // queue the chunks after pos_ until the depth is reached
+  void ReadAhead();
+
+  std::shared_ptr<ShardAsyncReader> async_reader_;
+  std::shared_ptr<ShardPositionalFile> file_;
+  uint64_t chunk_size_;
+  int32_t depth_;
+  uint64_t pos_ = 0;            // logical position in the file
+  uint64_t chunk_offset_ = 0;   // offset of the current chunk in the file
+  uint64_t next_take_ = 0;      // offset of the chunk after the current one
+  uint64_t next_submit_ = 0;    // offset of the next chunk to queue
+  std::vector<uint8_t> chunk_;  // the current chunk
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_ASYNC_READER_H_
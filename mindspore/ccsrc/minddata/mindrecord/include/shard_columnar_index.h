@@ -0,0 +1,172 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+#include "minddata/mindrecord/include/shard_mmap_file.h"
+
+namespace mindspore {
+namespace mindrecord {
+// suffix of the columnar index file, which lives next to the mindrecord file and its sqlite meta file
+const char kColumnarIndexSuffix[] = ".idx";
+const char kColumnarIndexMagic[] = "MRCOLIDX";
+const uint32_t kColumnarIndexVersion = 1;
+
+// the fixed columns of the columnar index, one uint64_t array for each of them
+enum IndexColumn : uint32_t {
+  kIndexRowId = 0,
+  kIndexRowGroupId,
+  kIndexPageIdRaw,
+  kIndexPageOffsetRaw,
+  kIndexPageOffsetRawEnd,
+  kIndexPageIdBlob,
+  kIndexPageOffsetBlob,
+  kIndexPageOffsetBlobEnd,
+  kIndexColumnCount
+};
+
+/// \brief One row of the index, mirrors a row of the INDEXES table in the sqlite meta file.
+struct ShardIndexRow {
+  uint64_t columns[kIndexColumnCount] = {0};
+  std::vector<std::string> field_values;  // same order as the index fields
+};
+
+/// \brief Compact, read-only and memory-mapped replacement of the per-shard sqlite INDEXES table.
+///
+/// File layout (all integers are little-endian uint64_t and all sections are 8-byte aligned):
+///   header            | ColumnarIndexHeader
+///   fixed columns     | kIndexColumnCount arrays of num_rows values, rows ordered by ROW_ID
+///   blob page order   | num_rows row positions ordered by (PAGE_ID_BLOB, ROW_ID)
+///   field directory   | num_fields x {name offset, name length, values offset, sorted offset}
+///   field values      | per field, num_rows x {arena offset, length}
+///   field sort order  | per field, num_rows row positions ordered by (value, ROW_ID)
+///   string arena      | shard name, field names and field values
+class MINDRECORD_API ShardColumnarIndex {
+ public:
+  struct ColumnarIndexHeader {
+    char magic[8];
+    uint64_t version;
+    uint64_t num_rows;
+    uint64_t num_fields;
+    uint64_t data_file_size;   // size of the mindrecord file when the index is built, used to detect stale index
+    uint64_t data_file_mtime;  // modification time in ns of the mindrecord file, detects rewrites of the same size
+    uint64_t shard_name_offset;
+    uint64_t shard_name_length;
+    uint64_t columns_offset;
+    uint64_t blob_page_order_offset;
+    uint64_t field_dir_offset;
+    uint64_t arena_offset;
+    uint64_t arena_size;
+  };
+
+  /// \brief a contiguous range of row positions
+  using RowSpan = std::pair<const uint64_t *, const uint64_t *>;
+
+  ShardColumnarIndex() = default;
+
+  ~ShardColumnarIndex() = default;
+
+  /// \brief get the path of the columnar index which belongs to the mindrecord file
+  static std::string GetIndexFileName(const std::string &data_file) { return data_file + kColumnarIndexSuffix; }
+
+  /// \brief serialize the rows into a columnar index file
+  /// \param[in] data_file the mindrecord file the index belongs to
+  /// \param[in] shard_name file name of the mindrecord file, used to detect renamed files
+  /// \param[in] field_names the generated names of the index fields, e.g. label_0
+  /// \param[in] rows rows of index, will be sorted by ROW_ID in place
+  /// \return Status the status of Status
+  static Status Write(const std::string &data_file, const std::string &shard_name,
+                      const std::vector<std::string> &field_names, std::vector<ShardIndexRow> *rows);
+
+  /// \brief map and validate the columnar index of the mindrecord file
+  /// \param[in] data_file the mindrecord file the index belongs to
+  /// \param[out] index_ptr the opened index
+  /// \return Status error if the index does not exist, is broken or is stale
+  static Status Open(const std::string &data_file, std::shared_ptr<ShardColumnarIndex> *index_ptr);
+
+  /// \brief get the number of rows
+  uint64_t GetNumRows() const { return header_->num_rows; }
+
+  /// \brief get the file name of the mindrecord file recorded when building the index
+  std::string_view GetShardName() const { return ArenaString(header_->shard_name_offset, header_->shard_name_length); }
+
+  /// \brief get the value of a fixed column
+  uint64_t GetColumn(IndexColumn column, uint64_t row) const { return columns_[column * header_->num_rows + row]; }
+
+  /// \brief find the row position by ROW_ID
+  bool FindRowById(uint64_t row_id, uint64_t *row) const;
+
+  /// \brief get the positions of rows stored in the blob page, ordered by ROW_ID
+  RowSpan GetRowsInBlobPage(uint64_t page_id) const;
+
+  /// \brief get the position of the index field by its generated name, -1 if not found
+  int GetFieldId(const std::string &field_name) const;
+
+  /// \brief get the raw string value of the index field
+  std::string_view GetFieldValue(int field_id, uint64_t row) const;
+
+  /// \brief get the positions of rows whose index field equals value, ordered by ROW_ID
+  RowSpan GetRowsByFieldValue(int field_id, std::string_view value) const;
+
+  /// \brief collect the distinct values of the index field
+  void GetDistinctFieldValues(int field_id, std::set<std::string> *values) const;
+
+  /// \brief whether the row matches the criteria, an empty criteria matches all rows
+  bool MatchCriteria(int field_id, std::string_view value, uint64_t row) const {
+    return field_id < 0 || GetFieldValue(field_id, row) == value;
+  }
+
+ private:
+  struct FieldEntry {
+    uint64_t name_offset;
+    uint64_t name_length;
+    uint64_t values_offset;
+    uint64_t sorted_offset;
+  };
+
+  Status Validate(uint64_t data_file_size, uint64_t data_file_mtime);
+
+  std::string_view ArenaString(uint64_t offset, uint64_t length) const {
+    return std::string_view(reinterpret_cast<const char *>(arena_) + offset, length);
+  }
+
+  const uint64_t *SectionAt(uint64_t offset) const {
+    return reinterpret_cast<const uint64_t *>(file_->Data() + offset);
+  }
+
+  std::shared_ptr<ShardMmapFile> file_;
+  const ColumnarIndexHeader *header_ = nullptr;
+  const uint64_t *columns_ = nullptr;
+  const uint64_t *blob_page_order_ = nullptr;
+  const FieldEntry *fields_ = nullptr;
+  const uint8_t *arena_ = nullptr;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
@@ -25,6 +25,7 @@
 #include <tuple>
 #include <utility>
 #include <vector>
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "./sqlite3.h"
 
@@ -106,6 +107,10 @@ class MINDRECORD_API ShardIndexGenerator {
   Status AddIndexFieldByRawData(const std::vector<json> &schema_detail,
                                 std::vector<std::tuple<std::string, std::string, std::string>> &row_data);  // NOLINT
 
+  Status AddColumnarIndexRows(const ROW_DATA &row_data, std::vector<ShardIndexRow> *rows);
+
+  Status WriteColumnarIndex(int shard_no, std::vector<ShardIndexRow> *rows);
+
   void DatabaseWriter();  // worker thread
 
   std::string file_path_;
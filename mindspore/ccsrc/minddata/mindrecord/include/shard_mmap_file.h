@@ -0,0 +1,93 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MMAP_FILE_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MMAP_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+/// \brief A read-only view of a whole file, or of a window of it. On POSIX systems the file is mapped with mmap so
+///     that the pages are shared with the page cache, on other platforms the content is loaded into memory.
+class MINDRECORD_API ShardMmapFile {
+ public:
+  ShardMmapFile() = default;
+
+  ~ShardMmapFile();
+
+  ShardMmapFile(const ShardMmapFile &) = delete;
+  ShardMmapFile &operator=(const ShardMmapFile &) = delete;
+
+  /// \brief map the file read-only
+  /// \param[in] file_path the path of the file
+  /// \param[out] file_ptr the mapped file
+  /// \param[in] copy_on_write open the file for MapWindow instead of mapping it. Used when the pages are handed out
+  ///     to consumers which may modify them in place, in which case a private writable mapping of the whole file
+  ///     would be charged in full against the commit limit.
+  /// \return Status the status of Status
+  static Status Open(const std::string &file_path, std::shared_ptr<ShardMmapFile> *file_ptr,
+                     bool copy_on_write = false);
+
+  /// \brief map a window of a file opened with copy_on_write, private and writable. Writes go to private copies of
+  ///     the touched pages and never reach the file, only the window is charged against the commit limit.
+  /// \param[in] offset the offset of the window in the file
+  /// \param[in] size the size of the window in bytes
+  /// \param[out] window_ptr the mapped window, Data() points to the byte at offset
+  /// \return Status the status of Status
+  Status MapWindow(uint64_t offset, uint64_t size, std::shared_ptr<ShardMmapFile> *window_ptr) const;
+
+  /// \brief advise the kernel about the expected access pattern of the whole mapping
+  /// \param[in] sequential true for read-ahead friendly scans, false for random access
+  void Advise(bool sequential) const;
+
+  /// \brief get the start address of the mapping
+  const uint8_t *Data() const { return data_; }
+
+  /// \brief whether the file is really mapped, false if the content is loaded into memory
+  bool IsMapped() const { return mapped_; }
+
+  /// \brief get the size of the mapping in bytes
+  uint64_t Size() const { return size_; }
+
+  /// \brief get the offset of the mapping in the file, 0 unless it is a window
+  uint64_t Offset() const { return offset_; }
+
+  /// \brief get the path of the mapped file
+  const std::string &GetPath() const { return path_; }
+
+ private:
+  std::string path_;
+  const uint8_t *data_ = nullptr;
+  uint64_t size_ = 0;
+  uint64_t offset_ = 0;
+  uint8_t *map_base_ = nullptr;  // page aligned start of the mapping, at or before data_
+  uint64_t map_size_ = 0;
+  bool mapped_ = false;
+  int fd_ = -1;                  // kept open for MapWindow in copy_on_write mode
+  std::vector<uint8_t> buffer_;  // used when mmap is not available
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MMAP_FILE_H_
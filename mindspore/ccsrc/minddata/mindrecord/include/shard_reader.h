@@ -27,6 +27,7 @@
 #include <chrono>
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -42,11 +43,14 @@
 #include <vector>
 #include "minddata/mindrecord/include/common/log_adapter.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_async_reader.h"
 #include "minddata/mindrecord/include/shard_category.h"
 #include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
+#include "minddata/mindrecord/include/shard_mmap_file.h"
 #include "minddata/mindrecord/include/shard_operator.h"
 #include "minddata/mindrecord/include/shard_pk_sample.h"
 #include "minddata/mindrecord/include/shard_reader.h"
@@ -58,6 +62,14 @@ namespace mindrecord {
 using ROW_GROUPS = std::pair<std::vector<std::vector<std::vector<uint64_t>>>, std::vector<std::vector<json>>>;
 using ROW_GROUP_BRIEF = std::tuple<std::string, int, uint64_t, std::vector<std::vector<uint64_t>>, std::vector<json>>;
 using TASK_CONTENT = std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>>;
+
+/// \brief A blob which lives in a mapped data file, file keeps the mapping alive as long as the view is used.
+struct ShardBlobView {
+  std::shared_ptr<ShardMmapFile> file;
+  const uint8_t *data = nullptr;
+  uint64_t size = 0;
+};
+using MAPPED_TASK_CONTENT = std::pair<TaskType, std::vector<std::tuple<ShardBlobView, json>>>;
 const int kNumBatchInMap = 1000;  // iterator buffer size in row-reader mode
 
 class MINDRECORD_API ShardReader {
@@ -184,6 +196,11 @@ class MINDRECORD_API ShardReader {
   Status GetNextById(const int64_t &task_id, const int32_t &consumer_id,
                      std::shared_ptr<TASK_CONTENT> *task_content_ptr);
 
+  /// \brief return a row by id, the blob is a view of the mapped data file instead of a copy.
+  ///     Only available in mmap mode.
+  Status GetNextMappedById(const int64_t &task_id, const int32_t &consumer_id,
+                           std::shared_ptr<MAPPED_TASK_CONTENT> *task_content_ptr);
+
   /// \brief  get blob filed list
   /// \return blob field list
   std::pair<ShardType, std::vector<std::string>> GetBlobFields();
@@ -196,6 +213,20 @@ class MINDRECORD_API ShardReader {
   /// \return null
   void SetAllInIndex(bool all_in_index) { all_in_index_ = all_in_index; }
 
+  /// \brief set flag of mmap mode, in which the data files are mapped and blobs are read without copy.
+  ///     Must be called before Open.
+  void SetMmapMode(bool mmap_mode) { mmap_mode_ = mmap_mode; }
+
+  /// \brief whether the data files are mapped, mmap mode is turned off when the files can not be mapped
+  bool IsMmapMode() const { return mmap_mode_; }
+
+  /// \brief set the number of blobs read ahead on background I/O threads, 0 to read synchronously.
+  ///     Only takes effect in fast load mode without mmap mode. Must be called before Open.
+  void SetPrefetchDepth(int32_t prefetch_depth) { prefetch_depth_ = prefetch_depth; }
+
+  /// \brief get the number of blob bytes which are not read because no blob field is selected
+  uint64_t GetBlobBytesSkipped() const { return blob_bytes_skipped_.load(std::memory_order_relaxed); }
+
   /// \brief get all classes
   Status GetAllClasses(const std::string &category_field, std::shared_ptr<std::set<std::string>> category_ptr);
 
@@ -238,6 +269,27 @@ class MINDRECORD_API ShardReader {
                                           const int32_t &consumer_id, const uint32_t &sample_id,
                                           std::shared_ptr<ROW_GROUPS> *row_group_ptr);
 
+  /// \brief read rows in one shard from the columnar index
+  /// \param[in] row_id the ROW_ID to read, -1 means all rows in the shard
+  Status ReadRowsFromColumnarIndex(int shard_id, const int32_t &consumer_id, int64_t row_id,
+                                   const std::vector<std::string> &columns,
+                                   std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
+                                   std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr);
+
+  /// \brief read the raw label of one row from raw data page
+  Status ReadRawLabel(std::shared_ptr<std::fstream> fs, int raw_page_id, uint64_t label_start, uint64_t label_end,
+                      const std::vector<std::string> &columns, json *label);
+
+  /// \brief open the columnar index of the mindrecord file, nullptr if it is not available
+  std::shared_ptr<ShardColumnarIndex> OpenColumnarIndex(const std::string &file);
+
+  /// \brief get the position of criteria field in columnar index and the normalized value of criteria
+  Status GetColumnarCriteria(int shard_id, const std::pair<std::string, std::string> &criteria, int *field_id,
+                             std::string *value);
+
+  /// \brief run func for every shard with a bounded number of threads
+  Status ParallelForShards(int shard_count, const std::function<Status(int)> &func);
+
   /// \brief read all rows in one shard
   Status ReadAllRowsInShard(int shard_id, const int32_t &consumer_id, const std::string &sql,
                             const std::vector<std::string> &columns,
@@ -302,6 +354,27 @@ class MINDRECORD_API ShardReader {
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
+  /// \brief find the position of the blob in the data file and the scalar fields of one task
+  Status LocateTaskBlob(int64_t task_id, uint32_t consumer_id, TaskType *task_type, uint32_t *shard_id,
+                        uint64_t *file_offset, uint64_t *blob_size, json *var_fields);
+
+  /// \brief open all the data files for mapping in mmap mode
+  Status MapDataFiles();
+
+  /// \brief get the mapped window of the row group which holds a blob, shared by the rows of the row group while
+  ///     any of them is alive
+  Status GetRowGroupWindow(uint32_t shard_id, uint64_t file_offset, uint64_t blob_size,
+                           std::shared_ptr<ShardMmapFile> *window_ptr);
+
+  /// \brief open the data files for the async reader if prefetch is enabled
+  Status OpenPrefetchFiles();
+
+  /// \brief queue the blobs of the tasks after task_id on the async reader
+  void PrefetchTasks(int64_t task_id);
+
+  /// \brief drop the blobs read ahead, e.g. when the order of tasks changes
+  void ResetPrefetch();
+
   /// \brief get labels from binary file
   Status GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
                                  const std::vector<std::vector<std::string>> &label_offsets,
@@ -326,9 +399,13 @@ class MINDRECORD_API ShardReader {
   std::shared_ptr<ShardColumn> shard_column_;  // shard column
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
+  std::vector<std::shared_ptr<ShardColumnarIndex>> columnar_indexes_;            // mmap index list, nullptr for sqlite
   std::vector<string> file_paths_;                                               // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
   std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
+  std::vector<std::shared_ptr<ShardMmapFile>> data_files_;                       // data files opened in mmap mode
+  std::shared_ptr<ShardAsyncReader> async_reader_;                               // reads blobs ahead of consumers
+  std::vector<std::shared_ptr<ShardPositionalFile>> prefetch_files_;             // data files of async reader
 
  private:
   int n_consumer_;                                         // number of workers (threads)
@@ -338,9 +415,22 @@ class MINDRECORD_API ShardReader {
   ShardTaskList tasks_;                                    // shard task list
   std::mutex shard_locker_;                                // locker of shard
 
+  // mapped row groups of each shard in mmap mode, by their offset in the data file
+  std::vector<std::map<uint64_t, std::weak_ptr<ShardMmapFile>>> row_group_windows_;
+  std::mutex windows_mutex_;        // locker of row_group_windows_
+  bool sequential_windows_ = true;  // if the windows are advised for sequential reads
+
   // flags
   bool all_in_index_ = true;  // if all columns are stored in index-table
   bool interrupt_ = false;    // reader interrupted
+  bool mmap_mode_ = false;    // if blobs are read from mapped data files
+  bool skip_blob_ = false;    // if no blob field is selected, in which case blobs are not read
+
+  std::atomic<uint64_t> blob_bytes_skipped_{0};  // size of the blobs which are not read
+
+  int32_t prefetch_depth_ = 0;  // number of blobs read ahead
+  std::mutex mtx_prefetch_;     // locker of prefetch_end_
+  int64_t prefetch_end_ = 0;    // the first task which is not queued on async reader
 
   int64_t num_padded_;  // number of padding samples
 
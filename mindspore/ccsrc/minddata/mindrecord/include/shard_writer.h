@@ -229,6 +229,9 @@ class MINDRECORD_API ShardWriter {
   /// \brief Remove lock file
   Status RemoveLockFile();
 
+  /// \brief Remove the columnar index files of the shards, which no longer match the data written
+  Status RemoveColumnarIndexFiles();
+
   /// \brief Remove lock file
   Status InitLockFile();
 
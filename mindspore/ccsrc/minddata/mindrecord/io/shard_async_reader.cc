@@ -0,0 +1,362 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_async_reader.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
+#include <sys/prctl.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "utils/file_utils.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+ShardPositionalFile::~ShardPositionalFile() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (fd_ >= 0) {
+    (void)close(fd_);
+    fd_ = -1;
+  }
+#else
+  if (fin_.is_open()) {
+    fin_.close();
+  }
+#endif
+}
+
+Status ShardPositionalFile::Open(const std::string &file_path, std::shared_ptr<ShardPositionalFile> *file_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(file_ptr);
+  auto realpath = FileUtils::GetRealPath(file_path.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(realpath.has_value(),
+                                  "Invalid file, failed to get the realpath of file: " + file_path);
+  auto file = std::make_shared<ShardPositionalFile>();
+  file->path_ = file_path;
+#if !defined(_WIN32) && !defined(_WIN64)
+  file->fd_ = open(realpath.value().c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(file->fd_ >= 0, "Invalid file, failed to open file: " + file_path +
+                                                    ". Please check file path, permission and open files limit"
+                                                    "(ulimit -a).");
+  struct stat st;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fstat(file->fd_, &st) == 0, "[Internal ERROR] Failed to stat file: " + file_path);
+  file->size_ = static_cast<uint64_t>(st.st_size);
+#else
+  file->fin_.open(realpath.value(), std::ios::in | std::ios::binary);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(file->fin_.good(), "Invalid file, failed to open file: " + file_path +
+                                                       ". Please check file path, permission and open files limit.");
+  (void)file->fin_.seekg(0, std::ios::end);
+  file->size_ = static_cast<uint64_t>(file->fin_.tellg());
+#endif
+  *file_ptr = file;
+  return Status::OK();
+}
+
+Status ShardPositionalFile::ReadAt(uint64_t offset, uint64_t size, std::vector<uint8_t> *buffer) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(buffer);
+  uint64_t read_size = offset < size_ ? std::min(size, size_ - offset) : 0;
+  buffer->resize(read_size);
+#if !defined(_WIN32) && !defined(_WIN64)
+  uint64_t done = 0;
+  while (done < read_size) {
+    auto ret = pread(fd_, buffer->data() + done, read_size - done, static_cast<off_t>(offset + done));
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(ret >= 0, "[Internal ERROR] Failed to read file: " + path_ +
+                                                ", errno: " + std::to_string(errno));
+    if (ret == 0) {
+      break;  // the file is truncated after it is opened
+    }
+    done += static_cast<uint64_t>(ret);
+  }
+  buffer->resize(done);
+#else
+  std::lock_guard<std::mutex> lock(mtx_);
+  fin_.clear();
+  auto &io_seekg = fin_.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(io_seekg.good(), "[Internal ERROR] Failed to seekg file: " + path_);
+  (void)fin_.read(reinterpret_cast<char *>(buffer->data()), static_cast<std::streamsize>(read_size));
+  buffer->resize(static_cast<size_t>(fin_.gcount()));
+#endif
+  return Status::OK();
+}
+
+ShardAsyncReader::ShardAsyncReader(int32_t num_threads, int32_t max_in_flight)
+    : max_in_flight_(std::max(max_in_flight, 1)) {
+  num_threads = std::min(std::max(num_threads, 1), kMaxAsyncReadThreads);
+  for (int32_t i = 0; i < num_threads; ++i) {
+    threads_.emplace_back(&ShardAsyncReader::IOThread, this);
+  }
+}
+
+ShardAsyncReader::~ShardAsyncReader() {
+  Stop();
+  MS_LOG(INFO) << "Async reader finished, submitted: " << stats_.submitted << ", rejected: " << stats_.rejected
+               << ", ready hits: " << stats_.ready_hits << ", pending hits: " << stats_.pending_hits
+               << ", cancelled: " << stats_.cancelled;
+}
+
+void ShardAsyncReader::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (stop_) {
+      return;
+    }
+    stop_ = true;
+  }
+  cv_request_.notify_all();
+  for (auto &thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  std::lock_guard<std::mutex> lock(mtx_);
+  queue_.clear();
+  stats_.cancelled += requests_.size();
+  requests_.clear();
+  cv_done_.notify_all();
+}
+
+void ShardAsyncReader::IOThread() {
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
+  (void)prctl(PR_SET_NAME, "THRD_ASYNC_READ", 0, 0, 0);
+#endif
+  while (true) {
+    std::shared_ptr<ReadRequest> request;
+    {
+      std::unique_lock<std::mutex> lock(mtx_);
+      cv_request_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+      if (stop_) {
+        return;
+      }
+      request = queue_.front();
+      queue_.pop_front();
+      if (request->cancelled) {
+        continue;
+      }
+      request->started = true;
+    }
+    std::vector<uint8_t> buffer;
+    Status rc = request->file->ReadAt(request->offset, request->size, &buffer);
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      request->buffer = std::move(buffer);
+      request->status = rc;
+      request->done = true;
+    }
+    cv_done_.notify_all();
+  }
+}
+
+bool ShardAsyncReader::TrySubmit(const std::shared_ptr<ShardPositionalFile> &file, uint64_t offset, uint64_t size) {
+  if (file == nullptr) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (stop_) {
+      return false;
+    }
+    RequestKey key(file.get(), offset);
+    if (requests_.find(key) != requests_.end()) {
+      return true;
+    }
+    if (requests_.size() >= static_cast<size_t>(max_in_flight_)) {
+      stats_.rejected++;
+      return false;
+    }
+    auto request = std::make_shared<ReadRequest>();
+    request->file = file;
+    request->offset = offset;
+    request->size = size;
+    requests_[key] = request;
+    queue_.push_back(request);
+    stats_.submitted++;
+  }
+  cv_request_.notify_one();
+  return true;
+}
+
+void ShardAsyncReader::EraseRequest(std::map<RequestKey, std::shared_ptr<ReadRequest>>::iterator iter) {
+  // the I/O thread skips the cancelled request when it pops it from the queue
+  iter->second->cancelled = true;
+  (void)requests_.erase(iter);
+}
+
+Status ShardAsyncReader::Take(const std::shared_ptr<ShardPositionalFile> &file, uint64_t offset, uint64_t size,
+                              std::vector<uint8_t> *buffer, bool *found) {
+  RETURN_UNEXPECTED_IF_NULL_MR(buffer);
+  RETURN_UNEXPECTED_IF_NULL_MR(found);
+  *found = false;
+  std::unique_lock<std::mutex> lock(mtx_);
+  auto iter = requests_.find(RequestKey(file.get(), offset));
+  if (iter == requests_.end()) {
+    return Status::OK();
+  }
+  auto request = iter->second;
+  if (request->size != size || !request->started) {
+    stats_.cancelled++;
+    EraseRequest(iter);
+    return Status::OK();
+  }
+  if (request->done) {
+    stats_.ready_hits++;
+  } else {
+    stats_.pending_hits++;
+    cv_done_.wait(lock, [this, &request] { return stop_ || request->done; });
+    if (!request->done) {
+      return Status::OK();  // stopped, the request is dropped by Stop
+    }
+  }
+  // while waiting, the request may have been cancelled and another one submitted for the same key
+  iter = requests_.find(RequestKey(file.get(), offset));
+  if (iter != requests_.end() && iter->second == request) {
+    (void)requests_.erase(iter);
+  }
+  RETURN_IF_NOT_OK_MR(request->status);
+  *buffer = std::move(request->buffer);
+  *found = true;
+  return Status::OK();
+}
+
+void ShardAsyncReader::Cancel(const std::shared_ptr<ShardPositionalFile> &file, uint64_t offset) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto iter = requests_.find(RequestKey(file.get(), offset));
+  if (iter != requests_.end()) {
+    stats_.cancelled++;
+    EraseRequest(iter);
+  }
+}
+
+void ShardAsyncReader::Clear() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  for (auto &request : queue_) {
+    request->cancelled = true;
+  }
+  queue_.clear();
+  stats_.cancelled += requests_.size();
+  requests_.clear();
+}
+
+ShardAsyncReader::Stats ShardAsyncReader::GetStats() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return stats_;
+}
+
+ShardPrefetchStream::ShardPrefetchStream(std::shared_ptr<ShardAsyncReader> async_reader, uint64_t chunk_size,
+                                         int32_t depth)
+    : async_reader_(std::move(async_reader)), chunk_size_(std::max<uint64_t>(chunk_size, 1)), depth_(depth) {
+  if (async_reader_ != nullptr) {
+    depth_ = std::min(depth_, async_reader_->GetMaxInFlight());
+  }
+}
+
+ShardPrefetchStream::~ShardPrefetchStream() { Close(); }
+
+Status ShardPrefetchStream::Open(const std::string &file_path) {
+  Close();
+  RETURN_IF_NOT_OK_MR(ShardPositionalFile::Open(file_path, &file_));
+  pos_ = 0;
+  chunk_offset_ = 0;
+  next_take_ = 0;
+  next_submit_ = 0;
+  chunk_.clear();
+  ReadAhead();
+  return Status::OK();
+}
+
+void ShardPrefetchStream::Close() {
+  if (file_ == nullptr) {
+    return;
+  }
+  if (async_reader_ != nullptr) {
+    for (uint64_t offset = next_take_; offset < next_submit_; offset += chunk_size_) {
+      async_reader_->Cancel(file_, offset);
+    }
+  }
+  file_ = nullptr;
+  chunk_.clear();
+}
+
+void ShardPrefetchStream::ReadAhead() {
+  if (async_reader_ == nullptr || depth_ <= 0) {
+    return;
+  }
+  next_submit_ = std::max(next_submit_, next_take_);
+  uint64_t limit = next_take_ + static_cast<uint64_t>(depth_) * chunk_size_;
+  while (next_submit_ < file_->Size() && next_submit_ < limit) {
+    if (!async_reader_->TrySubmit(file_, next_submit_, chunk_size_)) {
+      break;
+    }
+    next_submit_ += chunk_size_;
+  }
+}
+
+Status ShardPrefetchStream::LoadChunk() {
+  uint64_t offset = pos_ - pos_ % chunk_size_;
+  bool found = false;
+  if (async_reader_ != nullptr) {
+    // chunks which are skipped over are never taken
+    for (uint64_t skipped = next_take_; skipped < offset && skipped < next_submit_; skipped += chunk_size_) {
+      async_reader_->Cancel(file_, skipped);
+    }
+    RETURN_IF_NOT_OK_MR(async_reader_->Take(file_, offset, chunk_size_, &chunk_, &found));
+  }
+  if (!found) {
+    RETURN_IF_NOT_OK_MR(file_->ReadAt(offset, chunk_size_, &chunk_));
+  }
+  chunk_offset_ = offset;
+  next_take_ = offset + chunk_size_;
+  ReadAhead();
+  return Status::OK();
+}
+
+Status ShardPrefetchStream::Read(void *dst, uint64_t size, uint64_t *read_size) {
+  RETURN_UNEXPECTED_IF_NULL_MR(read_size);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(file_ != nullptr, "[Internal ERROR] The prefetch stream is not opened.");
+  *read_size = 0;
+  auto out = static_cast<uint8_t *>(dst);
+  while (*read_size < size && !Eof()) {
+    if (chunk_.empty() || pos_ < chunk_offset_ || pos_ >= chunk_offset_ + chunk_.size()) {
+      RETURN_IF_NOT_OK_MR(LoadChunk());
+      if (pos_ >= chunk_offset_ + chunk_.size()) {
+        break;  // the file is truncated after it is opened
+      }
+    }
+    uint64_t copy_size = std::min(size - *read_size, chunk_offset_ + chunk_.size() - pos_);
+    (void)memcpy(out + *read_size, chunk_.data() + (pos_ - chunk_offset_), copy_size);
+    *read_size += copy_size;
+    pos_ += copy_size;
+  }
+  return Status::OK();
+}
+
+void ShardPrefetchStream::Skip(uint64_t size) {
+  if (file_ == nullptr) {
+    return;
+  }
+  pos_ = std::min(pos_ + size, file_->Size());
+}
+}  // namespace mindrecord
+}  // namespace mindspore
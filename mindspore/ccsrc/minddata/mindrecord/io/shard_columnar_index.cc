@@ -0,0 +1,331 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_columnar_index.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <unordered_map>
+
+#include "utils/file_utils.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+constexpr uint64_t kFieldEntryWords = 4;
+constexpr uint64_t kFieldValueWords = 2;
+constexpr uint64_t kNanosecondsPerSecond = 1000000000;
+
+// the modification time of the file in ns, only seconds are kept on windows
+uint64_t FileModifyTime(const struct stat &file_stat) {
+#if defined(_WIN32) || defined(_WIN64)
+  return static_cast<uint64_t>(file_stat.st_mtime) * kNanosecondsPerSecond;
+#elif defined(__APPLE__)
+  return static_cast<uint64_t>(file_stat.st_mtimespec.tv_sec) * kNanosecondsPerSecond +
+         static_cast<uint64_t>(file_stat.st_mtimespec.tv_nsec);
+#else
+  return static_cast<uint64_t>(file_stat.st_mtim.tv_sec) * kNanosecondsPerSecond +
+         static_cast<uint64_t>(file_stat.st_mtim.tv_nsec);
+#endif
+}
+
+Status WriteWords(std::ofstream *out, const std::vector<uint64_t> &words) {
+  if (words.empty()) {
+    return Status::OK();
+  }
+  auto &io_write = out->write(reinterpret_cast<const char *>(words.data()),
+                              static_cast<std::streamsize>(words.size() * sizeof(uint64_t)));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(io_write.good(), "[Internal ERROR] Failed to write columnar index file.");
+  return Status::OK();
+}
+
+// append the string into the arena, identical strings are stored only once
+uint64_t AddToArena(const std::string &str, std::string *arena, std::unordered_map<std::string, uint64_t> *offsets) {
+  auto iter = offsets->find(str);
+  if (iter != offsets->end()) {
+    return iter->second;
+  }
+  uint64_t offset = arena->size();
+  arena->append(str);
+  (*offsets)[str] = offset;
+  return offset;
+}
+}  // namespace
+
+Status ShardColumnarIndex::Write(const std::string &data_file, const std::string &shard_name,
+                                 const std::vector<std::string> &field_names, std::vector<ShardIndexRow> *rows) {
+  RETURN_UNEXPECTED_IF_NULL_MR(rows);
+  const uint64_t num_rows = rows->size();
+  const uint64_t num_fields = field_names.size();
+  for (const auto &row : *rows) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(row.field_values.size() == num_fields,
+                                    "[Internal ERROR] The number of index field values: " +
+                                      std::to_string(row.field_values.size()) +
+                                      " is not equal to the number of index fields: " + std::to_string(num_fields));
+  }
+  std::stable_sort(rows->begin(), rows->end(), [](const ShardIndexRow &a, const ShardIndexRow &b) {
+    return a.columns[kIndexRowId] < b.columns[kIndexRowId];
+  });
+
+  auto data_realpath = FileUtils::GetRealPath(data_file.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(data_realpath.has_value(),
+                                  "Invalid file, failed to get the realpath of mindrecord file: " + data_file);
+  struct stat data_stat;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(stat(data_realpath.value().c_str(), &data_stat) == 0,
+                                  "Invalid file, failed to stat mindrecord file: " + data_file);
+
+  std::string arena;
+  std::unordered_map<std::string, uint64_t> arena_offsets;
+
+  ColumnarIndexHeader header;
+  (void)memcpy(header.magic, kColumnarIndexMagic, sizeof(header.magic));
+  header.version = kColumnarIndexVersion;
+  header.num_rows = num_rows;
+  header.num_fields = num_fields;
+  header.data_file_size = static_cast<uint64_t>(data_stat.st_size);
+  header.data_file_mtime = FileModifyTime(data_stat);
+  header.shard_name_offset = AddToArena(shard_name, &arena, &arena_offsets);
+  header.shard_name_length = shard_name.size();
+  header.columns_offset = sizeof(ColumnarIndexHeader);
+  header.blob_page_order_offset = header.columns_offset + kIndexColumnCount * num_rows * sizeof(uint64_t);
+  header.field_dir_offset = header.blob_page_order_offset + num_rows * sizeof(uint64_t);
+
+  std::vector<uint64_t> columns(kIndexColumnCount * num_rows);
+  for (uint64_t col = 0; col < kIndexColumnCount; ++col) {
+    for (uint64_t i = 0; i < num_rows; ++i) {
+      columns[col * num_rows + i] = (*rows)[i].columns[col];
+    }
+  }
+
+  std::vector<uint64_t> blob_page_order(num_rows);
+  std::iota(blob_page_order.begin(), blob_page_order.end(), 0);
+  std::stable_sort(blob_page_order.begin(), blob_page_order.end(), [rows](uint64_t a, uint64_t b) {
+    return (*rows)[a].columns[kIndexPageIdBlob] < (*rows)[b].columns[kIndexPageIdBlob];
+  });
+
+  // field values and sort orders follow the field directory
+  std::vector<uint64_t> field_dir;
+  std::vector<uint64_t> field_data;
+  uint64_t field_data_offset = header.field_dir_offset + num_fields * kFieldEntryWords * sizeof(uint64_t);
+  for (uint64_t f = 0; f < num_fields; ++f) {
+    field_dir.push_back(AddToArena(field_names[f], &arena, &arena_offsets));
+    field_dir.push_back(field_names[f].size());
+    field_dir.push_back(field_data_offset + field_data.size() * sizeof(uint64_t));
+    for (uint64_t i = 0; i < num_rows; ++i) {
+      const auto &value = (*rows)[i].field_values[f];
+      field_data.push_back(AddToArena(value, &arena, &arena_offsets));
+      field_data.push_back(value.size());
+    }
+    field_dir.push_back(field_data_offset + field_data.size() * sizeof(uint64_t));
+    std::vector<uint64_t> sorted(num_rows);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::stable_sort(sorted.begin(), sorted.end(), [rows, f](uint64_t a, uint64_t b) {
+      return (*rows)[a].field_values[f] < (*rows)[b].field_values[f];
+    });
+    field_data.insert(field_data.end(), sorted.begin(), sorted.end());
+  }
+  header.arena_offset = field_data_offset + field_data.size() * sizeof(uint64_t);
+  header.arena_size = arena.size();
+
+  // write into a temporary file first, so that readers never observe a partially written index
+  std::string index_file = GetIndexFileName(data_realpath.value());
+  std::string tmp_file = index_file + ".tmp";
+  std::ofstream out(tmp_file, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(out.good(), "Invalid file, failed to open columnar index file for writing: " +
+                                                tmp_file + ". Please check file path and permission.");
+  (void)out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  Status rc = WriteWords(&out, columns);
+  if (rc.IsOk()) {
+    rc = WriteWords(&out, blob_page_order);
+  }
+  if (rc.IsOk()) {
+    rc = WriteWords(&out, field_dir);
+  }
+  if (rc.IsOk()) {
+    rc = WriteWords(&out, field_data);
+  }
+  if (rc.IsOk() && !arena.empty()) {
+    (void)out.write(arena.data(), static_cast<std::streamsize>(arena.size()));
+  }
+  if (rc.IsOk() && !out.good()) {
+    rc = STATUS_ERROR_MR(StatusCode::kMDUnexpectedError, "[Internal ERROR] Failed to write columnar index file.");
+  }
+  out.close();
+  if (rc.IsError()) {
+    (void)std::remove(tmp_file.c_str());
+    return rc;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  // rename does not replace an existing file on windows
+  (void)std::remove(index_file.c_str());
+#endif
+  if (std::rename(tmp_file.c_str(), index_file.c_str()) != 0) {
+    (void)std::remove(tmp_file.c_str());
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to rename columnar index file: " + tmp_file + " to " +
+                                index_file + ". Please check file path and permission.");
+  }
+  MS_LOG(INFO) << "Succeed to write columnar index with " << num_rows << " rows, path: " << index_file;
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::Open(const std::string &data_file, std::shared_ptr<ShardColumnarIndex> *index_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(index_ptr);
+  auto data_realpath = FileUtils::GetRealPath(data_file.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(data_realpath.has_value(),
+                                  "Invalid file, failed to get the realpath of mindrecord file: " + data_file);
+  std::string index_file = GetIndexFileName(data_realpath.value());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(std::ifstream(index_file).good(),
+                                  "Columnar index file does not exist: " + index_file);
+  struct stat data_stat;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(stat(data_realpath.value().c_str(), &data_stat) == 0,
+                                  "Invalid file, failed to stat mindrecord file: " + data_file);
+
+  auto index = std::make_shared<ShardColumnarIndex>();
+  RETURN_IF_NOT_OK_MR(ShardMmapFile::Open(index_file, &index->file_));
+  RETURN_IF_NOT_OK_MR(index->Validate(static_cast<uint64_t>(data_stat.st_size), FileModifyTime(data_stat)));
+  // lookups are binary searches which jump around the file
+  index->file_->Advise(false);
+  *index_ptr = index;
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::Validate(uint64_t data_file_size, uint64_t data_file_mtime) {
+  const uint64_t file_size = file_->Size();
+  const std::string &path = file_->GetPath();
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(file_size >= sizeof(ColumnarIndexHeader),
+                                  "Invalid file, columnar index file is truncated: " + path);
+  header_ = reinterpret_cast<const ColumnarIndexHeader *>(file_->Data());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(memcmp(header_->magic, kColumnarIndexMagic, sizeof(header_->magic)) == 0,
+                                  "Invalid file, the magic of columnar index file is wrong: " + path);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(header_->version == kColumnarIndexVersion,
+                                  "Invalid file, unsupported columnar index version: " +
+                                    std::to_string(header_->version) + ", path: " + path);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(
+    header_->data_file_size == data_file_size && header_->data_file_mtime == data_file_mtime,
+    "Columnar index file is stale, the mindrecord file has been modified: " + path);
+
+  const uint64_t num_rows = header_->num_rows;
+  const uint64_t num_fields = header_->num_fields;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(
+    num_rows <= file_size / sizeof(uint64_t) && num_fields <= static_cast<uint64_t>(kMaxFieldCount),
+    "Invalid file, columnar index file is broken: " + path);
+  const uint64_t field_bytes = num_rows * (kFieldValueWords + 1) * sizeof(uint64_t);
+  bool layout_ok = header_->columns_offset == sizeof(ColumnarIndexHeader) &&
+                   header_->blob_page_order_offset ==
+                     header_->columns_offset + kIndexColumnCount * num_rows * sizeof(uint64_t) &&
+                   header_->field_dir_offset == header_->blob_page_order_offset + num_rows * sizeof(uint64_t) &&
+                   header_->arena_offset == header_->field_dir_offset +
+                                              num_fields * kFieldEntryWords * sizeof(uint64_t) +
+                                              num_fields * field_bytes &&
+                   header_->arena_offset <= file_size && header_->arena_size == file_size - header_->arena_offset;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(layout_ok, "Invalid file, the layout of columnar index file is broken: " + path);
+
+  columns_ = SectionAt(header_->columns_offset);
+  blob_page_order_ = SectionAt(header_->blob_page_order_offset);
+  fields_ = reinterpret_cast<const FieldEntry *>(file_->Data() + header_->field_dir_offset);
+  arena_ = file_->Data() + header_->arena_offset;
+
+  auto in_arena = [this](uint64_t offset, uint64_t length) {
+    return offset <= header_->arena_size && length <= header_->arena_size - offset;
+  };
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in_arena(header_->shard_name_offset, header_->shard_name_length),
+                                  "Invalid file, the shard name in columnar index file is broken: " + path);
+  for (uint64_t f = 0; f < num_fields; ++f) {
+    const auto &entry = fields_[f];
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(
+      in_arena(entry.name_offset, entry.name_length) && entry.values_offset + field_bytes <= header_->arena_offset &&
+        entry.sorted_offset == entry.values_offset + num_rows * kFieldValueWords * sizeof(uint64_t),
+      "Invalid file, the field directory in columnar index file is broken: " + path);
+    const uint64_t *values = SectionAt(entry.values_offset);
+    const uint64_t *sorted = SectionAt(entry.sorted_offset);
+    for (uint64_t i = 0; i < num_rows; ++i) {
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(in_arena(values[i * kFieldValueWords], values[i * kFieldValueWords + 1]) &&
+                                        sorted[i] < num_rows,
+                                      "Invalid file, the field values in columnar index file are broken: " + path);
+    }
+  }
+  for (uint64_t i = 0; i < num_rows; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(blob_page_order_[i] < num_rows,
+                                    "Invalid file, the page order in columnar index file is broken: " + path);
+  }
+  return Status::OK();
+}
+
+bool ShardColumnarIndex::FindRowById(uint64_t row_id, uint64_t *row) const {
+  const uint64_t *begin = columns_ + kIndexRowId * header_->num_rows;
+  const uint64_t *end = begin + header_->num_rows;
+  const uint64_t *iter = std::lower_bound(begin, end, row_id);
+  if (iter == end || *iter != row_id) {
+    return false;
+  }
+  *row = static_cast<uint64_t>(iter - begin);
+  return true;
+}
+
+ShardColumnarIndex::RowSpan ShardColumnarIndex::GetRowsInBlobPage(uint64_t page_id) const {
+  const uint64_t *page_ids = columns_ + kIndexPageIdBlob * header_->num_rows;
+  const uint64_t *begin = blob_page_order_;
+  const uint64_t *end = begin + header_->num_rows;
+  auto first =
+    std::lower_bound(begin, end, page_id, [page_ids](uint64_t row, uint64_t id) { return page_ids[row] < id; });
+  auto last =
+    std::upper_bound(first, end, page_id, [page_ids](uint64_t id, uint64_t row) { return id < page_ids[row]; });
+  return {first, last};
+}
+
+int ShardColumnarIndex::GetFieldId(const std::string &field_name) const {
+  for (uint64_t f = 0; f < header_->num_fields; ++f) {
+    if (ArenaString(fields_[f].name_offset, fields_[f].name_length) == field_name) {
+      return static_cast<int>(f);
+    }
+  }
+  return -1;
+}
+
+std::string_view ShardColumnarIndex::GetFieldValue(int field_id, uint64_t row) const {
+  const uint64_t *values = SectionAt(fields_[field_id].values_offset);
+  return ArenaString(values[row * kFieldValueWords], values[row * kFieldValueWords + 1]);
+}
+
+ShardColumnarIndex::RowSpan ShardColumnarIndex::GetRowsByFieldValue(int field_id, std::string_view value) const {
+  const uint64_t *begin = SectionAt(fields_[field_id].sorted_offset);
+  const uint64_t *end = begin + header_->num_rows;
+  auto first = std::lower_bound(begin, end, value, [this, field_id](uint64_t row, std::string_view v) {
+    return GetFieldValue(field_id, row) < v;
+  });
+  auto last = std::upper_bound(first, end, value, [this, field_id](std::string_view v, uint64_t row) {
+    return v < GetFieldValue(field_id, row);
+  });
+  return {first, last};
+}
+
+void ShardColumnarIndex::GetDistinctFieldValues(int field_id, std::set<std::string> *values) const {
+  const uint64_t *sorted = SectionAt(fields_[field_id].sorted_offset);
+  std::string_view last;
+  for (uint64_t i = 0; i < header_->num_rows; ++i) {
+    auto value = GetFieldValue(field_id, sorted[i]);
+    if (i == 0 || value != last) {
+      (void)values->emplace(value);
+      last = value;
+    }
+  }
+}
+}  // namespace mindrecord
+}  // namespace mindspore
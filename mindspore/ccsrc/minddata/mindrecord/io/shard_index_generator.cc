@@ -517,6 +517,7 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
     RETURN_STATUS_UNEXPECTED_MR("Execute SQL statement `BEGIN TRANSACTION;` failed, SQLite result code: " +
                                 std::to_string(sql_code));
   }
+  std::vector<ShardIndexRow> columnar_rows;
   for (int raw_page_id : raw_page_ids) {
     std::shared_ptr<std::string> sql_ptr;
     RELEASE_AND_RETURN_IF_NOT_OK_MR(GenerateRawSQL(fields_, &sql_ptr), db, in);
@@ -524,6 +525,7 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
     RELEASE_AND_RETURN_IF_NOT_OK_MR(GenerateRowData(shard_no, blob_id_to_page_id, raw_page_id, in, &row_data_ptr), db,
                                     in);
     RELEASE_AND_RETURN_IF_NOT_OK_MR(BindParameterExecuteSQL(db, *sql_ptr, *row_data_ptr), db, in);
+    RELEASE_AND_RETURN_IF_NOT_OK_MR(AddColumnarIndexRows(*row_data_ptr, &columnar_rows), db, in);
     MS_LOG(INFO) << "Insert " << row_data_ptr->size() << " rows to index db.";
   }
   sql_code = sqlite3_exec(db, "END TRANSACTION;", nullptr, nullptr, nullptr);
@@ -538,9 +540,67 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
   // Close database
   sqlite3_close(db);
   db = nullptr;
+
+  // the columnar index is an accelerator of the sqlite meta file, readers fall back to sqlite without it
+  return WriteColumnarIndex(shard_no, &columnar_rows);
+}
+
+Status ShardIndexGenerator::AddColumnarIndexRows(const ROW_DATA &row_data, std::vector<ShardIndexRow> *rows) {
+  RETURN_UNEXPECTED_IF_NULL_MR(rows);
+  static const std::map<std::string, IndexColumn> kPlaceHolderToColumn = {
+    {":ROW_ID", kIndexRowId},
+    {":ROW_GROUP_ID", kIndexRowGroupId},
+    {":PAGE_ID_RAW", kIndexPageIdRaw},
+    {":PAGE_OFFSET_RAW", kIndexPageOffsetRaw},
+    {":PAGE_OFFSET_RAW_END", kIndexPageOffsetRawEnd},
+    {":PAGE_ID_BLOB", kIndexPageIdBlob},
+    {":PAGE_OFFSET_BLOB", kIndexPageOffsetBlob},
+    {":PAGE_OFFSET_BLOB_END", kIndexPageOffsetBlobEnd}};
+  std::map<std::string, size_t> field_pos;
+  for (size_t i = 0; i < fields_.size(); ++i) {
+    std::shared_ptr<std::string> fn_ptr;
+    RETURN_IF_NOT_OK_MR(GenerateFieldName(fields_[i], &fn_ptr));
+    field_pos[":" + *fn_ptr] = i;
+  }
+  for (const auto &row : row_data) {
+    ShardIndexRow index_row;
+    index_row.field_values.resize(fields_.size());
+    for (const auto &field : row) {
+      const auto &place_holder = std::get<0>(field);
+      auto column_iter = kPlaceHolderToColumn.find(place_holder);
+      if (column_iter != kPlaceHolderToColumn.end()) {
+        try {
+          index_row.columns[column_iter->second] = std::stoull(std::get<2>(field));
+        } catch (...) {
+          RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to convert " + place_holder +
+                                      " to integer, value: " + std::get<2>(field));
+        }
+        continue;
+      }
+      auto field_iter = field_pos.find(place_holder);
+      if (field_iter != field_pos.end()) {
+        index_row.field_values[field_iter->second] = std::get<2>(field);
+      }
+    }
+    rows->push_back(std::move(index_row));
+  }
   return Status::OK();
 }
 
+Status ShardIndexGenerator::WriteColumnarIndex(int shard_no, std::vector<ShardIndexRow> *rows) {
+  RETURN_UNEXPECTED_IF_NULL_MR(rows);
+  std::string shard_address = shard_header_.GetShardAddressByID(shard_no);
+  std::shared_ptr<std::string> fn_ptr;
+  RETURN_IF_NOT_OK_MR(GetFileName(shard_address, &fn_ptr));
+  std::vector<std::string> field_names;
+  for (const auto &field : fields_) {
+    std::shared_ptr<std::string> field_ptr;
+    RETURN_IF_NOT_OK_MR(GenerateFieldName(field, &field_ptr));
+    field_names.push_back(*field_ptr);
+  }
+  return ShardColumnarIndex::Write(shard_address, *fn_ptr, field_names, rows);
+}
+
 Status ShardIndexGenerator::WriteToDatabase() {
   fields_ = shard_header_.GetFields();
   for (auto &field : fields_) {
@@ -0,0 +1,171 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_mmap_file.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cerrno>
+#include <fstream>
+
+#include "utils/file_utils.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+ShardMmapFile::~ShardMmapFile() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mapped_ && map_base_ != nullptr) {
+    if (munmap(map_base_, map_size_) != 0) {
+      MS_LOG(WARNING) << "Failed to unmap file: " << path_ << ", errno: " << errno;
+    }
+  }
+  if (fd_ >= 0) {
+    (void)close(fd_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  map_base_ = nullptr;
+  map_size_ = 0;
+}
+
+Status ShardMmapFile::Open(const std::string &file_path, std::shared_ptr<ShardMmapFile> *file_ptr,
+                           bool copy_on_write) {
+  RETURN_UNEXPECTED_IF_NULL_MR(file_ptr);
+  auto realpath = FileUtils::GetRealPath(file_path.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(realpath.has_value(),
+                                  "Invalid file, failed to get the realpath of file: " + file_path);
+  auto file = std::make_shared<ShardMmapFile>();
+  file->path_ = file_path;
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(realpath.value().c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fd >= 0, "Invalid file, failed to open file: " + file_path +
+                                             ". Please check file path, permission and open files limit(ulimit -a).");
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to stat file: " + file_path);
+  }
+  file->size_ = static_cast<uint64_t>(st.st_size);
+  if (copy_on_write) {
+    // the windows are mapped from the descriptor, which is closed with the file
+    file->fd_ = fd;
+    *file_ptr = file;
+    return Status::OK();
+  }
+  if (file->size_ > 0) {
+    void *addr = mmap(nullptr, file->size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+      (void)close(fd);
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to mmap file: " + file_path +
+                                  ", errno: " + std::to_string(errno));
+    }
+    file->map_base_ = static_cast<uint8_t *>(addr);
+    file->map_size_ = file->size_;
+    file->data_ = file->map_base_;
+    file->mapped_ = true;
+  }
+  // the mapping stays valid after the descriptor is closed
+  (void)close(fd);
+#else
+  std::ifstream fin(realpath.value(), std::ios::in | std::ios::binary);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fin.good(), "Invalid file, failed to open file: " + file_path +
+                                                ". Please check file path, permission and open files limit.");
+  (void)fin.seekg(0, std::ios::end);
+  file->size_ = static_cast<uint64_t>(fin.tellg());
+  (void)fin.seekg(0, std::ios::beg);
+  if (copy_on_write) {
+    // the windows are loaded when they are mapped
+    fin.close();
+    *file_ptr = file;
+    return Status::OK();
+  }
+  file->buffer_.resize(file->size_);
+  if (file->size_ > 0) {
+    auto &io_read = fin.read(reinterpret_cast<char *>(file->buffer_.data()), file->size_);
+    if (!io_read.good() || io_read.fail() || io_read.bad()) {
+      fin.close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file: " + file_path);
+    }
+  }
+  fin.close();
+  file->data_ = file->buffer_.data();
+#endif
+  *file_ptr = file;
+  return Status::OK();
+}
+
+Status ShardMmapFile::MapWindow(uint64_t offset, uint64_t size, std::shared_ptr<ShardMmapFile> *window_ptr) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(window_ptr);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(offset <= size_ && size <= size_ - offset,
+                                  "Invalid data, the window is out of the range of file: " + path_ + ", offset: " +
+                                    std::to_string(offset) + ", size: " + std::to_string(size));
+  auto window = std::make_shared<ShardMmapFile>();
+  window->path_ = path_;
+  window->offset_ = offset;
+  window->size_ = size;
+  if (size == 0) {
+    *window_ptr = window;
+    return Status::OK();
+  }
+#if !defined(_WIN32) && !defined(_WIN64)
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fd_ >= 0, "[Internal ERROR] File: " + path_ + " is not opened for windows.");
+  // mmap takes an offset aligned to the page size
+  const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  const uint64_t aligned_offset = offset / page_size * page_size;
+  window->map_size_ = size + (offset - aligned_offset);
+  void *addr = mmap(nullptr, window->map_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd_,
+                    static_cast<off_t>(aligned_offset));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(addr != MAP_FAILED, "[Internal ERROR] Failed to mmap file: " + path_ +
+                                                        ", offset: " + std::to_string(offset) +
+                                                        ", errno: " + std::to_string(errno));
+  window->map_base_ = static_cast<uint8_t *>(addr);
+  window->data_ = window->map_base_ + (offset - aligned_offset);
+  window->mapped_ = true;
+#else
+  auto realpath = FileUtils::GetRealPath(path_.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(realpath.has_value(), "Invalid file, failed to get the realpath of file: " + path_);
+  std::ifstream fin(realpath.value(), std::ios::in | std::ios::binary);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fin.good(), "Invalid file, failed to open file: " + path_ +
+                                                ". Please check file path, permission and open files limit.");
+  (void)fin.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+  window->buffer_.resize(size);
+  auto &io_read = fin.read(reinterpret_cast<char *>(window->buffer_.data()), size);
+  if (!io_read.good() || io_read.fail() || io_read.bad()) {
+    fin.close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file: " + path_);
+  }
+  fin.close();
+  window->data_ = window->buffer_.data();
+#endif
+  *window_ptr = window;
+  return Status::OK();
+}
+
+void ShardMmapFile::Advise(bool sequential) const {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mapped_ && map_base_ != nullptr) {
+    (void)madvise(map_base_, map_size_, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+  }
+#endif
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -17,6 +17,7 @@
 #include "minddata/mindrecord/include/shard_reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <thread>
 
 #include "utils/file_utils.h"
@@ -25,6 +26,10 @@
 
 namespace mindspore {
 namespace mindrecord {
+// position of the first index field in a row of labels, the leading columns are
+// ROW_GROUP_ID, PAGE_OFFSET_BLOB and PAGE_OFFSET_BLOB_END
+constexpr size_t kLabelFieldStart = 3;
+
 template <class Type>
 // convert the string to exactly number type (int32_t/int64_t/float/double)
 Type StringToNum(const std::string &str) {
@@ -83,9 +88,14 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
       *meta_data_ptr == *first_meta_data_ptr,
       "Invalid file, the metadata of mindrecord file: " + file +
         " is different from others, please make sure all the mindrecord files generated by the same script.");
+    // prefer the memory-mapped columnar index, the sqlite meta file is only opened when it is not available
+    auto columnar_index = OpenColumnarIndex(file);
     sqlite3 *db = nullptr;
-    RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    if (columnar_index == nullptr) {
+      RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    }
     database_paths_.push_back(db);
+    columnar_indexes_.push_back(columnar_index);
   }
   ShardHeader sh = ShardHeader();
   RETURN_IF_NOT_OK_MR(sh.BuildDataset(file_paths_, load_dataset));
@@ -142,6 +152,88 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
   return Status::OK();
 }
 
+std::shared_ptr<ShardColumnarIndex> ShardReader::OpenColumnarIndex(const std::string &file) {
+  std::shared_ptr<ShardColumnarIndex> columnar_index;
+  auto rc = ShardColumnarIndex::Open(file, &columnar_index);
+  if (rc.IsError()) {
+    MS_LOG(INFO) << "The columnar index of mindrecord file: " << file
+                 << " is not available, use the meta file instead. " << rc.GetErrDescription();
+    return nullptr;
+  }
+  std::shared_ptr<std::string> fn_ptr;
+  if (GetFileName(file, &fn_ptr).IsError() || columnar_index->GetShardName() != *fn_ptr) {
+    MS_LOG(WARNING) << "The columnar index of mindrecord file: " << file
+                    << " does not match the mindrecord file, use the meta file instead.";
+    return nullptr;
+  }
+  MS_LOG(DEBUG) << "Succeed to map columnar index, path: " << ShardColumnarIndex::GetIndexFileName(file);
+  return columnar_index;
+}
+
+Status ShardReader::GetColumnarCriteria(int shard_id, const std::pair<std::string, std::string> &criteria,
+                                        int *field_id, std::string *value) {
+  RETURN_UNEXPECTED_IF_NULL_MR(field_id);
+  RETURN_UNEXPECTED_IF_NULL_MR(value);
+  *field_id = -1;
+  *value = criteria.second;
+  if (criteria.first.empty()) {
+    return Status::OK();
+  }
+  std::shared_ptr<std::string> fn_ptr;
+  RETURN_IF_NOT_OK_MR(ShardIndexGenerator::GenerateFieldName(
+    std::make_pair(column_schema_id_[criteria.first], criteria.first), &fn_ptr));
+  *field_id = columnar_indexes_[shard_id]->GetFieldId(*fn_ptr);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(*field_id >= 0, "Invalid data, field: " + criteria.first +
+                                                    " can not be found in the columnar index of mindrecord file: " +
+                                                    file_paths_[shard_id]);
+  // index values of number fields are stored in json format, while sqlite compares them by value
+  auto schema = shard_header_->GetSchemas()[0]->GetSchema()["schema"];
+  if (schema.find(criteria.first) != schema.end() &&
+      kNumberFieldTypeSet.find(schema[criteria.first]["type"]) != kNumberFieldTypeSet.end()) {
+    try {
+      *value = json::parse(criteria.second).dump();
+    } catch (...) {
+      *value = criteria.second;
+    }
+  }
+  return Status::OK();
+}
+
+Status ShardReader::ParallelForShards(int shard_count, const std::function<Status(int)> &func) {
+  if (shard_count <= 0) {
+    return Status::OK();
+  }
+  // a bounded group of workers instead of one thread per shard, datasets may have thousands of shards
+  int num_workers = std::min(shard_count, static_cast<int>(GetMaxThreadNum()));
+  std::atomic<int> next_shard(0);
+  std::mutex status_mutex;
+  Status status = Status::OK();
+  auto worker = [&]() {
+    for (int shard_id = next_shard++; shard_id < shard_count; shard_id = next_shard++) {
+      auto rc = func(shard_id);
+      if (rc.IsError()) {
+        std::lock_guard<std::mutex> lck(status_mutex);
+        if (status.IsOk()) {
+          status = rc;
+        }
+      }
+    }
+  };
+  if (num_workers == 1) {
+    worker();
+    return status;
+  }
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    (void)threads.emplace_back(worker);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return status;
+}
+
 Status ShardReader::VerifyDataset(sqlite3 **db, const string &file) {
   std::string path_utf8 = "";
 #if defined(_WIN32) || defined(_WIN64)
@@ -225,7 +317,99 @@ Status ShardReader::Open(int n_consumer) {
     }
     MS_LOG(INFO) << "Succeed to open file, path: " << file;
   }
+  if (mmap_mode_) {
+    RETURN_IF_NOT_OK_MR(MapDataFiles());
+  }
+  RETURN_IF_NOT_OK_MR(OpenPrefetchFiles());
+  return Status::OK();
+}
+
+Status ShardReader::MapDataFiles() {
+#if defined(_WIN32) || defined(_WIN64)
+  // without mmap the whole data file would be loaded into memory
+  MS_LOG(WARNING) << "Mmap mode of mindrecord is not supported on Windows, read with file streams instead.";
+  mmap_mode_ = false;
+  return Status::OK();
+#else
+  // shuffled reads jump around the file, in which case read-ahead only wastes the page cache
+  bool sequential = std::none_of(operators_.begin(), operators_.end(), [](const std::shared_ptr<ShardOperator> &op) {
+    return std::dynamic_pointer_cast<ShardShuffle>(op) != nullptr;
+  });
+  data_files_.clear();
+  for (const auto &file : file_paths_) {
+    std::shared_ptr<ShardMmapFile> data_file;
+    // pages are handed out as tensors which may be modified in place, so the row groups are mapped copy-on-write
+    // one at a time, see GetRowGroupWindow
+    auto rc = ShardMmapFile::Open(file, &data_file, true);
+    if (rc.IsError()) {
+      MS_LOG(WARNING) << "Failed to map mindrecord file: " << file << ", read with file streams instead. "
+                      << rc.ToString();
+      data_files_.clear();
+      mmap_mode_ = false;
+      return Status::OK();
+    }
+    data_files_.push_back(data_file);
+  }
+  {
+    std::lock_guard<std::mutex> lock(windows_mutex_);
+    row_group_windows_.assign(data_files_.size(), {});
+    sequential_windows_ = sequential;
+  }
+  MS_LOG(INFO) << "Succeed to map " << data_files_.size() << " mindrecord files.";
   return Status::OK();
+#endif
+}
+
+Status ShardReader::OpenPrefetchFiles() {
+  async_reader_ = nullptr;
+  prefetch_files_.clear();
+  prefetch_end_ = 0;
+  // mapped blobs are read by page faults, and only the tasks of fast load mode are known before they are consumed
+  if (prefetch_depth_ <= 0 || mmap_mode_ || skip_blob_ || load_mode_ != LoadMode::kFast) {
+    return Status::OK();
+  }
+  for (const auto &file : file_paths_) {
+    std::shared_ptr<ShardPositionalFile> data_file;
+    RETURN_IF_NOT_OK_MR(ShardPositionalFile::Open(file, &data_file));
+    prefetch_files_.push_back(data_file);
+  }
+  async_reader_ =
+    std::make_shared<ShardAsyncReader>(std::min(prefetch_depth_, kMaxAsyncReadThreads), prefetch_depth_);
+  MS_LOG(INFO) << "Succeed to enable prefetch of mindrecord files, depth: " << prefetch_depth_;
+  return Status::OK();
+}
+
+void ShardReader::PrefetchTasks(int64_t task_id) {
+  std::lock_guard<std::mutex> lock(mtx_prefetch_);
+  // the consumers may jump ahead of the prefetched tasks, e.g. when the depth was exhausted
+  prefetch_end_ = std::max(prefetch_end_, task_id + 1);
+  int64_t limit = std::min(task_id + 1 + prefetch_depth_, static_cast<int64_t>(tasks_.Size()));
+  for (; prefetch_end_ < limit; ++prefetch_end_) {
+    TaskType task_type = TaskType::kCommonTask;
+    uint32_t shard_id = 0;
+    uint64_t file_offset = 0;
+    uint64_t blob_size = 0;
+    json var_fields;
+    // the error is raised when the task is consumed
+    if (LocateTaskBlob(prefetch_end_, 0, &task_type, &shard_id, &file_offset, &blob_size, &var_fields).IsError()) {
+      break;
+    }
+    if (task_type == TaskType::kPaddedTask || blob_size == 0 || shard_id >= prefetch_files_.size()) {
+      continue;
+    }
+    if (!async_reader_->TrySubmit(prefetch_files_[shard_id], file_offset, blob_size)) {
+      break;
+    }
+  }
+}
+
+void ShardReader::ResetPrefetch() {
+  if (async_reader_ == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mtx_prefetch_);
+  prefetch_end_ = 0;
+  async_reader_->Clear();
 }
 
 Status ShardReader::ExtendRandomFileStreams(const int n_new_consumers) {
@@ -309,6 +493,17 @@ Status ShardReader::ShrinkRandomFileStreams(const int n_remove_consumers) {
 }
 
 void ShardReader::FileStreamsOperator() {
+  // the mappings are released after the last tensor which refers to them is destroyed
+  data_files_.clear();
+  {
+    std::lock_guard<std::mutex> lock(windows_mutex_);
+    row_group_windows_.clear();
+  }
+  if (async_reader_ != nullptr) {
+    async_reader_->Stop();
+    async_reader_ = nullptr;
+  }
+  prefetch_files_.clear();
   for (int i = static_cast<int>(file_streams_.size()) - 1; i >= 0; --i) {
     if (file_streams_[i] != nullptr) {
       file_streams_[i]->close();
@@ -420,32 +615,8 @@ Status ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::string
         int raw_page_id = std::stoi(labels[i][3]);
         uint64_t label_start = std::stoull(labels[i][4]) + kInt64Len;
         uint64_t label_end = std::stoull(labels[i][5]);
-        CHECK_FAIL_RETURN_UNEXPECTED_MR(label_end >= label_start,
-                                        "The sample's end offset: " + std::to_string(label_end) +
-                                          " should >= start offset: " + std::to_string(label_start) + ", check fail.");
-        auto len = label_end - label_start;
-        auto label_raw = std::vector<uint8_t>(len);
-        auto &io_seekg = fs->seekg(page_size_ * raw_page_id + header_size_ + label_start, std::ios::beg);
-        if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-          fs->close();
-          RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
-        }
-        auto &io_read = fs->read(reinterpret_cast<char *>(&label_raw[0]), len);
-        if (!io_read.good() || io_read.fail() || io_read.bad()) {
-          fs->close();
-          RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
-        }
-        json label_json = json::from_msgpack(label_raw);
         json tmp;
-        if (!columns.empty()) {
-          for (const auto &col : columns) {
-            if (label_json.find(col) != label_json.end()) {
-              tmp[col] = label_json[col];
-            }
-          }
-        } else {
-          tmp = label_json;
-        }
+        RETURN_IF_NOT_OK_MR(ReadRawLabel(fs, raw_page_id, label_start, label_end, columns, &tmp));
         (*col_val_ptr)[shard_id].emplace_back(tmp);
       } else {
         json construct_json;
@@ -469,9 +640,110 @@ Status ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::string
   return Status::OK();
 }
 
+Status ShardReader::ReadRawLabel(std::shared_ptr<std::fstream> fs, int raw_page_id, uint64_t label_start,
+                                 uint64_t label_end, const std::vector<std::string> &columns, json *label) {
+  RETURN_UNEXPECTED_IF_NULL_MR(label);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(label_end >= label_start,
+                                  "The sample's end offset: " + std::to_string(label_end) +
+                                    " should >= start offset: " + std::to_string(label_start) + ", check fail.");
+  auto len = label_end - label_start;
+  auto label_raw = std::vector<uint8_t>(len);
+  auto &io_seekg = fs->seekg(page_size_ * raw_page_id + header_size_ + label_start, std::ios::beg);
+  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+    fs->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+  }
+  auto &io_read = fs->read(reinterpret_cast<char *>(&label_raw[0]), len);
+  if (!io_read.good() || io_read.fail() || io_read.bad()) {
+    fs->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+  }
+  json label_json = json::from_msgpack(label_raw);
+  if (!columns.empty()) {
+    json tmp;
+    for (const auto &col : columns) {
+      if (label_json.find(col) != label_json.end()) {
+        tmp[col] = label_json[col];
+      }
+    }
+    *label = std::move(tmp);
+  } else {
+    *label = std::move(label_json);
+  }
+  return Status::OK();
+}
+
+Status ShardReader::ReadRowsFromColumnarIndex(
+  int shard_id, const int32_t &consumer_id, int64_t row_id, const std::vector<std::string> &columns,
+  std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
+  std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
+  const auto &columnar_index = columnar_indexes_[shard_id];
+  RETURN_UNEXPECTED_IF_NULL_MR(columnar_index);
+  uint64_t begin = 0;
+  uint64_t end = columnar_index->GetNumRows();
+  if (row_id >= 0) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(columnar_index->FindRowById(static_cast<uint64_t>(row_id), &begin),
+                                    "[Internal ERROR] Failed to find row: " + std::to_string(row_id) +
+                                      " in the columnar index of mindrecord file: " + file_paths_[shard_id]);
+    end = begin + 1;
+  }
+  std::vector<int> field_ids;
+  if (all_in_index_) {
+    for (const auto &col : columns) {
+      std::shared_ptr<std::string> fn_ptr;
+      RETURN_IF_NOT_OK_MR(
+        ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[col], col), &fn_ptr));
+      int field_id = columnar_index->GetFieldId(*fn_ptr);
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(field_id >= 0, "[Internal ERROR] Field: " + col +
+                                                       " can not be found in the columnar index of mindrecord file: " +
+                                                       file_paths_[shard_id]);
+      field_ids.push_back(field_id);
+    }
+  }
+  auto schema = shard_header_->GetSchemas()[0]->GetSchema()["schema"];
+  auto fs = file_streams_random_[consumer_id][shard_id];
+  auto &offsets = (*offset_ptr)[shard_id];
+  auto &col_vals = (*col_val_ptr)[shard_id];
+  offsets.reserve(offsets.size() + end - begin);
+  col_vals.reserve(col_vals.size() + end - begin);
+  std::vector<std::string> label(kLabelFieldStart + field_ids.size());
+  try {
+    for (uint64_t row = begin; row < end; ++row) {
+      uint64_t offset_start = columnar_index->GetColumn(kIndexPageOffsetBlob, row) + kInt64Len;
+      uint64_t offset_end = columnar_index->GetColumn(kIndexPageOffsetBlobEnd, row);
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(offset_end >= offset_start,
+                                      "The sample's end offset: " + std::to_string(offset_end) +
+                                        " should >= start offset: " + std::to_string(offset_start) + ", check fail.");
+      (void)offsets.emplace_back(std::vector<uint64_t>{static_cast<uint64_t>(shard_id),
+                                                       columnar_index->GetColumn(kIndexRowGroupId, row), offset_start,
+                                                       offset_end});
+      json construct_json;
+      if (all_in_index_) {
+        for (size_t j = 0; j < field_ids.size(); ++j) {
+          label[kLabelFieldStart + j] = std::string(columnar_index->GetFieldValue(field_ids[j], row));
+        }
+        RETURN_IF_NOT_OK_MR(ConvertJsonValue(label, columns, schema, &construct_json));
+      } else {
+        auto raw_page_id = static_cast<int>(columnar_index->GetColumn(kIndexPageIdRaw, row));
+        uint64_t label_start = columnar_index->GetColumn(kIndexPageOffsetRaw, row) + kInt64Len;
+        uint64_t label_end = columnar_index->GetColumn(kIndexPageOffsetRawEnd, row);
+        RETURN_IF_NOT_OK_MR(ReadRawLabel(fs, raw_page_id, label_start, label_end, columns, &construct_json));
+      }
+      (void)col_vals.emplace_back(std::move(construct_json));
+    }
+  } catch (std::exception &e) {
+    fs->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Exception raised in ReadRowsFromColumnarIndex function, " +
+                                std::string(e.what()));
+  }
+  MS_LOG(DEBUG) << "Succeed to get " << (end - begin) << " records from shard " << std::to_string(shard_id)
+                << " columnar index.";
+  return Status::OK();
+}
+
 Status ShardReader::ConvertJsonValue(const std::vector<std::string> &label, const std::vector<std::string> &columns,
                                      const json &schema, json *value) {
-  constexpr int64_t index = 3;
+  constexpr int64_t index = kLabelFieldStart;
   for (unsigned int j = 0; j < columns.size(); ++j) {
     if (schema[columns[j]]["type"] == "int32") {
       (*value)[columns[j]] = StringToNum<int32_t>(label[j + index]);
@@ -525,15 +797,22 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   RETURN_IF_NOT_OK_MR(
     ShardIndexGenerator::GenerateFieldName(std::make_pair(index_columns[category_field], category_field), &fn_ptr));
   std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
-  std::vector<std::thread> threads = std::vector<std::thread>(shard_count_);
-  for (int x = 0; x < shard_count_; x++) {
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, sql, category_ptr);
-  }
-
-  for (int x = 0; x < shard_count_; x++) {
-    threads[x].join();
-  }
-  return Status::OK();
+  return ParallelForShards(shard_count_, [this, &sql, &fn_ptr, &category_ptr](int shard_id) {
+    const auto &columnar_index = columnar_indexes_[shard_id];
+    if (columnar_index == nullptr) {
+      GetClassesInShard(database_paths_[shard_id], shard_id, sql, category_ptr);
+      return Status::OK();
+    }
+    int field_id = columnar_index->GetFieldId(*fn_ptr);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(field_id >= 0, "[Internal ERROR] Field: " + *fn_ptr +
+                                                     " can not be found in the columnar index of mindrecord file: " +
+                                                     file_paths_[shard_id]);
+    std::set<std::string> categories;
+    columnar_index->GetDistinctFieldValues(field_id, &categories);
+    std::lock_guard<std::mutex> lck(shard_locker_);
+    category_ptr->insert(categories.begin(), categories.end());
+    return Status::OK();
+  });
 }
 
 void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
@@ -583,22 +862,12 @@ Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
 
   std::string sql = "SELECT " + fields + " FROM INDEXES ORDER BY ROW_ID ;";
 
-  std::vector<std::future<Status>> async_results;
-  auto status = Status::OK();
-  for (int x = 0; x < shard_count_; x++) {
-    async_results.push_back(std::async(std::launch::async, &ShardReader::ReadAllRowsInShard, this, x, 0, sql, columns,
-                                       offset_ptr, col_val_ptr));
-  }
-
-  for (auto i = 0; i < async_results.size(); i++) {
-    auto res = async_results[i].get();
-    if (res.IsError() && status.IsOk()) {
-      status = res;
+  RETURN_IF_NOT_OK_MR(ParallelForShards(shard_count_, [&](int shard_id) {
+    if (columnar_indexes_[shard_id] != nullptr) {
+      return ReadRowsFromColumnarIndex(shard_id, 0, -1, columns, offset_ptr, col_val_ptr);
     }
-  }
-  if (status.IsError()) {
-    return status;
-  }
+    return ReadAllRowsInShard(shard_id, 0, sql, columns, offset_ptr, col_val_ptr);
+  }));
   *row_group_ptr = std::make_shared<ROW_GROUPS>(std::move(*offset_ptr), std::move(*col_val_ptr));
   return Status::OK();
 }
@@ -611,6 +880,11 @@ Status ShardReader::ReadRowGroupByShardIDAndSampleID(const std::vector<std::stri
   auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
     shard_count_, std::vector<std::vector<uint64_t>>{});
   auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
+  if (columnar_indexes_[shard_id] != nullptr) {
+    RETURN_IF_NOT_OK_MR(ReadRowsFromColumnarIndex(shard_id, consumer_id, sample_id, columns, offset_ptr, col_val_ptr));
+    *row_group_ptr = std::make_shared<ROW_GROUPS>(std::move(*offset_ptr), std::move(*col_val_ptr));
+    return Status::OK();
+  }
   if (all_in_index_) {
     for (unsigned int i = 0; i < columns.size(); ++i) {
       fields += ',';
@@ -684,6 +958,31 @@ int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, c
 
 std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int shard_id,
                                                                const std::pair<std::string, std::string> &criteria) {
+  const auto &columnar_index = columnar_indexes_[shard_id];
+  if (columnar_index != nullptr) {
+    int field_id = -1;
+    std::string value;
+    auto rc = GetColumnarCriteria(shard_id, criteria, &field_id, &value);
+    if (rc.IsError()) {
+      MS_LOG(EXCEPTION) << rc.GetErrDescription();
+    }
+    std::vector<std::vector<uint64_t>> res;
+    auto rows = columnar_index->GetRowsInBlobPage(page_id);
+    for (auto iter = rows.first; iter != rows.second; ++iter) {
+      if (!columnar_index->MatchCriteria(field_id, value, *iter)) {
+        continue;
+      }
+      uint64_t offset_start = columnar_index->GetColumn(kIndexPageOffsetBlob, *iter) + kInt64Len;
+      uint64_t offset_end = columnar_index->GetColumn(kIndexPageOffsetBlobEnd, *iter);
+      if (offset_end < offset_start) {
+        MS_LOG(EXCEPTION) << "The sample's end offset: " << std::to_string(offset_end)
+                          << " should >= start offset: " << std::to_string(offset_start) << ", check fail.";
+      }
+      (void)res.emplace_back(std::vector<uint64_t>{offset_start, offset_end});
+    }
+    return res;
+  }
+
   auto db = database_paths_[shard_id];
 
   std::string sql = "SELECT PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END FROM INDEXES WHERE PAGE_ID_BLOB = :page_id_blob";
@@ -755,6 +1054,26 @@ std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int
 Status ShardReader::GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                                        std::shared_ptr<std::vector<uint64_t>> *pages_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(pages_ptr);
+  const auto &columnar_index = columnar_indexes_[shard_id];
+  if (columnar_index != nullptr) {
+    int field_id = -1;
+    std::string value;
+    RETURN_IF_NOT_OK_MR(GetColumnarCriteria(shard_id, criteria, &field_id, &value));
+    std::set<uint64_t> page_ids;
+    if (field_id < 0) {
+      for (uint64_t row = 0; row < columnar_index->GetNumRows(); ++row) {
+        (void)page_ids.insert(columnar_index->GetColumn(kIndexPageIdBlob, row));
+      }
+    } else {
+      auto rows = columnar_index->GetRowsByFieldValue(field_id, value);
+      for (auto iter = rows.first; iter != rows.second; ++iter) {
+        (void)page_ids.insert(columnar_index->GetColumn(kIndexPageIdBlob, *iter));
+      }
+    }
+    MS_LOG(DEBUG) << "Succeed to get " << page_ids.size() << " pages from columnar index.";
+    (*pages_ptr)->insert((*pages_ptr)->end(), page_ids.begin(), page_ids.end());
+    return Status::OK();
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql = "SELECT DISTINCT PAGE_ID_BLOB FROM INDEXES WHERE 1 = 1 ";
@@ -928,6 +1247,23 @@ Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vect
                                       const std::pair<std::string, std::string> &criteria,
                                       std::shared_ptr<std::vector<json>> *labels_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
+  const auto &columnar_index = columnar_indexes_[shard_id];
+  if (columnar_index != nullptr) {
+    int field_id = -1;
+    std::string value;
+    RETURN_IF_NOT_OK_MR(GetColumnarCriteria(shard_id, criteria, &field_id, &value));
+    std::vector<std::vector<std::string>> label_offsets;
+    auto rows = columnar_index->GetRowsInBlobPage(page_id);
+    for (auto iter = rows.first; iter != rows.second; ++iter) {
+      if (columnar_index->MatchCriteria(field_id, value, *iter)) {
+        (void)label_offsets.emplace_back(
+          std::vector<std::string>{std::to_string(columnar_index->GetColumn(kIndexPageIdRaw, *iter)),
+                                   std::to_string(columnar_index->GetColumn(kIndexPageOffsetRaw, *iter)),
+                                   std::to_string(columnar_index->GetColumn(kIndexPageOffsetRawEnd, *iter))});
+      }
+    }
+    return GetLabelsFromBinaryFile(shard_id, columns, label_offsets, labels_ptr);
+  }
   // get page info from sqlite
   auto db = database_paths_[shard_id];
   std::string sql =
@@ -981,6 +1317,7 @@ Status ShardReader::GetLabels(int page_id, int shard_id, const std::vector<std::
   RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
   if (all_in_index_) {
     auto db = database_paths_[shard_id];
+    const auto &columnar_index = columnar_indexes_[shard_id];
     std::string fields;
     for (unsigned int i = 0; i < columns.size(); ++i) {
       if (i > 0) {
@@ -994,7 +1331,34 @@ Status ShardReader::GetLabels(int page_id, int shard_id, const std::vector<std::
     }
     auto labels = std::make_shared<std::vector<std::vector<std::string>>>();
     std::string sql = "SELECT " + fields + " FROM INDEXES WHERE PAGE_ID_BLOB = :page_id_blob";
-    if (!criteria.first.empty()) {
+    if (columnar_index != nullptr) {
+      int criteria_id = -1;
+      std::string value;
+      RETURN_IF_NOT_OK_MR(GetColumnarCriteria(shard_id, criteria, &criteria_id, &value));
+      std::vector<int> field_ids;
+      for (const auto &col : columns) {
+        std::shared_ptr<std::string> fn_ptr;
+        RETURN_IF_NOT_OK_MR(
+          ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[col], col), &fn_ptr));
+        int field_id = columnar_index->GetFieldId(*fn_ptr);
+        CHECK_FAIL_RETURN_UNEXPECTED_MR(field_id >= 0,
+                                        "[Internal ERROR] Field: " + col +
+                                          " can not be found in the columnar index of mindrecord file: " +
+                                          file_paths_[shard_id]);
+        field_ids.push_back(field_id);
+      }
+      auto rows = columnar_index->GetRowsInBlobPage(page_id);
+      for (auto iter = rows.first; iter != rows.second; ++iter) {
+        if (!columnar_index->MatchCriteria(criteria_id, value, *iter)) {
+          continue;
+        }
+        std::vector<std::string> label;
+        for (const auto field_id : field_ids) {
+          (void)label.emplace_back(columnar_index->GetFieldValue(field_id, *iter));
+        }
+        labels->push_back(std::move(label));
+      }
+    } else if (!criteria.first.empty()) {
       sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + ":criteria;";
       RETURN_IF_NOT_OK_MR(QueryWithPageIdBlobAndCriteria(db, sql, page_id, criteria.second, labels));
     } else {
@@ -1082,30 +1446,57 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   (void)ShardIndexGenerator::GenerateFieldName(std::make_pair(map_schema_id_fields[category_field], category_field),
                                                &fn_ptr);
   std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
-  std::vector<std::thread> threads = std::vector<std::thread>(shard_count);
   auto category_ptr = std::make_shared<std::set<std::string>>();
-  sqlite3 *db = nullptr;
-  for (int x = 0; x < shard_count; x++) {
+  auto rc = ParallelForShards(static_cast<int>(shard_count), [this, &sql, &fn_ptr, &category_ptr](int shard_id) {
+    if (static_cast<size_t>(shard_id) < columnar_indexes_.size() && columnar_indexes_[shard_id] != nullptr) {
+      int field_id = columnar_indexes_[shard_id]->GetFieldId(*fn_ptr);
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(field_id >= 0, "[Internal ERROR] Field: " + *fn_ptr +
+                                                       " can not be found in the columnar index of mindrecord file: " +
+                                                       file_paths_[shard_id]);
+      std::set<std::string> categories;
+      columnar_indexes_[shard_id]->GetDistinctFieldValues(field_id, &categories);
+      std::lock_guard<std::mutex> lck(shard_locker_);
+      category_ptr->insert(categories.begin(), categories.end());
+      return Status::OK();
+    }
     std::string path_utf8 = "";
 #if defined(_WIN32) || defined(_WIN64)
-    path_utf8 = FileUtils::GB2312ToUTF_8((file_paths_[x] + ".db").data());
+    path_utf8 = FileUtils::GB2312ToUTF_8((file_paths_[shard_id] + ".db").data());
 #endif
     if (path_utf8.empty()) {
-      path_utf8 = file_paths_[x] + ".db";
+      path_utf8 = file_paths_[shard_id] + ".db";
     }
 
-    int rc = sqlite3_open_v2(path_utf8.data(), &db, SQLITE_OPEN_READONLY, nullptr);
-    if (SQLITE_OK != rc) {
-      MS_LOG(ERROR) << "[Internal ERROR] Failed to open meta file: " << file_paths_[x] + ".db, " << sqlite3_errmsg(db);
-      return -1;
+    sqlite3 *db = nullptr;
+    int ret = sqlite3_open_v2(path_utf8.data(), &db, SQLITE_OPEN_READONLY, nullptr);
+    if (SQLITE_OK != ret) {
+      std::string err_msg = "[Internal ERROR] Failed to open meta file: " + file_paths_[shard_id] + ".db, " +
+                            std::string(sqlite3_errmsg(db));
+      sqlite3_close(db);
+      RETURN_STATUS_UNEXPECTED_MR(err_msg);
     }
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, db, x, sql, category_ptr);
-  }
-
-  for (int x = 0; x < shard_count; x++) {
-    threads[x].join();
+    std::vector<std::vector<std::string>> categories;
+    char *errmsg = nullptr;
+    ret = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &categories, &errmsg);
+    if (ret != SQLITE_OK) {
+      std::string err_msg = "[Internal ERROR] Failed to execute the sql [ " + sql + " ] while reading meta file, " +
+                            std::string(errmsg == nullptr ? "" : errmsg);
+      sqlite3_free(errmsg);
+      sqlite3_close(db);
+      RETURN_STATUS_UNEXPECTED_MR(err_msg);
+    }
+    sqlite3_free(errmsg);
+    sqlite3_close(db);
+    std::lock_guard<std::mutex> lck(shard_locker_);
+    for (const auto &category : categories) {
+      (void)category_ptr->emplace(category[0]);
+    }
+    return Status::OK();
+  });
+  if (rc.IsError()) {
+    MS_LOG(ERROR) << rc.GetErrDescription();
+    return -1;
   }
-  sqlite3_close(db);
   return category_ptr->size();
 }
 
@@ -1189,6 +1580,14 @@ Status ShardReader::Open(const std::vector<std::string> &file_paths, bool load_d
 
   selected_columns_ = selected_columns;
   RETURN_IF_NOT_OK_MR(CheckColumnList(selected_columns_));
+  // the blob of a sample is one contiguous range, it can be skipped only when none of its fields is selected
+  auto blob_fields = GetBlobFields().second;
+  auto is_blob_field = [&blob_fields](const std::string &col) {
+    return std::find(blob_fields.begin(), blob_fields.end(), col) != blob_fields.end();
+  };
+  skip_blob_ =
+    !selected_columns_.empty() && std::none_of(selected_columns_.begin(), selected_columns_.end(), is_blob_field);
+  blob_bytes_skipped_ = 0;
 
   // Initialize argument
   shard_count_ = static_cast<int>(file_paths_.size());
@@ -1313,27 +1712,21 @@ Status ShardReader::CreateTasksByRow(const std::vector<std::tuple<int, int, int,
   // Init the tasks_ size
   tasks_.ResizeTask(sample_count);
 
-  // Init the task threads, maybe use ThreadPool is better
-  std::vector<std::thread> init_tasks_thread(shard_count_);
-
-  uint32_t current_offset = 0;
-  for (uint32_t shard_id = 0; shard_id < shard_count_; shard_id++) {
-    init_tasks_thread[shard_id] = std::thread([this, &offsets, &local_columns, shard_id, current_offset]() {
-      auto offset = current_offset;
-      for (uint32_t i = 0; i < offsets[shard_id].size(); i += 1) {
-        tasks_.InsertTask(offset, TaskType::kCommonTask, offsets[shard_id][i][0], offsets[shard_id][i][1],
-                          std::vector<uint64_t>{offsets[shard_id][i][2], offsets[shard_id][i][3]},
-                          local_columns[shard_id][i]);
-        offset++;
-      }
-    });
-    current_offset += offsets[shard_id].size();
-  }
-
-  for (uint32_t shard_id = 0; shard_id < shard_count_; shard_id++) {
-    init_tasks_thread[shard_id].join();
-  }
-  return Status::OK();
+  // the first task position of each shard
+  std::vector<uint32_t> shard_offsets(shard_count_, 0);
+  for (int shard_id = 1; shard_id < shard_count_; shard_id++) {
+    shard_offsets[shard_id] = shard_offsets[shard_id - 1] + offsets[shard_id - 1].size();
+  }
+  return ParallelForShards(shard_count_, [this, &offsets, &local_columns, &shard_offsets](int shard_id) {
+    auto offset = shard_offsets[shard_id];
+    for (uint32_t i = 0; i < offsets[shard_id].size(); i += 1) {
+      tasks_.InsertTask(offset, TaskType::kCommonTask, offsets[shard_id][i][0], offsets[shard_id][i][1],
+                        std::vector<uint64_t>{offsets[shard_id][i][2], offsets[shard_id][i][3]},
+                        local_columns[shard_id][i]);
+      offset++;
+    }
+    return Status::OK();
+  });
 }
 
 Status ShardReader::CreateLazyTasksByRow(const std::vector<std::tuple<int, int, int, uint64_t>> &row_group_summary,
@@ -1345,28 +1738,19 @@ Status ShardReader::CreateLazyTasksByRow(const std::vector<std::tuple<int, int,
   // Init the tasks_ size
   tasks_.ResizeTask(sample_count);
 
-  // Init the task threads, maybe use ThreadPool is better
-  std::vector<std::thread> init_tasks_thread(shard_count_);
-
-  for (uint32_t shard_id = 0; shard_id < shard_count_; shard_id++) {
+  return ParallelForShards(shard_count_, [this](int shard_id) {
     // the offset indicate the shard start
     uint32_t current_offset = shard_id == 0 ? 0 : shard_sample_count_[shard_id - 1];
 
     // the count indicate the number of samples in the shard
     uint32_t shard_count =
       shard_id == 0 ? shard_sample_count_[0] : shard_sample_count_[shard_id] - shard_sample_count_[shard_id - 1];
-    init_tasks_thread[shard_id] = std::thread([this, shard_id, current_offset, shard_count]() {
-      for (uint32_t i = current_offset; i < shard_count + current_offset; ++i) {
-        // here "i - current_offset" indicate the sample id in the shard
-        tasks_.InsertTask(i, TaskType::kCommonTask, shard_id, i - current_offset, {}, json());
-      }
-    });
-  }
-
-  for (uint32_t shard_id = 0; shard_id < shard_count_; shard_id++) {
-    init_tasks_thread[shard_id].join();
-  }
-  return Status::OK();
+    for (uint32_t i = current_offset; i < shard_count + current_offset; ++i) {
+      // here "i - current_offset" indicate the sample id in the shard
+      tasks_.InsertTask(i, TaskType::kCommonTask, shard_id, i - current_offset, {}, json());
+    }
+    return Status::OK();
+  });
 }
 
 Status ShardReader::CreateSlowTasksByRow() {
@@ -1449,9 +1833,13 @@ Status ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, uint
   return Status::OK();
 }
 
-Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
-                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+Status ShardReader::LocateTaskBlob(int64_t task_id, uint32_t consumer_id, TaskType *task_type, uint32_t *shard_id,
+                                   uint64_t *file_offset, uint64_t *blob_size, json *var_fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_type);
+  RETURN_UNEXPECTED_IF_NULL_MR(shard_id);
+  RETURN_UNEXPECTED_IF_NULL_MR(file_offset);
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_size);
+  RETURN_UNEXPECTED_IF_NULL_MR(var_fields);
   if (load_mode_ == LoadMode::kFast || load_mode_ == LoadMode::kLazy) {
     // All tasks are done
     CHECK_FAIL_RETURN_UNEXPECTED_MR(task_id < tasks_.Size(), "[Internal ERROR] 'task_id': " + std::to_string(task_id) +
@@ -1463,23 +1851,19 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
         " is out of bound: " + std::to_string(num_padded_ + shard_sample_count_[shard_sample_count_.size() - 1]));
   }
 
-  uint32_t shard_id = 0;
   uint32_t group_id = 0;
   uint32_t blob_start = 0;
   uint32_t blob_end = 0;
-  json var_fields;
   // Pick up task from task list
   ShardTask task = tasks_.GetTaskByID(task_id);
 
   // check task type
-  auto task_type = std::get<0>(task);
-  if (task_type == TaskType::kPaddedTask) {
-    *task_content_ptr =
-      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+  *task_type = std::get<0>(task);
+  if (*task_type == TaskType::kPaddedTask) {
     return Status::OK();
   }
 
-  shard_id = std::get<0>(std::get<1>(task));  // shard id
+  *shard_id = std::get<0>(std::get<1>(task));  // shard id
 
   if (load_mode_ == LoadMode::kLazy || load_mode_ == LoadMode::kSlow) {
     // get scalar variable fields by sample id
@@ -1488,40 +1872,71 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
     // read the meta from index
     std::shared_ptr<ROW_GROUPS> row_group_ptr;
     RETURN_IF_NOT_OK_MR(
-      ReadRowGroupByShardIDAndSampleID(selected_columns_, shard_id, consumer_id, sample_id_in_shard, &row_group_ptr));
+      ReadRowGroupByShardIDAndSampleID(selected_columns_, *shard_id, consumer_id, sample_id_in_shard, &row_group_ptr));
     auto &offsets = std::get<0>(*row_group_ptr);
     auto &local_columns = std::get<1>(*row_group_ptr);
 
-    group_id = offsets[shard_id][0][1];       // group_id
-    blob_start = offsets[shard_id][0][2];     // blob start
-    blob_end = offsets[shard_id][0][3];       // blob end
-    var_fields = local_columns[shard_id][0];  // scalar variable field
+    group_id = offsets[*shard_id][0][1];                  // group_id
+    blob_start = offsets[*shard_id][0][2];                // blob start
+    blob_end = offsets[*shard_id][0][3];                  // blob end
+    *var_fields = std::move(local_columns[*shard_id][0]);  // scalar variable field
   } else {
     group_id = std::get<1>(std::get<1>(task));  // group id
     blob_start = std::get<2>(task)[0];          // blob start
     blob_end = std::get<2>(task)[1];            // blob end
-    var_fields = std::get<3>(task);             // scalar variable field
+    *var_fields = std::get<3>(task);            // scalar variable field
   }
 
-  // read the blob from data file
+  // locate the blob in data file
   std::shared_ptr<Page> page_ptr;
-  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, shard_id, &page_ptr));
+  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, *shard_id, &page_ptr));
   MS_LOG(DEBUG) << "[Internal ERROR] Success to get page by group id: " << group_id;
 
-  // Pack image list
-  std::vector<uint8_t> images(blob_end - blob_start);
-  auto file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  *file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  *blob_size = blob_end - blob_start;
+  return Status::OK();
+}
 
-  auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
-  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
+                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(
+    LocateTaskBlob(task_id, consumer_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr =
+      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+    return Status::OK();
   }
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_end - blob_start);
-  if (!io_read.good() || io_read.fail() || io_read.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+
+  // Pack image list
+  std::vector<uint8_t> images;
+  bool prefetched = false;
+  if (skip_blob_) {
+    // none of the fields in the blob is selected
+    (void)blob_bytes_skipped_.fetch_add(blob_size, std::memory_order_relaxed);
+  } else if (async_reader_ != nullptr && shard_id < prefetch_files_.size()) {
+    RETURN_IF_NOT_OK_MR(async_reader_->Take(prefetch_files_[shard_id], file_offset, blob_size, &images, &prefetched));
+    prefetched = prefetched && images.size() == blob_size;
+    PrefetchTasks(task_id);
+  }
+  if (!skip_blob_ && !prefetched) {
+    images.resize(blob_size);
+    auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
+    if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+      file_streams_random_[consumer_id][shard_id]->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+    }
+    auto &io_read =
+      file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_size);
+    if (!io_read.good() || io_read.fail() || io_read.bad()) {
+      file_streams_random_[consumer_id][shard_id]->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+    }
   }
 
   // Deliver batch data to output map
@@ -1645,6 +2060,82 @@ Status ShardReader::GetNextById(const int64_t &task_id, const int32_t &consumer_
   return Status::OK();
 }
 
+Status ShardReader::GetNextMappedById(const int64_t &task_id, const int32_t &consumer_id,
+                                      std::shared_ptr<MAPPED_TASK_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  if (interrupt_) {
+    return Status::OK();
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(mmap_mode_, "[Internal ERROR] GetNextMappedById() is only available in mmap mode.");
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(
+    LocateTaskBlob(task_id, consumer_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  std::vector<std::tuple<ShardBlobView, json>> batch;
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr = std::make_shared<MAPPED_TASK_CONTENT>(TaskType::kPaddedTask, std::move(batch));
+    return Status::OK();
+  }
+
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_id < data_files_.size(),
+                                  "[Internal ERROR] 'shard_id': " + std::to_string(shard_id) +
+                                    " is out of bound: " + std::to_string(data_files_.size()));
+  const auto &file = data_files_[shard_id];
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(
+    file_offset <= file->Size() && blob_size <= file->Size() - file_offset,
+    "Invalid data, the blob is out of the range of mindrecord file: " + file->GetPath() +
+      ", offset: " + std::to_string(file_offset) + ", size: " + std::to_string(blob_size));
+  ShardBlobView view;
+  if (skip_blob_) {
+    // an empty view never faults the pages of the blob in
+    (void)blob_bytes_skipped_.fetch_add(blob_size, std::memory_order_relaxed);
+  } else {
+    std::shared_ptr<ShardMmapFile> window;
+    RETURN_IF_NOT_OK_MR(GetRowGroupWindow(shard_id, file_offset, blob_size, &window));
+    view.data = window->Data() + (file_offset - window->Offset());
+    view.file = std::move(window);
+    view.size = blob_size;
+  }
+  batch.emplace_back(std::move(view), std::move(var_fields));
+  *task_content_ptr = std::make_shared<MAPPED_TASK_CONTENT>(TaskType::kCommonTask, std::move(batch));
+  return Status::OK();
+}
+
+Status ShardReader::GetRowGroupWindow(uint32_t shard_id, uint64_t file_offset, uint64_t blob_size,
+                                      std::shared_ptr<ShardMmapFile> *window_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(window_ptr);
+  const auto &file = data_files_[shard_id];
+  // a blob page holds one row group, the window covers the page unless the blob runs past it
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(file_offset >= header_size_ && page_size_ > 0,
+                                  "Invalid data, the blob is out of the pages of mindrecord file: " + file->GetPath() +
+                                    ", offset: " + std::to_string(file_offset));
+  const uint64_t group_offset = header_size_ + (file_offset - header_size_) / page_size_ * page_size_;
+  const uint64_t group_size =
+    std::max(std::min(page_size_, file->Size() - group_offset), file_offset + blob_size - group_offset);
+
+  std::lock_guard<std::mutex> lock(windows_mutex_);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_id < row_group_windows_.size(),
+                                  "[Internal ERROR] 'shard_id': " + std::to_string(shard_id) +
+                                    " is out of bound: " + std::to_string(row_group_windows_.size()));
+  auto &windows = row_group_windows_[shard_id];
+  auto iter = windows.find(group_offset);
+  if (iter != windows.end()) {
+    auto window = iter->second.lock();
+    if (window != nullptr && window->Size() >= group_size) {
+      *window_ptr = std::move(window);
+      return Status::OK();
+    }
+  }
+  // the window is unmapped after the last tensor which refers to its rows is destroyed
+  RETURN_IF_NOT_OK_MR(file->MapWindow(group_offset, group_size, window_ptr));
+  (*window_ptr)->Advise(sequential_windows_);
+  windows[group_offset] = *window_ptr;
+  return Status::OK();
+}
+
 Status ShardReader::UnCompressBlob(const std::vector<uint8_t> &raw_blob_data,
                                    std::shared_ptr<std::vector<std::vector<uint8_t>>> *blob_data_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(blob_data_ptr);
@@ -1680,6 +2171,7 @@ void ShardReader::Reset() {
     deliver_id_ = 0;
   }
   cv_delivery_.notify_all();
+  ResetPrefetch();
 }
 
 void ShardReader::ShuffleTask() {
@@ -1710,6 +2202,7 @@ void ShardReader::ShuffleTask() {
   } else {
     tasks_.generator_ids_.ResetShardIndexAndID();
   }
+  ResetPrefetch();
 }
 
 const std::vector<int64_t> *ShardReader::GetSampleIds() {
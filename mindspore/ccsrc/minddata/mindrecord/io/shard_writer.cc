@@ -15,6 +15,7 @@
  */
 
 #include "minddata/mindrecord/include/shard_writer.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
@@ -103,6 +104,11 @@ Status ShardWriter::OpenDataFiles(bool append, bool overwrite) {
           if (res2 == 0) {
             MS_LOG(WARNING) << "Succeed to remove the old mindrecord metadata files, path: " << file + ".db";
           }
+          auto columnar_index_file = ShardColumnarIndex::GetIndexFileName(whole_path.value());
+          if (std::remove(columnar_index_file.c_str()) == 0) {
+            MS_LOG(WARNING) << "Succeed to remove the old mindrecord columnar index files, path: "
+                            << ShardColumnarIndex::GetIndexFileName(file);
+          }
         } else {
           RETURN_STATUS_UNEXPECTED_MR(
             "Invalid file, mindrecord files already exist. Please check file path: " + file +
@@ -152,6 +158,20 @@ Status ShardWriter::RemoveLockFile() {
   return Status::OK();
 }
 
+Status ShardWriter::RemoveColumnarIndexFiles() {
+  for (const auto &file : file_paths_) {
+    auto columnar_index_file = ShardColumnarIndex::GetIndexFileName(file);
+    if (std::remove(columnar_index_file.c_str()) == 0) {
+      MS_LOG(INFO) << "Succeed to remove the stale mindrecord columnar index file, path: " << columnar_index_file;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(!std::ifstream(columnar_index_file) == true,
+                                    "Invalid file, failed to remove the stale mindrecord columnar index file. Please "
+                                    "check file path and permission: " +
+                                      columnar_index_file);
+  }
+  return Status::OK();
+}
+
 Status ShardWriter::InitLockFile() {
   CHECK_FAIL_RETURN_UNEXPECTED_MR(file_paths_.size() != 0, "[Internal ERROR] 'file_paths_' is not initialized.");
 
@@ -202,6 +222,8 @@ Status ShardWriter::Commit() {
   }
   RETURN_IF_NOT_OK_MR(WriteShardHeader());
   MS_LOG(INFO) << "Succeed to write meta data.";
+  // The columnar index is written again by ShardIndexGenerator
+  RETURN_IF_NOT_OK_MR(RemoveColumnarIndexFiles());
   // Remove lock file
   RETURN_IF_NOT_OK_MR(RemoveLockFile());
 
@@ -39,6 +39,10 @@ class BACKEND_EXPORT CPUMemoryPool : public DynamicMemPoolBestFit {
   size_t free_mem_size() override;
   std::string GetMemoryPoolType() const override { return "CPU"; }
 
+ protected:
+  // The kernels of the actors alloc and free their outputs on many threads.
+  const bool IsEnableThreadCache() const override { return true; }
+
  private:
   CPUMemoryPool() = default;
   DISABLE_COPY_AND_ASSIGN(CPUMemoryPool);
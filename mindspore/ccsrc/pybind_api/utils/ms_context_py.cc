@@ -87,6 +87,7 @@ void RegMsContext(const py::module *m) {
     .value("mode", MsCtxParam::MS_CTX_EXECUTION_MODE)
     .value("device_target", MsCtxParam::MS_CTX_DEVICE_TARGET)
     .value("inter_op_parallel_num", MsCtxParam::MS_CTX_INTER_OP_PARALLEL_NUM)
+    .value("intra_op_parallel_num", MsCtxParam::MS_CTX_INTRA_OP_PARALLEL_NUM)
     .value("runtime_num_threads", MsCtxParam::MS_CTX_RUNTIME_NUM_THREADS)
     .value("_graph_memory_max_size", MsCtxParam::MS_CTX_GRAPH_MEMORY_MAX_SIZE)
     .value("print_file_path", MsCtxParam::MS_CTX_PRINT_FILE_PATH)
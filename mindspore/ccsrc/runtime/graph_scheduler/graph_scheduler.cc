@@ -458,6 +458,24 @@ void GraphScheduler::Initialize() {
     MS_LOG(INTERNAL_EXCEPTION) << "#dmsg#Runtime error info:#dmsg#Actor manager init failed.";
   }
   default_actor_thread_num_ = actor_thread_num;
+  auto thread_pool = actor_manager->GetActorThreadPool();
+  MS_EXCEPTION_IF_NULL(thread_pool);
+  // The idle threads steal the uneven kernel splits of the busy threads, and park sooner when there is no work.
+  if (common::GetEnv("MS_DEV_ENABLE_WORK_STEALING") == "1") {
+    thread_pool->SetWorkStealing(true);
+    MS_LOG(INFO) << "Enable the work stealing of the actor thread pool.";
+  }
+  // The kernels running on the actor threads at the same time share the kernel threads as the helpers of their
+  // parallel regions, and each kernel takes at most intra_op_parallel_num threads.
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  auto intra_op_parallel_num = context_ptr->get_param<uint32_t>(MS_CTX_INTRA_OP_PARALLEL_NUM);
+  if (intra_op_parallel_num > 0) {
+    auto kernel_thread_num = actor_and_kernel_thread_num - actor_thread_num;
+    thread_pool->SetParallelBudget(static_cast<int>(kernel_thread_num), static_cast<int>(intra_op_parallel_num));
+    MS_LOG(INFO) << "The parallel budget of the kernels: " << kernel_thread_num
+                 << ", the intra op parallel num: " << intra_op_parallel_num;
+  }
   common::SetOMPThreadNum();
   MS_LOG(INFO) << "The actor thread number: " << actor_thread_num
                << ", the kernel thread number: " << (actor_and_kernel_thread_num - actor_thread_num);
@@ -710,11 +728,16 @@ void GraphScheduler::Schedule(const ActorSet *actor_set) {
   // Schedule actors.
   auto actor_manager = ActorMgr::GetActorMgrRef();
   MS_EXCEPTION_IF_NULL(actor_manager);
+  // The lock-free mailbox saves the lock and the list node of every message sent between the actors.
+  static const bool enable_mpsc_mailbox = common::GetEnv("MS_DEV_ENABLE_MPSC_MAILBOX") == "1";
 
   for (auto actor : actors) {
     MS_EXCEPTION_IF_NULL(actor);
     // The sub actors in the fusion actor do not participate in message interaction.
     if (actor->parent_fusion_actor_ == nullptr) {
+      if (enable_mpsc_mailbox) {
+        actor->set_mailbox_type(MailBoxType::kMpsc);
+      }
       (void)actor_manager->Spawn(actor);
     } else {
       actor->Init();
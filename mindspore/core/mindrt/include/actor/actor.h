@@ -87,6 +87,10 @@ class MS_CORE_API ActorBase {
   inline void set_actor_mgr(const std::shared_ptr<ActorMgr> &mgr) { actor_mgr_ = mgr; }
   inline std::shared_ptr<ActorMgr> get_actor_mgr() const { return actor_mgr_; }
 
+  // Select the mailbox created when the actor is spawned, it takes effect for the actors sharing the thread pool.
+  inline void set_mailbox_type(MailBoxType type) { mailbox_type_ = type; }
+  inline MailBoxType get_mailbox_type() const { return mailbox_type_; }
+
  protected:
   using ActorFunction = std::function<void(const std::unique_ptr<MessageBase> &msg)>;
 
@@ -216,6 +220,7 @@ class MS_CORE_API ActorBase {
 
   ActorThreadPool *pool_{nullptr};
   std::shared_ptr<ActorMgr> actor_mgr_;
+  MailBoxType mailbox_type_{MailBoxType::kDefault};
 };
 using ActorReference = std::shared_ptr<ActorBase>;
 };  // namespace mindspore
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_MSG_H
 #define MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_MSG_H
 
+#include <atomic>
 #include <utility>
 #include <string>
 
@@ -88,6 +89,11 @@ class MessageBase {
 
   // The id of remote function to call.
   uint32_t func_id_;
+
+ private:
+  friend class MpscMailBox;
+  // The next message in the mailbox of MpscMailBox.
+  std::atomic<MessageBase *> mailboxNext{nullptr};
 };
 }  // namespace mindspore
 
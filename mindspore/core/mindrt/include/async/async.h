@@ -17,6 +17,8 @@
 #ifndef MINDSPORE_CORE_MINDRT_INCLUDE_ASYNC_ASYNC_H
 #define MINDSPORE_CORE_MINDRT_INCLUDE_ASYNC_ASYNC_H
 
+#include <cstddef>
+#include <new>
 #include <tuple>
 #include <memory>
 #include <utility>
@@ -30,12 +32,33 @@
 namespace mindspore {
 using MessageHandler = std::function<void(ActorBase *)>;
 
+// The memory of the messages of Async. A thread keeps the messages it frees in a free list, at most
+// kMaxPooledMessages of them, and allocates the messages it sends from the list, so that the actors exchanging
+// messages on the threads of a pool rarely go to the heap.
+class MS_CORE_API MessagePool {
+ public:
+  static constexpr size_t kMaxPooledMessages = 1024;
+  // Return nullptr if the memory can not be allocated.
+  static void *Alloc(std::size_t size) noexcept;
+  static void Free(void *ptr, std::size_t size) noexcept;
+};
+
 class MessageAsync : public MessageBase {
  public:
   explicit MessageAsync(MessageHandler &&h) : MessageBase("Async", Type::KASYNC), handler(h) {}
   virtual ~MessageAsync() = default;
   void Run(ActorBase *actor) override { (handler)(actor); }
 
+  static void *operator new(std::size_t size) {
+    void *ptr = MessagePool::Alloc(size);
+    return ptr != nullptr ? ptr : ::operator new(size);
+  }
+  static void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return MessagePool::Alloc(size); }
+  static void operator delete(void *ptr, std::size_t size) noexcept { MessagePool::Free(ptr, size); }
+  static void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+    MessagePool::Free(ptr, sizeof(MessageAsync));
+  }
+
  private:
   MessageHandler handler;
 };
@@ -252,7 +252,12 @@ AID ActorMgr::Spawn(const ActorReference &actor, bool shareThread) {
   MS_LOG(DEBUG) << "ACTOR was spawned,a=" << actor->GetAID().Name().c_str();
 
   if (shareThread) {
-    auto mailbox = std::make_unique<NonblockingMailBox>();
+    std::unique_ptr<MailBox> mailbox;
+    if (actor->get_mailbox_type() == MailBoxType::kMpsc) {
+      mailbox = std::make_unique<MpscMailBox>();
+    } else {
+      mailbox = std::make_unique<NonblockingMailBox>();
+    }
     auto hook = std::make_unique<std::function<void()>>([actor]() {
       auto actor_mgr = actor->get_actor_mgr();
       if (actor_mgr != nullptr) {
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "actor/mailbox.h"
+#include <thread>
 
 namespace mindspore {
 int BlockingMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
@@ -70,6 +71,73 @@ std::list<std::unique_ptr<MessageBase>> *NonblockingMailBox::GetMsgs() {
   return ret;
 }
 
+MpscMailBox::~MpscMailBox() {
+  while (auto msg = Pop()) {
+    delete msg;
+  }
+}
+
+void MpscMailBox::Push(MessageBase *msg) {
+  msg->mailboxNext.store(nullptr, std::memory_order_relaxed);
+  MessageBase *prev = tail.exchange(msg, std::memory_order_acq_rel);
+  prev->mailboxNext.store(msg, std::memory_order_release);
+}
+
+MessageBase *MpscMailBox::Pop() {
+  MessageBase *first = head;
+  MessageBase *next = first->mailboxNext.load(std::memory_order_acquire);
+  if (first == &stub) {
+    if (next == nullptr) {
+      return nullptr;
+    }
+    head = next;
+    first = next;
+    next = next->mailboxNext.load(std::memory_order_acquire);
+  }
+  if (next != nullptr) {
+    head = next;
+    return first;
+  }
+  // the first message is the last one, put the stub behind it so that it can be taken off
+  if (first != tail.load(std::memory_order_acquire)) {
+    // a sender is between the exchange of the tail and the link to its message
+    return nullptr;
+  }
+  Push(&stub);
+  next = first->mailboxNext.load(std::memory_order_acquire);
+  if (next != nullptr) {
+    head = next;
+    return first;
+  }
+  return nullptr;
+}
+
+int MpscMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
+  Push(msg.release());
+  if (pending.fetch_add(1, std::memory_order_acq_rel) == 0 && notifyHook) {
+    (*notifyHook.get())();
+  }
+  return 0;
+}
+
+std::unique_ptr<MessageBase> MpscMailBox::GetMsg() {
+  if (taken) {
+    taken = false;
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      // the next message notifies the actor again
+      return nullptr;
+    }
+  }
+  MessageBase *msg = Pop();
+  while (msg == nullptr) {
+    // a message is pending, but its sender has not linked it yet
+    std::this_thread::yield();
+    msg = Pop();
+  }
+  taken = true;
+  return std::unique_ptr<MessageBase>(msg);
+}
+
 int HQueMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
   bool empty = mailbox.Empty();
   MessageBase *msgPtr = msg.release();
@@ -16,6 +16,7 @@
 
 #ifndef MINDSPORE_MAILBOX_H
 #define MINDSPORE_MAILBOX_H
+#include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -26,6 +27,13 @@
 #include "thread/hqueue.h"
 
 namespace mindspore {
+enum class MailBoxType {
+  // mutex guarded lists of messages, which the actor takes all at a time
+  kDefault = 0,
+  // lock-free queue of the messages linked through MessageBase, for the actors of a shared thread pool only
+  kMpsc,
+};
+
 class MailBox {
  public:
   virtual ~MailBox() = default;
@@ -82,6 +90,30 @@ class NonblockingMailBox : public MailBox {
   bool released_ = true;
 };
 
+// A multi-producer single-consumer mailbox which links the messages through MessageBase itself, so that enqueueing a
+// message takes no lock and no allocation. The senders push the messages with an atomic exchange of the tail, and the
+// actor pops them one at a time. The count of pending messages decides which sender notifies the actor: the one which
+// finds the mailbox empty, and the actor gives up running when it has taken the last pending message.
+class MpscMailBox : public MailBox {
+ public:
+  MpscMailBox() : tail(&stub), head(&stub) { takeAllMsgsEachTime = false; }
+  virtual ~MpscMailBox();
+  int EnqueueMessage(std::unique_ptr<MessageBase> msg) override;
+  std::list<std::unique_ptr<MessageBase>> *GetMsgs() override { return nullptr; }
+  std::unique_ptr<MessageBase> GetMsg() override;
+
+ private:
+  void Push(MessageBase *msg);
+  MessageBase *Pop();
+
+  MessageBase stub;
+  std::atomic<MessageBase *> tail;
+  // only touched by the actor
+  MessageBase *head;
+  bool taken = false;
+  std::atomic<int64_t> pending{0};
+};
+
 class HQueMailBox : public MailBox {
  public:
   HQueMailBox() { takeAllMsgsEachTime = false; }
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "async/async.h"
+
+namespace mindspore {
+namespace {
+struct FreeMessage {
+  FreeMessage *next;
+};
+
+struct FreeMessageList {
+  ~FreeMessageList();
+  FreeMessage *head = nullptr;
+  size_t count = 0;
+};
+
+// Set when the free list of the thread is destroyed, the messages freed later by the thread go to the heap.
+thread_local bool gFreeListDestroyed = false;
+thread_local FreeMessageList gFreeList;
+
+FreeMessageList::~FreeMessageList() {
+  gFreeListDestroyed = true;
+  while (head != nullptr) {
+    FreeMessage *next = head->next;
+    ::operator delete(static_cast<void *>(head));
+    head = next;
+  }
+  count = 0;
+}
+}  // namespace
+
+void *MessagePool::Alloc(std::size_t size) noexcept {
+  if (size == sizeof(MessageAsync) && !gFreeListDestroyed && gFreeList.head != nullptr) {
+    FreeMessage *msg = gFreeList.head;
+    gFreeList.head = msg->next;
+    --gFreeList.count;
+    return msg;
+  }
+  return ::operator new(size, std::nothrow);
+}
+
+void MessagePool::Free(void *ptr, std::size_t size) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (size != sizeof(MessageAsync) || gFreeListDestroyed || gFreeList.count >= kMaxPooledMessages) {
+    ::operator delete(ptr);
+    return;
+  }
+  FreeMessage *msg = static_cast<FreeMessage *>(ptr);
+  msg->next = gFreeList.head;
+  gFreeList.head = msg;
+  ++gFreeList.count;
+}
+}  // namespace mindspore
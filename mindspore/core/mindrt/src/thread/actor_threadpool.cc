@@ -40,13 +40,13 @@ void ActorWorker::RunWithSpin() {
   _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
 #endif
   while (alive_) {
-    // only run either local KernelTask or PoolQueue ActorTask
-    if (RunLocalKernelTask() || RunQueueActorTask()) {
+    // only run either local KernelTask or PoolQueue ActorTask, steal the KernelTask of others if there is neither
+    if (RunLocalKernelTask() || RunQueueActorTask() || StealKernelTask()) {
       spin_count_ = 0;
     } else {
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (spin_count_ > SpinLimit()) {
       WaitUntilActive();
       spin_count_ = 0;
     }
@@ -72,6 +72,7 @@ bool ActorWorker::ActorActive() {
   }
   {
     std::lock_guard<std::mutex> _l(mutex_);
+    CountUnpark();
     active_num_++;
     status_ = kThreadBusy;
   }
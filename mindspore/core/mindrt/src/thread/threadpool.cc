@@ -17,6 +17,8 @@
 #include <sched.h>
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <chrono>
 #include <sstream>
 #include "thread/threadpool.h"
 #include "thread/core_affinity.h"
@@ -27,6 +29,20 @@
 namespace mindspore {
 std::mutex ThreadPool::create_thread_pool_muntex_;
 
+namespace {
+// the depth of the parallel region running on this thread
+thread_local int parallel_depth = 0;
+
+class ParallelDepthGuard {
+ public:
+  explicit ParallelDepthGuard(int depth) : prev_depth_(parallel_depth) { parallel_depth = depth; }
+  ~ParallelDepthGuard() { parallel_depth = prev_depth_; }
+
+ private:
+  int prev_depth_;
+};
+}  // namespace
+
 Worker::~Worker() {
   {
     std::lock_guard<std::mutex> _l(mutex_);
@@ -133,26 +149,37 @@ void Worker::Run() {
   _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
 #endif
   while (alive_) {
-    if (RunLocalKernelTask()) {
+    if (RunLocalKernelTask() || StealKernelTask()) {
       spin_count_ = 0;
     } else {
       RunOtherKernelTask();
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (spin_count_ > SpinLimit()) {
       WaitUntilActive();
       spin_count_ = 1;
     }
   }
 }
 
+void Worker::RunTask(Task *task, int task_id) const {
+  float lhs_scale = lhs_scale_;
+  float rhs_scale = rhs_scale_;
+  if (task->task_num > 0) {
+    lhs_scale = static_cast<float>(task_id) / task->task_num;
+    rhs_scale = task_id == task->task_num - 1 ? kMaxScale : static_cast<float>(task_id + 1) / task->task_num;
+  }
+  ParallelDepthGuard depth_guard(task->depth);
+  task->status |= task->func(task->content, task_id, lhs_scale, rhs_scale);
+}
+
 bool Worker::TryRunTask(TaskSplit *task_split) {
   if (task_split == nullptr) {
     return false;
   }
   auto task = task_split->task_;
   auto task_id = task_split->task_id_;
-  task->status |= task->func(task->content, task_id, lhs_scale_, rhs_scale_);
+  RunTask(task, task_id);
   (void)++task->finished;
   return true;
 }
@@ -160,9 +187,13 @@ bool Worker::TryRunTask(TaskSplit *task_split) {
 bool Worker::RunLocalKernelTask() {
   bool res = false;
   Task *task = task_.load(std::memory_order_consume);
-  if (task != nullptr) {
+  // a task launched inside the split runs this again while waiting for its splits, which must not run the split again
+  if (task != nullptr && task != running_task_) {
     int task_id = task_id_.load(std::memory_order_consume);
-    task->status |= task->func(task->content, task_id, lhs_scale_, rhs_scale_);
+    Task *outer_task = running_task_;
+    running_task_ = task;
+    RunTask(task, task_id);
+    running_task_ = outer_task;
     task_.store(nullptr, std::memory_order_relaxed);
     (void)++task->finished;
     res |= true;
@@ -172,9 +203,49 @@ bool Worker::RunLocalKernelTask() {
     auto task_split = local_task_queue_->Dequeue();
     res |= TryRunTask(task_split);
   }
+
+  // the splits forked by this worker in the work stealing mode, which are not stolen yet
+  if (local_steal_deque_ != nullptr) {
+    while (!local_steal_deque_->Empty()) {
+      res |= TryRunTask(local_steal_deque_->Pop());
+    }
+  }
   return res;
 }
 
+bool Worker::StealKernelTask() {
+  if (pool_ == nullptr || !pool_->work_stealing()) {
+    return false;
+  }
+  const auto &steal_deques = pool_->steal_deques();
+  const auto &task_queues = pool_->task_queues();
+  size_t victim_num = std::min(steal_deques.size(), task_queues.size());
+  if (victim_num <= 1) {
+    return false;
+  }
+  // start from a random victim, so that the thieves do not contend on the same worker
+  steal_seed_ ^= steal_seed_ << 13;
+  steal_seed_ ^= steal_seed_ >> 7;
+  steal_seed_ ^= steal_seed_ << 17;
+  size_t start = static_cast<size_t>(steal_seed_ % victim_num);
+  for (size_t i = 0; i < victim_num; ++i) {
+    size_t index = (start + i) % victim_num;
+    if (index == worker_id_) {
+      continue;
+    }
+    auto task_split = steal_deques[index]->Steal();
+    // the splits launched by a thread out of the pool are distributed to the queues of the workers
+    if (task_split == nullptr && !task_queues[index]->Empty()) {
+      task_split = task_queues[index]->Dequeue();
+    }
+    if (TryRunTask(task_split)) {
+      (void)steal_count_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
 void Worker::RunOtherKernelTask() {
   if (pool_ == nullptr || pool_->actor_thread_num() <= kMinActorRunOther) {
     return;
@@ -206,16 +277,56 @@ void Worker::YieldAndDeactive() {
 }
 
 void Worker::WaitUntilActive() {
-  std::unique_lock<std::mutex> _l(mutex_);
-  cond_var_->wait(_l, [&] { return status_ == kThreadBusy || active_num_ > 0 || !alive_; });
-  if (active_num_ > 0) {
-    active_num_--;
+  auto start = std::chrono::steady_clock::now();
+  bool parked = false;
+  {
+    std::unique_lock<std::mutex> _l(mutex_);
+    auto is_active = [&] { return status_ == kThreadBusy || active_num_ > 0 || !alive_; };
+    if (!is_active()) {
+      parked = true;
+      parked_ = true;
+      (void)park_count_.fetch_add(1, std::memory_order_relaxed);
+      cond_var_->wait(_l, is_active);
+      parked_ = false;
+    }
+    if (active_num_ > 0) {
+      active_num_--;
+    }
+    // When active_num > 0, status = kThreadIdle, a task may enqueue,
+    // because of spint_count = 0, the status may switch to kThreadIdle without handle this task,
+    // then a new task may enqueue to override the old one, which cause task missed.
+    // So, after wait, the status_ should be kThreadBusy.
+    status_.store(kThreadBusy);
+  }
+  if (parked && pool_ != nullptr && pool_->work_stealing()) {
+    auto park_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    AdaptSpinCount(park_time.count());
+  }
+}
+
+int Worker::SpinLimit() const {
+  if (pool_ == nullptr || !pool_->work_stealing()) {
+    return max_spin_count_;
+  }
+  return std::min(adaptive_spin_count_, max_spin_count_.load());
+}
+
+void Worker::AdaptSpinCount(int64_t park_time) {
+  int max_spin_count = max_spin_count_;
+  if (park_time < kShortParkTime) {
+    // the work came soon after giving up spinning, so spin longer next time
+    adaptive_spin_count_ = adaptive_spin_count_ > max_spin_count / 2 ? max_spin_count : adaptive_spin_count_ * 2;
+  } else if (park_time > kLongParkTime) {
+    // the spinning burnt the cpu for nothing, so spin shorter next time
+    adaptive_spin_count_ = std::max(adaptive_spin_count_ / 2, kMinSpinCount);
+  }
+}
+
+void Worker::CountUnpark() {
+  if (parked_) {
+    parked_ = false;
+    (void)unpark_count_.fetch_add(1, std::memory_order_relaxed);
   }
-  // When active_num > 0, status = kThreadIdle, a task may enqueue,
-  // because of spint_count = 0, the status may switch to kThreadIdle without handle this task,
-  // then a new task may enqueue to override the old one, which cause task missed.
-  // So, after wait, the status_ should be kThreadBusy.
-  status_.store(kThreadBusy);
 }
 
 void Worker::set_scale(float lhs_scale, float rhs_scale) {
@@ -226,6 +337,7 @@ void Worker::set_scale(float lhs_scale, float rhs_scale) {
 void Worker::Active(std::vector<TaskSplit> *task_list, int task_id_start, int task_id_end) {
   {
     std::lock_guard<std::mutex> _l(mutex_);
+    CountUnpark();
     // add the first to task_, and others to queue.
     status_ = kThreadBusy;
     Task *task = task_.load(std::memory_order_consume);
@@ -251,6 +363,7 @@ void Worker::Active() {
   }
   {
     std::lock_guard<std::mutex> _l(mutex_);
+    CountUnpark();
     active_num_++;
     status_ = kThreadBusy;
   }
@@ -278,6 +391,7 @@ ThreadPool::~ThreadPool() {
     task_queue->Clean();
   }
   task_queues_.clear();
+  steal_deques_.clear();
   THREAD_INFO("destruct success");
 }
 
@@ -291,6 +405,14 @@ int ThreadPool::TaskQueuesInit(size_t thread_num) {
       return THREAD_ERROR;
     }
   }
+  for (size_t i = 0; i < thread_num; ++i) {
+    auto steal_deque = std::make_unique<WorkStealDeque<TaskSplit>>();
+    if (steal_deque->Init(kMaxHqueueSize) != true) {
+      THREAD_ERROR("init steal deque failed.");
+      return THREAD_ERROR;
+    }
+    (void)steal_deques_.emplace_back(std::move(steal_deque));
+  }
   THREAD_INFO("init task queues success.");
   return THREAD_OK;
 }
@@ -298,6 +420,7 @@ int ThreadPool::TaskQueuesInit(size_t thread_num) {
 int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num) {
   // if single thread, run master thread
   if (task_num <= 1) {
+    ParallelDepthGuard depth_guard(parallel_depth + 1);
     return SyncRunFunc(func, content, 0, task_num);
   }
 
@@ -305,12 +428,31 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
   // if the task num is greater than the KernelThread num
   THREAD_DEBUG("launch: %d", task_num);
   Task task = {func, content};
+  task.depth = parallel_depth + 1;
+  Worker *curr = CurrentWorker();
+  // the helpers come from the budget shared by all the regions, so a nested region takes what the outer ones left,
+  // and runs by itself if nothing is left
+  int helper_num = ClaimHelpers(curr != nullptr ? task_num - 1 : task_num);
+  if (helper_num == 0) {
+    SyncRunTask(&task, 0, task_num);
+    return task.status != THREAD_OK ? THREAD_ERROR : THREAD_OK;
+  }
   std::vector<TaskSplit> task_list;
   for (int i = 0; i < task_num; ++i) {
     (void)task_list.emplace_back(TaskSplit{&task, i});
   }
-  Worker *curr = CurrentWorker();
-  DistributeTask(&task_list, &task, task_num, curr);
+  int used_helper_num = 0;
+  if (!work_stealing_) {
+    used_helper_num = DistributeTask(&task_list, &task, task_num, curr, helper_num);
+  } else if (curr != nullptr && curr->local_steal_deque() != nullptr) {
+    task.task_num = task_num;
+    used_helper_num = ForkTask(&task_list, task_num, curr, helper_num);
+  } else {
+    task.task_num = task_num;
+    used_helper_num = DistributeTask(&task_list, &task, task_num, curr, helper_num);
+  }
+  // give back the helpers which are not idle now
+  ReleaseHelpers(helper_num - used_helper_num);
   // synchronization
   // wait until the finished is equal to task_num
   while (task.finished != task_num) {
@@ -319,6 +461,7 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
     }
     std::this_thread::yield();
   }
+  ReleaseHelpers(used_helper_num);
   // check the return value of task
   if (task.status != THREAD_OK) {
     return THREAD_ERROR;
@@ -329,6 +472,7 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
 void ThreadPool::SyncRunTask(Task *task, int start_num, int task_num) const {
   // run task sequentially
   // if the current thread is not the actor thread
+  ParallelDepthGuard depth_guard(task->depth);
   float per_scale = kMaxScale / (task_num - start_num);
   for (int i = start_num; i < task_num; ++i) {
     float lhs_scale = i * per_scale;
@@ -349,7 +493,8 @@ int ThreadPool::SyncRunFunc(const Func &func, Content content, int start, int en
   return THREAD_OK;
 }
 
-void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, int task_num, Worker *curr) const {
+int ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, int task_num, Worker *curr,
+                               int max_helper_num) const {
   int sum_frequency = 0;
   std::vector<Worker *> assigned;
   assigned.reserve(task_num);
@@ -359,6 +504,7 @@ void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, i
   // if the current thread isn't nullptr, that is the curr is a ActorThread,
   // then assign (task_num - 1) tasks to workers, and run the last one by itself
   int num_assigned = use_curr ? task_num - 1 : task_num;
+  num_assigned = std::min(num_assigned, max_helper_num);
   int count = 0;
 
   if (!occupied_actor_thread_) {
@@ -380,13 +526,90 @@ void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, i
     CalculateScales(assigned, sum_frequency);
     ActiveWorkers(assigned, task_list, assigned.size(), curr);
     SyncRunTask(task, assigned.size(), task_num);
-    return;
+    return count;
   }
 
   CalculateScales(assigned, sum_frequency);
   ActiveWorkers(assigned, task_list, task_num, curr);
+  return count;
+}
+
+int ThreadPool::ForkTask(std::vector<TaskSplit> *task_list, int task_num, Worker *curr, int max_helper_num) const {
+  // push the splits to the deque of the current worker, which runs them from the last one,
+  // and wake up the idle workers to steal them from the first one.
+  auto steal_deque = curr->local_steal_deque();
+  int pushed = 0;
+  while (pushed < task_num && steal_deque->Push(&(*task_list)[pushed])) {
+    (void)++pushed;
+  }
+  int num = static_cast<int>(workers_.size()) - 1;
+  int offset = occupied_actor_thread_ ? 0 : static_cast<int>(actor_thread_num_);
+  int num_wake = std::min(pushed - 1, max_helper_num);
+  int count = 0;
+  for (int i = num; i >= offset && count < num_wake; --i) {
+    if (workers_[i] != curr && workers_[i]->available()) {
+      workers_[i]->Active();
+      (void)++count;
+    }
+  }
+  // the deque is full, run the rest by itself
+  for (int i = pushed; i < task_num; ++i) {
+    (void)curr->TryRunTask(&(*task_list)[i]);
+  }
+  return count;
 }
 
+int ThreadPool::ClaimHelpers(int helper_num) {
+  int intra_op_num = intra_op_num_;
+  if (intra_op_num > 0) {
+    helper_num = std::min(helper_num, intra_op_num - 1);
+  }
+  if (helper_num <= 0) {
+    return 0;
+  }
+  int budget = parallel_budget_;
+  if (budget <= 0) {
+    (void)busy_helper_num_.fetch_add(helper_num);
+    return helper_num;
+  }
+  int busy_helper_num = busy_helper_num_;
+  int claimed = 0;
+  do {
+    claimed = std::min(helper_num, budget - busy_helper_num);
+    if (claimed <= 0) {
+      return 0;
+    }
+  } while (!busy_helper_num_.compare_exchange_weak(busy_helper_num, busy_helper_num + claimed));
+  return claimed;
+}
+
+void ThreadPool::ReleaseHelpers(int helper_num) {
+  if (helper_num > 0) {
+    (void)busy_helper_num_.fetch_sub(helper_num);
+  }
+}
+
+void ThreadPool::SetParallelBudget(int budget, int intra_op_num) {
+  parallel_budget_ = budget > 0 ? budget : 0;
+  intra_op_num_ = intra_op_num > 0 ? intra_op_num : 0;
+  THREAD_INFO("parallel budget: %d, intra op num: %d", parallel_budget_.load(), intra_op_num_.load());
+}
+
+int ThreadPool::GetFreeHelperNum() const {
+  int free_helper_num = static_cast<int>(workers_.size());
+  int budget = parallel_budget_;
+  if (budget > 0) {
+    free_helper_num = std::min(free_helper_num, budget - busy_helper_num_.load());
+  }
+  int intra_op_num = intra_op_num_;
+  if (intra_op_num > 0) {
+    free_helper_num = std::min(free_helper_num, intra_op_num - 1);
+  }
+  return std::max(free_helper_num, 0);
+}
+
+int ThreadPool::ParallelDepth() { return parallel_depth; }
+
 void ThreadPool::CalculateScales(const std::vector<Worker *> &assigned, int sum_frequency) const {
   // divide task according to computing power(core frequency)
   float lhs_scale = 0;
@@ -558,6 +781,17 @@ ThreadPool *ThreadPool::CreateThreadPool(size_t thread_num, const std::vector<in
   return pool;
 }
 
+WorkStealStatistics ThreadPool::GetWorkStealStatistics() {
+  WorkStealStatistics statistics;
+  std::lock_guard<std::mutex> _l(pool_mutex_);
+  for (const auto &worker : workers_) {
+    statistics.steal_count += worker->steal_count();
+    statistics.park_count += worker->park_count();
+    statistics.unpark_count += worker->unpark_count();
+  }
+  return statistics;
+}
+
 void ThreadPool::SetWorkerIdMap() {
   for (size_t i = 0; i < workers_.size(); ++i) {
     auto thread_id = workers_[i]->thread_id();
@@ -38,6 +38,7 @@
 #endif
 #include "mindapi/base/macros.h"
 #include "thread/hqueue.h"
+#include "thread/work_steal_deque.h"
 
 #define USE_HQUEUE
 namespace mindspore {
@@ -49,6 +50,10 @@ constexpr int kDefaultFrequency = 1;
 constexpr float kMaxScale = 1.;
 constexpr size_t kMaxHqueueSize = 8192;
 constexpr size_t kMinActorRunOther = 2;
+// in the work stealing mode, a worker woken up within the short park time spins longer before the next park, and a
+// worker parked longer than the long park time spins shorter. Unit: us
+constexpr int64_t kShortParkTime = 100;
+constexpr int64_t kLongParkTime = 2000;
 /* Thread status */
 constexpr int kThreadBusy = 0;  // busy, the thread is running task
 constexpr int kThreadHeld = 1;  // held, the thread has been marked as occupied
@@ -65,6 +70,10 @@ typedef struct Task {
   Task(Func f, Content c) : func(f), content(c) {}
   Func func;
   Content content;
+  // the total number of splits, set when the splits may run on any worker, then each split takes an even scale
+  int task_num{0};
+  // the depth of the parallel region, a task launched inside a split of this task is one deeper
+  int depth{0};
   std::atomic_int finished{0};
   std::atomic_int status{THREAD_OK};  // return status, RET_OK
 } Task;
@@ -75,11 +84,22 @@ typedef struct TaskSplit {
   int task_id_;
 } TaskSplit;
 
+// the counters of the work stealing mode
+typedef struct WorkStealStatistics {
+  // the splits taken from the other workers
+  uint64_t steal_count{0};
+  // the times the workers went to sleep
+  uint64_t park_count{0};
+  // the times the sleeping workers were woken up
+  uint64_t unpark_count{0};
+} WorkStealStatistics;
+
 class ThreadPool;
 class Worker {
  public:
   explicit Worker(ThreadPool *pool, size_t index) : pool_(pool), worker_id_(index) {
     cond_var_ = std::make_unique<std::condition_variable>();
+    steal_seed_ = static_cast<uint64_t>(index) * 0x9E3779B97F4A7C15ULL + 1;
   }
   virtual ~Worker();
   // create thread and start running at the same time
@@ -94,12 +114,15 @@ class Worker {
   // assigns task first before running
   virtual bool RunLocalKernelTask();
   virtual void RunOtherKernelTask();
+  // take a split from the deque or the queue of a random worker in the work stealing mode
+  bool StealKernelTask();
   // try to run a single task
   bool TryRunTask(TaskSplit *task_split);
   // set max spin count before running
   void SetMaxSpinCount(int max_spin_count) { max_spin_count_ = max_spin_count; }
   void InitWorkerMask(const std::vector<int> &core_list, const size_t workers_size);
   void InitLocalTaskQueue(HQueue<TaskSplit> *task_queue) { local_task_queue_ = task_queue; }
+  void InitLocalStealDeque(WorkStealDeque<TaskSplit> *steal_deque) { local_steal_deque_ = steal_deque; }
 
   void set_frequency(int frequency) { frequency_ = frequency; }
   int frequency() const { return frequency_; }
@@ -108,6 +131,11 @@ class Worker {
   float lhs_scale() const { return lhs_scale_; }
   float rhs_scale() const { return rhs_scale_; }
   HQueue<TaskSplit> *local_task_queue() { return local_task_queue_; }
+  WorkStealDeque<TaskSplit> *local_steal_deque() { return local_steal_deque_; }
+
+  uint64_t steal_count() const { return steal_count_.load(std::memory_order_relaxed); }
+  uint64_t park_count() const { return park_count_.load(std::memory_order_relaxed); }
+  uint64_t unpark_count() const { return unpark_count_.load(std::memory_order_relaxed); }
 
   std::thread::id thread_id() const {
     THREAD_TEST_TRUE(thread_ == nullptr);
@@ -131,6 +159,11 @@ class Worker {
   void SetAffinity();
   void YieldAndDeactive();
   virtual void WaitUntilActive();
+  // the spin count before waiting, which adapts to the observed park time in the work stealing mode
+  int SpinLimit() const;
+  void AdaptSpinCount(int64_t park_time);
+  // count a wake up of the sleeping worker, called with the mutex_ held
+  void CountUnpark();
 
   bool alive_{true};
   std::unique_ptr<std::thread> thread_{nullptr};
@@ -147,6 +180,7 @@ class Worker {
 
   std::atomic<Task *> task_{nullptr};
   std::atomic_int task_id_{0};
+  Task *running_task_{nullptr};  // the task_ being run by this worker, only touched by its own thread
   float lhs_scale_{0.};
   float rhs_scale_{kMaxScale};
   int frequency_{kDefaultFrequency};
@@ -154,11 +188,20 @@ class Worker {
   std::atomic_int max_spin_count_{kMinSpinCount};
   ThreadPool *pool_{nullptr};
   HQueue<TaskSplit> *local_task_queue_{nullptr};
+  WorkStealDeque<TaskSplit> *local_steal_deque_{nullptr};
   size_t worker_id_{0};
   std::vector<int> core_list_;
 
+  bool parked_{false};
+  int adaptive_spin_count_{kDefaultKernelSpinCount};
+  uint64_t steal_seed_{0};
+  std::atomic<uint64_t> steal_count_{0};
+  std::atomic<uint64_t> park_count_{0};
+  std::atomic<uint64_t> unpark_count_{0};
+
  private:
   void Run();
+  void RunTask(Task *task, int task_id) const;
 };
 
 class MS_CORE_API ThreadPool {
@@ -168,6 +211,7 @@ class MS_CORE_API ThreadPool {
 
   size_t thread_num() const { return workers_.size(); }
   const std::vector<std::unique_ptr<HQueue<TaskSplit>>> &task_queues() { return task_queues_; }
+  const std::vector<std::unique_ptr<WorkStealDeque<TaskSplit>>> &steal_deques() { return steal_deques_; }
 
   int SetCpuAffinity(const std::vector<int> &core_list);
   int SetCpuAffinity(BindMode bind_mode);
@@ -187,6 +231,22 @@ class MS_CORE_API ThreadPool {
   void SetSpinCountMinValue();
   void SetMaxSpinCount(int spin_count);
   void SetMinSpinCount(int spin_count);
+  // in the work stealing mode, the splits launched by a worker go to its own deque and the idle workers steal them,
+  // and the spin count of each worker adapts to its park time. ParallelThreadPool does not support it.
+  void SetWorkStealing(bool work_stealing) { work_stealing_ = work_stealing; }
+  bool work_stealing() const { return work_stealing_; }
+  WorkStealStatistics GetWorkStealStatistics();
+  // the parallel regions running at the same time, including the nested ones, share a budget of helper workers, so
+  // that the inter op parallelism of the actors and the intra op parallelism of the kernels compose without taking
+  // more threads than the budget. budget is the max number of workers helping the regions at the same time, and
+  // intra_op_num is the max number of threads running one region, including the launching thread. 0 means no limit.
+  void SetParallelBudget(int budget, int intra_op_num);
+  int parallel_budget() const { return parallel_budget_; }
+  int intra_op_num() const { return intra_op_num_; }
+  // the helper workers a region launched now can take at most
+  int GetFreeHelperNum() const;
+  // the depth of the parallel region running on the calling thread, 0 out of any region
+  static int ParallelDepth();
   void ActiveWorkers();
   void SetWorkerIdMap();
   // init task queues
@@ -217,6 +277,7 @@ class MS_CORE_API ThreadPool {
         return THREAD_ERROR;
       }
       worker->InitLocalTaskQueue(task_queues_[queues_idx].get());
+      worker->InitLocalStealDeque(steal_deques_[queues_idx].get());
       workers_.push_back(worker);
     }
     for (size_t i = 0; i < thread_num; ++i) {
@@ -231,7 +292,12 @@ class MS_CORE_API ThreadPool {
 
   int InitAffinityInfo();
 
-  void DistributeTask(std::vector<TaskSplit> *task_list, Task *task, int task_num, Worker *curr) const;
+  int DistributeTask(std::vector<TaskSplit> *task_list, Task *task, int task_num, Worker *curr,
+                     int max_helper_num) const;
+  int ForkTask(std::vector<TaskSplit> *task_list, int task_num, Worker *curr, int max_helper_num) const;
+  // take the helper workers of a region from the budget, return the number taken
+  int ClaimHelpers(int helper_num);
+  void ReleaseHelpers(int helper_num);
   void CalculateScales(const std::vector<Worker *> &workers, int sum_frequency) const;
   void ActiveWorkers(const std::vector<Worker *> &workers, std::vector<TaskSplit> *task_list, int task_num,
                      const Worker *curr) const;
@@ -242,11 +308,16 @@ class MS_CORE_API ThreadPool {
   std::mutex pool_mutex_;
   std::vector<Worker *> workers_;
   std::vector<std::unique_ptr<HQueue<TaskSplit>>> task_queues_;
+  std::vector<std::unique_ptr<WorkStealDeque<TaskSplit>>> steal_deques_;
   std::unordered_map<std::thread::id, size_t> worker_ids_;
   CoreAffinity *affinity_{nullptr};
   std::atomic<size_t> actor_thread_num_{0};
   std::atomic<size_t> kernel_thread_num_{0};
   bool occupied_actor_thread_{true};
+  std::atomic_bool work_stealing_{false};
+  std::atomic_int parallel_budget_{0};
+  std::atomic_int intra_op_num_{0};
+  std::atomic_int busy_helper_num_{0};
   std::atomic_int max_spin_count_{kDefaultSpinCount};
   std::atomic_int min_spin_count_{kMinSpinCount};
   float server_cpu_frequence = -1.0f;  // Unit : GHz
@@ -141,6 +141,7 @@ MsContext::MsContext(const std::string &policy, const std::string &target) {
   uint32_t inter_op_parallel_num_default = std::min(cpu_core_num, kDefaultInterOpParallelThreads);
   set_param<uint32_t>(MS_CTX_RUNTIME_NUM_THREADS, runtime_num_threads_default);
   set_param<uint32_t>(MS_CTX_INTER_OP_PARALLEL_NUM, inter_op_parallel_num_default);
+  set_param<uint32_t>(MS_CTX_INTRA_OP_PARALLEL_NUM, 0);
 
   backend_policy_ = kPolicyMap[policy];
   ascend_soc_version_ = "";
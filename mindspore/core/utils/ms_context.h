@@ -146,6 +146,7 @@ enum MsCtxParam : unsigned {
   MS_CTX_DEVICE_ID = MS_CTX_TYPE_UINT32_BEGIN,
   MS_CTX_RUNTIME_NUM_THREADS,
   MS_CTX_INTER_OP_PARALLEL_NUM,
+  MS_CTX_INTRA_OP_PARALLEL_NUM,
   MS_CTX_GE_REF,
   MS_CTX_MAX_CALL_DEPTH,
   MS_CTX_TSD_REF,
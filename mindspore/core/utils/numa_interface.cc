@@ -202,4 +202,44 @@ Status LoadNumaCpuInfo(void *handle, const int32_t rank_id, std::vector<int> *nu
   numa_bitmask_free(numa_cpu_mask);
   return Status::OK();
 }
+
+Status GetNumaNodeCount(void *handle, int32_t *num_nodes) {
+  if (num_nodes == nullptr) {
+    RETURN_STATUS_UNEXPECTED("The pointer[num_nodes] is null.");
+  }
+  *num_nodes = 1;
+  if (handle == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa package not found.");
+  }
+  DEFINE_NUMA_METHOD(handle, numa_available, int);
+  if (numa_available() == -1) {
+    return Status::OK();
+  }
+  DEFINE_NUMA_METHOD(handle, numa_max_node, int);
+  auto numa_node_max_id = numa_max_node();
+  if (numa_node_max_id < 0) {
+    RETURN_STATUS_UNEXPECTED("Get numa max node failed.");
+  }
+  *num_nodes = numa_node_max_id + 1;
+  return Status::OK();
+}
+
+Status NumaBindThread(void *handle, const int32_t &node_id) {
+  if (handle == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa package not found.");
+  }
+  if (node_id < 0) {
+    RETURN_STATUS_UNEXPECTED("Value error, node_id is a negative value.");
+  }
+  DEFINE_NUMA_METHOD(handle, numa_run_on_node, int, int);
+  DEFINE_NUMA_METHOD(handle, numa_set_preferred, void, int);
+  // Both of them only apply to the calling thread.
+  if (numa_run_on_node(node_id) < 0) {
+    MS_LOG(WARNING) << "Try to bind thread to numa id: " << node_id
+                    << ", but execute numa_run_on_node failed, errno: " << strerror(errno) << ".";
+    return Status::OK();
+  }
+  numa_set_preferred(node_id);
+  return Status::OK();
+}
 }  // namespace mindspore
@@ -34,5 +34,13 @@ MS_CORE_API std::shared_ptr<void> GetNumaAdapterHandle();
 MS_CORE_API Status NumaBind(void *handle, const int32_t &rank_id);
 
 MS_CORE_API Status LoadNumaCpuInfo(void *handle, const int32_t rank_id, std::vector<int> *numa_cpus);
+
+// Get the number of numa nodes of the host, 1 if numa is not available.
+MS_CORE_API Status GetNumaNodeCount(void *handle, int32_t *num_nodes);
+
+// Unlike NumaBind, this only binds the calling thread: it runs on the cpus of
+// the numa node and its memory is allocated from the node as long as there is
+// free memory on it. The threads it creates inherit the binding.
+MS_CORE_API Status NumaBindThread(void *handle, const int32_t &node_id);
 }  // namespace mindspore
 #endif  // MINDSPORE_CORE_UTILS_NUMA_INTERFACE_H_
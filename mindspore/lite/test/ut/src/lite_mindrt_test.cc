@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 // #include <sys/time.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 #include "actor/actor.h"
 #include "actor/op_actor.h"
 #include "async/uuid_base.h"
@@ -158,4 +162,123 @@ TEST_F(LiteMindRtTest, ActorThreadPoolTest) {
   }
 }
 
+// only the first outer split forks slow inner splits, so the other workers run out of work at once and have to steal
+// the inner splits of the first one
+void RunUnevenNestedLaunch(ThreadPool *pool) {
+  const int outer_num = 4;
+  const int inner_num = 64;
+  const int round_num = 5;
+  std::vector<std::atomic_int> sums(outer_num);
+  for (auto &sum : sums) {
+    sum = 0;
+  }
+  struct Content {
+    ThreadPool *pool;
+    std::vector<std::atomic_int> *sums;
+    int outer_id;
+  };
+  auto inner_func = [](void *content, int task_id, float, float) -> int {
+    auto inner_content = static_cast<Content *>(content);
+    if (inner_content->outer_id == 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    (*inner_content->sums)[inner_content->outer_id] += task_id;
+    return THREAD_OK;
+  };
+  auto outer_func = [inner_func](void *content, int task_id, float, float) -> int {
+    auto outer_content = static_cast<Content *>(content);
+    Content inner_content = {outer_content->pool, outer_content->sums, task_id};
+    return outer_content->pool->ParallelLaunch(inner_func, &inner_content, inner_num);
+  };
+  for (int i = 0; i < round_num; ++i) {
+    Content content = {pool, &sums, 0};
+    ASSERT_EQ(pool->ParallelLaunch(outer_func, &content, outer_num), THREAD_OK);
+  }
+  for (auto &sum : sums) {
+    ASSERT_EQ(sum.load(), round_num * inner_num * (inner_num - 1) / 2);
+  }
+}
+
+TEST_F(LiteMindRtTest, WorkStealingTest) {
+  auto pool = ThreadPool::CreateThreadPool(8);
+  ASSERT_NE(pool, nullptr);
+  pool->SetWorkStealing(true);
+  RunUnevenNestedLaunch(pool);
+  // the pool is limited to the number of cores, and a single worker has nobody to steal from
+  if (pool->thread_num() > 1) {
+    ASSERT_GT(pool->GetWorkStealStatistics().steal_count, 0);
+  }
+  delete pool;
+}
+
+TEST_F(LiteMindRtTest, ActorThreadPoolWorkStealingTest) {
+  auto pool = ActorThreadPool::CreateThreadPool(2, 8, Power_NoBind);
+  ASSERT_NE(pool, nullptr);
+  pool->SetWorkStealing(true);
+  RunUnevenNestedLaunch(pool);
+  if (pool->thread_num() > 1) {
+    ASSERT_GT(pool->GetWorkStealStatistics().steal_count, 0);
+  }
+  delete pool;
+}
+
+// in the default mode the outer split keeps the task slot of its worker while the worker runs the inner splits
+TEST_F(LiteMindRtTest, NestedLaunchWithoutWorkStealingTest) {
+  auto pool = ThreadPool::CreateThreadPool(8);
+  ASSERT_NE(pool, nullptr);
+  pool->SetWorkStealing(false);
+  RunUnevenNestedLaunch(pool);
+  ASSERT_EQ(pool->GetWorkStealStatistics().steal_count, 0);
+  delete pool;
+}
+
+TEST_F(LiteMindRtTest, NestedParallelBudgetTest) {
+  const int outer_num = 4;
+  const int inner_num = 16;
+  const int budget = 3;
+  auto pool = ThreadPool::CreateThreadPool(8);
+  ASSERT_NE(pool, nullptr);
+  pool->SetParallelBudget(budget, 0);
+  std::atomic_int running(0);
+  std::atomic_int max_running(0);
+  std::atomic_int sum(0);
+  std::atomic_int wrong_depth(0);
+  struct Content {
+    ThreadPool *pool;
+    std::atomic_int *running;
+    std::atomic_int *max_running;
+    std::atomic_int *sum;
+    std::atomic_int *wrong_depth;
+  };
+  // the outer region takes all the budget, so the inner regions run on the threads of their outer splits
+  auto inner_func = [](void *content, int task_id, float, float) -> int {
+    auto inner_content = static_cast<Content *>(content);
+    if (ThreadPool::ParallelDepth() != 2) {
+      ++(*inner_content->wrong_depth);
+    }
+    int running_num = ++(*inner_content->running);
+    int seen = inner_content->max_running->load();
+    while (running_num > seen && !inner_content->max_running->compare_exchange_weak(seen, running_num)) {
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    *inner_content->sum += task_id;
+    --(*inner_content->running);
+    return THREAD_OK;
+  };
+  auto outer_func = [inner_func](void *content, int, float, float) -> int {
+    auto outer_content = static_cast<Content *>(content);
+    return outer_content->pool->ParallelLaunch(inner_func, content, inner_num);
+  };
+  Content content = {pool, &running, &max_running, &sum, &wrong_depth};
+  ASSERT_EQ(ThreadPool::ParallelDepth(), 0);
+  ASSERT_EQ(pool->ParallelLaunch(outer_func, &content, outer_num), THREAD_OK);
+  ASSERT_EQ(ThreadPool::ParallelDepth(), 0);
+  ASSERT_EQ(sum.load(), outer_num * inner_num * (inner_num - 1) / 2);
+  ASSERT_EQ(wrong_depth.load(), 0);
+  // the launching thread and the helpers of the budget
+  ASSERT_LE(max_running.load(), budget + 1);
+  ASSERT_EQ(pool->GetFreeHelperNum(), budget);
+  delete pool;
+}
+
 }  // namespace mindspore
@@ -563,6 +563,12 @@ class _Context:
             raise ValueError("The num of parallel thread must bigger than or equal to 0.")
         self.set_param(ms_ctx_param.inter_op_parallel_num, inter_op_parallel_num)
 
+    def set_intra_op_parallel_num(self, intra_op_parallel_num):
+        """Check and set intra_op_parallel_num."""
+        if intra_op_parallel_num < 0:
+            raise ValueError("The num of parallel thread must bigger than or equal to 0.")
+        self.set_param(ms_ctx_param.intra_op_parallel_num, intra_op_parallel_num)
+
     setters = {
         'mode': set_mode,
         'save_graphs_path': set_save_graphs_path,
@@ -577,6 +583,7 @@ class _Context:
         'print_file_path': set_print_file_path,
         'env_config_path': set_env_config_path,
         'inter_op_parallel_num': set_inter_op_parallel_num,
+        'intra_op_parallel_num': set_intra_op_parallel_num,
         'runtime_num_threads': set_runtime_num_threads,
         'memory_optimize_level': set_memory_optimize_level,
         'op_timeout': set_op_timeout,
@@ -1105,7 +1112,7 @@ def _check_target_specific_cfgs(device, arg_key):
 @args_type_check(mode=int, precompile_only=bool, device_target=str, device_id=int, save_graphs=(bool, int),
                  save_graphs_path=str, enable_dump=bool, aoe_tune_mode=str, aoe_config=dict,
                  save_dump_path=str, enable_reduce_precision=bool, variable_memory_max_size=str,
-                 enable_auto_mixed_precision=bool, inter_op_parallel_num=int,
+                 enable_auto_mixed_precision=bool, inter_op_parallel_num=int, intra_op_parallel_num=int,
                  enable_graph_kernel=bool, reserve_class_name_in_scope=bool, check_bprop=bool,
                  max_device_memory=str, print_file_path=str, max_call_depth=int, env_config_path=str,
                  graph_kernel_flags=str, save_compile_cache=bool, runtime_num_threads=int, load_compile_cache=bool,
@@ -1185,6 +1192,8 @@ def set_context(**kwargs):
     |                         +------------------------------+----------------------------+
     |                         |  inter_op_parallel_num       |  CPU/GPU/Ascend            |
     |                         +------------------------------+----------------------------+
+    |                         |  intra_op_parallel_num       |  CPU/GPU/Ascend            |
+    |                         +------------------------------+----------------------------+
     |                         |  runtime_num_threads         |  CPU/GPU/Ascend            |
     |                         +------------------------------+----------------------------+
     |                         |  compile_cache_path          |  CPU/GPU/Ascend            |
@@ -1361,6 +1370,10 @@ def set_context(**kwargs):
             the ID of the current device in the cluster.
         inter_op_parallel_num(int): The thread number of op parallel at the same time. Default value is ``0`` ,
             which means use the default num.
+        intra_op_parallel_num(int): The max thread number running one cpu kernel in parallel, including the nested
+            parallel regions inside the kernel. All the cpu kernels running at the same time share the kernel threads
+            of `runtime_num_threads`, so that the inter op and the intra op parallelism do not exceed them.
+            Default value is ``0`` , which means no limit.
         runtime_num_threads(int): The thread pool number of cpu kernel used in runtime,
             which must bigger than or equal to 0. Default value is ``30`` , if you run many processes at
             the same time, you should set the value smaller to avoid thread contention.
@@ -1591,6 +1604,7 @@ def set_context(**kwargs):
         >>> ms.set_context(pynative_synchronize=True)
         >>> ms.set_context(runtime_num_threads=10)
         >>> ms.set_context(inter_op_parallel_num=4)
+        >>> ms.set_context(intra_op_parallel_num=4)
         >>> ms.set_context(disable_format_transform=True)
         >>> ms.set_context(memory_optimize_level='O0')
         >>> ms.set_context(memory_offload='ON')
@@ -49,9 +49,18 @@ __all__ = ['set_sending_batches', 'load', '_init_device_info',
            'set_fast_recovery', 'get_fast_recovery',
            'set_debug_mode', 'get_debug_mode',
            'set_error_samples_mode', 'get_error_samples_mode', 'ErrorSamplesMode',
-           'set_multiprocessing_timeout_interval', 'get_multiprocessing_timeout_interval']
+           'set_multiprocessing_timeout_interval', 'get_multiprocessing_timeout_interval',
+           'set_mindrecord_mmap', 'get_mindrecord_mmap',
+           'set_io_prefetch_depth', 'get_io_prefetch_depth',
+           'set_shuffle_memory_limit', 'get_shuffle_memory_limit',
+           'set_shuffle_spill_dir', 'get_shuffle_spill_dir',
+           'set_embedded_cache', 'get_embedded_cache',
+           'set_numa_placement', 'get_numa_placement', 'NumaPlacement',
+           'set_autotune_strategy', 'get_autotune_strategy', 'AutoTuneStrategy',
+           'set_executor_mode', 'get_executor_mode', 'ExecutorMode']
 
 INT32_MAX = 2147483647
+UINT64_MAX = 18446744073709551615
 UINT32_MAX = 4294967295
 
 _config = cde.GlobalContext.config_manager()
@@ -1086,3 +1095,460 @@ def get_error_samples_mode():
         >>> error_samples_mode = ds.config.get_error_samples_mode()
     """
     return _CDE_TO_PYTHON_ERROR_SAMPLES_MODE.get(_config.get_error_samples_mode())
+
+
+def set_mindrecord_mmap(mindrecord_mmap):
+    """
+    Set whether MindDataset maps the MindRecord files into memory. When enabled, the bytes of blob fields are
+    handed to the dataset pipeline as views of the mapped pages instead of being copied out of the files, which
+    saves one memory copy per sample on large blobs such as images.
+
+    Note:
+        - The mapped files must not be modified while they are being read.
+        - Not supported on Windows, where the files are read as usual.
+
+    Args:
+        mindrecord_mmap (bool): Whether to map the MindRecord files into memory. Default: False.
+
+    Raises:
+        TypeError: If `mindrecord_mmap` is not a boolean data type.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_mindrecord_mmap(True)
+    """
+    if not isinstance(mindrecord_mmap, bool):
+        raise TypeError("mindrecord_mmap must be a boolean dtype.")
+    _config.set_mindrecord_mmap(mindrecord_mmap)
+
+
+def get_mindrecord_mmap():
+    """
+    Get whether MindDataset maps the MindRecord files into memory.
+    If `set_mindrecord_mmap` is never called before, the default value False will be returned.
+
+    Returns:
+        bool, whether the MindRecord files are mapped into memory.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> mindrecord_mmap = ds.config.get_mindrecord_mmap()
+    """
+    return _config.get_mindrecord_mmap()
+
+
+def set_io_prefetch_depth(depth):
+    """
+    Set the number of file reads which MindDataset and TFRecordDataset keep in flight ahead of the samples being
+    loaded. The reads are issued on background I/O threads, so that the latency of the storage overlaps with the
+    parsing of the previous samples, which helps most on network file systems and cold page cache.
+
+    Note:
+        - MindDataset reads the blobs of the following samples ahead only when the whole index of the dataset is
+          loaded into memory, which is the default for datasets of no more than 5 million samples, and the files
+          are not mapped by `set_mindrecord_mmap` .
+        - TFRecordDataset reads ahead the uncompressed and ZLIB compressed files, GZIP files are read as usual.
+        - Each read of TFRecordDataset is 1MB, the memory held by the reads ahead grows with the depth.
+
+    Args:
+        depth (int): The number of reads kept in flight, 0 to read synchronously. Default: 0.
+
+    Raises:
+        TypeError: If `depth` is not of type int.
+        ValueError: If `depth` < 0 or `depth` > INT32_MAX(2147483647).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_io_prefetch_depth(8)
+    """
+    if not isinstance(depth, int) or isinstance(depth, bool):
+        raise TypeError("depth isn't of type int.")
+    if depth < 0 or depth > INT32_MAX:
+        raise ValueError("depth given is not within the required range [0, INT32_MAX(2147483647)].")
+    _config.set_io_prefetch_depth(depth)
+
+
+def get_io_prefetch_depth():
+    """
+    Get the number of file reads which MindDataset and TFRecordDataset keep in flight.
+    If `set_io_prefetch_depth` is never called before, the default value 0 will be returned.
+
+    Returns:
+        int, the number of reads kept in flight, 0 means the files are read synchronously.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> depth = ds.config.get_io_prefetch_depth()
+    """
+    return _config.get_io_prefetch_depth()
+
+
+def set_shuffle_memory_limit(limit):
+    """
+    Set the number of bytes of samples which the shuffle buffer of `shuffle` keeps in memory. When a buffer grows
+    beyond the limit, the following samples are compressed and spilled to files on local disk, and read back when
+    they are drawn, so that a large `buffer_size` does not exhaust the host memory.
+
+    Note:
+        - The order of the samples is the same as that of the shuffle in memory with the same seed.
+        - Samples holding Python objects are always kept in memory.
+        - Spilling to disk is not supported on Windows, where the limit is ignored.
+
+    Args:
+        limit (int): The number of bytes of samples kept in memory by each shuffle buffer, 0 to keep all samples in
+            memory. Default: 0.
+
+    Raises:
+        TypeError: If `limit` is not of type int.
+        ValueError: If `limit` < 0.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_shuffle_memory_limit(4 * 1024 ** 3)
+    """
+    if not isinstance(limit, int) or isinstance(limit, bool):
+        raise TypeError("limit isn't of type int.")
+    if limit < 0 or limit > UINT64_MAX:
+        raise ValueError("limit given is not within the required range [0, UINT64_MAX(18446744073709551615)].")
+    _config.set_shuffle_memory_limit(limit)
+
+
+def get_shuffle_memory_limit():
+    """
+    Get the number of bytes of samples which the shuffle buffer of `shuffle` keeps in memory.
+    If `set_shuffle_memory_limit` is never called before, the default value 0 will be returned.
+
+    Returns:
+        int, the number of bytes of samples kept in memory, 0 means all samples are kept in memory.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> limit = ds.config.get_shuffle_memory_limit()
+    """
+    return _config.get_shuffle_memory_limit()
+
+
+def set_shuffle_spill_dir(spill_dir):
+    """
+    Set the directory of the files holding the samples spilled by the shuffle buffers, see
+    `set_shuffle_memory_limit` . The files are removed from the directory as soon as they are created, the space is
+    released when the pipeline ends.
+
+    Args:
+        spill_dir (str): An existing directory, preferably on a local disk, or an empty string to use the directory
+            given by the environment variable TMPDIR, or /tmp. Default: ''.
+
+    Raises:
+        TypeError: If `spill_dir` is not of type str.
+        ValueError: If `spill_dir` is not an existing directory.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_shuffle_spill_dir("/tmp")
+    """
+    if not isinstance(spill_dir, str):
+        raise TypeError("spill_dir isn't of type str.")
+    if spill_dir and not os.path.isdir(spill_dir):
+        raise ValueError("spill_dir given is not an existing directory.")
+    _config.set_shuffle_spill_dir(os.path.realpath(spill_dir) if spill_dir else spill_dir)
+
+
+def get_shuffle_spill_dir():
+    """
+    Get the directory of the files holding the samples spilled by the shuffle buffers.
+    If `set_shuffle_spill_dir` is never called before, the default value '' will be returned.
+
+    Returns:
+        str, the directory of the spilled samples, '' means the directory given by TMPDIR, or /tmp.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> spill_dir = ds.config.get_shuffle_spill_dir()
+    """
+    return _config.get_shuffle_spill_dir()
+
+
+def set_embedded_cache(embedded_cache):
+    """
+    Set whether `DatasetCache` keeps the cache in shared memory of the host by the pipelines themselves instead of
+    by a cache server. The processes of a job on one host which use the same `session_id` on the same pipeline share
+    one cache, and the samples are fetched from it without any remote procedure call. No cache server needs to be
+    started, the `hostname` and `port` of `DatasetCache` are ignored.
+
+    Note:
+        - The `session_id` is chosen by the user, it must be the same positive integer in all the processes.
+        - Spilling to disk is not supported.
+        - The memory is released when the last process using the cache ends.
+        - Only supported on Linux.
+
+    Args:
+        embedded_cache (bool): Whether to keep the cache in shared memory of the host. Default: False.
+
+    Raises:
+        TypeError: If `embedded_cache` is not a boolean data type.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_embedded_cache(True)
+    """
+    if not isinstance(embedded_cache, bool):
+        raise TypeError("embedded_cache must be a boolean dtype.")
+    _config.set_embedded_cache(embedded_cache)
+
+
+def get_embedded_cache():
+    """
+    Get whether `DatasetCache` keeps the cache in shared memory of the host instead of by a cache server.
+    If `set_embedded_cache` is never called before, the default value False will be returned, unless the environment
+    variable MS_CACHE_EMBEDDED is set to 1.
+
+    Returns:
+        bool, whether the cache is kept in shared memory of the host.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> embedded_cache = ds.config.get_embedded_cache()
+    """
+    return _config.get_embedded_cache()
+
+
+class NumaPlacement(IntEnum):
+    """
+    An enumeration for `numa_placement` .
+
+    Possible enumeration values are: NumaPlacement.NONE, NumaPlacement.DEVICE, NumaPlacement.SPREAD.
+
+    - NumaPlacement.NONE: means the threads of the pipeline are scheduled on any numa node.
+    - NumaPlacement.DEVICE: means all the threads of the pipeline run on the numa node of the device.
+    - NumaPlacement.SPREAD: means the workers of each operation are spread over the numa nodes, and the last
+      operation of the pipeline runs on the numa node of the device.
+    """
+
+    NONE = 0
+    DEVICE = 1
+    SPREAD = 2
+
+
+# Convert NumaPlacement from Python enum format to CDE enum format
+_PYTHON_TO_CDE_NUMA_PLACEMENT = {
+    NumaPlacement.NONE: cde.NumaPlacement.DE_NUMA_PLACEMENT_NONE,
+    NumaPlacement.DEVICE: cde.NumaPlacement.DE_NUMA_PLACEMENT_DEVICE,
+    NumaPlacement.SPREAD: cde.NumaPlacement.DE_NUMA_PLACEMENT_SPREAD
+}
+
+# Convert NumaPlacement from CDE int format to Python enum format
+_CDE_TO_PYTHON_NUMA_PLACEMENT = {
+    0: NumaPlacement.NONE,
+    1: NumaPlacement.DEVICE,
+    2: NumaPlacement.SPREAD
+}
+
+
+def set_numa_placement(numa_placement):
+    """
+    Set the policy to place the threads of a dataset pipeline on numa nodes. Each thread is bound to a numa node,
+    it runs on the cpus of the node and the tensors it produces are allocated from the memory of the node, so that
+    the samples do not cross the sockets between the operations of the pipeline.
+
+    The numa node of the device is the rank id modulo the number of numa nodes, as in `set_numa_enable` .
+
+    Note:
+        - The `numa library <http://rpmfind.net/linux/rpm2html/search.php?query=libnuma-devel>`_ needs to be
+          installed.
+        - It has no effect on a host with one numa node.
+        - The processes of `python_multiprocessing` are not placed.
+
+    Args:
+        numa_placement (NumaPlacement): The policy to place the threads of a dataset pipeline. It can be any of
+            [NumaPlacement.NONE, NumaPlacement.DEVICE, NumaPlacement.SPREAD].
+
+            - ``NumaPlacement.NONE``: means the threads are scheduled on any numa node.
+
+            - ``NumaPlacement.DEVICE``: means all the threads run on the numa node of the device, next to the thread
+              sending the data to the device.
+
+            - ``NumaPlacement.SPREAD``: means the workers of each operation are spread over the numa nodes, while
+              the last operation of the pipeline stays on the numa node of the device.
+
+    Raises:
+        TypeError: If `numa_placement` is not of type NumaPlacement.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_numa_placement(ds.config.NumaPlacement.DEVICE)
+    """
+    type_check(numa_placement, (NumaPlacement,), "numa_placement")
+    _config.set_numa_placement(_PYTHON_TO_CDE_NUMA_PLACEMENT.get(numa_placement))
+
+
+def get_numa_placement():
+    """
+    Get the policy to place the threads of a dataset pipeline on numa nodes.
+    If `set_numa_placement` is never called before, the default setting is NumaPlacement.NONE.
+
+    Returns:
+        NumaPlacement, the policy to place the threads of a dataset pipeline on numa nodes.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> numa_placement = ds.config.get_numa_placement()
+    """
+    return _CDE_TO_PYTHON_NUMA_PLACEMENT.get(_config.get_numa_placement())
+
+
+class AutoTuneStrategy(IntEnum):
+    """
+    An enumeration for `autotune_strategy` .
+
+    Possible enumeration values are: AutoTuneStrategy.HEURISTIC, AutoTuneStrategy.MODEL.
+
+    - AutoTuneStrategy.HEURISTIC: means the operations are adjusted one at a time after the utilization of their
+      queues and CPU.
+    - AutoTuneStrategy.MODEL: means a throughput model of the pipeline is solved for the parallelism and the queue
+      size of all the operations at once.
+    """
+
+    HEURISTIC = 0
+    MODEL = 1
+
+
+# Convert AutoTuneStrategy from Python enum format to CDE enum format
+_PYTHON_TO_CDE_AUTOTUNE_STRATEGY = {
+    AutoTuneStrategy.HEURISTIC: cde.AutoTuneStrategy.DE_AUTOTUNE_STRATEGY_HEURISTIC,
+    AutoTuneStrategy.MODEL: cde.AutoTuneStrategy.DE_AUTOTUNE_STRATEGY_MODEL
+}
+
+# Convert AutoTuneStrategy from CDE int format to Python enum format
+_CDE_TO_PYTHON_AUTOTUNE_STRATEGY = {
+    0: AutoTuneStrategy.HEURISTIC,
+    1: AutoTuneStrategy.MODEL
+}
+
+
+def set_autotune_strategy(autotune_strategy):
+    """
+    Set how AutoTune chooses the parameter configuration of the data pipeline. It takes effect when AutoTune is
+    enabled by `set_enable_autotune` .
+
+    With ``AutoTuneStrategy.MODEL`` , AutoTune models the throughput of the pipeline from the profiling data: the
+    CPU time each operation spends per batch, and whether its queues are fed or full. Then it solves for the
+    parallelism and the queue size of all the operations at once, under a budget of the CPU threads and of half the
+    memory available on the host. When a configuration file is saved by `set_enable_autotune` , the model of the
+    last tuning iteration is exported to its "model" field.
+
+    Args:
+        autotune_strategy (AutoTuneStrategy): How AutoTune chooses the configuration. It can be any of
+            [AutoTuneStrategy.HEURISTIC, AutoTuneStrategy.MODEL].
+
+            - ``AutoTuneStrategy.HEURISTIC``: means the operations are adjusted one at a time after the utilization
+              of their queues and CPU.
+
+            - ``AutoTuneStrategy.MODEL``: means a throughput model of the pipeline is solved for the parallelism and
+              the queue size of all the operations at once.
+
+    Raises:
+        TypeError: If `autotune_strategy` is not of type AutoTuneStrategy.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_autotune_strategy(ds.config.AutoTuneStrategy.MODEL)
+    """
+    type_check(autotune_strategy, (AutoTuneStrategy,), "autotune_strategy")
+    _config.set_autotune_strategy(_PYTHON_TO_CDE_AUTOTUNE_STRATEGY.get(autotune_strategy))
+
+
+def get_autotune_strategy():
+    """
+    Get how AutoTune chooses the parameter configuration of the data pipeline.
+    If `set_autotune_strategy` is never called before, the default setting is AutoTuneStrategy.HEURISTIC.
+
+    Returns:
+        AutoTuneStrategy, how AutoTune chooses the parameter configuration of the data pipeline.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> autotune_strategy = ds.config.get_autotune_strategy()
+    """
+    return _CDE_TO_PYTHON_AUTOTUNE_STRATEGY.get(_config.get_autotune_strategy())
+
+
+class ExecutorMode(IntEnum):
+    """
+    An enumeration for `executor_mode` .
+
+    Possible enumeration values are: ExecutorMode.THREAD_PER_OP, ExecutorMode.SHARED.
+
+    - ExecutorMode.THREAD_PER_OP: means every thread of the pipeline runs as soon as it is runnable.
+    - ExecutorMode.SHARED: means the threads of the pipeline take turns on as many run slots as the cpus the
+      process may use.
+    """
+
+    THREAD_PER_OP = 0
+    SHARED = 1
+
+
+# Convert ExecutorMode from Python enum format to CDE enum format
+_PYTHON_TO_CDE_EXECUTOR_MODE = {
+    ExecutorMode.THREAD_PER_OP: cde.ExecutorMode.DE_EXECUTOR_MODE_THREAD_PER_OP,
+    ExecutorMode.SHARED: cde.ExecutorMode.DE_EXECUTOR_MODE_SHARED
+}
+
+# Convert ExecutorMode from CDE int format to Python enum format
+_CDE_TO_PYTHON_EXECUTOR_MODE = {
+    0: ExecutorMode.THREAD_PER_OP,
+    1: ExecutorMode.SHARED
+}
+
+
+def set_executor_mode(executor_mode):
+    """
+    Set the mode to execute the threads of a dataset pipeline.
+
+    By default, each operation of the pipeline has threads of its own, which the operating system runs as soon as
+    they are runnable. A pipeline then has many more runnable threads than cpus, which preempt one another, and in
+    a container limited by a cpu quota, they exhaust the quota early in each period and are throttled all together.
+
+    With the shared executor, the threads of the pipeline take turns on as many run slots as the cpus the process
+    may use, which are the cpus it is affine to, limited by the cpu quota of its cgroup. A thread holds a slot while
+    it computes and hands it over when it waits on the queue between two operations, so the capacity of the queues
+    still decides which operation waits for which.
+
+    Note:
+        - A thread blocked on something else than a queue of the pipeline, such as reading a file or sending data
+          to the device, keeps its slot.
+        - The processes of `python_multiprocessing` are not part of the pipeline threads.
+        - It applies to the pipelines launched after the call.
+
+    Args:
+        executor_mode (ExecutorMode): The mode to execute the threads of a dataset pipeline. It can be any of
+            [ExecutorMode.THREAD_PER_OP, ExecutorMode.SHARED].
+
+            - ``ExecutorMode.THREAD_PER_OP``: means every thread runs as soon as it is runnable.
+
+            - ``ExecutorMode.SHARED``: means the threads take turns on as many run slots as the cpus the process
+              may use.
+
+    Raises:
+        TypeError: If `executor_mode` is not of type ExecutorMode.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> ds.config.set_executor_mode(ds.config.ExecutorMode.SHARED)
+    """
+    type_check(executor_mode, (ExecutorMode,), "executor_mode")
+    _config.set_executor_mode(_PYTHON_TO_CDE_EXECUTOR_MODE.get(executor_mode))
+
+
+def get_executor_mode():
+    """
+    Get the mode to execute the threads of a dataset pipeline.
+    If `set_executor_mode` is never called before, the default setting is ExecutorMode.THREAD_PER_OP.
+
+    Returns:
+        ExecutorMode, the mode to execute the threads of a dataset pipeline.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> executor_mode = ds.config.get_executor_mode()
+    """
+    return _CDE_TO_PYTHON_EXECUTOR_MODE.get(_config.get_executor_mode())
@@ -0,0 +1,283 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "backend/common/somas/somas_solver_pre.h"
+#include "include/backend/kernel_graph.h"
+
+namespace mindspore {
+namespace somas {
+namespace {
+constexpr auto kSomasSolverTries = "MS_DEV_SOMAS_SOLVER_TRIES";
+constexpr auto kPlanCacheDir = "./somas_solver_pre_test/";
+constexpr size_t kTensorSize = 100;
+
+// The input of the solver: the sizes of the tensors, their conflicts and their contiguous lists
+struct SolverInput {
+  std::vector<size_t> sizes;
+  std::vector<VectorBitSet> constraints;
+  vector<vector<size_t>> continuous;
+};
+
+// Tensors 0 and 1 conflict, so do tensors 0 and 2, and tensor 3 follows tensor 1
+SolverInput SmallInput() {
+  SolverInput input;
+  input.sizes.assign(4, kTensorSize);
+  input.constraints.assign(input.sizes.size(), VectorBitSet(input.sizes.size()));
+  for (size_t i = 0; i < input.sizes.size(); i++) {
+    for (size_t j = 0; j < input.sizes.size(); j++) {
+      bool conflict = (i == 0 && (j == 1 || j == 2)) || (j == 0 && (i == 1 || i == 2));
+      input.constraints[i].SetBit(j, !conflict);
+    }
+  }
+  input.continuous.push_back({1, 3});
+  return input;
+}
+
+// Tensors with random sizes and lifetimes, two tensors conflict when their lifetimes overlap
+SolverInput RandomInput(size_t count, unsigned int seed) {
+  constexpr size_t kMaxStart = 200;
+  constexpr size_t kMaxLife = 30;
+  constexpr size_t kMaxBlocks = 64;
+  constexpr size_t kBlockSize = 512;
+  std::mt19937 gen(seed);
+  std::vector<size_t> starts;
+  std::vector<size_t> ends;
+  SolverInput input;
+  for (size_t i = 0; i < count; i++) {
+    starts.push_back(gen() % kMaxStart);
+    ends.push_back(starts.back() + gen() % kMaxLife);
+    input.sizes.push_back(kBlockSize * (1 + gen() % kMaxBlocks));
+  }
+  input.constraints.assign(count, VectorBitSet(count));
+  for (size_t i = 0; i < count; i++) {
+    for (size_t j = 0; j < count; j++) {
+      input.constraints[i].SetBit(j, ends[i] < starts[j] || ends[j] < starts[i]);
+    }
+  }
+  input.continuous.push_back({3, 4, 5});
+  input.continuous.push_back({10, 11});
+  return input;
+}
+
+TensorsDescMap MakeTensors(const SolverInput &input) {
+  TensorsDescMap tensors;
+  for (size_t i = 0; i < input.sizes.size(); i++) {
+    tensors[i] = std::make_shared<SomasSolverTensorDesc>(i, input.sizes[i], 0, false);
+  }
+  return tensors;
+}
+
+// Check the offsets of the tensors against the input, return the memory they use
+size_t CheckSolution(const SolverInput &input, const TensorsDescMap &tensors) {
+  size_t used_size = 0;
+  for (auto &tensor1 : tensors) {
+    used_size = std::max(used_size, tensor1.second->offset_ + tensor1.second->size_);
+    for (auto &tensor2 : tensors) {
+      if (tensor1.first == tensor2.first || input.constraints[tensor1.first].IsBitTrue(tensor2.first)) {
+        continue;
+      }
+      auto &t1 = tensor1.second;
+      auto &t2 = tensor2.second;
+      EXPECT_TRUE(t1->offset_ + t1->size_ <= t2->offset_ || t2->offset_ + t2->size_ <= t1->offset_)
+        << "tensors " << t1->index_ << " and " << t2->index_ << " overlap";
+    }
+  }
+  for (auto &continuous : input.continuous) {
+    for (size_t i = 1; i < continuous.size(); i++) {
+      auto &prev = tensors.at(continuous[i - 1]);
+      EXPECT_EQ(prev->offset_ + prev->size_, tensors.at(continuous[i])->offset_);
+    }
+  }
+  return used_size;
+}
+
+std::vector<size_t> OffsetsOf(const TensorsDescMap &tensors) {
+  std::vector<size_t> offsets(tensors.size());
+  for (auto &tensor : tensors) {
+    offsets[tensor.first] = tensor.second->offset_;
+  }
+  return offsets;
+}
+}  // namespace
+
+class TestSomasSolverPre : public UT::Common {
+ public:
+  void SetUp() override {
+    (void)unsetenv(kSomasSolverTries);
+    RemovePlans();
+  }
+  void TearDown() override {
+    (void)unsetenv(kSomasSolverTries);
+    RemovePlans();
+  }
+
+  // Solve the input with a new solver, return the memory the solver allocates
+  size_t Solve(const SolverInput &input, TensorsDescMap *tensors, size_t improve_tries = 0, size_t lower_bound = 0,
+               const std::string &plan_cache_dir = "") {
+    SomasSolverPre solver;
+    solver.SetImproveTries(improve_tries);
+    solver.SetLowerBound(lower_bound);
+    solver.SetPlanCacheDir(plan_cache_dir);
+    EXPECT_EQ(solver.Solving(graph_, tensors, &input.constraints, input.continuous, {}, true), SUCCESS);
+    EXPECT_EQ(CheckSolution(input, *tensors), solver.GetMaxOffset());
+    return solver.GetMaxOffset();
+  }
+
+  // Save a plan whose offsets are changed by the function, and check that it is not loaded
+  template <typename F>
+  void CheckPlanRejected(const SolverInput &input, F change) {
+    SomasSolverPre solver;
+    solver.SetPlanCacheDir(kPlanCacheDir);
+    auto tensors = MakeTensors(input);
+    ASSERT_EQ(solver.Solving(graph_, &tensors, &input.constraints, input.continuous, {}, true), SUCCESS);
+    auto fingerprint = solver.Fingerprint(tensors, &input.constraints, input.continuous);
+    change(&tensors);
+    solver.SavePlan(fingerprint, tensors);
+
+    SomasSolverPre other;
+    other.SetPlanCacheDir(kPlanCacheDir);
+    auto loaded = MakeTensors(input);
+    EXPECT_FALSE(other.LoadPlan(fingerprint, &loaded, &input.constraints, input.continuous));
+    EXPECT_EQ(OffsetsOf(loaded), std::vector<size_t>(input.sizes.size(), 0));
+    // the rejected plan is replaced by a solved one
+    (void)Solve(input, &loaded, 0, 0, kPlanCacheDir);
+  }
+
+  session::KernelGraph graph_;
+
+ private:
+  void RemovePlans() {
+    DIR *dir = opendir(kPlanCacheDir);
+    if (dir == nullptr) {
+      return;
+    }
+    for (struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+      (void)std::remove((std::string(kPlanCacheDir) + entry->d_name).c_str());
+    }
+    (void)closedir(dir);
+    (void)rmdir(kPlanCacheDir);
+  }
+};
+
+/// Feature: SOMAS solver plan cache
+/// Description: Fingerprint the same solver input twice, then inputs that differ in a size, a conflict, a contiguous
+///     list or the number of improvement tries
+/// Expectation: Only the same input gets the same fingerprint
+TEST_F(TestSomasSolverPre, TestFingerprint) {
+  auto input = SmallInput();
+  auto tensors = MakeTensors(input);
+  SomasSolverPre solver;
+  auto fingerprint = solver.Fingerprint(tensors, &input.constraints, input.continuous);
+  EXPECT_EQ(solver.Fingerprint(MakeTensors(input), &input.constraints, input.continuous), fingerprint);
+
+  auto other = input;
+  other.sizes[2] += 1;
+  EXPECT_NE(solver.Fingerprint(MakeTensors(other), &other.constraints, other.continuous), fingerprint);
+  other = input;
+  other.constraints[1].SetBit(2, false);
+  EXPECT_NE(solver.Fingerprint(MakeTensors(other), &other.constraints, other.continuous), fingerprint);
+  other = input;
+  other.continuous[0] = {2, 3};
+  EXPECT_NE(solver.Fingerprint(MakeTensors(other), &other.constraints, other.continuous), fingerprint);
+  solver.SetImproveTries(1);
+  EXPECT_NE(solver.Fingerprint(tensors, &input.constraints, input.continuous), fingerprint);
+}
+
+/// Feature: SOMAS solver plan cache
+/// Description: Solve an input with the plan cache, then solve the same input again with a new solver
+/// Expectation: The second solver loads the saved plan, which has the same offsets and size as the solved one
+TEST_F(TestSomasSolverPre, TestPlanRoundTrip) {
+  auto input = RandomInput(200, 1);
+  auto solved = MakeTensors(input);
+  auto max_offset = Solve(input, &solved, 0, 0, kPlanCacheDir);
+
+  SomasSolverPre solver;
+  solver.SetPlanCacheDir(kPlanCacheDir);
+  auto loaded = MakeTensors(input);
+  auto fingerprint = solver.Fingerprint(loaded, &input.constraints, input.continuous);
+  ASSERT_TRUE(solver.LoadPlan(fingerprint, &loaded, &input.constraints, input.continuous));
+  EXPECT_EQ(solver.GetMaxOffset(), max_offset);
+  EXPECT_EQ(OffsetsOf(loaded), OffsetsOf(solved));
+
+  auto other = input;
+  other.sizes[0] += 1;
+  auto other_tensors = MakeTensors(other);
+  EXPECT_FALSE(solver.LoadPlan(solver.Fingerprint(other_tensors, &other.constraints, other.continuous),
+                               &other_tensors, &other.constraints, other.continuous));
+}
+
+/// Feature: SOMAS solver plan cache
+/// Description: Load plans saved with the fingerprint of the input but which overlap two conflicting tensors, break
+///     a contiguous list or claim a wrong size
+/// Expectation: The plans are rejected, the offsets of the tensors are untouched and the input is solved again
+TEST_F(TestSomasSolverPre, TestMismatchedPlan) {
+  auto input = SmallInput();
+  CheckPlanRejected(input, [](TensorsDescMap *tensors) { (*tensors)[2]->offset_ = (*tensors)[0]->offset_; });
+  CheckPlanRejected(input, [](TensorsDescMap *tensors) { std::swap((*tensors)[1]->offset_, (*tensors)[3]->offset_); });
+  CheckPlanRejected(input, [](TensorsDescMap *tensors) {
+    for (auto &tensor : *tensors) {
+      tensor.second->offset_ += kTensorSize;
+    }
+  });
+}
+
+/// Feature: SOMAS solver improvement mode
+/// Description: Solve random inputs with and without improvement tries, then with a lower bound the heuristics
+///     already reach
+/// Expectation: The improved solutions are valid and never worse, no try improves a solution at the lower bound
+TEST_F(TestSomasSolverPre, TestImproveSolution) {
+  constexpr size_t kTries = 16;
+  for (unsigned int seed = 1; seed <= 3; seed++) {
+    auto input = RandomInput(200, seed);
+    auto heuristic = MakeTensors(input);
+    auto heuristic_size = Solve(input, &heuristic);
+    auto improved = MakeTensors(input);
+    EXPECT_LE(Solve(input, &improved, kTries), heuristic_size);
+    auto bounded = MakeTensors(input);
+    EXPECT_EQ(Solve(input, &bounded, kTries, heuristic_size), heuristic_size);
+    EXPECT_EQ(OffsetsOf(bounded), OffsetsOf(heuristic));
+  }
+}
+
+/// Feature: SOMAS solver improvement mode
+/// Description: Read the number of improvement tries from MS_DEV_SOMAS_SOLVER_TRIES, then solve with it
+/// Expectation: Unset or invalid values turn the improvement off, the solution with the tries is valid
+TEST_F(TestSomasSolverPre, TestSolverTriesEnv) {
+  EXPECT_EQ(SomasSolverPre::GetImproveTriesConfig(), static_cast<size_t>(0));
+  (void)setenv(kSomasSolverTries, "16", 1);
+  EXPECT_EQ(SomasSolverPre::GetImproveTriesConfig(), static_cast<size_t>(16));
+  auto input = RandomInput(200, 4);
+  auto heuristic = MakeTensors(input);
+  auto heuristic_size = Solve(input, &heuristic);
+  auto improved = MakeTensors(input);
+  EXPECT_LE(Solve(input, &improved, SomasSolverPre::GetImproveTriesConfig()), heuristic_size);
+
+  for (auto value : {"-1", "abc", "8x", "99999999999999999999999"}) {
+    (void)setenv(kSomasSolverTries, value, 1);
+    EXPECT_EQ(SomasSolverPre::GetImproveTriesConfig(), static_cast<size_t>(0)) << value;
+  }
+}
+}  // namespace somas
+}  // namespace mindspore
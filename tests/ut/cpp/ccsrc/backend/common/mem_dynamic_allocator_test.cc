@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 #include <random>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include "common/common_test.h"
 #include "include/backend/mem_reuse/mem_dynamic_allocator.h"
@@ -64,6 +66,11 @@ class DummyPool : public DynamicMemPoolBestFit {
   std::unordered_set<DeviceMemPtr> allocated_mems_;
 };
 
+class ThreadCachePool : public DummyPool {
+ public:
+  const bool IsEnableThreadCache() const override { return true; }
+};
+
 class TestMemDynamicAllocator : public UT::Common {
  public:
   TestMemDynamicAllocator() = default;
@@ -239,5 +246,56 @@ TEST_F(TestMemDynamicAllocator, test_malloc_with_multi_stream_id) {
   EXPECT_EQ(persitent_mem_pool->mem_bufs_[std::make_pair(stream1, DynamicMemBufStatus::kMemBufIdle)].size(),
             expected_size_two);
 }
+
+/// Feature: test memory malloc from the thread cache of mem dynamic allocator.
+/// Description: test small memory alloced and freed by many threads from the spans of the thread cache.
+/// Expectation: the spans are used memory of the common pool, and the spans all free are given back.
+TEST_F(TestMemDynamicAllocator, test_thread_cache) {
+  ThreadCachePool pool;
+  auto addr1 = pool.AllocTensorMem(1000);
+  EXPECT_EQ(pool.TotalUsedMemStatistics(), kThreadCacheSpanSize);
+  pool.FreeTensorMem(addr1);
+  EXPECT_EQ(pool.AllocTensorMem(1000), addr1);
+  // Big memory is from the best fit pool.
+  auto addr2 = pool.AllocTensorMem(kThreadCacheSpanSize);
+  EXPECT_EQ(pool.TotalUsedMemStatistics(), kThreadCacheSpanSize * 2);
+
+  const size_t thread_num = 4;
+  const size_t alloc_num = 1000;
+  std::vector<std::vector<DeviceMemPtr>> addrs(thread_num);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < thread_num; ++i) {
+    threads.emplace_back([&pool, &addrs, i]() {
+      for (size_t j = 0; j < alloc_num; ++j) {
+        auto addr = pool.AllocTensorMem((j % 64 + 1) * kDynamicMemAlignSize);
+        EXPECT_NE(addr, nullptr);
+        addrs[i].emplace_back(addr);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+  // Free the memory on another thread than the one which alloced it.
+  for (size_t i = 0; i < thread_num; ++i) {
+    threads.emplace_back([&pool, &addrs, i]() {
+      for (auto addr : addrs[(i + 1) % thread_num]) {
+        pool.FreeTensorMem(addr);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  // The threads gave back their free lists when they exited, only the span of addr1 is still used.
+  pool.thread_cache()->Scavenge();
+  EXPECT_EQ(pool.TotalUsedMemStatistics(), kThreadCacheSpanSize * 2);
+  auto statistics = pool.ThreadCacheMemStatistics();
+  EXPECT_EQ(statistics.span_mem_size_, kThreadCacheSpanSize);
+  EXPECT_GT(statistics.released_span_count_, expected_size_zero);
+  pool.FreeTensorMem(addr1);
+  pool.FreeTensorMem(addr2);
+}
 }  // namespace device
 }  // namespace mindspore
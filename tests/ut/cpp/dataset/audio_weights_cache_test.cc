@@ -0,0 +1,179 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/audio/kernels/audio_utils.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+constexpr int32_t kSampleRate = 16000;
+constexpr int32_t kNumFreqs = 201;
+constexpr int32_t kNumFrames = 101;
+constexpr int32_t kNumMels = 128;
+constexpr int32_t kNumMfcc = 40;
+
+// Create a random spectrogram of shape <channel, freq, time>
+std::shared_ptr<Tensor> RandomSpectrogram(int32_t channels) {
+  std::mt19937 rnd(0);
+  std::uniform_real_distribution<float> dist(0.0, 1.0);
+  std::vector<float> values(channels * kNumFreqs * kNumFrames);
+  for (auto &value : values) {
+    value = dist(rnd);
+  }
+  std::shared_ptr<Tensor> spectrogram;
+  (void)Tensor::CreateFromVector(values, TensorShape({channels, kNumFreqs, kNumFrames}), &spectrogram);
+  return spectrogram;
+}
+
+// The mel cepstrum computed as before the weights were cached, the filterbank and the DCT are built for each sample
+// and each frame is copied out of the matrix product of its channel
+Status MfccRebuildingWeights(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  std::shared_ptr<Tensor> fb;
+  RETURN_IF_NOT_OK(CreateFbanks<float>(&fb, kNumFreqs, 0.0, kSampleRate / 2.0, kNumMels, kSampleRate, NormType::kNone,
+                                       MelType::kHtk));
+  std::shared_ptr<Tensor> dct;
+  RETURN_IF_NOT_OK(Dct(&dct, kNumMfcc, kNumMels, NormMode::kOrtho));
+  Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_fb(&*fb->begin<float>(), kNumMels,
+                                                                             kNumFreqs);
+  Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_dm(&*dct->begin<float>(), kNumMfcc,
+                                                                             kNumMels);
+  const dsize_t channels = input->shape()[0];
+  std::vector<float> out;
+  Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic> mel;
+  Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic> mfcc;
+  for (dsize_t c = 0; c < channels; c++) {
+    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>> matrix_c(
+      &*input->begin<float>() + kNumFreqs * kNumFrames * c, kNumFrames, kNumFreqs);
+    mel.noalias() = matrix_c * matrix_fb.transpose();
+    mfcc.noalias() = mel * matrix_dm.transpose();
+    std::vector<float> vec_c(mfcc.data(), mfcc.data() + mfcc.size());
+    out.insert(out.end(), vec_c.begin(), vec_c.end());
+  }
+  return Tensor::CreateFromVector(out, TensorShape({channels, kNumMfcc, kNumFrames}), output);
+}
+
+// The mel cepstrum computed with the cached weights
+Status MfccCachedWeights(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  std::shared_ptr<Tensor> mel;
+  RETURN_IF_NOT_OK(MelScale<float>(input, &mel, kNumMels, kSampleRate, 0.0, kSampleRate / 2.0, kNumFreqs,
+                                   NormType::kNone, MelType::kHtk));
+  std::shared_ptr<const RowMajorMatrix<float>> dct_weights;
+  RETURN_IF_NOT_OK(DctWeights(&dct_weights, kNumMfcc, kNumMels, NormMode::kOrtho));
+  return ApplyWeights<float>(mel, *dct_weights, output);
+}
+}  // namespace
+
+class MindDataTestAudioWeightsCache : public UT::Common {
+ public:
+  MindDataTestAudioWeightsCache() = default;
+};
+
+/// Feature: MelFbankWeights, LinearFbankWeights and DctWeights
+/// Description: Test that the weights are shared by the calls with the same arguments
+/// Expectation: The same matrix is returned for the same arguments and a new one for other arguments
+TEST_F(MindDataTestAudioWeightsCache, TestShared) {
+  MS_LOG(INFO) << "Doing MindDataTestAudioWeightsCache-TestShared.";
+  std::shared_ptr<const RowMajorMatrix<float>> mel_1;
+  std::shared_ptr<const RowMajorMatrix<float>> mel_2;
+  std::shared_ptr<const RowMajorMatrix<float>> mel_3;
+  ASSERT_OK(MelFbankWeights<float>(&mel_1, kNumFreqs, 0.0, 8000.0, kNumMels, kSampleRate, NormType::kNone,
+                                   MelType::kHtk));
+  ASSERT_OK(MelFbankWeights<float>(&mel_2, kNumFreqs, 0.0, 8000.0, kNumMels, kSampleRate, NormType::kNone,
+                                   MelType::kHtk));
+  ASSERT_OK(MelFbankWeights<float>(&mel_3, kNumFreqs, 0.0, 8000.0, kNumMels, kSampleRate, NormType::kSlaney,
+                                   MelType::kHtk));
+  EXPECT_EQ(mel_1, mel_2);
+  EXPECT_NE(mel_1, mel_3);
+  EXPECT_EQ(mel_1->rows(), kNumMels);
+  EXPECT_EQ(mel_1->cols(), kNumFreqs);
+
+  std::shared_ptr<const RowMajorMatrix<float>> linear_1;
+  std::shared_ptr<const RowMajorMatrix<float>> linear_2;
+  ASSERT_OK(LinearFbankWeights(&linear_1, kNumFreqs, 0.0, 8000.0, kNumMels, kSampleRate));
+  ASSERT_OK(LinearFbankWeights(&linear_2, kNumFreqs, 0.0, 8000.0, kNumMels, kSampleRate));
+  EXPECT_EQ(linear_1, linear_2);
+
+  std::shared_ptr<const RowMajorMatrix<float>> dct_1;
+  std::shared_ptr<const RowMajorMatrix<float>> dct_2;
+  ASSERT_OK(DctWeights(&dct_1, kNumMfcc, kNumMels, NormMode::kOrtho));
+  ASSERT_OK(DctWeights(&dct_2, kNumMfcc, kNumMels, NormMode::kOrtho));
+  EXPECT_EQ(dct_1, dct_2);
+  EXPECT_EQ(dct_1->rows(), kNumMfcc);
+  EXPECT_EQ(dct_1->cols(), kNumMels);
+}
+
+/// Feature: ApplyWeights
+/// Description: Test the mel cepstrum of a spectrogram with the cached weights against the weights rebuilt for the
+///     sample
+/// Expectation: Both give the same result
+TEST_F(MindDataTestAudioWeightsCache, TestSameResult) {
+  MS_LOG(INFO) << "Doing MindDataTestAudioWeightsCache-TestSameResult.";
+  constexpr int32_t kChannels = 2;
+  std::shared_ptr<Tensor> input = RandomSpectrogram(kChannels);
+
+  std::shared_ptr<Tensor> expected;
+  std::shared_ptr<Tensor> actual;
+  ASSERT_OK(MfccRebuildingWeights(input, &expected));
+  ASSERT_OK(MfccCachedWeights(input, &actual));
+  ASSERT_EQ(expected->shape(), actual->shape());
+  auto expected_iter = expected->begin<float>();
+  for (auto iter = actual->begin<float>(); iter != actual->end<float>(); ++iter, ++expected_iter) {
+    EXPECT_NEAR(*iter, *expected_iter, 1e-3 * (1.0 + std::abs(*expected_iter)));
+  }
+}
+
+/// Feature: MelSpectrogram
+/// Description: Test the mel spectrogram of a float64 waveform, which goes through the float64 weights
+/// Expectation: The output is float64, as MelSpectrogramOp declares, and matches the output of the float32 waveform
+TEST_F(MindDataTestAudioWeightsCache, TestMelSpectrogramFloat64) {
+  MS_LOG(INFO) << "Doing MindDataTestAudioWeightsCache-TestMelSpectrogramFloat64.";
+  constexpr int32_t kLength = 400;
+  constexpr int32_t kNumFft = 64;
+  constexpr int32_t kHopLength = 16;
+  constexpr int32_t kMels = 16;
+  std::mt19937 rnd(0);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> values(kLength);
+  for (auto &value : values) {
+    value = dist(rnd);
+  }
+  std::shared_ptr<Tensor> waveform_f64;
+  ASSERT_OK(Tensor::CreateFromVector(values, TensorShape({1, kLength}), &waveform_f64));
+  std::shared_ptr<Tensor> waveform_f32;
+  ASSERT_OK(TypeCast(waveform_f64, &waveform_f32, DataType(DataType::DE_FLOAT32)));
+
+  std::shared_ptr<Tensor> mel_f64;
+  std::shared_ptr<Tensor> mel_f32;
+  ASSERT_OK(MelSpectrogram(waveform_f64, &mel_f64, kSampleRate, kNumFft, kNumFft, kHopLength, 0.0, kSampleRate / 2.0,
+                           0, kMels, WindowType::kHann, 2.0, false, true, BorderType::kReflect, true, NormType::kNone,
+                           MelType::kHtk));
+  ASSERT_OK(MelSpectrogram(waveform_f32, &mel_f32, kSampleRate, kNumFft, kNumFft, kHopLength, 0.0, kSampleRate / 2.0,
+                           0, kMels, WindowType::kHann, 2.0, false, true, BorderType::kReflect, true, NormType::kNone,
+                           MelType::kHtk));
+  EXPECT_EQ(mel_f64->type(), DataType(DataType::DE_FLOAT64));
+  EXPECT_EQ(mel_f32->type(), DataType(DataType::DE_FLOAT32));
+  ASSERT_EQ(mel_f64->shape(), mel_f32->shape());
+  auto f32_iter = mel_f32->begin<float>();
+  for (auto iter = mel_f64->begin<double>(); iter != mel_f64->end<double>(); ++iter, ++f32_iter) {
+    EXPECT_NEAR(*iter, *f32_iter, 1e-3 * (1.0 + std::abs(*iter)));
+  }
+}
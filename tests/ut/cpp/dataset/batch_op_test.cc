@@ -16,6 +16,8 @@
 #include <memory>
 #include <string>
 #include "minddata/dataset/core/client.h"
+#include "minddata/dataset/engine/datasetops/batch_op.h"
+#include "minddata/dataset/engine/datasetops/batch_slab.h"
 // #include "minddata/dataset/core/pybind_support.h"
 // #include "minddata/dataset/core/tensor.h"
 // #include "minddata/dataset/core/tensor_shape.h"
@@ -136,3 +138,98 @@ TEST_F(MindDataTestBatchOp, DISABLED_TestSimpleBatchPadding) {
     EXPECT_TRUE(rc.IsOk());
   }
 }
+
+/// Feature: BatchSlab
+/// Description: Fill the slots of a batch with the rows and batch them, then batch rows which are not all in their slot
+/// Expectation: The batched tensor is the slab itself in the first case and a copy of the rows in the second case
+TEST_F(MindDataTestBatchOp, TestBatchSlab) {
+  constexpr int32_t kBatchSize = 4;
+  constexpr size_t kMaxSlabs = 8;
+  auto slabs = std::make_shared<BatchSlabQueue>(kBatchSize, kMaxSlabs);
+  std::shared_ptr<BatchSlab> slab = slabs->NewSlab(0, 0);
+  std::shared_ptr<BatchSlab> skipped = slabs->NewSlab(0, 1);
+  std::shared_ptr<BatchSlab> next = slabs->NewSlab(0, 2);
+
+  auto table = std::make_unique<TensorQTable>();
+  for (int32_t i = 0; i < kBatchSize; i++) {
+    std::shared_ptr<Tensor> slot;
+    ASSERT_OK(slab->GetSlot(0, i, TensorShape({2, 3}), DataType(DataType::DE_INT32), &slot));
+    ASSERT_NE(slot, nullptr);
+    ASSERT_OK(slot->Fill<int32_t>(i));
+    EXPECT_TRUE(slab->IsSlot(0, i, slot));
+    (void)table->emplace_back(TensorRow(i, {slot}));
+  }
+  // a tensor of another shape does not fit the slots of the column
+  std::shared_ptr<Tensor> other;
+  ASSERT_OK(slab->GetSlot(0, 0, TensorShape({3, 2}), DataType(DataType::DE_INT32), &other));
+  EXPECT_EQ(other, nullptr);
+
+  EXPECT_EQ(slabs->PopSlab(0, 0), slab);
+  TensorRow batched;
+  ASSERT_OK(BatchOp::BatchRows(&table, &batched, false, false, slab));
+  ASSERT_EQ(batched.size(), 1);
+  EXPECT_EQ(batched[0]->shape(), TensorShape({kBatchSize, 2, 3}));
+  EXPECT_EQ(batched[0]->GetBuffer(), table->front()[0]->GetBuffer());
+  int32_t value = 0;
+  ASSERT_OK(batched[0]->GetItemAt(&value, {kBatchSize - 1, 1, 2}));
+  EXPECT_EQ(value, kBatchSize - 1);
+
+  // the rows of the batch are regrouped, the slab of the skipped batch is dropped
+  EXPECT_EQ(slabs->PopSlab(0, 2), next);
+  EXPECT_EQ(slabs->PopSlab(1, 0), nullptr);
+  auto partial = std::make_unique<TensorQTable>();
+  for (int32_t i = 0; i < 2; i++) {
+    std::shared_ptr<Tensor> slot;
+    ASSERT_OK(next->GetSlot(0, i, TensorShape({2}), DataType(DataType::DE_FLOAT32), &slot));
+    ASSERT_OK(slot->Fill<float>(1.0));
+    (void)partial->emplace_back(TensorRow(i, {slot}));
+  }
+  std::shared_ptr<Tensor> stray;
+  ASSERT_OK(next->GetSlot(0, 2, TensorShape({2}), DataType(DataType::DE_FLOAT32), &stray));
+  std::shared_ptr<Tensor> taken;
+  ASSERT_OK(next->TakeBatch(partial, 0, &taken));
+  EXPECT_EQ(taken, nullptr);
+  batched.clear();
+  ASSERT_OK(BatchOp::BatchRows(&partial, &batched, false, false, next));
+  ASSERT_EQ(batched.size(), 1);
+  EXPECT_EQ(batched[0]->shape(), TensorShape({2, 2}));
+  EXPECT_NE(batched[0]->GetBuffer(), partial->front()[0]->GetBuffer());
+}
+
+/// Feature: BatchSlabQueue
+/// Description: Drop the partial last batch of a round as drop_remainder does, reset the BatchOp in the middle of a
+///     round, then make more slabs than the queue holds
+/// Expectation: The slabs no batch takes are freed at the EOE or the reset, the slabs of the next round are kept, and
+///     no slab is made beyond the bound
+TEST_F(MindDataTestBatchOp, TestBatchSlabQueue) {
+  constexpr int32_t kBatchSize = 4;
+  constexpr size_t kMaxSlabs = 3;
+  auto slabs = std::make_shared<BatchSlabQueue>(kBatchSize, kMaxSlabs);
+
+  // round 0 has a full batch and a partial one that the BatchOp drops, the MapOp already started round 1
+  std::shared_ptr<BatchSlab> full = slabs->NewSlab(0, 0);
+  std::weak_ptr<BatchSlab> remainder = slabs->NewSlab(0, 1);
+  std::shared_ptr<BatchSlab> next_round = slabs->NewSlab(1, 0);
+  EXPECT_EQ(slabs->PopSlab(0, 0), full);
+  slabs->EndRound(0);
+  EXPECT_TRUE(remainder.expired());
+  EXPECT_EQ(slabs->NumSlabs(), 1);
+  EXPECT_EQ(slabs->PopSlab(1, 0), next_round);
+
+  // the BatchOp is reset while the slabs of the rest of the round wait
+  std::weak_ptr<BatchSlab> pending = slabs->NewSlab(1, 1);
+  (void)slabs->NewSlab(1, 2);
+  slabs->Clear();
+  EXPECT_TRUE(pending.expired());
+  EXPECT_EQ(slabs->NumSlabs(), 0);
+  EXPECT_EQ(slabs->PopSlab(1, 1), nullptr);
+
+  // the rows of the batches beyond the bound are copied as usual
+  for (int64_t batch = 0; batch < static_cast<int64_t>(kMaxSlabs); batch++) {
+    EXPECT_NE(slabs->NewSlab(2, batch), nullptr);
+  }
+  EXPECT_EQ(slabs->NewSlab(2, kMaxSlabs), nullptr);
+  EXPECT_EQ(slabs->NumSlabs(), kMaxSlabs);
+  EXPECT_NE(slabs->PopSlab(2, 0), nullptr);
+  EXPECT_NE(slabs->NewSlab(2, kMaxSlabs + 1), nullptr);
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/buffer_pool.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestBufferPool : public UT::Common {
+ public:
+  MindDataTestBufferPool() = default;
+};
+
+/// Feature: BufferPool
+/// Description: Test that freed blocks are reused and that Reallocate keeps the content
+/// Expectation: Blocks of the same size class are recycled instead of being allocated from the system
+TEST_F(MindDataTestBufferPool, TestReuse) {
+  MS_LOG(INFO) << "Doing MindDataTestBufferPool-TestReuse.";
+  BufferPool pool;
+  constexpr size_t kSmall = 1000;
+  constexpr size_t kLarge = 4 * 1024 * 1024;
+  for (int i = 0; i < 10; ++i) {
+    void *small = nullptr;
+    void *large = nullptr;
+    ASSERT_OK(pool.Allocate(kSmall, &small));
+    ASSERT_OK(pool.Allocate(kLarge, &large));
+    (void)memset(small, 1, kSmall);
+    (void)memset(large, 1, kLarge);
+    pool.Deallocate(small);
+    pool.Deallocate(large);
+  }
+  BufferPoolStats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocations, 20);
+  EXPECT_EQ(stats.num_system_allocs, 2);
+  EXPECT_EQ(stats.num_thread_hits, 9);
+  EXPECT_EQ(stats.num_central_hits, 9);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_GE(stats.bytes_cached, kSmall + kLarge);
+
+  void *p = nullptr;
+  ASSERT_OK(pool.Allocate(kSmall, &p));
+  (void)memset(p, 7, kSmall);
+  ASSERT_OK(pool.Reallocate(&p, kSmall, kLarge));
+  EXPECT_EQ(static_cast<uint8_t *>(p)[kSmall - 1], 7);
+  pool.Deallocate(p);
+
+  pool.Trim();
+  EXPECT_LT(pool.GetStats().bytes_cached, kLarge);
+}
+
+/// Feature: BufferPool
+/// Description: Test blocks allocated by one thread and freed by another, and blocks larger than the size classes
+/// Expectation: No block is lost and nothing is in use at the end
+TEST_F(MindDataTestBufferPool, TestCrossThread) {
+  MS_LOG(INFO) << "Doing MindDataTestBufferPool-TestCrossThread.";
+  BufferPool pool;
+  constexpr int kNumBlocks = 1000;
+  std::vector<void *> blocks(kNumBlocks, nullptr);
+  std::thread producer([&pool, &blocks]() {
+    for (int i = 0; i < kNumBlocks; ++i) {
+      ASSERT_OK(pool.Allocate(64 + i * 97, &blocks[i]));
+    }
+  });
+  producer.join();
+  std::thread consumer([&pool, &blocks]() {
+    for (void *block : blocks) {
+      pool.Deallocate(block);
+    }
+  });
+  consumer.join();
+
+  void *huge = nullptr;
+  constexpr size_t kHuge = 256 * 1024 * 1024;
+  ASSERT_OK(pool.Allocate(kHuge, &huge));
+  pool.Deallocate(huge);
+  BufferPoolStats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocations, kNumBlocks + 1);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+}
+
+/// Feature: BufferPool
+/// Description: Test that the tensors take their buffers from the pool of the global context
+/// Expectation: A tensor freed and created again with the same size reuses the buffer
+TEST_F(MindDataTestBufferPool, TestTensorBuffers) {
+  MS_LOG(INFO) << "Doing MindDataTestBufferPool-TestTensorBuffers.";
+  auto pool = std::dynamic_pointer_cast<BufferPool>(GlobalContext::Instance()->mem_pool());
+  ASSERT_NE(pool, nullptr);
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({224, 224, 3}), DataType(DataType::DE_UINT8), &tensor));
+  const uchar *buffer = tensor->GetBuffer();
+  tensor.reset();
+  uint64_t num_system_allocs = pool->GetStats().num_system_allocs;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({224, 224, 3}), DataType(DataType::DE_UINT8), &tensor));
+  EXPECT_EQ(tensor->GetBuffer(), buffer);
+  EXPECT_EQ(pool->GetStats().num_system_allocs, num_system_allocs);
+}
@@ -0,0 +1,303 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/engine/cache/cache_client.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+// Each test uses its own session, so that the caches of the tests are different segments.
+constexpr session_id_type kSessionCreateAttach = 0x1001;
+constexpr session_id_type kSessionFetch = 0x1002;
+constexpr session_id_type kSessionIndexFull = 0x1003;
+constexpr session_id_type kSessionSegmentFull = 0x1004;
+constexpr session_id_type kSessionBuildPhase = 0x1005;
+constexpr session_id_type kSessionDestroy = 0x1006;
+constexpr session_id_type kSessionOrphaned = 0x1007;
+constexpr session_id_type kSessionBenchmark = 0x1008;
+constexpr uint32_t kCrc = 1;
+// The slots of the index of a segment of 1MB, which is the minimum number of slots of the embedded cache
+constexpr row_id_type kMinNumSlots = 1024;
+
+std::shared_ptr<CacheClient> EmbeddedClient(session_id_type session_id, uint64_t cache_mem_sz) {
+  CacheClient::Builder builder;
+  builder.SetSessionId(session_id).SetCacheMemSz(cache_mem_sz).SetSpill(false).SetEmbedded(true);
+  std::shared_ptr<CacheClient> client;
+  Status rc = builder.Build(&client);
+  EXPECT_TRUE(rc.IsOk()) << rc.ToString();
+  return client;
+}
+
+// A row of a single column of the given number of int64 values, which are all the row id
+TensorRow MakeRow(row_id_type row_id, size_t num_values = 1) {
+  std::shared_ptr<Tensor> t;
+  Status rc = Tensor::CreateFromVector(std::vector<int64_t>(num_values, row_id), &t);
+  EXPECT_TRUE(rc.IsOk()) << rc.ToString();
+  TensorRow row(row_id, {t});
+  return row;
+}
+
+// The value of the row, -1 if the row is empty, i.e. not cached
+int64_t ValueOf(const TensorRow &row) {
+  if (row.empty()) {
+    return -1;
+  }
+  int64_t value = -1;
+  EXPECT_TRUE(row[0]->GetItemAt(&value, {0}).IsOk());
+  return value;
+}
+}  // namespace
+
+class MindDataTestCacheEmbedded : public UT::Common {
+ public:
+  MindDataTestCacheEmbedded() = default;
+};
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Test the first client creates the cache and the next client of the same session and pipeline
+///     attaches to it
+/// Expectation: Only the creator gets the cookie, the other client gets kMDDuplicateKey, and both see the rows
+TEST_F(MindDataTestCacheEmbedded, TestCreateAttach) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestCreateAttach.";
+  auto creator = EmbeddedClient(kSessionCreateAttach, 16);
+  ASSERT_OK(creator->CreateCache(kCrc, false));
+  EXPECT_FALSE(creator->cookie().empty());
+  EXPECT_TRUE(creator->IsEmbedded());
+
+  auto client = EmbeddedClient(kSessionCreateAttach, 16);
+  Status rc = client->CreateCache(kCrc, false);
+  EXPECT_EQ(rc.StatusCode(), StatusCode::kMDDuplicateKey);
+  EXPECT_TRUE(client->cookie().empty());
+
+  ASSERT_OK(creator->WriteRow(MakeRow(3)));
+  TensorTable rows;
+  ASSERT_OK(client->GetRows({3}, &rows));
+  ASSERT_EQ(rows.size(), 1);
+  EXPECT_EQ(ValueOf(rows[0]), 3);
+  ASSERT_OK(creator->DestroyCache());
+}
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Test CacheRow and BatchFetchRows of a cache of a mappable dataset, with hits, misses and a duplicate
+/// Expectation: The cached rows are returned, a key not cached returns an empty row, a duplicate key is ignored
+TEST_F(MindDataTestCacheEmbedded, TestCacheRowFetch) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestCacheRowFetch.";
+  auto client = EmbeddedClient(kSessionFetch, 16);
+  ASSERT_OK(client->CreateCache(kCrc, false));
+  for (row_id_type i = 0; i < 10; i += 2) {
+    ASSERT_OK(client->WriteRow(MakeRow(i)));
+  }
+  TensorTable rows;
+  ASSERT_OK(client->GetRows({0, 1, 2, 8, 9, 100}, &rows));
+  ASSERT_EQ(rows.size(), 6);
+  EXPECT_EQ(ValueOf(rows[0]), 0);
+  EXPECT_EQ(ValueOf(rows[1]), -1);
+  EXPECT_EQ(ValueOf(rows[2]), 2);
+  EXPECT_EQ(ValueOf(rows[3]), 8);
+  EXPECT_EQ(ValueOf(rows[4]), -1);
+  EXPECT_EQ(ValueOf(rows[5]), -1);
+
+  // The first row of a key is kept
+  TensorRow duplicate = MakeRow(4, 2);
+  ASSERT_OK(client->WriteRow(duplicate));
+  CacheServiceStat stat{};
+  ASSERT_OK(client->GetStat(&stat));
+  EXPECT_EQ(stat.num_mem_cached, 5);
+  EXPECT_EQ(stat.min_row_id, 0);
+  EXPECT_EQ(stat.max_row_id, 8);
+  rows.clear();
+  ASSERT_OK(client->GetRows({4}, &rows));
+  ASSERT_EQ(rows.size(), 1);
+  ASSERT_FALSE(rows[0].empty());
+  EXPECT_EQ(rows[0][0]->Size(), 1);
+  ASSERT_OK(client->DestroyCache());
+}
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Test caching more small rows than the slots of the index of a segment
+/// Expectation: The rows beyond the index are rejected with kMDOutOfMemory, the rows cached are still found
+TEST_F(MindDataTestCacheEmbedded, TestIndexFull) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestIndexFull.";
+  // A segment of 1MB has the minimum number of slots, and room for many more small rows.
+  auto client = EmbeddedClient(kSessionIndexFull, 1);
+  ASSERT_OK(client->CreateCache(kCrc, false));
+  Status rc;
+  row_id_type i = 0;
+  for (; i <= kMinNumSlots; ++i) {
+    rc = client->WriteRow(MakeRow(i));
+    if (rc.IsError()) {
+      break;
+    }
+  }
+  EXPECT_EQ(rc.StatusCode(), StatusCode::kMDOutOfMemory);
+  EXPECT_EQ(i, kMinNumSlots);
+  TensorTable rows;
+  ASSERT_OK(client->GetRows({0, i - 1, i}, &rows));
+  EXPECT_EQ(ValueOf(rows[0]), 0);
+  EXPECT_EQ(ValueOf(rows[1]), i - 1);
+  EXPECT_EQ(ValueOf(rows[2]), -1);
+  ASSERT_OK(client->DestroyCache());
+}
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Test caching more bytes than the segment holds
+/// Expectation: The row which does not fit is rejected with kMDOutOfMemory, the rows cached are still found
+TEST_F(MindDataTestCacheEmbedded, TestSegmentFull) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestSegmentFull.";
+  constexpr size_t kNumValues = 16384;  // 128KB a row
+  auto client = EmbeddedClient(kSessionSegmentFull, 1);
+  ASSERT_OK(client->CreateCache(kCrc, false));
+  Status rc;
+  row_id_type i = 0;
+  for (; i < 10; ++i) {
+    rc = client->WriteRow(MakeRow(i, kNumValues));
+    if (rc.IsError()) {
+      break;
+    }
+  }
+  EXPECT_EQ(rc.StatusCode(), StatusCode::kMDOutOfMemory);
+  EXPECT_GT(i, 0);
+  EXPECT_LT(i, 8);
+  TensorTable rows;
+  ASSERT_OK(client->GetRows({0, i}, &rows));
+  EXPECT_EQ(ValueOf(rows[0]), 0);
+  EXPECT_EQ(ValueOf(rows[1]), -1);
+  ASSERT_OK(client->DestroyCache());
+}
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Test the build phase of a cache of a non-mappable dataset, which only the creator may write to
+/// Expectation: Rows are accepted with the cookie in the build phase only, and fetched in the fetch phase only
+TEST_F(MindDataTestCacheEmbedded, TestBuildPhase) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestBuildPhase.";
+  auto creator = EmbeddedClient(kSessionBuildPhase, 16);
+  ASSERT_OK(creator->CreateCache(kCrc, true));
+  auto client = EmbeddedClient(kSessionBuildPhase, 16);
+  EXPECT_EQ(client->CreateCache(kCrc, true).StatusCode(), StatusCode::kMDDuplicateKey);
+
+  // The row ids are generated
+  row_id_type row_id = -1;
+  ASSERT_OK(creator->WriteRow(MakeRow(100), &row_id));
+  EXPECT_EQ(row_id, 0);
+  ASSERT_OK(creator->WriteRow(MakeRow(101), &row_id));
+  EXPECT_EQ(row_id, 1);
+  // Without the cookie
+  EXPECT_ERROR(client->WriteRow(MakeRow(102)));
+  EXPECT_ERROR(client->BuildPhaseDone());
+  TensorTable rows;
+  EXPECT_ERROR(client->GetRows({0}, &rows));
+  int8_t state = 0;
+  ASSERT_OK(client->GetState(&state));
+  EXPECT_EQ(static_cast<CacheServiceState>(state), CacheServiceState::kBuildPhase);
+
+  ASSERT_OK(creator->BuildPhaseDone());
+  ASSERT_OK(client->GetState(&state));
+  EXPECT_EQ(static_cast<CacheServiceState>(state), CacheServiceState::kFetchPhase);
+  EXPECT_ERROR(creator->WriteRow(MakeRow(103)));
+  ASSERT_OK(client->GetRows({0, 1, 2}, &rows));
+  ASSERT_EQ(rows.size(), 3);
+  EXPECT_EQ(ValueOf(rows[0]), 100);
+  EXPECT_EQ(ValueOf(rows[1]), 101);
+  EXPECT_EQ(ValueOf(rows[2]), -1);
+  ASSERT_OK(creator->DestroyCache());
+}
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Test creating the cache again after it is destroyed
+/// Expectation: The new cache is created empty rather than attached to the destroyed one
+TEST_F(MindDataTestCacheEmbedded, TestDestroyCache) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestDestroyCache.";
+  auto client = EmbeddedClient(kSessionDestroy, 16);
+  ASSERT_OK(client->CreateCache(kCrc, false));
+  ASSERT_OK(client->WriteRow(MakeRow(1)));
+  ASSERT_OK(client->DestroyCache());
+
+  auto client2 = EmbeddedClient(kSessionDestroy, 16);
+  ASSERT_OK(client2->CreateCache(kCrc, false));
+  EXPECT_FALSE(client2->cookie().empty());
+  CacheServiceStat stat{};
+  ASSERT_OK(client2->GetStat(&stat));
+  EXPECT_EQ(stat.num_mem_cached, 0);
+  ASSERT_OK(client2->DestroyCache());
+}
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Test creating a cache whose segment is left by a process which exited in the build phase
+/// Expectation: The orphaned segment is removed and the cache is created again, rather than waiting for the build
+///     phase of the exited process
+TEST_F(MindDataTestCacheEmbedded, TestOrphanedSegment) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestOrphanedSegment.";
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    // Leave without detaching or destroying anything, as if the process crashed.
+    auto client = EmbeddedClient(kSessionOrphaned, 16);
+    bool ok = client->CreateCache(kCrc, true).IsOk() && client->WriteRow(MakeRow(1)).IsOk();
+    _exit(ok ? 0 : 1);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+
+  auto client = EmbeddedClient(kSessionOrphaned, 16);
+  ASSERT_OK(client->CreateCache(kCrc, true));
+  EXPECT_FALSE(client->cookie().empty());
+  CacheServiceStat stat{};
+  ASSERT_OK(client->GetStat(&stat));
+  EXPECT_EQ(stat.num_mem_cached, 0);
+  EXPECT_EQ(static_cast<CacheServiceState>(stat.cache_service_state), CacheServiceState::kBuildPhase);
+  ASSERT_OK(client->DestroyCache());
+}
+
+/// Feature: CacheEmbeddedGreeter
+/// Description: Benchmark the per row latency of fetching rows from the embedded cache in batches
+/// Expectation: All the rows are found, the latency is logged
+TEST_F(MindDataTestCacheEmbedded, TestFetchBenchmark) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheEmbedded-TestFetchBenchmark.";
+  constexpr row_id_type kNumRows = 4096;
+  constexpr size_t kNumValues = 1024;  // 8KB a row
+  constexpr size_t kBatchSize = 32;
+  auto client = EmbeddedClient(kSessionBenchmark, 256);
+  ASSERT_OK(client->CreateCache(kCrc, false));
+  for (row_id_type i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(client->WriteRow(MakeRow(i, kNumValues)));
+  }
+  std::vector<row_id_type> keys;
+  auto start = std::chrono::steady_clock::now();
+  for (row_id_type i = 0; i < kNumRows; i += kBatchSize) {
+    keys.clear();
+    for (row_id_type k = i; k < i + static_cast<row_id_type>(kBatchSize); ++k) {
+      keys.push_back(k);
+    }
+    TensorTable rows;
+    ASSERT_OK(client->GetRows(keys, &rows));
+    ASSERT_EQ(ValueOf(rows.back()), keys.back());
+  }
+  auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  MS_LOG(INFO) << "Fetched " << kNumRows << " rows of " << kNumValues * sizeof(int64_t)
+               << " bytes from the embedded cache in batches of " << kBatchSize << ", " << elapsed / kNumRows
+               << " us a row.";
+  ASSERT_OK(client->DestroyCache());
+}
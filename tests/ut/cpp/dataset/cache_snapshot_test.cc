@@ -0,0 +1,185 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/engine/cache/cache_snapshot.h"
+#include "utils/log_adapter.h"
+#include "utils/system/crc32c.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+constexpr char kSchema[] = "{\"columns\":{\"image\":{\"type\":\"uint8\"}}}";
+// Fields of the header of a snapshot file
+constexpr size_t kChecksumPos = 36;
+constexpr size_t kSchemaOffsetPos = 48;
+constexpr size_t kSchemaSizePos = 56;
+constexpr size_t kIndexOffsetPos = 64;
+constexpr size_t kFileSizePos = 80;
+// Fields of an entry of the index
+constexpr size_t kIndexEntrySize = 24;
+constexpr size_t kEntryOffsetPos = 8;
+
+// The content of the row of a key, of a size that varies with the key
+std::string RowOf(int64_t key) { return std::string(static_cast<size_t>(key % 7 + 1) * 100, 'a' + key % 26); }
+
+std::vector<char> ReadFile(const Path &file) {
+  std::ifstream ifs(file.ToString(), std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+void WriteFile(const Path &file, const std::vector<char> &content) {
+  std::ofstream ofs(file.ToString(), std::ios::binary | std::ios::trunc);
+  ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+template <typename T>
+T Get(const std::vector<char> &content, size_t pos) {
+  T value;
+  (void)memcpy(&value, content.data() + pos, sizeof(T));
+  return value;
+}
+
+template <typename T>
+void Put(std::vector<char> *content, size_t pos, T value) {
+  (void)memcpy(content->data() + pos, &value, sizeof(T));
+}
+}  // namespace
+
+class MindDataTestCacheSnapshot : public UT::Common {
+ public:
+  void SetUp() override {
+    info_.fingerprint.pipeline = 0x1234;
+    info_.fingerprint.source = 0x5678;
+    info_.generate_id = false;
+    file_ = CacheSnapshot::FileOf(".", info_.fingerprint);
+    (void)file_.Remove();
+  }
+
+  void TearDown() override { (void)file_.Remove(); }
+
+  // Save a snapshot of the rows of the keys
+  Status Save(const std::vector<int64_t> &keys) {
+    std::vector<std::pair<CacheSnapshot::key_type, size_t>> rows;
+    for (auto key : keys) {
+      rows.emplace_back(key, RowOf(key).size());
+    }
+    auto read_row = [](CacheSnapshot::key_type key, WritableSlice *dest) -> Status {
+      std::string row = RowOf(key);
+      return WritableSlice::Copy(dest, ReadableSlice(row.data(), row.size()));
+    };
+    return CacheSnapshot::Create(file_, info_, kSchema, std::move(rows), read_row);
+  }
+
+  CacheSnapshot::Info info_;
+  Path file_{"."};
+};
+
+/// Feature: CacheSnapshot
+/// Description: Test saving the rows of a cache and loading them back
+/// Expectation: The schema and all the rows are loaded, keys not saved are not found
+TEST_F(MindDataTestCacheSnapshot, TestSaveLoad) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheSnapshot-TestSaveLoad.";
+  std::vector<int64_t> keys = {9, 3, 27, 0, 14, 5};
+  ASSERT_OK(Save(keys));
+  std::shared_ptr<CacheSnapshot> snapshot;
+  ASSERT_OK(CacheSnapshot::Open(file_, info_, &snapshot));
+  EXPECT_EQ(snapshot->GetSchema(), kSchema);
+  ASSERT_EQ(snapshot->NumRows(), keys.size());
+  for (size_t i = 1; i < snapshot->NumRows(); ++i) {
+    EXPECT_LT(snapshot->KeyAt(i - 1), snapshot->KeyAt(i));
+  }
+  for (auto key : keys) {
+    ReadableSlice row = snapshot->Find(key);
+    ASSERT_EQ(row.GetSize(), RowOf(key).size());
+    EXPECT_EQ(std::string(static_cast<const char *>(row.GetPointer()), row.GetSize()), RowOf(key));
+  }
+  EXPECT_EQ(snapshot->Find(1).GetSize(), 0);
+}
+
+/// Feature: CacheSnapshot
+/// Description: Test opening a snapshot that does not exist or was saved by another pipeline
+/// Expectation: kMDFileNotExist if there is no file, an error if the fingerprints or the kind of cache differ
+TEST_F(MindDataTestCacheSnapshot, TestMismatch) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheSnapshot-TestMismatch.";
+  std::shared_ptr<CacheSnapshot> snapshot;
+  Status rc = CacheSnapshot::Open(file_, info_, &snapshot);
+  EXPECT_EQ(rc.StatusCode(), StatusCode::kMDFileNotExist);
+
+  ASSERT_OK(Save({1, 2, 3}));
+  CacheSnapshot::Info other = info_;
+  other.fingerprint.pipeline += 1;
+  EXPECT_ERROR(CacheSnapshot::Open(file_, other, &snapshot));
+  other = info_;
+  other.fingerprint.source += 1;
+  EXPECT_ERROR(CacheSnapshot::Open(file_, other, &snapshot));
+  other = info_;
+  other.generate_id = true;
+  EXPECT_ERROR(CacheSnapshot::Open(file_, other, &snapshot));
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+/// Feature: CacheSnapshot
+/// Description: Test opening a snapshot file that is truncated
+/// Expectation: The file is rejected, whether it is cut in the rows or in the header
+TEST_F(MindDataTestCacheSnapshot, TestTruncated) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheSnapshot-TestTruncated.";
+  ASSERT_OK(Save({1, 2, 3}));
+  std::vector<char> content = ReadFile(file_);
+  std::shared_ptr<CacheSnapshot> snapshot;
+
+  WriteFile(file_, std::vector<char>(content.begin(), content.end() - 1));
+  EXPECT_ERROR(CacheSnapshot::Open(file_, info_, &snapshot));
+  WriteFile(file_, std::vector<char>(content.begin(), content.begin() + kChecksumPos));
+  EXPECT_ERROR(CacheSnapshot::Open(file_, info_, &snapshot));
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+/// Feature: CacheSnapshot
+/// Description: Test opening a snapshot file whose schema is corrupted, and one whose index points a row out of the
+///     file while its checksum is made to match
+/// Expectation: Both files are rejected
+TEST_F(MindDataTestCacheSnapshot, TestCorrupted) {
+  MS_LOG(INFO) << "Doing MindDataTestCacheSnapshot-TestCorrupted.";
+  ASSERT_OK(Save({1, 2, 3}));
+  const std::vector<char> content = ReadFile(file_);
+  std::shared_ptr<CacheSnapshot> snapshot;
+
+  std::vector<char> corrupted = content;
+  corrupted[Get<uint64_t>(content, kSchemaOffsetPos)] ^= 1;
+  WriteFile(file_, corrupted);
+  EXPECT_ERROR(CacheSnapshot::Open(file_, info_, &snapshot));
+
+  corrupted = content;
+  auto schema_offset = Get<uint64_t>(content, kSchemaOffsetPos);
+  auto schema_size = Get<uint64_t>(content, kSchemaSizePos);
+  auto index_offset = Get<uint64_t>(content, kIndexOffsetPos);
+  auto file_size = Get<uint64_t>(content, kFileSizePos);
+  Put<uint64_t>(&corrupted, index_offset + kEntryOffsetPos, file_size + 1);
+  uint32_t crc = mindspore::system::Crc32c::MakeCrc32c(0, corrupted.data() + schema_offset, schema_size);
+  crc = mindspore::system::Crc32c::MakeCrc32c(crc, corrupted.data() + index_offset, 3 * kIndexEntrySize);
+  Put<uint32_t>(&corrupted, kChecksumPos, crc);
+  WriteFile(file_, corrupted);
+  EXPECT_ERROR(CacheSnapshot::Open(file_, info_, &snapshot));
+  EXPECT_EQ(snapshot, nullptr);
+}
@@ -13,6 +13,11 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+
 #include "common/common.h"
 #include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/serdes.h"
@@ -481,6 +486,46 @@ TEST_F(MindDataTestDeserialize, TestDeserializeTextfile) {
   compare_dataset(ds);
 }
 
+/// Feature: Fingerprint
+/// Description: Test Fingerprint of the IR trees, on which a persistent cache is keyed
+/// Expectation: The fingerprints change with the parameters of the pipeline and with the dataset files only
+TEST_F(MindDataTestDeserialize, TestFingerprint) {
+  MS_LOG(INFO) << "Doing MindDataTestDeserialize-Fingerprint.";
+  std::string data_dir = "./data/dataset/testMnistData";
+  auto make_mnist = [&data_dir](int32_t num_workers, float prob) {
+    std::shared_ptr<SamplerObj> sampler = std::make_shared<SequentialSamplerObj>(0, 10);
+    std::shared_ptr<DatasetNode> ds = std::make_shared<MnistNode>(data_dir, "all", sampler, nullptr);
+    std::shared_ptr<TensorOperation> operation = std::make_shared<vision::RandomHorizontalFlipOperation>(prob);
+    std::vector<std::shared_ptr<TensorOperation>> ops = {operation};
+    ds = std::make_shared<MapNode>(ds, ops);
+    return ds->SetNumWorkers(num_workers);
+  };
+  uint64_t pipeline_fp1 = 0;
+  uint64_t source_fp1 = 0;
+  ASSERT_OK(Serdes::Fingerprint(make_mnist(2, 0.5), &pipeline_fp1, &source_fp1));
+  EXPECT_NE(pipeline_fp1, 0ULL);
+  uint64_t pipeline_fp2 = 0;
+  uint64_t source_fp2 = 0;
+  // The number of workers does not change the rows
+  ASSERT_OK(Serdes::Fingerprint(make_mnist(8, 0.5), &pipeline_fp2, &source_fp2));
+  EXPECT_EQ(pipeline_fp1, pipeline_fp2);
+  EXPECT_EQ(source_fp1, source_fp2);
+  ASSERT_OK(Serdes::Fingerprint(make_mnist(2, 0.8), &pipeline_fp2, &source_fp2));
+  EXPECT_NE(pipeline_fp1, pipeline_fp2);
+
+  // A change of a dataset file changes the source fingerprint only
+  std::string file = "./fingerprint_test_" + std::to_string(getpid()) + ".txt";
+  std::ofstream(file) << "This is a text file.\n";
+  std::shared_ptr<DatasetNode> ds =
+    std::make_shared<TextFileNode>(std::vector<std::string>{file}, 0, ShuffleMode::kFalse, 1, 0, nullptr);
+  ASSERT_OK(Serdes::Fingerprint(ds, &pipeline_fp1, &source_fp1));
+  std::ofstream(file, std::ios::app) << "Be happy every day.\n";
+  ASSERT_OK(Serdes::Fingerprint(ds, &pipeline_fp2, &source_fp2));
+  EXPECT_EQ(pipeline_fp1, pipeline_fp2);
+  EXPECT_NE(source_fp1, source_fp2);
+  (void)std::remove(file.c_str());
+}
+
 /// Feature: Deserialize
 /// Description: Test Deserialize with invalid json path or object
 /// Expectation: Throw correct error and message
@@ -0,0 +1,76 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/audio/kernels/fft_plan.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestFftPlan : public UT::Common {
+ public:
+  MindDataTestFftPlan() = default;
+};
+
+/// Feature: RealFftPlan
+/// Description: Test the spectrum of random signals of lengths with radix 2, 3, 4 and other prime factors
+/// Expectation: The spectrum is equal to the one computed by the definition of the DFT
+TEST_F(MindDataTestFftPlan, TestForward) {
+  MS_LOG(INFO) << "Doing MindDataTestFftPlan-TestForward.";
+  std::mt19937 rnd(0);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (int32_t n_fft : {1, 2, 3, 7, 12, 15, 16, 50, 98, 400, 511, 512}) {
+    std::shared_ptr<const RealFftPlan<double>> plan;
+    ASSERT_OK(RealFftPlan<double>::Get(n_fft, &plan));
+    ASSERT_EQ(plan->num_bins(), n_fft / 2 + 1);
+    std::vector<double> signal(n_fft);
+    for (auto &value : signal) {
+      value = dist(rnd);
+    }
+    // leave a gap between the bins to check the stride
+    constexpr int64_t kStride = 3;
+    std::vector<double> spectrum(plan->num_bins() * kStride);
+    plan->Forward(signal.data(), spectrum.data(), kStride);
+    for (int32_t k = 0; k < plan->num_bins(); ++k) {
+      double re = 0;
+      double im = 0;
+      for (int32_t j = 0; j < n_fft; ++j) {
+        double angle = 2 * M_PI * j * k / n_fft;
+        re += signal[j] * std::cos(angle);
+        im -= signal[j] * std::sin(angle);
+      }
+      EXPECT_NEAR(spectrum[k * kStride], re, 1e-9);
+      EXPECT_NEAR(spectrum[k * kStride + 1], im, 1e-9);
+    }
+  }
+}
+
+/// Feature: RealFftPlan
+/// Description: Test that the plans are shared by the calls with the same length
+/// Expectation: The same plan is returned and a non-positive length is rejected
+TEST_F(MindDataTestFftPlan, TestCache) {
+  MS_LOG(INFO) << "Doing MindDataTestFftPlan-TestCache.";
+  std::shared_ptr<const RealFftPlan<float>> plan1;
+  std::shared_ptr<const RealFftPlan<float>> plan2;
+  ASSERT_OK(RealFftPlan<float>::Get(400, &plan1));
+  ASSERT_OK(RealFftPlan<float>::Get(400, &plan2));
+  EXPECT_EQ(plan1.get(), plan2.get());
+  EXPECT_ERROR(RealFftPlan<float>::Get(0, &plan1));
+}
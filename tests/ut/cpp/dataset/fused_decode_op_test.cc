@@ -0,0 +1,122 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/data/compose_op.h"
+#include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/fused_decode_op.h"
+#include "minddata/dataset/kernels/image/horizontal_flip_op.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestFusedDecodeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestFusedDecodeOp() : CVOpCommon() {}
+
+  // run the ops fused and one by one on the jpeg input, and return the mean absolute difference of the outputs
+  void RunFusedAndUnfused(const std::vector<std::shared_ptr<TensorOp>> &ops, std::shared_ptr<Tensor> *fused_output,
+                          double *mean_diff) {
+    FusedDecodeOp fused_op(ops);
+    ComposeOp compose_op(ops);
+    TensorRow fused_row, unfused_row;
+    ASSERT_OK(fused_op.Compute(TensorRow{raw_input_tensor_}, &fused_row));
+    ASSERT_OK(compose_op.Compute(TensorRow{raw_input_tensor_}, &unfused_row));
+    ASSERT_EQ(fused_row.size(), 1);
+    ASSERT_EQ(unfused_row.size(), 1);
+    ASSERT_EQ(fused_row[0]->shape(), unfused_row[0]->shape());
+    ASSERT_EQ(fused_row[0]->type(), unfused_row[0]->type());
+
+    std::shared_ptr<Tensor> fused, unfused;
+    ASSERT_OK(TypeCast(fused_row[0], &fused, DataType(DataType::DE_FLOAT32)));
+    ASSERT_OK(TypeCast(unfused_row[0], &unfused, DataType(DataType::DE_FLOAT32)));
+    double diff_sum = 0;
+    auto unfused_itr = unfused->begin<float>();
+    for (auto itr = fused->begin<float>(); itr != fused->end<float>(); ++itr, ++unfused_itr) {
+      diff_sum += std::abs(*itr - *unfused_itr);
+    }
+    *mean_diff = diff_sum / fused->Size();
+    *fused_output = fused_row[0];
+  }
+};
+
+/// Feature: FusedDecode op
+/// Description: Test FusedDecodeOp with Decode, CenterCrop, HorizontalFlip, Normalize and HWC2CHW
+/// Expectation: Output differs from running the ops one by one by a mean absolute difference below 0.05, as
+///     JpegCropAndDecode decodes the crop only, at scale_denom 1, and the chroma at its edges is upsampled from fewer
+///     neighbours than in the whole decoded image
+TEST_F(MindDataTestFusedDecodeOp, TestCropFlipNormalizeHwcToChw) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedDecodeOp-TestCropFlipNormalizeHwcToChw.";
+  constexpr int32_t crop_height = 100;
+  constexpr int32_t crop_width = 120;
+  std::vector<std::shared_ptr<TensorOp>> ops = {
+    std::make_shared<DecodeOp>(true), std::make_shared<CenterCropOp>(crop_height, crop_width),
+    std::make_shared<HorizontalFlipOp>(),
+    std::make_shared<NormalizeOp>(std::vector<float>{121.0, 115.0, 100.0}, std::vector<float>{70.0, 68.0, 71.0}, true),
+    std::make_shared<HwcToChwOp>()};
+  std::shared_ptr<Tensor> output;
+  double mean_diff = 0;
+  RunFusedAndUnfused(ops, &output, &mean_diff);
+  ASSERT_NE(output, nullptr);
+  EXPECT_EQ(output->shape(), TensorShape({3, crop_height, crop_width}));
+  EXPECT_EQ(output->type(), DataType(DataType::DE_FLOAT32));
+  constexpr double kMaxMeanDiff = 0.05;
+  EXPECT_LT(mean_diff, kMaxMeanDiff);
+}
+
+/// Feature: FusedDecode op
+/// Description: Test FusedDecodeOp with Decode and a Resize which shrinks the image with the scaled IDCT
+/// Expectation: Output differs from running the ops one by one by a mean absolute difference below 5.0 of 255, as
+///     JpegCropAndDecode decodes with a scale_denom above 1, whose scaled IDCT gives other pixels than decoding the
+///     whole image and shrinking it with the Resize
+TEST_F(MindDataTestFusedDecodeOp, TestResizeScaledDecode) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedDecodeOp-TestResizeScaledDecode.";
+  constexpr int32_t height = 64;
+  constexpr int32_t width = 48;
+  std::vector<std::shared_ptr<TensorOp>> ops = {std::make_shared<DecodeOp>(true),
+                                                std::make_shared<ResizeOp>(height, width)};
+  std::shared_ptr<Tensor> output;
+  double mean_diff = 0;
+  RunFusedAndUnfused(ops, &output, &mean_diff);
+  ASSERT_NE(output, nullptr);
+  EXPECT_EQ(output->shape(), TensorShape({height, width, 3}));
+  EXPECT_EQ(output->type(), DataType(DataType::DE_UINT8));
+  constexpr double kMaxMeanDiff = 5.0;
+  EXPECT_LT(mean_diff, kMaxMeanDiff);
+}
+
+/// Feature: FusedDecode op
+/// Description: Test FusedDecodeOp with a chain which can not be fused, a Normalize of CHW input
+/// Expectation: The ops are run one by one and the output is the same
+TEST_F(MindDataTestFusedDecodeOp, TestUnfusibleChain) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedDecodeOp-TestUnfusibleChain.";
+  std::vector<std::shared_ptr<TensorOp>> ops = {
+    std::make_shared<DecodeOp>(true), std::make_shared<HwcToChwOp>(),
+    std::make_shared<NormalizeOp>(std::vector<float>{121.0}, std::vector<float>{70.0}, false)};
+  std::shared_ptr<Tensor> output;
+  double mean_diff = 1.0;
+  RunFusedAndUnfused(ops, &output, &mean_diff);
+  EXPECT_EQ(mean_diff, 0.0);
+}
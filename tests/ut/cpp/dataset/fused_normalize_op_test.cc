@@ -0,0 +1,110 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/data/compose_op.h"
+#include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/kernels/data/type_cast_op.h"
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/normalize_pad_op.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestFusedNormalizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestFusedNormalizeOp() : CVOpCommon() {}
+
+  // run the fused op and the ops it replaces on the input, and check that the outputs are the same
+  void CheckFusedAndUnfused(const std::shared_ptr<Tensor> &input, bool pad, bool to_chw, const std::string &dtype) {
+    const std::vector<float> mean = {121.0, 115.0, 100.0};
+    const std::vector<float> std = {70.0, 68.0, 71.0};
+    std::vector<std::shared_ptr<TensorOp>> ops;
+    if (pad) {
+      ops.push_back(std::make_shared<NormalizePadOp>(mean, std, dtype, true));
+    } else {
+      ops.push_back(std::make_shared<NormalizeOp>(mean, std, true));
+    }
+    if (to_chw) {
+      ops.push_back(std::make_shared<HwcToChwOp>());
+    }
+    if (!pad) {
+      ops.push_back(std::make_shared<TypeCastOp>(dtype));
+    }
+    FusedNormalizeOp fused_op(mean, std, pad, to_chw, dtype);
+    ComposeOp compose_op(ops);
+    std::shared_ptr<Tensor> fused_output;
+    TensorRow unfused_row;
+    ASSERT_OK(fused_op.Compute(input, &fused_output));
+    ASSERT_OK(compose_op.Compute(TensorRow{input}, &unfused_row));
+    ASSERT_EQ(unfused_row.size(), 1);
+    ASSERT_EQ(fused_output->shape(), unfused_row[0]->shape());
+    ASSERT_EQ(fused_output->type(), unfused_row[0]->type());
+
+    std::vector<TensorShape> shapes;
+    ASSERT_OK(fused_op.OutputShape({input->shape()}, shapes));
+    EXPECT_EQ(shapes[0], fused_output->shape());
+
+    std::shared_ptr<Tensor> fused, unfused;
+    ASSERT_OK(TypeCast(fused_output, &fused, DataType(DataType::DE_FLOAT32)));
+    ASSERT_OK(TypeCast(unfused_row[0], &unfused, DataType(DataType::DE_FLOAT32)));
+    EXPECT_TRUE(std::equal(fused->begin<float>(), fused->end<float>(), unfused->begin<float>()));
+  }
+};
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp on a uint8 image with every combination of pad, HWC2CHW and output type
+/// Expectation: Output is the same as running Normalize or NormalizePad, HWC2CHW and TypeCast one by one
+TEST_F(MindDataTestFusedNormalizeOp, TestUint8Image) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestUint8Image.";
+  for (bool pad : {false, true}) {
+    for (bool to_chw : {false, true}) {
+      for (const std::string dtype : {"float32", "float16"}) {
+        CheckFusedAndUnfused(input_tensor_, pad, to_chw, dtype);
+      }
+    }
+  }
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp on a float32 image and on an int16 image, which runs the ops one by one
+/// Expectation: Output is the same as running Normalize, HWC2CHW and TypeCast one by one
+TEST_F(MindDataTestFusedNormalizeOp, TestOtherTypes) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestOtherTypes.";
+  for (auto type : {DataType::DE_FLOAT32, DataType::DE_INT16}) {
+    std::shared_ptr<Tensor> input;
+    ASSERT_OK(TypeCast(input_tensor_, &input, DataType(type)));
+    CheckFusedAndUnfused(input, false, true, "float32");
+    CheckFusedAndUnfused(input, true, true, "float16");
+  }
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp with mean and std which do not match the channels of the image
+/// Expectation: Error is returned
+TEST_F(MindDataTestFusedNormalizeOp, TestChannelMismatch) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestChannelMismatch.";
+  FusedNormalizeOp fused_op({121.0, 115.0}, {70.0, 68.0}, false, true, "float32");
+  std::shared_ptr<Tensor> output;
+  EXPECT_ERROR(fused_op.Compute(input_tensor_, &output));
+}
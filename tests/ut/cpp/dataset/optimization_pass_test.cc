@@ -22,13 +22,18 @@
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/engine/ir/datasetops/dataset_node.h"
 #include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/image_folder_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/opt/post/auto_worker_pass.h"
+#include "minddata/dataset/engine/opt/pre/projection_pushdown_pass.h"
 #include "minddata/dataset/include/dataset/transforms.h"
 #include "minddata/dataset/include/dataset/vision.h"
 #include "minddata/dataset/include/dataset/vision_lite.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
 
@@ -120,3 +125,136 @@ TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassPreBuiltTensorO
   ASSERT_EQ(fused_ops.size(), 1);
   ASSERT_EQ(fused_ops[0]->Name(), kRandomCropDecodeResizeOp);
 }
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass by fusing Decode with a chain of crop, flip, normalize and HWC2CHW operations
+/// Expectation: The chain is fused into one FusedDecode operation, and the operations after it are kept
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassDecodeChain) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassDecodeChain.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::vector<std::shared_ptr<TensorTransform>> transforms = {
+    std::make_shared<vision::Decode>(), std::make_shared<vision::RandomResizedCrop>(std::vector<int32_t>{100}),
+    std::make_shared<vision::RandomHorizontalFlip>(0.5),
+    std::make_shared<vision::Normalize>(std::vector<float>{121.0, 115.0, 100.0}, std::vector<float>{70.0, 68.0, 71.0}),
+    std::make_shared<vision::HWC2CHW>(), std::make_shared<transforms::TypeCast>(mindspore::DataType::kNumberTypeFloat16)};
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)->Map(transforms, {"image"});
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  // no deepcopy is performed because this doesn't go through tree_adapter
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  ASSERT_NE(map_node, nullptr);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 2);
+  ASSERT_EQ(fused_ops[0]->Name(), vision::kFusedDecodeOperation);
+  auto fused_ir = std::dynamic_pointer_cast<vision::FusedDecodeOperation>(fused_ops[0]);
+  ASSERT_NE(fused_ir, nullptr);
+  EXPECT_EQ(fused_ir->Transforms().size(), 5);
+  EXPECT_EQ(fused_ops[1]->Name(), transforms::kTypeCastOperation);
+}
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass fuses Normalize or NormalizePad with the HWC2CHW and TypeCast after it
+/// Expectation: Each chain is replaced by a FusedNormalize operation, a TypeCast to int32 is not fused
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassNormalizeChain) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassNormalizeChain.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::vector<float> mean = {121.0, 115.0, 100.0};
+  std::vector<float> std = {70.0, 68.0, 71.0};
+  std::vector<std::shared_ptr<TensorTransform>> transforms = {
+    std::make_shared<vision::Normalize>(mean, std), std::make_shared<vision::HWC2CHW>(),
+    std::make_shared<transforms::TypeCast>(mindspore::DataType::kNumberTypeFloat16),
+    std::make_shared<vision::NormalizePad>(mean, std), std::make_shared<vision::HWC2CHW>(),
+    std::make_shared<transforms::TypeCast>(mindspore::DataType::kNumberTypeInt32)};
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)->Map(transforms, {"image"});
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  // no deepcopy is performed because this doesn't go through tree_adapter
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  ASSERT_NE(map_node, nullptr);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 3);
+  EXPECT_EQ(fused_ops[0]->Name(), vision::kFusedNormalizeOperation);
+  EXPECT_EQ(fused_ops[1]->Name(), vision::kFusedNormalizeOperation);
+  EXPECT_EQ(fused_ops[2]->Name(), transforms::kTypeCastOperation);
+  nlohmann::json fused_json;
+  ASSERT_OK(fused_ops[0]->to_json(&fused_json));
+  EXPECT_EQ(fused_json["dtype"], "float16");
+  EXPECT_EQ(fused_json["to_chw"], true);
+  EXPECT_EQ(fused_json["pad"], false);
+}
+
+/// Feature: IR Optimization
+/// Description: Test ProjectionPushdownPass pushes the projected columns through a RepeatNode into the leaf nodes
+/// Expectation: The columns to load of the leaf nodes are the projected columns
+TEST_F(MindDataTestOptimizationPass, MindDataTestProjectionPushdownPass) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestProjectionPushdownPass.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)->Repeat(2)->Project({"label"});
+
+  ProjectionPushdownPass pushdown_pass;
+  bool modified = false;
+  // no deepcopy is performed because this doesn't go through tree_adapter
+  ASSERT_OK(pushdown_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  auto image_folder_node = std::dynamic_pointer_cast<ImageFolderNode>(root->IRNode()->Children()[0]->Children()[0]);
+  ASSERT_NE(image_folder_node, nullptr);
+  EXPECT_EQ(image_folder_node->ColumnsToLoad(), std::vector<std::string>{"label"});
+
+  std::string file_path = datasets_root_path_ + "/../mindrecord/testMindDataSet/testImageNetData/imagenet.mindrecord0";
+  root = MindData(file_path)->Project({"file_name"});
+  modified = false;
+  ASSERT_OK(pushdown_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  auto minddata_node = std::dynamic_pointer_cast<MindDataNode>(root->IRNode()->Children()[0]);
+  ASSERT_NE(minddata_node, nullptr);
+  EXPECT_EQ(minddata_node->ColumnsList(), std::vector<std::string>{"file_name"});
+}
+
+/// Feature: IR Optimization
+/// Description: Test ProjectionPushdownPass stops at a MapNode, which may consume the dropped columns
+/// Expectation: The leaf node is not modified
+TEST_F(MindDataTestOptimizationPass, MindDataTestProjectionPushdownPassStopAtMap) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestProjectionPushdownPassStopAtMap.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)->Map({vision::Decode()}, {"image"})->Project({"label"});
+
+  ProjectionPushdownPass pushdown_pass;
+  bool modified = false;
+  ASSERT_OK(pushdown_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, false);
+  auto image_folder_node = std::dynamic_pointer_cast<ImageFolderNode>(root->IRNode()->Children()[0]->Children()[0]);
+  ASSERT_NE(image_folder_node, nullptr);
+  EXPECT_TRUE(image_folder_node->ColumnsToLoad().empty());
+}
+
+/// Feature: IR Optimization
+/// Description: Test a pipeline which only projects the label of ImageFolder, where the images are not read
+/// Expectation: Each row only contains the label, and all the rows are produced
+TEST_F(MindDataTestOptimizationPass, MindDataTestProjectionPushdownPassLabelOnly) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestProjectionPushdownPassLabelOnly.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::shared_ptr<Dataset> ds = ImageFolder(folder_path, true)->Project({"label"});
+  EXPECT_NE(ds, nullptr);
+
+  std::shared_ptr<Iterator> iter = ds->CreateIterator();
+  EXPECT_NE(iter, nullptr);
+
+  std::unordered_map<std::string, mindspore::MSTensor> row;
+  ASSERT_OK(iter->GetNextRow(&row));
+  uint64_t i = 0;
+  while (row.size() != 0) {
+    i++;
+    EXPECT_EQ(row.size(), 1);
+    EXPECT_NE(row.find("label"), row.end());
+    ASSERT_OK(iter->GetNextRow(&row));
+  }
+  EXPECT_EQ(i, 44);
+
+  iter->Stop();
+}
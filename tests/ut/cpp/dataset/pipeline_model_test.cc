@@ -0,0 +1,105 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/perf/pipeline_model.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestPipelineModel : public UT::Common {
+ public:
+  MindDataTestPipelineModel() {}
+
+  // Batch(0) <- Map(1) <- ImageFolder(2), with 4 workers each
+  static std::vector<PipelineModel::OpStat> Pipeline(double map_cpu_util, double map_in_util, double map_out_util) {
+    return {{0, "BatchOp(ID:0)", -1, true, 4, 16, 2, 2.0, 0.3, 0.1},
+            {1, "MapOp(ID:1)", 0, true, 4, 16, 16 * map_out_util, map_cpu_util, map_in_util, map_out_util},
+            {2, "ImageFolderOp(ID:2)", 1, true, 4, 16, 16 * map_in_util, 2.0, 1.0, map_in_util}};
+  }
+};
+
+/// Feature: PipelineModel
+/// Description: Test a pipeline whose map op is fed but can not keep up
+/// Expectation: The workers of the budget go to the map op
+TEST_F(MindDataTestPipelineModel, TestSaturatedOp) {
+  // 100 batches/s, the map op uses its 4 workers fully
+  PipelineModel model(100, 1, 128);
+  ASSERT_OK(model.Build(Pipeline(4.0, 0.9, 0.1), 10, 0));
+  EXPECT_NEAR(model.Throughput(), 100, 1e-6);
+  ASSERT_OK(model.Solve(32, 100, -1, -1));
+  const auto &plan = model.Plan();
+  EXPECT_TRUE(plan[1].saturated);
+  EXPECT_FALSE(plan[0].saturated);
+  // The batch and leaf ops use 2 cores at 100 batches/s, so the map op gets the rest of the budget
+  int32_t total = plan[0].num_workers + plan[1].num_workers + plan[2].num_workers;
+  EXPECT_EQ(total, 32);
+  EXPECT_GT(plan[1].num_workers, plan[0].num_workers);
+  EXPECT_GT(plan[1].num_workers, plan[2].num_workers);
+  EXPECT_GT(model.PredictedThroughput(), model.Throughput());
+}
+
+/// Feature: PipelineModel
+/// Description: Test a pipeline which is faster than its consumer
+/// Expectation: The ops keep the workers the target throughput needs, which frees workers
+TEST_F(MindDataTestPipelineModel, TestTarget) {
+  PipelineModel model(100, 1, 128);
+  // The output of the map op is full, it waits on the batch op
+  ASSERT_OK(model.Build(Pipeline(1.0, 0.9, 1.0), 10, 0));
+  ASSERT_OK(model.Solve(32, 100, -1, 120));
+  const auto &plan = model.Plan();
+  EXPECT_FALSE(plan[1].saturated);
+  // 1 core per 100 batches/s, so 2 workers reach 120 batches/s
+  EXPECT_EQ(plan[1].num_workers, 2);
+  EXPECT_EQ(plan[0].num_workers, 3);
+  EXPECT_NEAR(model.PredictedThroughput(), 120, 1e-6);
+}
+
+/// Feature: PipelineModel
+/// Description: Test the worker, per op and memory budgets
+/// Expectation: The solution stays within the budgets
+TEST_F(MindDataTestPipelineModel, TestBudget) {
+  PipelineModel model(100, 1, 128);
+  // 1000MB over 30 rows in flight, 12 in the workers and 18 in the connectors
+  ASSERT_OK(model.Build(Pipeline(4.0, 0.9, 0.1), 10, 1000));
+  ASSERT_OK(model.Solve(64, 8, -1, -1));
+  EXPECT_EQ(model.Plan()[1].num_workers, 8);
+  EXPECT_EQ(model.Plan()[1].connector_capacity, 16);
+
+  ASSERT_OK(model.Solve(64, 8, 1000, -1));
+  int64_t rows = 0;
+  for (const auto &plan : model.Plan()) {
+    EXPECT_GE(plan.connector_capacity, 1);
+    rows += plan.num_workers + plan.connector_capacity;
+  }
+  EXPECT_LE(rows * 1000 / 30, 1000);
+  EXPECT_LT(model.Plan()[1].connector_capacity, 16);
+
+  ASSERT_OK(model.Solve(2, 8, -1, -1));
+  for (const auto &plan : model.Plan()) {
+    EXPECT_EQ(plan.num_workers, 1);
+  }
+  auto json = model.ToJson();
+  EXPECT_EQ(json["ops"].size(), 3U);
+  EXPECT_EQ(json["ops"][1]["planned_num_workers"], 1);
+}
+
+/// Feature: PipelineModel
+/// Description: Test building a model without profiled batches
+/// Expectation: An error is returned
+TEST_F(MindDataTestPipelineModel, TestNoBatch) {
+  PipelineModel model(100, 1, 128);
+  EXPECT_ERROR(model.Build(Pipeline(4.0, 0.9, 0.1), 0, 0));
+}
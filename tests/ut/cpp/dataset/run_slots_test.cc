@@ -0,0 +1,133 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/util/queue.h"
+#include "minddata/dataset/util/run_slots.h"
+#include "minddata/dataset/util/task_manager.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestRunSlots : public UT::Common {
+ public:
+  MindDataTestRunSlots() {}
+
+  static void WriteFile(const std::string &path, const std::string &content) {
+    std::ofstream fs(path, std::ios::out | std::ios::trunc);
+    fs << content;
+  }
+};
+
+/// Feature: RunSlots
+/// Description: Test the cpu quota read from cgroup v2 and v1 files
+/// Expectation: The quota is rounded up, and never more than the cpus the process is affine to
+TEST_F(MindDataTestRunSlots, TestCpuQuota) {
+  int32_t num_cpus = RunSlots::CpuQuota("/path/does/not/exist");
+  EXPECT_GE(num_cpus, 1);
+
+  std::string root = "/tmp/run_slots_test_" + std::to_string(getpid());
+  ASSERT_EQ(mkdir(root.c_str(), S_IRWXU), 0);
+  WriteFile(root + "/cpu.max", "max 100000\n");
+  EXPECT_EQ(RunSlots::CpuQuota(root), num_cpus);
+  WriteFile(root + "/cpu.max", "150000 100000\n");
+  EXPECT_EQ(RunSlots::CpuQuota(root), std::min(num_cpus, 2));
+  (void)remove((root + "/cpu.max").c_str());
+
+  ASSERT_EQ(mkdir((root + "/cpu").c_str(), S_IRWXU), 0);
+  WriteFile(root + "/cpu/cpu.cfs_quota_us", "-1\n");
+  WriteFile(root + "/cpu/cpu.cfs_period_us", "100000\n");
+  EXPECT_EQ(RunSlots::CpuQuota(root), num_cpus);
+  WriteFile(root + "/cpu/cpu.cfs_quota_us", "50000\n");
+  EXPECT_EQ(RunSlots::CpuQuota(root), 1);
+  (void)remove((root + "/cpu/cpu.cfs_quota_us").c_str());
+  (void)remove((root + "/cpu/cpu.cfs_period_us").c_str());
+  (void)rmdir((root + "/cpu").c_str());
+  (void)rmdir(root.c_str());
+}
+
+/// Feature: RunSlots
+/// Description: Test threads entering and leaving the slots
+/// Expectation: No more threads than slots hold one at the same time
+TEST_F(MindDataTestRunSlots, TestBound) {
+  const int32_t num_slots = 2;
+  const int32_t num_threads = 8;
+  RunSlots run_slots(num_slots);
+  std::atomic<int32_t> max_running(0);
+  std::vector<std::thread> threads;
+  for (int32_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&run_slots, &max_running]() {
+      RunSlots::Enter(&run_slots);
+      EXPECT_EQ(RunSlots::Current(), &run_slots);
+      int32_t running = run_slots.NumRunning();
+      int32_t seen = max_running.load();
+      while (running > seen && !max_running.compare_exchange_weak(seen, running)) {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      RunSlots::Leave();
+      EXPECT_EQ(RunSlots::Current(), nullptr);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(run_slots.NumOverruns(), 0);
+  EXPECT_LE(max_running.load(), num_slots);
+  EXPECT_EQ(run_slots.NumRunning(), 0);
+}
+
+/// Feature: RunSlots
+/// Description: Test a producer and a consumer of a queue sharing a single run slot
+/// Expectation: The thread blocked on the queue hands its slot over, so both run without going over the bound
+TEST_F(MindDataTestRunSlots, TestHandOver) {
+  const int32_t num_rows = 100;
+  auto run_slots = std::make_shared<RunSlots>(1);
+  TaskGroup vg;
+  vg.SetRunSlots(run_slots);
+  Queue<int32_t> queue(1);
+  ASSERT_OK(queue.Register(&vg));
+  int64_t sum = 0;
+  ASSERT_OK(vg.CreateAsyncTask("Producer", [&queue, num_rows]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int32_t i = 0; i < num_rows; ++i) {
+      RETURN_IF_NOT_OK(queue.Add(i));
+    }
+    return Status::OK();
+  }));
+  ASSERT_OK(vg.CreateAsyncTask("Consumer", [&queue, &sum, num_rows]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int32_t i = 0; i < num_rows; ++i) {
+      int32_t row = 0;
+      RETURN_IF_NOT_OK(queue.PopFront(&row));
+      sum += row;
+    }
+    return Status::OK();
+  }));
+  ASSERT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  EXPECT_EQ(sum, num_rows * (num_rows - 1) / 2);
+  EXPECT_EQ(run_slots->NumOverruns(), 0);
+  EXPECT_EQ(run_slots->NumRunning(), 0);
+}
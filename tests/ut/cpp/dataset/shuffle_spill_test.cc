@@ -0,0 +1,76 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/datasetops/shuffle_spill.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestShuffleSpill : public UT::Common {
+ public:
+  MindDataTestShuffleSpill() = default;
+};
+
+/// Feature: ShuffleSpill
+/// Description: Test that rows written to disk are read back in any order with their tensors, id and paths
+/// Expectation: The rows read back are equal to the rows written, across several segments
+TEST_F(MindDataTestShuffleSpill, TestWriteRead) {
+  MS_LOG(INFO) << "Doing MindDataTestShuffleSpill-TestWriteRead.";
+  if (!ShuffleSpill::Supported()) {
+    GTEST_SKIP();
+  }
+  // small segments, so that the rows span several of them
+  constexpr uint64_t kSegmentSize = 64 * 1024;
+  constexpr int32_t kNumRows = 100;
+  ShuffleSpill spill("/tmp", kSegmentSize);
+  std::vector<TensorRow> rows;
+  std::vector<ShuffleSpill::Handle> handles(kNumRows);
+  for (int32_t i = 0; i < kNumRows; ++i) {
+    std::shared_ptr<Tensor> numbers;
+    std::shared_ptr<Tensor> text;
+    // the zeros compress well, the counter does not
+    std::vector<int32_t> values(i % 2 == 0 ? 4096 : 16, 0);
+    for (size_t j = 0; j < values.size(); j += 7) {
+      values[j] = i + static_cast<int32_t>(j);
+    }
+    ASSERT_OK(Tensor::CreateFromVector(values, TensorShape({static_cast<dsize_t>(values.size())}), &numbers));
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<std::string>{"row", std::to_string(i)}, &text));
+    TensorRow row(i, {numbers, text});
+    row.setPath({"path_" + std::to_string(i), ""});
+    ASSERT_TRUE(ShuffleSpill::Spillable(row));
+    ASSERT_OK(spill.Write(row, &handles[i]));
+    rows.push_back(row);
+  }
+  EXPECT_GT(spill.spilled_bytes(), spill.stored_bytes());
+
+  for (int32_t k = 0; k < kNumRows; ++k) {
+    int32_t i = (k * 37) % kNumRows;
+    TensorRow row;
+    ASSERT_OK(spill.Read(handles[i], &row));
+    ASSERT_EQ(row.size(), 2);
+    EXPECT_EQ(row.getId(), i);
+    EXPECT_EQ(row.getPath(), rows[i].getPath());
+    EXPECT_EQ(*row[0], *rows[i][0]);
+    EXPECT_EQ(*row[1], *rows[i][1]);
+  }
+  EXPECT_EQ(spill.num_reads(), kNumRows);
+  spill.Clear();
+}
@@ -52,6 +52,24 @@ TEST_F(MindDataTestSlidingWindowOp, Compute) {
   MS_LOG(INFO) << "MindDataTestSlidingWindowOp end.";
 }
 
+/// Feature: SlidingWindow op
+/// Description: Test SlidingWindowOp's Compute on a numeric tensor
+/// Expectation: Output is equal to the expected output
+TEST_F(MindDataTestSlidingWindowOp, ComputeNumeric) {
+  MS_LOG(INFO) << "Doing MindDataTestSlidingWindowOp->ComputeNumeric.";
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int64_t>{1, 2, 3, 4, 5}, &input));
+  std::shared_ptr<Tensor> output;
+
+  auto op = std::make_unique<SlidingWindowOp>(2, -1);
+  ASSERT_OK(op->Compute(input, &output));
+
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int64_t>{1, 2, 2, 3, 3, 4, 4, 5}, TensorShape({4, 2}), &expected));
+  ASSERT_TRUE(output->shape() == expected->shape());
+  ASSERT_TRUE(*output == *expected);
+}
+
 /// Feature: SlidingWindow op
 /// Description: Test SlidingWindowOp's OutputShape
 /// Expectation: Output's shape is equal to the expected output's shape
@@ -22,6 +22,7 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/core/cv_tensor.h"
 #include "minddata/dataset/core/data_type.h"
+#include "minddata/dataset/core/string_tensor_builder.h"
 
 using namespace mindspore::dataset;
 
@@ -189,3 +190,62 @@ TEST_F(MindDataTestStringTensorDE, Iterator) {
     index += 2;
   }
 }
+
+/// Feature: StringTensorBuilder
+/// Description: Test building string tensors of several shapes with one builder, including an empty one
+/// Expectation: The tensors are equal to the ones created from vectors of strings
+TEST_F(MindDataTestStringTensorDE, Builder) {
+  std::vector<std::string> strings{"abc", "", "hi", "klmno", "123", "789"};
+  StringTensorBuilder builder;
+  for (const auto &str : strings) {
+    builder.Append(str);
+  }
+  ASSERT_EQ(builder.size(), strings.size());
+  ASSERT_EQ(builder[1], "");
+  ASSERT_EQ(builder[3], "klmno");
+  std::shared_ptr<Tensor> t;
+  ASSERT_OK(builder.Build(TensorShape({2, 3}), DataType(DataType::DE_STRING), &t));
+  ASSERT_TRUE(builder.empty());
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(Tensor::CreateFromVector(strings, TensorShape({2, 3}), &expected));
+  ASSERT_EQ(t->shape(), expected->shape());
+  ASSERT_EQ(t->SizeInBytes(), expected->SizeInBytes());
+  ASSERT_TRUE(*t == *expected);
+
+  // reuse the builder, with an item made of a prefix and a string
+  builder.Append("##", "ing");
+  builder.Append("x");
+  ASSERT_OK(builder.Build(&t));
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<std::string>{"##ing", "x"}, &expected));
+  ASSERT_TRUE(*t == *expected);
+
+  ASSERT_OK(builder.Build(&t));
+  ASSERT_EQ(t->shape(), TensorShape({0}));
+  ASSERT_EQ(t->type(), DataType(DataType::DE_STRING));
+
+  builder.Append("a");
+  ASSERT_FALSE(builder.Build(TensorShape({2}), DataType(DataType::DE_STRING), &t).IsOk());
+  ASSERT_FALSE(builder.Build(TensorShape({1}), DataType(DataType::DE_INT32), &t).IsOk());
+}
+
+/// Feature: StringTensorBuilder
+/// Description: Test dropping the last items of a builder
+/// Expectation: Only the items before the truncation and the ones appended after it are in the tensor
+TEST_F(MindDataTestStringTensorDE, BuilderTruncate) {
+  StringTensorBuilder builder;
+  builder.Append("un");
+  builder.Append("##want");
+  builder.Append("##ed");
+  builder.Truncate(1);
+  ASSERT_EQ(builder.size(), 1);
+  builder.Append("[UNK]");
+  std::shared_ptr<Tensor> t;
+  ASSERT_OK(builder.Build(&t));
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<std::string>{"un", "[UNK]"}, &expected));
+  ASSERT_TRUE(*t == *expected);
+
+  builder.Append("a");
+  builder.Truncate(0);
+  ASSERT_TRUE(builder.empty());
+}
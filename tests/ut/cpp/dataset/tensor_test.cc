@@ -506,6 +506,44 @@ TEST_F(MindDataTestTensorDE, TensorPartialInsert) {
   EXPECT_FALSE(s.IsOk());
 }
 
+/// Feature: Tensor
+/// Description: Test creating a Tensor which aliases external memory
+/// Expectation: The Tensor shares the memory and keeps its owner alive until it is destroyed
+TEST_F(MindDataTestTensorDE, TensorFromExternalMemory) {
+  auto owner = std::make_shared<std::vector<float>>(std::vector<float>{1.0, 2.0, 3.0, 4.0});
+  auto src = reinterpret_cast<const uchar *>(owner->data());
+  std::weak_ptr<std::vector<float>> weak_owner = owner;
+  TensorPtr t;
+  Status rc = Tensor::CreateFromExternalMemory(TensorShape({2, 2}), DataType(DataType::DE_FLOAT32), src,
+                                               4 * sizeof(float), owner, &t);
+  ASSERT_TRUE(rc.IsOk());
+  owner.reset();
+  ASSERT_FALSE(weak_owner.expired());
+  ASSERT_EQ(t->GetBuffer(), src);
+  float value = 0;
+  ASSERT_TRUE(t->GetItemAt<float>(&value, {1, 0}).IsOk());
+  ASSERT_EQ(value, 3.0);
+
+  // moving the tensor moves the owner as well
+  Tensor moved(std::move(*t));
+  ASSERT_EQ(moved.GetBuffer(), src);
+  t.reset();
+  ASSERT_FALSE(weak_owner.expired());
+  moved.Invalidate();
+  ASSERT_TRUE(weak_owner.expired());
+
+  // length must match the shape and only numeric types are supported
+  auto buffer = std::make_shared<std::vector<uint8_t>>(8);
+  rc = Tensor::CreateFromExternalMemory(TensorShape({3}), DataType(DataType::DE_UINT8), buffer->data(), 8, buffer, &t);
+  ASSERT_TRUE(rc.IsError());
+  rc = Tensor::CreateFromExternalMemory(TensorShape({1}), DataType(DataType::DE_STRING), buffer->data(), 8, buffer,
+                                        &t);
+  ASSERT_TRUE(rc.IsError());
+  rc = Tensor::CreateFromExternalMemory(TensorShape({8}), DataType(DataType::DE_UINT8), buffer->data(), 8, nullptr,
+                                        &t);
+  ASSERT_TRUE(rc.IsError());
+}
+
 /// Feature: Tensor
 /// Description: Test creating an empty Tensor
 /// Expectation: Output is equal to the expected output
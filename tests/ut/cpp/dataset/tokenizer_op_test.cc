@@ -26,6 +26,7 @@
 #include "minddata/dataset/text/kernels/unicode_char_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/unicode_script_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/whitespace_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/wordpiece_tokenizer_op.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
 
@@ -382,4 +383,35 @@ std::shared_ptr<Tensor> input;
   TensorRow output;
   Status s = basic_tokenizer->Compute(TensorRow(0, {input}), &output);
   EXPECT_TRUE(s.IsOk());
-}
\ No newline at end of file
+}
+
+/// Feature: WordpieceTokenizer op
+/// Description: Test WordpieceTokenizerOp with ascii and multi-byte subwords and a word not in the vocab
+/// Expectation: Each word is split into the longest subwords of the vocab, with the unknown token for the others
+TEST_F(MindDataTestTokenizerOp, TestWordpieceTokenizer) {
+  MS_LOG(INFO) << "Doing TestWordpieceTokenizer.";
+  std::shared_ptr<Vocab> vocab;
+  std::vector<std::string> words = {"un", "unwant", "##want", "##ed", "中", "##国", "##国人"};
+  ASSERT_OK(Vocab::BuildFromVector(words, {"[UNK]"}, true, &vocab));
+  auto op = std::make_unique<WordpieceTokenizerOp>(vocab, "##", 100, "[UNK]", true);
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<std::string>{"unwanted", "wa", "中国人", "中国", "x"}, &input));
+  TensorRow output;
+  ASSERT_OK(op->Compute(TensorRow(0, {input}), &output));
+  ASSERT_EQ(output.size(), 3);
+  EXPECT_EQ(output[0]->Size(), 8);
+  CheckEqual(output[0], {0}, "unwant");
+  CheckEqual(output[0], {1}, "##ed");
+  CheckEqual(output[0], {2}, "[UNK]");
+  CheckEqual(output[0], {3}, "中");
+  CheckEqual(output[0], {4}, "##国人");
+  CheckEqual(output[0], {5}, "中");
+  CheckEqual(output[0], {6}, "##国");
+  CheckEqual(output[0], {7}, "[UNK]");
+  uint32_t start = 0;
+  uint32_t limit = 0;
+  ASSERT_OK(output[1]->GetItemAt(&start, {4}));
+  ASSERT_OK(output[2]->GetItemAt(&limit, {4}));
+  EXPECT_EQ(start, 3);
+  EXPECT_EQ(limit, 9);
+}
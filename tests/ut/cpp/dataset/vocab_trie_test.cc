@@ -0,0 +1,113 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "common/common.h"
+#include "minddata/dataset/include/dataset/text.h"
+#include "minddata/dataset/text/vocab_trie.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestVocabTrie : public UT::Common {
+ public:
+  MindDataTestVocabTrie() = default;
+};
+
+/// Feature: VocabTrie
+/// Description: Test finding random words of all byte values, and random strings which may not be in the vocab
+/// Expectation: The ids are equal to the ones of the map the trie is built from
+TEST_F(MindDataTestVocabTrie, TestFind) {
+  MS_LOG(INFO) << "Doing MindDataTestVocabTrie-TestFind.";
+  std::mt19937 rnd(0);
+  auto random_word = [&rnd](int max_len, int alphabet) {
+    std::string word(rnd() % max_len, '\0');
+    for (auto &c : word) {
+      c = static_cast<char>(rnd() % alphabet);
+    }
+    return word;
+  };
+  for (int alphabet : {4, 26, 256}) {
+    std::unordered_map<WordType, WordIdType> word2id;
+    for (int i = 0; i < 5000; i++) {
+      (void)word2id.emplace(random_word(12, alphabet), static_cast<WordIdType>(word2id.size()));
+    }
+    VocabTrie trie(word2id);
+    for (const auto &[word, id] : word2id) {
+      EXPECT_EQ(trie.Find(word), id);
+    }
+    for (int i = 0; i < 5000; i++) {
+      std::string word = random_word(14, alphabet);
+      auto iter = word2id.find(word);
+      EXPECT_EQ(trie.Find(word), iter == word2id.end() ? Vocab::kNoTokenExists : iter->second);
+    }
+  }
+
+  VocabTrie empty_trie({});
+  EXPECT_EQ(empty_trie.Find(""), Vocab::kNoTokenExists);
+  EXPECT_EQ(empty_trie.Find("a"), Vocab::kNoTokenExists);
+  VocabTrie empty_word_trie({{"", 3}});
+  EXPECT_EQ(empty_word_trie.Find(""), 3);
+  EXPECT_EQ(empty_word_trie.Find("a"), Vocab::kNoTokenExists);
+}
+
+/// Feature: VocabTrie
+/// Description: Test walking a string byte by byte to find all of its prefixes in the vocab
+/// Expectation: The walk stops after the longest prefix of a word and gives the ids of the prefixes which are words
+TEST_F(MindDataTestVocabTrie, TestWalk) {
+  MS_LOG(INFO) << "Doing MindDataTestVocabTrie-TestWalk.";
+  VocabTrie trie({{"un", 0}, {"unwant", 1}, {"##ed", 2}, {"##want", 3}});
+  VocabTrie::State state = VocabTrie::kRoot;
+  ASSERT_TRUE(trie.Walk("u", &state));
+  EXPECT_EQ(trie.Value(state), Vocab::kNoTokenExists);
+  ASSERT_TRUE(trie.Walk("n", &state));
+  EXPECT_EQ(trie.Value(state), 0);
+  ASSERT_TRUE(trie.Walk("wan", &state));
+  EXPECT_EQ(trie.Value(state), Vocab::kNoTokenExists);
+  VocabTrie::State prefix = state;
+  ASSERT_TRUE(trie.Walk("t", &state));
+  EXPECT_EQ(trie.Value(state), 1);
+  EXPECT_FALSE(trie.Walk("ed", &state));
+  EXPECT_EQ(trie.Value(state), 1);
+  EXPECT_FALSE(trie.Walk("d", &prefix));
+
+  state = VocabTrie::kRoot;
+  ASSERT_TRUE(trie.Walk("##", &state));
+  VocabTrie::State suffix = state;
+  EXPECT_TRUE(trie.Walk("ed", &state));
+  EXPECT_EQ(trie.Value(state), 2);
+  EXPECT_TRUE(trie.Walk("want", &suffix));
+  EXPECT_EQ(trie.Value(suffix), 3);
+}
+
+/// Feature: Vocab
+/// Description: Test the trie of a vocab is shared until a word is appended
+/// Expectation: The same trie is returned by the calls before AppendWord, and the new word is found after it
+TEST_F(MindDataTestVocabTrie, TestVocabGetTrie) {
+  MS_LOG(INFO) << "Doing MindDataTestVocabTrie-TestVocabGetTrie.";
+  std::shared_ptr<Vocab> vocab;
+  ASSERT_OK(Vocab::BuildFromVector({"apple", "banana"}, {"<unk>"}, true, &vocab));
+  std::shared_ptr<const VocabTrie> trie = vocab->GetTrie();
+  EXPECT_EQ(trie, vocab->GetTrie());
+  EXPECT_EQ(trie->Find("banana"), 2);
+  EXPECT_EQ(trie->Find("cat"), Vocab::kNoTokenExists);
+  vocab->AppendWord("cat");
+  EXPECT_NE(trie, vocab->GetTrie());
+  EXPECT_EQ(vocab->GetTrie()->Find("cat"), 3);
+}
@@ -14,16 +14,23 @@
  * limitations under the License.
  */
 
+#include <sys/stat.h>
+#include <utime.h>
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "utils/ms_utils.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
+#include "minddata/mindrecord/include/shard_async_reader.h"
+#include "minddata/mindrecord/include/shard_category.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_reader.h"
 #include "minddata/mindrecord/include/shard_sample.h"
 #include "ut_common.h"
@@ -39,12 +46,33 @@ class TestShardReader : public UT::Common {
     for (int i = 1; i <= 4; i++) {
       string filename = std::string("./imagenet.shard0") + std::to_string(i);
       string db_name = std::string("./imagenet.shard0") + std::to_string(i) + ".db";
+      string idx_name = std::string("./imagenet.shard0") + std::to_string(i) + ".idx";
       remove(common::SafeCStr(filename));
       remove(common::SafeCStr(db_name));
+      remove(common::SafeCStr(idx_name));
     }
   }
 };
 
+/// \brief read all labels of the dataset in order
+std::vector<json> ReadAllLabels(const std::string &file_name, const std::vector<std::string> &column_list,
+                                const std::vector<std::shared_ptr<ShardOperator>> &ops = {}) {
+  std::vector<json> labels;
+  ShardReader dataset;
+  auto status = dataset.Open({file_name}, true, 4, column_list, ops);
+  EXPECT_TRUE(status.IsOk());
+  dataset.Launch();
+  while (true) {
+    auto x = dataset.GetNext();
+    if (x.empty()) break;
+    for (auto &j : x) {
+      labels.push_back(std::get<1>(j));
+    }
+  }
+  dataset.Close();
+  return labels;
+}
+
 TEST_F(TestShardReader, TestShardReaderGeneral) {
   MS_LOG(INFO) << FormatInfo("Test read imageNet");
   std::string file_name = "./imagenet.shard01";
@@ -239,5 +267,189 @@ TEST_F(TestShardReader, TestShardReaderConsumer) {
   }
   dataset.Close();
 }
+
+TEST_F(TestShardReader, TestShardReaderColumnarIndex) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test read imageNet with columnar index"));
+  std::string file_name = "./imagenet.shard01";
+  std::shared_ptr<ShardColumnarIndex> columnar_index;
+  ASSERT_TRUE(ShardColumnarIndex::Open(file_name, &columnar_index).IsOk());
+  int field_id = columnar_index->GetFieldId("label_0");
+  ASSERT_GE(field_id, 0);
+  std::set<std::string> classes;
+  columnar_index->GetDistinctFieldValues(field_id, &classes);
+  EXPECT_FALSE(classes.empty());
+  std::string category = *classes.begin();
+
+  auto column_list = std::vector<std::string>{"file_name", "label"};
+  auto index_labels = ReadAllLabels(file_name, column_list);
+  auto raw_labels = ReadAllLabels(file_name, {});
+  std::vector<std::shared_ptr<ShardOperator>> ops = {
+    std::make_shared<ShardCategory>(std::vector<std::pair<std::string, std::string>>{{"label", category}})};
+  auto category_labels = ReadAllLabels(file_name, column_list, ops);
+  EXPECT_FALSE(index_labels.empty());
+  EXPECT_FALSE(category_labels.empty());
+
+  // the columnar index is stale once the mindrecord file is rewritten in place, even with the same size
+  struct stat data_stat;
+  ASSERT_EQ(stat(file_name.c_str(), &data_stat), 0);
+  struct utimbuf times = {data_stat.st_atime, data_stat.st_mtime + 1};
+  ASSERT_EQ(utime(file_name.c_str(), &times), 0);
+  EXPECT_FALSE(ShardColumnarIndex::Open(file_name, &columnar_index).IsOk());
+  EXPECT_EQ(index_labels, ReadAllLabels(file_name, column_list));
+
+  // the reader falls back to the sqlite meta files without the columnar index
+  for (int i = 1; i <= 4; i++) {
+    remove(common::SafeCStr(std::string("./imagenet.shard0") + std::to_string(i) + ".idx"));
+  }
+  EXPECT_FALSE(ShardColumnarIndex::Open(file_name, &columnar_index).IsOk());
+  EXPECT_EQ(index_labels, ReadAllLabels(file_name, column_list));
+  EXPECT_EQ(raw_labels, ReadAllLabels(file_name, {}));
+  EXPECT_EQ(category_labels, ReadAllLabels(file_name, column_list, ops));
+}
+
+TEST_F(TestShardReader, TestShardWriterRemoveColumnarIndex) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test the columnar index is rewritten when the shards are committed"));
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label"};
+  auto labels = ReadAllLabels(file_name, column_list);
+  EXPECT_FALSE(labels.empty());
+
+  // committing the shards again leaves no stale columnar index behind
+  {
+    ShardWriter fw;
+    ASSERT_TRUE(fw.OpenForAppend(file_name).IsOk());
+    ASSERT_TRUE(fw.Commit().IsOk());
+  }
+  std::shared_ptr<ShardColumnarIndex> columnar_index;
+  for (int i = 1; i <= 4; i++) {
+    std::string idx_name = std::string("./imagenet.shard0") + std::to_string(i) + ".idx";
+    EXPECT_FALSE(std::ifstream(idx_name).good());
+  }
+  EXPECT_FALSE(ShardColumnarIndex::Open(file_name, &columnar_index).IsOk());
+  EXPECT_EQ(labels, ReadAllLabels(file_name, column_list));
+
+  // the index generator writes it again
+  ShardIndexGenerator sg{file_name, true};
+  ASSERT_TRUE(sg.Build().IsOk());
+  ASSERT_TRUE(sg.WriteToDatabase().IsOk());
+  ASSERT_TRUE(ShardColumnarIndex::Open(file_name, &columnar_index).IsOk());
+  EXPECT_EQ(labels, ReadAllLabels(file_name, column_list));
+}
+
+TEST_F(TestShardReader, TestShardReaderMmapMode) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test read imageNet in mmap mode"));
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label", "image"};
+
+  ShardReader stream_reader;
+  ASSERT_TRUE(stream_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(stream_reader.Launch(true).IsOk());
+  EXPECT_FALSE(stream_reader.IsMmapMode());
+
+  ShardReader mmap_reader;
+  mmap_reader.SetMmapMode(true);
+  ASSERT_TRUE(mmap_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(mmap_reader.Launch(true).IsOk());
+  ASSERT_TRUE(mmap_reader.IsMmapMode());
+
+  int64_t num_rows = mmap_reader.GetNumRowsAfterSampling();
+  ASSERT_EQ(num_rows, stream_reader.GetNumRowsAfterSampling());
+  ASSERT_GT(num_rows, 0);
+  std::shared_ptr<TASK_CONTENT> row;
+  std::shared_ptr<MAPPED_TASK_CONTENT> mapped_row;
+  std::set<std::shared_ptr<ShardMmapFile>> windows;
+  for (int64_t i = 0; i < num_rows; i++) {
+    ASSERT_TRUE(stream_reader.GetNextById(i, 0, &row).IsOk());
+    ASSERT_TRUE(mmap_reader.GetNextMappedById(i, 0, &mapped_row).IsOk());
+    ASSERT_EQ(row->second.size(), 1);
+    ASSERT_EQ(mapped_row->second.size(), 1);
+    const auto &blob = std::get<0>(row->second[0]);
+    const auto &view = std::get<0>(mapped_row->second[0]);
+    ASSERT_NE(view.file, nullptr);
+    ASSERT_EQ(view.size, blob.size());
+    // the view points into the window of its row group, not into a mapping of the whole file
+    EXPECT_GE(view.data, view.file->Data());
+    EXPECT_LE(view.data + view.size, view.file->Data() + view.file->Size());
+    windows.insert(view.file);
+    EXPECT_EQ(memcmp(view.data, blob.data(), blob.size()), 0);
+    EXPECT_EQ(std::get<1>(mapped_row->second[0]), std::get<1>(row->second[0]));
+  }
+  // the rows of a row group share its window
+  EXPECT_LT(windows.size(), static_cast<size_t>(num_rows));
+
+  // the view keeps the mapping alive after the reader is closed
+  auto file = std::get<0>(mapped_row->second[0]).file;
+  mmap_reader.Close();
+  stream_reader.Close();
+  EXPECT_EQ(memcmp(std::get<0>(mapped_row->second[0]).data, std::get<0>(row->second[0]).data(),
+                   std::get<0>(row->second[0]).size()),
+            0);
+  EXPECT_TRUE(file->IsMapped());
+}
+
+TEST_F(TestShardReader, TestShardReaderPrefetch) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test read imageNet with prefetch"));
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label", "image"};
+
+  ShardReader stream_reader;
+  ASSERT_TRUE(stream_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(stream_reader.Launch(true).IsOk());
+
+  ShardReader prefetch_reader;
+  prefetch_reader.SetPrefetchDepth(4);
+  ASSERT_TRUE(prefetch_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(prefetch_reader.Launch(true).IsOk());
+
+  int64_t num_rows = prefetch_reader.GetNumRowsAfterSampling();
+  ASSERT_EQ(num_rows, stream_reader.GetNumRowsAfterSampling());
+  ASSERT_GT(num_rows, 0);
+  std::shared_ptr<TASK_CONTENT> row;
+  std::shared_ptr<TASK_CONTENT> prefetched_row;
+  // read twice to cover the reset of the prefetched tasks
+  for (int epoch = 0; epoch < 2; epoch++) {
+    for (int64_t i = 0; i < num_rows; i++) {
+      ASSERT_TRUE(stream_reader.GetNextById(i, 0, &row).IsOk());
+      ASSERT_TRUE(prefetch_reader.GetNextById(i, 0, &prefetched_row).IsOk());
+      ASSERT_EQ(prefetched_row->second.size(), 1);
+      EXPECT_EQ(std::get<0>(prefetched_row->second[0]), std::get<0>(row->second[0]));
+      EXPECT_EQ(std::get<1>(prefetched_row->second[0]), std::get<1>(row->second[0]));
+    }
+    prefetch_reader.Reset();
+  }
+  prefetch_reader.Close();
+  stream_reader.Close();
+}
+
+TEST_F(TestShardReader, TestShardPrefetchStream) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test read file by prefetch stream"));
+  std::string file_name = "./imagenet.shard01";
+  std::shared_ptr<ShardPositionalFile> file;
+  ASSERT_TRUE(ShardPositionalFile::Open(file_name, &file).IsOk());
+  std::vector<uint8_t> expected;
+  ASSERT_TRUE(file->ReadAt(0, file->Size(), &expected).IsOk());
+  ASSERT_EQ(expected.size(), file->Size());
+
+  const uint64_t chunk_size = 4000;
+  const uint64_t read_size = 1500;
+  const uint64_t skip_size = 700;
+  for (auto async_reader : {std::shared_ptr<ShardAsyncReader>(), std::make_shared<ShardAsyncReader>(2, 3)}) {
+    ShardPrefetchStream stream(async_reader, chunk_size, 3);
+    ASSERT_TRUE(stream.Open(file_name).IsOk());
+    uint64_t pos = 0;
+    std::vector<uint8_t> buffer(read_size);
+    while (!stream.Eof()) {
+      uint64_t size = 0;
+      ASSERT_TRUE(stream.Read(buffer.data(), read_size, &size).IsOk());
+      ASSERT_EQ(size, std::min(read_size, expected.size() - pos));
+      EXPECT_EQ(memcmp(buffer.data(), expected.data() + pos, size), 0);
+      pos += size;
+      stream.Skip(skip_size);
+      pos = std::min<uint64_t>(pos + skip_size, expected.size());
+    }
+    EXPECT_EQ(pos, expected.size());
+    stream.Close();
+  }
+}
 }  // namespace mindrecord
 }  // namespace mindspore
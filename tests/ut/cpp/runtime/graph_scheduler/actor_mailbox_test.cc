@@ -0,0 +1,126 @@
+/**
+ * Copyright 2024 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "actor/mailbox.h"
+#include "async/async.h"
+#include "thread/semaphore.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace runtime {
+class ActorMailBoxTest : public UT::Common {
+ public:
+  ActorMailBoxTest() {}
+};
+
+namespace {
+struct MailBoxRunResult {
+  size_t received{0};
+  size_t runs{0};
+  double msgs_per_second{0};
+};
+
+// Send the messages from the producer threads, and run the consumer the way an actor of a shared thread pool runs:
+// once per notification, taking the messages until the mailbox gives up.
+MailBoxRunResult RunMailBox(MailBox *mailbox, size_t producer_num, size_t msg_num_per_producer) {
+  Semaphore ready;
+  mailbox->SetNotifyHook(std::make_unique<std::function<void()>>([&ready]() { ready.Signal(); }));
+  MailBoxRunResult result;
+  const size_t total = producer_num * msg_num_per_producer;
+  auto start = std::chrono::steady_clock::now();
+  std::thread consumer([mailbox, total, &ready, &result]() {
+    while (result.received < total) {
+      ready.Wait();
+      ++result.runs;
+      if (mailbox->TakeAllMsgsEachTime()) {
+        while (auto msgs = mailbox->GetMsgs()) {
+          result.received += msgs->size();
+          msgs->clear();
+        }
+      } else {
+        while (auto msg = mailbox->GetMsg()) {
+          ++result.received;
+        }
+      }
+    }
+  });
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < producer_num; ++i) {
+    producers.emplace_back([mailbox, msg_num_per_producer]() {
+      for (size_t j = 0; j < msg_num_per_producer; ++j) {
+        std::unique_ptr<MessageBase> msg(new (std::nothrow) MessageAsync([](ActorBase *) {}));
+        (void)mailbox->EnqueueMessage(std::move(msg));
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  consumer.join();
+  auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  result.msgs_per_second = static_cast<double>(result.received) / cost;
+  return result;
+}
+}  // namespace
+
+/// Feature: Lock-free actor mailbox.
+/// Description: Send messages from several threads to the mpsc mailbox.
+/// Expectation: The consumer takes every message.
+TEST_F(ActorMailBoxTest, test_mpsc_mailbox) {
+  const size_t producer_num = 4;
+  const size_t msg_num_per_producer = 20000;
+  MpscMailBox mailbox;
+  auto result = RunMailBox(&mailbox, producer_num, msg_num_per_producer);
+  EXPECT_EQ(result.received, producer_num * msg_num_per_producer);
+  EXPECT_GE(result.runs, 1);
+}
+
+/// Feature: Lock-free actor mailbox.
+/// Description: Allocate and free the messages of Async on one thread.
+/// Expectation: The freed message is reused by the next allocation.
+TEST_F(ActorMailBoxTest, test_message_pool) {
+  auto msg = new (std::nothrow) MessageAsync([](ActorBase *) {});
+  ASSERT_NE(msg, nullptr);
+  void *addr = msg;
+  delete msg;
+  std::unique_ptr<MessageBase> new_msg(new (std::nothrow) MessageAsync([](ActorBase *) {}));
+  EXPECT_EQ(static_cast<void *>(new_msg.get()), addr);
+}
+
+/// Feature: Lock-free actor mailbox.
+/// Description: Micro benchmark of the message throughput of the mutex guarded mailbox and the mpsc mailbox.
+/// Expectation: Both mailboxes deliver all the messages.
+TEST_F(ActorMailBoxTest, test_mailbox_throughput) {
+  const size_t msg_num_per_producer = 100000;
+  for (size_t producer_num : {1, 4}) {
+    NonblockingMailBox nonblocking_mailbox;
+    auto nonblocking = RunMailBox(&nonblocking_mailbox, producer_num, msg_num_per_producer);
+    MpscMailBox mpsc_mailbox;
+    auto mpsc = RunMailBox(&mpsc_mailbox, producer_num, msg_num_per_producer);
+    EXPECT_EQ(nonblocking.received, producer_num * msg_num_per_producer);
+    EXPECT_EQ(mpsc.received, producer_num * msg_num_per_producer);
+    MS_LOG(INFO) << producer_num << " producers, nonblocking mailbox: " << nonblocking.msgs_per_second
+                 << " msgs/s, mpsc mailbox: " << mpsc.msgs_per_second << " msgs/s";
+  }
+}
+}  // namespace runtime
+}  // namespace mindspore
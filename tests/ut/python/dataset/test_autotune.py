@@ -206,3 +206,27 @@ class TestAutotuneWithProfiler:
                 pass
 
         ds.config.set_enable_autotune(False)
+
+    @staticmethod
+    def test_autotune_model_strategy():
+        """
+        Feature: Autotuning
+        Description: Test simple pipeline of autotune with the model strategy - Generator -> Map -> Batch
+        Expectation: Pipeline runs successfully
+        """
+        autotune_strategy_original = ds.config.get_autotune_strategy()
+        ds.config.set_autotune_strategy(ds.config.AutoTuneStrategy.MODEL)
+        ds.config.set_enable_autotune(True)
+
+        source = [(np.array([x]),) for x in range(1024)]
+        data1 = ds.GeneratorDataset(source, ["data"])
+        data1 = data1.map(operations=[lambda x: x + 1], input_columns=["data"], num_parallel_workers=2)
+        data1 = data1.batch(32)
+
+        itr = data1.create_dict_iterator(num_epochs=5)
+        for _ in range(5):
+            for _ in itr:
+                pass
+
+        ds.config.set_enable_autotune(False)
+        ds.config.set_autotune_strategy(autotune_strategy_original)
@@ -110,3 +110,25 @@ class TestAutotuneConfig:
         ds.config.set_enable_autotune(False, "")
 
         ds.config.set_enable_autotune(False, None)
+
+    @staticmethod
+    def test_autotune_config_strategy():
+        """
+        Feature: Autotuning
+        Description: Test set_autotune_strategy() and get_autotune_strategy()
+        Expectation: The strategy set is returned, invalid input is detected
+        """
+        autotune_strategy = ds.config.get_autotune_strategy()
+        assert autotune_strategy == ds.config.AutoTuneStrategy.HEURISTIC
+
+        ds.config.set_autotune_strategy(ds.config.AutoTuneStrategy.MODEL)
+        assert ds.config.get_autotune_strategy() == ds.config.AutoTuneStrategy.MODEL
+
+        with pytest.raises(TypeError):
+            ds.config.set_autotune_strategy(1)
+
+        with pytest.raises(TypeError):
+            ds.config.set_autotune_strategy("MODEL")
+
+        ds.config.set_autotune_strategy(autotune_strategy)
+        assert ds.config.get_autotune_strategy() == ds.config.AutoTuneStrategy.HEURISTIC
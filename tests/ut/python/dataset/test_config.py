@@ -539,6 +539,154 @@ def test_fast_recovery():
     assert "set_fast_recovery() missing 1 required positional argument: 'fast_recovery'" in str(error_info.value)
 
 
+def test_mindrecord_mmap():
+    """
+    Feature: Test the set_mindrecord_mmap and get_mindrecord_mmap functions
+    Description: Set the flag and get it back, and set it with inputs which are not boolean
+    Expectation: The flag is returned as set, TypeError will be raised when input argument is not a boolean
+    """
+    mindrecord_mmap_original = ds.config.get_mindrecord_mmap()
+    assert not mindrecord_mmap_original
+
+    ds.config.set_mindrecord_mmap(True)
+    assert ds.config.get_mindrecord_mmap()
+    ds.config.set_mindrecord_mmap(False)
+    assert not ds.config.get_mindrecord_mmap()
+
+    config_error_func(ds.config.set_mindrecord_mmap, 1, TypeError, "mindrecord_mmap must be a boolean dtype")
+    config_error_func(ds.config.set_mindrecord_mmap, None, TypeError, "mindrecord_mmap must be a boolean dtype")
+
+    ds.config.set_mindrecord_mmap(mindrecord_mmap_original)
+
+
+def test_io_prefetch_depth():
+    """
+    Feature: Test the set_io_prefetch_depth and get_io_prefetch_depth functions
+    Description: Test the default value, valid values and invalid inputs of io_prefetch_depth
+    Expectation: Output is equal to the expected output, or the expected error is raised
+    """
+    io_prefetch_depth_original = ds.config.get_io_prefetch_depth()
+    assert io_prefetch_depth_original == 0
+
+    ds.config.set_io_prefetch_depth(8)
+    assert ds.config.get_io_prefetch_depth() == 8
+    ds.config.set_io_prefetch_depth(0)
+    assert ds.config.get_io_prefetch_depth() == 0
+
+    config_error_func(ds.config.set_io_prefetch_depth, -1, ValueError,
+                      "depth given is not within the required range")
+    config_error_func(ds.config.set_io_prefetch_depth, 2147483648, ValueError,
+                      "depth given is not within the required range")
+    config_error_func(ds.config.set_io_prefetch_depth, True, TypeError, "depth isn't of type int")
+    config_error_func(ds.config.set_io_prefetch_depth, 1.0, TypeError, "depth isn't of type int")
+
+    ds.config.set_io_prefetch_depth(io_prefetch_depth_original)
+
+
+def test_shuffle_memory_limit():
+    """
+    Feature: Test the set and get functions of shuffle_memory_limit and shuffle_spill_dir
+    Description: Test the default values, valid values and invalid inputs, and the output of a spilling shuffle
+    Expectation: Output is equal to the expected output, or the expected error is raised
+    """
+    shuffle_memory_limit_original = ds.config.get_shuffle_memory_limit()
+    shuffle_spill_dir_original = ds.config.get_shuffle_spill_dir()
+    assert shuffle_memory_limit_original == 0
+    assert shuffle_spill_dir_original == ""
+
+    config_error_func(ds.config.set_shuffle_memory_limit, -1, ValueError,
+                      "limit given is not within the required range")
+    config_error_func(ds.config.set_shuffle_memory_limit, True, TypeError, "limit isn't of type int")
+    config_error_func(ds.config.set_shuffle_spill_dir, 1, TypeError, "spill_dir isn't of type str")
+    config_error_func(ds.config.set_shuffle_spill_dir, "/not/exist/dir", ValueError,
+                      "spill_dir given is not an existing directory")
+
+    def pipeline():
+        data = ds.NumpySlicesDataset({"col": np.arange(2000 * 64, dtype=np.float32).reshape(2000, 64)},
+                                     shuffle=False)
+        data = data.shuffle(buffer_size=1000)
+        return [item["col"][0] for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    ds.config.set_seed(1)
+    expected = pipeline()
+    # keep about 64 rows of 256 bytes in memory, the others go to disk
+    ds.config.set_shuffle_memory_limit(64 * 256)
+    ds.config.set_shuffle_spill_dir(os.path.dirname(os.path.realpath(__file__)))
+    assert ds.config.get_shuffle_memory_limit() == 64 * 256
+    ds.config.set_seed(1)
+    assert pipeline() == expected
+
+    ds.config.set_shuffle_memory_limit(shuffle_memory_limit_original)
+    ds.config.set_shuffle_spill_dir(shuffle_spill_dir_original)
+
+
+def test_embedded_cache():
+    """
+    Feature: Test the set and get functions of embedded_cache
+    Description: Test the default value, valid values and invalid inputs
+    Expectation: The value set is returned, or the expected error is raised
+    """
+    embedded_cache_original = ds.config.get_embedded_cache()
+    assert embedded_cache_original is False
+
+    config_error_func(ds.config.set_embedded_cache, 1, TypeError, "embedded_cache must be a boolean dtype")
+    config_error_func(ds.config.set_embedded_cache, "True", TypeError, "embedded_cache must be a boolean dtype")
+
+    ds.config.set_embedded_cache(True)
+    assert ds.config.get_embedded_cache() is True
+    ds.config.set_embedded_cache(False)
+    assert ds.config.get_embedded_cache() is False
+
+    ds.config.set_embedded_cache(embedded_cache_original)
+
+
+def test_numa_placement():
+    """
+    Feature: Test the set and get functions of numa_placement
+    Description: Test the default value, valid values and invalid inputs
+    Expectation: The value set is returned, or the expected error is raised
+    """
+    numa_placement_original = ds.config.get_numa_placement()
+    assert numa_placement_original == ds.config.NumaPlacement.NONE
+
+    config_error_func(ds.config.set_numa_placement, 1, TypeError, "is not of type")
+    config_error_func(ds.config.set_numa_placement, "DEVICE", TypeError, "is not of type")
+
+    for numa_placement in [ds.config.NumaPlacement.DEVICE, ds.config.NumaPlacement.SPREAD,
+                           ds.config.NumaPlacement.NONE]:
+        ds.config.set_numa_placement(numa_placement)
+        assert ds.config.get_numa_placement() == numa_placement
+
+    ds.config.set_numa_placement(numa_placement_original)
+
+
+def test_executor_mode():
+    """
+    Feature: Test the set and get functions of executor_mode
+    Description: Test the default value, valid values and invalid inputs, and run a pipeline with the shared executor
+    Expectation: The value set is returned, or the expected error is raised, and the pipeline produces the same data
+    """
+    executor_mode_original = ds.config.get_executor_mode()
+    assert executor_mode_original == ds.config.ExecutorMode.THREAD_PER_OP
+
+    config_error_func(ds.config.set_executor_mode, 1, TypeError, "is not of type")
+    config_error_func(ds.config.set_executor_mode, "SHARED", TypeError, "is not of type")
+
+    def pipeline():
+        data = ds.NumpySlicesDataset(list(range(200)), column_names=["col"], shuffle=False)
+        data = data.map(operations=[lambda x: x * 2], input_columns=["col"], num_parallel_workers=4)
+        data = data.batch(8, num_parallel_workers=2)
+        return [item["col"].tolist() for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    expected = pipeline()
+    ds.config.set_executor_mode(ds.config.ExecutorMode.SHARED)
+    assert ds.config.get_executor_mode() == ds.config.ExecutorMode.SHARED
+    assert pipeline() == expected
+
+    ds.config.set_executor_mode(executor_mode_original)
+    assert ds.config.get_executor_mode() == executor_mode_original
+
+
 def test_debug_mode_error_case():
     """
     Feature: Test the debug mode setter function
@@ -619,5 +767,11 @@ if __name__ == '__main__':
     test_multiprocessing_timeout_interval()
     test_config_bool_type_error()
     test_fast_recovery()
+    test_mindrecord_mmap()
+    test_io_prefetch_depth()
+    test_shuffle_memory_limit()
+    test_embedded_cache()
+    test_numa_placement()
+    test_executor_mode()
     test_debug_mode_error_case()
     test_error_samples_mode()
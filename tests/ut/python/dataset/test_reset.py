@@ -581,6 +581,140 @@ def test_reset_nonmappable():
     ds.config.set_fast_recovery(original_fast_recovery)
 
 
+def run_nonmappable_reset(create_dataset, column, num_epochs, failure_point):
+    """
+    Run a pipeline, reset it at the failure point, and collect the rows of all the epochs.
+    """
+    ds.config.set_seed(1)
+    ds.config.set_fast_recovery(True)
+
+    data = create_dataset()
+    itr = data.create_dict_iterator(num_epochs=num_epochs, output_numpy=True)
+    ds.engine.datasets._set_training_dataset(itr)  # pylint: disable=W0212
+    dataset_size = data.get_dataset_size()
+
+    res = list()
+    failure = False
+    for epoch in range(num_epochs):
+        for step, item in enumerate(itr):
+            res.append(item[column].item())
+            if epoch * dataset_size + step + 1 == failure_point:
+                failure = True
+                break
+        if failure:
+            ds.engine.datasets._reset_training_dataset(failure_point, dataset_size)  # pylint: disable=W0212
+            failure = False
+            # let's collect the remaining rows of this epoch
+            if failure_point % dataset_size != 0:
+                for step, item in enumerate(itr):
+                    res.append(item[column].item())
+    return res
+
+
+def check_nonmappable_reset(create_dataset, column, num_epochs):
+    """
+    Check that the rows read by a pipeline reset at each step are identical to the rows read without reset.
+    """
+    original_seed = ds.config.get_seed()
+    original_fast_recovery = ds.config.get_fast_recovery()
+
+    expected = run_nonmappable_reset(create_dataset, column, num_epochs, -1)  # no reset in this run
+    # try different failure points and compare against 'expected'
+    for failure_point in range(len(expected)):
+        expected2 = run_nonmappable_reset(create_dataset, column, num_epochs, failure_point)
+        np.testing.assert_array_equal(expected, expected2)
+
+    ds.config.set_seed(original_seed)
+    ds.config.set_fast_recovery(original_fast_recovery)
+
+
+def write_text_files(path, rows_per_file):
+    """
+    Write text files of the given numbers of lines, all the lines are distinct.
+    """
+    files = []
+    for i, num_rows in enumerate(rows_per_file):
+        filename = os.path.join(path, "{}.txt".format(i))
+        with open(filename, "w") as f:
+            for j in range(num_rows):
+                f.write("file {} line {}\n".format(i, j))
+        files.append(filename)
+    return files
+
+
+def write_tfrecord_files(path, rows_per_file):
+    """
+    Write TFRecord files of the given numbers of rows, made of the records of tf_file_dataset, which are distinct.
+    """
+    records = []
+    for i in range(1, 6):
+        with open("../data/dataset/tf_file_dataset/test{}.data".format(i), "rb") as f:
+            content = f.read()
+        pos = 0
+        while pos < len(content):
+            # length, crc of the length, data, crc of the data
+            length = int.from_bytes(content[pos:pos + 8], "little")
+            records.append(content[pos:pos + 12 + length + 4])
+            pos += 12 + length + 4
+    assert sum(rows_per_file) <= len(records)
+    files = []
+    for i, num_rows in enumerate(rows_per_file):
+        filename = os.path.join(path, "{}.data".format(i))
+        with open(filename, "wb") as f:
+            for _ in range(num_rows):
+                f.write(records.pop(0))
+        files.append(filename)
+    return files
+
+
+@pytest.mark.parametrize("shuffle", (False, ds.Shuffle.FILES))
+def test_reset_textfile(shuffle):
+    """
+    Feature: Dataset recovery
+    Description: The TextFile op skips the rows of the reset epoch in its files, rather than reading them
+    Expectation: The order of rows read in normal and reset runs are identical
+    """
+    text_files = ["../data/dataset/testTextFileDataset/1.txt", "../data/dataset/testTextFileDataset/2.txt"]
+
+    def create_dataset():
+        data = ds.TextFileDataset(text_files, shuffle=shuffle, num_parallel_workers=2)
+        return data.repeat(2)
+
+    check_nonmappable_reset(create_dataset, "text", num_epochs=3)
+
+
+@pytest.mark.parametrize("shuffle", (False, ds.Shuffle.FILES))
+def test_reset_textfile_skip_in_files(shuffle, tmp_path):
+    """
+    Feature: Dataset recovery
+    Description: Reset a TextFile pipeline without repeat, so that the skip is pushed down into the TextFile op, which
+        has more workers than files of the same number of rows
+    Expectation: The order of rows read in normal and reset runs are identical
+    """
+    text_files = write_text_files(str(tmp_path), [5, 1, 8, 3, 2])
+
+    def create_dataset():
+        return ds.TextFileDataset(text_files, shuffle=shuffle, num_parallel_workers=3)
+
+    check_nonmappable_reset(create_dataset, "text", num_epochs=2)
+
+
+@pytest.mark.parametrize("shuffle", (False, ds.Shuffle.FILES))
+def test_reset_tfrecord_skip_in_files(shuffle, tmp_path):
+    """
+    Feature: Dataset recovery
+    Description: Reset a TFRecord pipeline without repeat, so that the skip is pushed down into the TFRecord op, which
+        counts the rows of its files to skip them, with files of uneven numbers of rows read by several workers
+    Expectation: The order of rows read in normal and reset runs are identical
+    """
+    tf_files = write_tfrecord_files(str(tmp_path), [7, 2, 11, 1, 4])
+
+    def create_dataset():
+        return ds.TFRecordDataset(tf_files, columns_list=["scalars"], shuffle=shuffle, num_parallel_workers=3)
+
+    check_nonmappable_reset(create_dataset, "scalars", num_epochs=2)
+
+
 def test_reset_generator_with_unknow_length():
     """
     Feature: Failover
@@ -616,4 +750,5 @@ if __name__ == "__main__":
     test_reset_sampler(ds.RandomSampler())
     test_reset_batch(False)
     test_reset_nonmappable()
+    test_reset_textfile(ds.Shuffle.FILES)
     test_reset_generator_with_unknow_length()